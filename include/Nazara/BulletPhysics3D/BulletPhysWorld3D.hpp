@@ -23,6 +23,8 @@ namespace Nz
 {
 	class BulletRigidBody3D;
 
+	// Unlike JoltPhysWorld3D, this world has no SaveState/RestoreState: Bullet doesn't expose its persistent manifolds and solver caches,
+	// so a restored world would not simulate the same way as the original one
 	class NAZARA_BULLETPHYSICS3D_API BulletPhysWorld3D
 	{
 		friend BulletRigidBody3D;
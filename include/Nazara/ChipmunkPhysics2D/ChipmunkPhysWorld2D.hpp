@@ -29,6 +29,8 @@ namespace Nz
 {
 	class ChipmunkArbiter2D;
 
+	// Unlike JoltPhysWorld3D, this world has no SaveState/RestoreState: Chipmunk doesn't expose its arbiter cache (contact persistence),
+	// so a restored world would not simulate the same way as the original one
 	class NAZARA_CHIPMUNKPHYSICS2D_API ChipmunkPhysWorld2D
 	{
 		friend ChipmunkRigidBody2D;
@@ -58,12 +60,16 @@ namespace Nz
 
 			void DebugDraw(const DebugDrawOptions& options, bool drawShapes = true, bool drawConstraints = true, bool drawCollisions = true) const;
 
+			void ForEachAwakeBody(const FunctionRef<void(ChipmunkRigidBody2D& body)>& callback);
+			void ForEachMovedBody(const FunctionRef<void(ChipmunkRigidBody2D& body)>& callback, bool resetMovedBodies = false);
+
 			float GetDamping() const;
 			Vector2f GetGravity() const;
 			cpSpace* GetHandle() const;
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
 			Time GetStepSize() const;
+			inline Time GetTimestepAccumulator() const;
 
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, ChipmunkRigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, NearestQueryResult* result);
@@ -143,6 +149,7 @@ namespace Nz
 
 			void DeferBodyAction(ChipmunkRigidBody2D& rigidBody, PostStep&& func);
 			void InitCallbacks(cpCollisionHandler* handler, ContactCallbacks callbacks);
+			inline void MarkBodyAsMoved(UInt32 bodyIndex);
 			inline UInt32 RegisterBody(ChipmunkRigidBody2D& rigidBody);
 			inline void UnregisterBody(UInt32 bodyIndex);
 			inline void UpdateBodyPointer(ChipmunkRigidBody2D& rigidBody);
@@ -153,6 +160,7 @@ namespace Nz
 			std::vector<ChipmunkRigidBody2D*> m_bodies;
 			cpSpace* m_handle;
 			Bitset<UInt64> m_freeBodyIndices;
+			Bitset<UInt64> m_movedBodyIndices;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
 	};
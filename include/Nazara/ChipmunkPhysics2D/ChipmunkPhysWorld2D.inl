@@ -7,6 +7,16 @@
 
 namespace Nz
 {
+	inline Time ChipmunkPhysWorld2D::GetTimestepAccumulator() const
+	{
+		return m_timestepAccumulator;
+	}
+
+	inline void ChipmunkPhysWorld2D::MarkBodyAsMoved(UInt32 bodyIndex)
+	{
+		m_movedBodyIndices.UnboundedSet(bodyIndex);
+	}
+
 	inline UInt32 ChipmunkPhysWorld2D::RegisterBody(ChipmunkRigidBody2D& rigidBody)
 	{
 		std::size_t bodyIndex = m_freeBodyIndices.FindFirst();
@@ -33,6 +43,7 @@ namespace Nz
 		assert(m_bodies[bodyIndex]);
 		m_bodies[bodyIndex] = nullptr;
 
+		m_movedBodyIndices.UnboundedReset(bodyIndex);
 		m_rigidBodyPostSteps.erase(bodyIndex);
 	}
 
@@ -11,6 +11,7 @@
 #include <Nazara/ChipmunkPhysics2D/ChipmunkPhysWorld2D.hpp>
 #include <Nazara/ChipmunkPhysics2D/Components/ChipmunkRigidBody2DComponent.hpp>
 #include <Nazara/Core/Time.hpp>
+#include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -36,10 +37,14 @@ namespace Nz
 			ChipmunkPhysics2DSystem(ChipmunkPhysics2DSystem&&) = delete;
 			~ChipmunkPhysics2DSystem();
 
+			void EnableInterpolation(bool enable = true);
+
 			inline ChipmunkPhysWorld2D& GetPhysWorld();
 			inline const ChipmunkPhysWorld2D& GetPhysWorld() const;
 			inline entt::handle GetRigidBodyEntity(UInt32 bodyIndex) const;
 
+			inline bool IsInterpolationEnabled() const;
+
 			inline bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, entt::handle* nearestEntity = nullptr);
 			inline bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, NearestQueryResult* result);
 
@@ -78,16 +83,31 @@ namespace Nz
 			};
 
 		private:
+			struct PreviousTransform
+			{
+				RadianAnglef rotation;
+				Vector2f position;
+			};
+
 			void OnBodyConstruct(entt::registry& registry, entt::entity entity);
 			void OnBodyDestruct(entt::registry& registry, entt::entity entity);
+			void OnPreStep();
+			void ReplicateTransform(const ChipmunkRigidBody2D& rigidBody, const Vector2f& position, const RadianAnglef& rotation);
 			ChipmunkPhysWorld2D::ContactCallbacks SetupContactCallbacks(ContactCallbacks callbacks);
 
 			std::vector<entt::entity> m_bodyIndicesToEntity;
+			std::vector<PreviousTransform> m_previousTransforms;
 			entt::registry& m_registry;
 			entt::observer m_physicsConstructObserver;
 			entt::scoped_connection m_bodyConstructConnection;
 			entt::scoped_connection m_bodyDestructConnection;
+			Bitset<UInt64> m_interpolatedBodies;
+			Bitset<UInt64> m_settlingBodies;
 			ChipmunkPhysWorld2D m_physWorld;
+			bool m_hasStepped;
+			bool m_isInterpolationEnabled;
+
+			NazaraSlot(ChipmunkPhysWorld2D, OnPhysWorld2DPreStep, m_onPreStep);
 	};
 }
 
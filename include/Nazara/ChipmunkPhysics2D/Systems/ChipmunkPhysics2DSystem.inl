@@ -21,6 +21,11 @@ namespace Nz
 		return entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
 	}
 
+	inline bool ChipmunkPhysics2DSystem::IsInterpolationEnabled() const
+	{
+		return m_isInterpolationEnabled;
+	}
+
 	inline bool ChipmunkPhysics2DSystem::NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, entt::handle* nearestEntity)
 	{
 		ChipmunkRigidBody2D* nearestBody;
@@ -38,6 +38,8 @@
 #include <Nazara/Core/ApplicationComponent.hpp>
 #include <Nazara/Core/ApplicationComponentRegistry.hpp>
 #include <Nazara/Core/ApplicationUpdater.hpp>
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Core/BitWriter.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
@@ -89,6 +91,7 @@
 #include <Nazara/Core/StdLogger.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/ThreadExt.hpp>
 #include <Nazara/Core/Time.hpp>
@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_BITREADER_HPP
+#define NAZARA_CORE_BITREADER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <NazaraUtils/TypeTag.hpp>
+#include <type_traits>
+
+namespace Nz
+{
+	class BitReader
+	{
+		public:
+			inline BitReader(const void* data, std::size_t size);
+			BitReader(const BitReader&) = default;
+			BitReader(BitReader&&) noexcept = default;
+			~BitReader() = default;
+
+			inline std::size_t GetBitOffset() const;
+			inline std::size_t GetRemainingBitCount() const;
+
+			inline bool HasOverflowed() const;
+
+			inline UInt64 Read(unsigned int bitCount);
+			inline bool ReadBool();
+			inline float ReadQuantized(float min, float max, unsigned int bitCount);
+			inline Vector3f ReadQuantizedVector3(float min, float max, unsigned int bitCount);
+			inline Quaternionf ReadQuaternion(unsigned int bitsPerComponent);
+			inline Int64 ReadRanged(Int64 min, Int64 max);
+			inline Int64 ReadVarInt();
+			inline UInt64 ReadVarUInt();
+
+			BitReader& operator=(const BitReader&) = default;
+			BitReader& operator=(BitReader&&) noexcept = default;
+
+			static constexpr Int64 ZigZagDecode(UInt64 value);
+
+		private:
+			const UInt8* m_data;
+			std::size_t m_bitOffset;
+			std::size_t m_bitSize;
+			bool m_overflowed;
+	};
+
+	template<typename T> bool Unserialize(BitReader& reader, T* value);
+
+	inline bool Unserialize(BitReader& reader, bool* value, TypeTag<bool>);
+	template<typename T> std::enable_if_t<std::is_integral_v<T>, bool> Unserialize(BitReader& reader, T* value, TypeTag<T>);
+	template<typename T> std::enable_if_t<std::is_floating_point_v<T>, bool> Unserialize(BitReader& reader, T* value, TypeTag<T>);
+	template<typename T> bool Unserialize(BitReader& reader, Quaternion<T>* quat, TypeTag<Quaternion<T>>);
+	template<typename T> bool Unserialize(BitReader& reader, Vector2<T>* vector, TypeTag<Vector2<T>>);
+	template<typename T> bool Unserialize(BitReader& reader, Vector3<T>* vector, TypeTag<Vector3<T>>);
+	template<typename T> bool Unserialize(BitReader& reader, Vector4<T>* vector, TypeTag<Vector4<T>>);
+}
+
+#include <Nazara/Core/BitReader.inl>
+
+#endif // NAZARA_CORE_BITREADER_HPP
@@ -0,0 +1,238 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/BitWriter.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::BitReader
+	* \brief Core class that reads values packed by BitWriter
+	*
+	* Reading past the end of the buffer doesn't throw, it returns zeroed values and marks the reader as overflowed which must be checked before using values read from untrusted data.
+	*/
+
+	/*!
+	* \brief Constructs a reader over a memory block, which must stay valid for the reader lifetime
+	*/
+	inline BitReader::BitReader(const void* data, std::size_t size) :
+	m_data(static_cast<const UInt8*>(data)),
+	m_bitOffset(0),
+	m_bitSize(size * 8),
+	m_overflowed(false)
+	{
+	}
+
+	inline std::size_t BitReader::GetBitOffset() const
+	{
+		return m_bitOffset;
+	}
+
+	inline std::size_t BitReader::GetRemainingBitCount() const
+	{
+		return m_bitSize - m_bitOffset;
+	}
+
+	/*!
+	* \brief Checks if a read went past the end of the buffer
+	*/
+	inline bool BitReader::HasOverflowed() const
+	{
+		return m_overflowed;
+	}
+
+	inline UInt64 BitReader::Read(unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "bit count must be at most 64");
+		if (bitCount == 0)
+			return 0;
+
+		if (bitCount > m_bitSize - m_bitOffset)
+		{
+			m_bitOffset = m_bitSize;
+			m_overflowed = true;
+			return 0;
+		}
+
+		std::size_t byteIndex = m_bitOffset / 8;
+		unsigned int bitOffset = static_cast<unsigned int>(m_bitOffset % 8);
+
+		m_bitOffset += bitCount;
+
+		UInt64 value = m_data[byteIndex++] >> bitOffset;
+		for (unsigned int readBits = 8 - bitOffset; readBits < bitCount; readBits += 8)
+			value |= UInt64(m_data[byteIndex++]) << readBits;
+
+		if (bitCount < 64)
+			value &= (UInt64(1) << bitCount) - 1;
+
+		return value;
+	}
+
+	inline bool BitReader::ReadBool()
+	{
+		return Read(1) != 0;
+	}
+
+	inline float BitReader::ReadQuantized(float min, float max, unsigned int bitCount)
+	{
+		NazaraAssert(min < max, "invalid range");
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+
+		UInt64 maxValue = (UInt64(1) << bitCount) - 1;
+		double ratio = double(Read(bitCount)) / maxValue;
+
+		return static_cast<float>(min + ratio * (double(max) - min));
+	}
+
+	inline Vector3f BitReader::ReadQuantizedVector3(float min, float max, unsigned int bitCount)
+	{
+		Vector3f value;
+		value.x = ReadQuantized(min, max, bitCount);
+		value.y = ReadQuantized(min, max, bitCount);
+		value.z = ReadQuantized(min, max, bitCount);
+
+		return value;
+	}
+
+	inline Quaternionf BitReader::ReadQuaternion(unsigned int bitsPerComponent)
+	{
+		unsigned int largestIndex = static_cast<unsigned int>(Read(2));
+
+		std::array<float, 4> components;
+		float squaredSum = 0.f;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			components[i] = ReadQuantized(-BitWriter::QuaternionComponentLimit, BitWriter::QuaternionComponentLimit, bitsPerComponent);
+			squaredSum += components[i] * components[i];
+		}
+
+		components[largestIndex] = std::sqrt(std::max(1.f - squaredSum, 0.f));
+
+		return Quaternionf::Normalize(Quaternionf(components[0], components[1], components[2], components[3]));
+	}
+
+	inline Int64 BitReader::ReadRanged(Int64 min, Int64 max)
+	{
+		NazaraAssert(min <= max, "invalid range");
+
+		UInt64 range = static_cast<UInt64>(max) - static_cast<UInt64>(min);
+		UInt64 value = Read(BitWriter::ComputeRangeBitCount(range));
+
+		// Corrupted data may hold a value above the range
+		if (value > range)
+		{
+			m_overflowed = true;
+			return min;
+		}
+
+		return static_cast<Int64>(static_cast<UInt64>(min) + value);
+	}
+
+	inline Int64 BitReader::ReadVarInt()
+	{
+		return ZigZagDecode(ReadVarUInt());
+	}
+
+	inline UInt64 BitReader::ReadVarUInt()
+	{
+		UInt64 value = 0;
+		for (unsigned int shift = 0; shift < 64; shift += 7)
+		{
+			UInt64 byte = Read(8);
+			value |= (byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+				return value;
+		}
+
+		// More than 10 bytes means corrupted data
+		m_overflowed = true;
+		return 0;
+	}
+
+	constexpr Int64 BitReader::ZigZagDecode(UInt64 value)
+	{
+		return static_cast<Int64>(value >> 1) ^ -static_cast<Int64>(value & 1);
+	}
+
+
+	template<typename T>
+	bool Unserialize(BitReader& reader, T* value)
+	{
+		return Unserialize(reader, value, TypeTag<T>());
+	}
+
+	inline bool Unserialize(BitReader& reader, bool* value, TypeTag<bool>)
+	{
+		NazaraAssert(value, "invalid data pointer");
+
+		*value = reader.ReadBool();
+		return !reader.HasOverflowed();
+	}
+
+	template<typename T>
+	std::enable_if_t<std::is_integral_v<T>, bool> Unserialize(BitReader& reader, T* value, TypeTag<T>)
+	{
+		NazaraAssert(value, "invalid data pointer");
+
+		if constexpr (sizeof(T) == 1)
+			*value = static_cast<T>(reader.Read(8));
+		else if constexpr (std::is_signed_v<T>)
+			*value = static_cast<T>(reader.ReadVarInt());
+		else
+			*value = static_cast<T>(reader.ReadVarUInt());
+
+		return !reader.HasOverflowed();
+	}
+
+	template<typename T>
+	std::enable_if_t<std::is_floating_point_v<T>, bool> Unserialize(BitReader& reader, T* value, TypeTag<T>)
+	{
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "unsupported floating-point type");
+		NazaraAssert(value, "invalid data pointer");
+
+		using Bits = std::conditional_t<sizeof(T) == 4, UInt32, UInt64>;
+
+		Bits bits = static_cast<Bits>(reader.Read(sizeof(T) * 8));
+		std::memcpy(value, &bits, sizeof(T));
+
+		return !reader.HasOverflowed();
+	}
+
+	template<typename T>
+	bool Unserialize(BitReader& reader, Quaternion<T>* quat, TypeTag<Quaternion<T>>)
+	{
+		return Unserialize(reader, &quat->w) && Unserialize(reader, &quat->x) && Unserialize(reader, &quat->y) && Unserialize(reader, &quat->z);
+	}
+
+	template<typename T>
+	bool Unserialize(BitReader& reader, Vector2<T>* vector, TypeTag<Vector2<T>>)
+	{
+		return Unserialize(reader, &vector->x) && Unserialize(reader, &vector->y);
+	}
+
+	template<typename T>
+	bool Unserialize(BitReader& reader, Vector3<T>* vector, TypeTag<Vector3<T>>)
+	{
+		return Unserialize(reader, &vector->x) && Unserialize(reader, &vector->y) && Unserialize(reader, &vector->z);
+	}
+
+	template<typename T>
+	bool Unserialize(BitReader& reader, Vector4<T>* vector, TypeTag<Vector4<T>>)
+	{
+		return Unserialize(reader, &vector->x) && Unserialize(reader, &vector->y) && Unserialize(reader, &vector->z) && Unserialize(reader, &vector->w);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,74 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_BITWRITER_HPP
+#define NAZARA_CORE_BITWRITER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <NazaraUtils/TypeTag.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	class BitWriter
+	{
+		public:
+			BitWriter() = default;
+			inline explicit BitWriter(std::size_t reservedByteCount);
+			BitWriter(const BitWriter&) = default;
+			BitWriter(BitWriter&&) noexcept = default;
+			~BitWriter() = default;
+
+			inline void Clear();
+
+			inline std::size_t GetBitCount() const;
+			inline const UInt8* GetData() const;
+			inline std::size_t GetSize() const;
+
+			inline void Reserve(std::size_t byteCount);
+
+			inline void Write(UInt64 value, unsigned int bitCount);
+			inline void WriteBool(bool value);
+			inline void WriteQuantized(float value, float min, float max, unsigned int bitCount);
+			inline void WriteQuantized(const Vector3f& value, float min, float max, unsigned int bitCount);
+			inline void WriteQuaternion(const Quaternionf& value, unsigned int bitsPerComponent);
+			inline void WriteRanged(Int64 value, Int64 min, Int64 max);
+			inline void WriteVarInt(Int64 value);
+			inline void WriteVarUInt(UInt64 value);
+
+			BitWriter& operator=(const BitWriter&) = default;
+			BitWriter& operator=(BitWriter&&) noexcept = default;
+
+			static constexpr unsigned int ComputeRangeBitCount(UInt64 range);
+			static constexpr UInt64 ZigZagEncode(Int64 value);
+
+			static constexpr float QuaternionComponentLimit = 0.707107f; //< 1/sqrt(2), upper bound of the three smallest components of an unit quaternion
+
+		private:
+			std::vector<UInt8> m_buffer;
+			std::size_t m_bitCount = 0;
+	};
+
+	template<typename T> bool Serialize(BitWriter& writer, T&& value);
+
+	inline bool Serialize(BitWriter& writer, bool value, TypeTag<bool>);
+	template<typename T> std::enable_if_t<std::is_integral_v<T>, bool> Serialize(BitWriter& writer, T value, TypeTag<T>);
+	template<typename T> std::enable_if_t<std::is_floating_point_v<T>, bool> Serialize(BitWriter& writer, T value, TypeTag<T>);
+	template<typename T> bool Serialize(BitWriter& writer, const Quaternion<T>& quat, TypeTag<Quaternion<T>>);
+	template<typename T> bool Serialize(BitWriter& writer, const Vector2<T>& vector, TypeTag<Vector2<T>>);
+	template<typename T> bool Serialize(BitWriter& writer, const Vector3<T>& vector, TypeTag<Vector3<T>>);
+	template<typename T> bool Serialize(BitWriter& writer, const Vector4<T>& vector, TypeTag<Vector4<T>>);
+}
+
+#include <Nazara/Core/BitWriter.inl>
+
+#endif // NAZARA_CORE_BITWRITER_HPP
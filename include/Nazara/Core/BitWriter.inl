@@ -0,0 +1,271 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::BitWriter
+	* \brief Core class that packs values at the bit level into a contiguous buffer
+	*
+	* Bits are written least significant first, every method is inline and works directly on the buffer which makes it suitable for per-frame network snapshots.
+	* Values are read back using BitReader, in the same order and with the same parameters.
+	*/
+
+	inline BitWriter::BitWriter(std::size_t reservedByteCount)
+	{
+		m_buffer.reserve(reservedByteCount);
+	}
+
+	/*!
+	* \brief Removes all written bits while keeping the buffer memory
+	*/
+	inline void BitWriter::Clear()
+	{
+		m_buffer.clear();
+		m_bitCount = 0;
+	}
+
+	inline std::size_t BitWriter::GetBitCount() const
+	{
+		return m_bitCount;
+	}
+
+	inline const UInt8* BitWriter::GetData() const
+	{
+		return m_buffer.data();
+	}
+
+	/*!
+	* \brief Gets the number of bytes required to store written bits
+	*/
+	inline std::size_t BitWriter::GetSize() const
+	{
+		return m_buffer.size();
+	}
+
+	inline void BitWriter::Reserve(std::size_t byteCount)
+	{
+		m_buffer.reserve(byteCount);
+	}
+
+	/*!
+	* \brief Writes the lowest bits of an integer
+	*
+	* \param value Value to write, bits above bitCount are ignored
+	* \param bitCount Number of bits to write (up to 64)
+	*/
+	inline void BitWriter::Write(UInt64 value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "bit count must be at most 64");
+		if (bitCount == 0)
+			return;
+
+		if (bitCount < 64)
+			value &= (UInt64(1) << bitCount) - 1;
+
+		std::size_t byteIndex = m_bitCount / 8;
+		unsigned int bitOffset = static_cast<unsigned int>(m_bitCount % 8);
+
+		m_bitCount += bitCount;
+		m_buffer.resize((m_bitCount + 7) / 8); //< new bytes are zero-initialized
+
+		// Complete the last partial byte, next bytes are new
+		m_buffer[byteIndex++] |= static_cast<UInt8>(value << bitOffset);
+		for (unsigned int writtenBits = 8 - bitOffset; writtenBits < bitCount; writtenBits += 8)
+			m_buffer[byteIndex++] = static_cast<UInt8>(value >> writtenBits);
+	}
+
+	inline void BitWriter::WriteBool(bool value)
+	{
+		Write((value) ? 1 : 0, 1);
+	}
+
+	/*!
+	* \brief Writes a float as a fixed-point value over a range
+	*
+	* \param value Value to write, it is clamped to [min, max]
+	* \param min Lowest value of the range
+	* \param max Highest value of the range
+	* \param bitCount Precision of the value, the error is at most (max - min) / (2^(bitCount+1) - 2)
+	*/
+	inline void BitWriter::WriteQuantized(float value, float min, float max, unsigned int bitCount)
+	{
+		NazaraAssert(min < max, "invalid range");
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "bit count must be between 1 and 32");
+
+		UInt64 maxValue = (UInt64(1) << bitCount) - 1;
+		double ratio = std::clamp((double(value) - min) / (double(max) - min), 0.0, 1.0);
+
+		Write(static_cast<UInt64>(ratio * maxValue + 0.5), bitCount);
+	}
+
+	inline void BitWriter::WriteQuantized(const Vector3f& value, float min, float max, unsigned int bitCount)
+	{
+		WriteQuantized(value.x, min, max, bitCount);
+		WriteQuantized(value.y, min, max, bitCount);
+		WriteQuantized(value.z, min, max, bitCount);
+	}
+
+	/*!
+	* \brief Writes a rotation using the smallest three compression
+	*
+	* The largest component is dropped (and rebuilt on reading), only its index and the three others are written, using 2 + 3 * bitsPerComponent bits.
+	*
+	* \param value Rotation to write, it will be normalized
+	* \param bitsPerComponent Precision of each of the three written components
+	*/
+	inline void BitWriter::WriteQuaternion(const Quaternionf& value, unsigned int bitsPerComponent)
+	{
+		Quaternionf rotation = Quaternionf::Normalize(value);
+
+		std::array<float, 4> components = { rotation.w, rotation.x, rotation.y, rotation.z };
+
+		unsigned int largestIndex = 0;
+		for (unsigned int i = 1; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+				largestIndex = i;
+		}
+
+		// q and -q represent the same rotation, make the dropped component positive
+		float sign = (components[largestIndex] < 0.f) ? -1.f : 1.f;
+
+		Write(largestIndex, 2);
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			if (i != largestIndex)
+				WriteQuantized(sign * components[i], -QuaternionComponentLimit, QuaternionComponentLimit, bitsPerComponent);
+		}
+	}
+
+	/*!
+	* \brief Writes an integer known to be in a range, using the least number of bits required to represent the range
+	*/
+	inline void BitWriter::WriteRanged(Int64 value, Int64 min, Int64 max)
+	{
+		NazaraAssert(min <= max, "invalid range");
+		NazaraAssert(value >= min && value <= max, "value is out of range");
+
+		UInt64 range = static_cast<UInt64>(max) - static_cast<UInt64>(min);
+		Write(static_cast<UInt64>(value) - static_cast<UInt64>(min), ComputeRangeBitCount(range));
+	}
+
+	/*!
+	* \brief Writes a signed integer using zigzag and variable-length encoding, small absolute values take less bits
+	*/
+	inline void BitWriter::WriteVarInt(Int64 value)
+	{
+		WriteVarUInt(ZigZagEncode(value));
+	}
+
+	/*!
+	* \brief Writes an unsigned integer using variable-length encoding (7 bits per byte, the last bit tells if more bytes follow)
+	*/
+	inline void BitWriter::WriteVarUInt(UInt64 value)
+	{
+		while (value >= 0x80)
+		{
+			Write((value & 0x7F) | 0x80, 8);
+			value >>= 7;
+		}
+
+		Write(value, 8);
+	}
+
+	constexpr unsigned int BitWriter::ComputeRangeBitCount(UInt64 range)
+	{
+		unsigned int bitCount = 0;
+		while (range > 0)
+		{
+			bitCount++;
+			range >>= 1;
+		}
+
+		return bitCount;
+	}
+
+	constexpr UInt64 BitWriter::ZigZagEncode(Int64 value)
+	{
+		return (static_cast<UInt64>(value) << 1) ^ static_cast<UInt64>(value >> 63);
+	}
+
+
+	template<typename T>
+	bool Serialize(BitWriter& writer, T&& value)
+	{
+		return Serialize(writer, std::forward<T>(value), TypeTag<std::decay_t<T>>());
+	}
+
+	inline bool Serialize(BitWriter& writer, bool value, TypeTag<bool>)
+	{
+		writer.WriteBool(value);
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes an integer, integers larger than one byte use variable-length encoding
+	* \return true
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral_v<T>, bool> Serialize(BitWriter& writer, T value, TypeTag<T>)
+	{
+		if constexpr (sizeof(T) == 1)
+			writer.Write(static_cast<UInt8>(value), 8);
+		else if constexpr (std::is_signed_v<T>)
+			writer.WriteVarInt(value);
+		else
+			writer.WriteVarUInt(value);
+
+		return true;
+	}
+
+	template<typename T>
+	std::enable_if_t<std::is_floating_point_v<T>, bool> Serialize(BitWriter& writer, T value, TypeTag<T>)
+	{
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "unsupported floating-point type");
+
+		using Bits = std::conditional_t<sizeof(T) == 4, UInt32, UInt64>;
+
+		Bits bits;
+		std::memcpy(&bits, &value, sizeof(T));
+		writer.Write(bits, sizeof(T) * 8);
+
+		return true;
+	}
+
+	template<typename T>
+	bool Serialize(BitWriter& writer, const Quaternion<T>& quat, TypeTag<Quaternion<T>>)
+	{
+		return Serialize(writer, quat.w) && Serialize(writer, quat.x) && Serialize(writer, quat.y) && Serialize(writer, quat.z);
+	}
+
+	template<typename T>
+	bool Serialize(BitWriter& writer, const Vector2<T>& vector, TypeTag<Vector2<T>>)
+	{
+		return Serialize(writer, vector.x) && Serialize(writer, vector.y);
+	}
+
+	template<typename T>
+	bool Serialize(BitWriter& writer, const Vector3<T>& vector, TypeTag<Vector3<T>>)
+	{
+		return Serialize(writer, vector.x) && Serialize(writer, vector.y) && Serialize(writer, vector.z);
+	}
+
+	template<typename T>
+	bool Serialize(BitWriter& writer, const Vector4<T>& vector, TypeTag<Vector4<T>>)
+	{
+		return Serialize(writer, vector.x) && Serialize(writer, vector.y) && Serialize(writer, vector.z) && Serialize(writer, vector.w);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
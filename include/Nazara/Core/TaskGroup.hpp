@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_TASKGROUP_HPP
+#define NAZARA_CORE_TASKGROUP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace Nz
+{
+	class NAZARA_CORE_API TaskGroup
+	{
+		friend class TaskScheduler;
+
+		public:
+			using Task = std::function<void()>;
+
+			inline TaskGroup();
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup(TaskGroup&&) = delete;
+			~TaskGroup();
+
+			void AddTask(Task task);
+
+			inline bool IsFinished() const;
+
+			void Wait();
+
+			TaskGroup& operator=(const TaskGroup&) = delete;
+			TaskGroup& operator=(TaskGroup&&) = delete;
+
+		private:
+			void OnTaskDone(std::exception_ptr exception);
+			void OnTaskQueued();
+			void OnTaskStarted();
+			void WaitForCompletion();
+
+			struct QueuedTask
+			{
+				Task task;
+				ErrorModeFlags errorFlags;
+			};
+
+			std::atomic_size_t m_remainingTaskCount;
+			std::condition_variable m_conditionVariable;
+			std::deque<QueuedTask> m_queuedTasks; //< guarded by the scheduler mutex
+			std::exception_ptr m_exception;
+			std::mutex m_mutex;
+			std::size_t m_queuedTaskCount;
+			bool m_isScheduled; //< whether the group is in the scheduler list of groups having tasks, guarded by the scheduler mutex
+	};
+}
+
+#include <Nazara/Core/TaskGroup.inl>
+
+#endif // NAZARA_CORE_TASKGROUP_HPP
@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	inline TaskGroup::TaskGroup() :
+	m_remainingTaskCount(0),
+	m_queuedTaskCount(0),
+	m_isScheduled(false)
+	{
+	}
+
+	/*!
+	* \brief Checks whether every task added to this group has been executed
+	*/
+	inline bool TaskGroup::IsFinished() const
+	{
+		return m_remainingTaskCount == 0;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
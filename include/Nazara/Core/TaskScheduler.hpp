@@ -8,12 +8,16 @@
 #define NAZARA_CORE_TASKSCHEDULER_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Enums.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 
 namespace Nz
 {
 	class NAZARA_CORE_API TaskScheduler
 	{
+		friend TaskGroup;
+
 		public:
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
@@ -30,6 +34,11 @@ namespace Nz
 
 		private:
 			static void AddTaskFunctor(Functor* taskFunctor);
+			static void ExecuteTask(TaskGroup& group, TaskGroup::Task& task, ErrorModeFlags errorFlags);
+			static bool RunPendingTask(TaskGroup& group);
+			static void Submit(TaskGroup& group, TaskGroup::Task&& task);
+			static void Unschedule(TaskGroup& group);
+			static void WorkerProc();
 	};
 }
 
@@ -17,6 +17,8 @@
 #include <Nazara/Renderer/Framebuffer.hpp>
 #include <Nazara/Renderer/RenderPass.hpp>
 #include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Renderer/TextureHeap.hpp>
+#include <optional>
 #include <vector>
 
 namespace Nz
@@ -37,6 +39,7 @@ namespace Nz
 
 			const std::shared_ptr<Texture>& GetAttachmentTexture(std::size_t attachmentIndex) const;
 			const std::shared_ptr<RenderPass>& GetRenderPass(std::size_t passIndex) const;
+			inline UInt64 GetTransientMemoryUsage() const;
 
 			bool Resize(RenderFrame& renderFrame);
 
@@ -51,6 +54,10 @@ namespace Nz
 
 			BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping);
 
+			void AllocateTransientTextures(RenderFrame& renderFrame, const std::vector<TextureInfo>& textureInfos);
+			bool RecordSecondaryCommandBuffers(PassData& passData, std::size_t subpassIndex, const FramePassEnvironment& env);
+			void ReleaseCommandBuffers(RenderFrame& renderFrame, PassData& passData);
+
 			struct TextureBarrier
 			{
 				std::size_t textureId;
@@ -64,7 +71,11 @@ namespace Nz
 
 			struct SubpassData
 			{
+				FramePass::ChunkCountCallback chunkCountCallback;
 				FramePass::CommandCallback commandCallback;
+				FramePass::CommandChunkCallback commandChunkCallback;
+				std::vector<CommandBufferPtr> secondaryCommandBuffers; //< one per chunk, empty when chunks are recorded in the primary command buffer
+				std::size_t chunkCount = 0;
 			};
 
 			struct PassData
@@ -77,21 +88,29 @@ namespace Nz
 				std::vector<CommandBufferBuilder::ClearValues> outputClearValues;
 				std::vector<SubpassData> subpasses;
 				std::vector<TextureBarrier> invalidationBarriers;
+				std::vector<TextureBarrier> skipBarriers; //< transitions recorded instead of the pass when it's skipped
 				FramePass::ExecutionCallback executionCallback;
 				Recti renderRect;
+				bool aliasingBarrier = false; //< a texture first used in this pass shares its memory with other textures
 				bool forceCommandBufferRegeneration = true;
+				bool isSkipped = false; //< command buffer only holds the skip barriers
 			};
 
 			struct TextureData : FrameGraphTextureData
 			{
+				std::optional<std::size_t> heapIndex;
 				std::shared_ptr<Texture> texture;
+				UInt64 heapOffset = 0;
 			};
 
 			std::shared_ptr<CommandPool> m_commandPool;
+			std::vector<std::shared_ptr<CommandPool>> m_secondaryCommandPools; //< one per recording task, as pools aren't thread-safe
+			std::vector<std::shared_ptr<TextureHeap>> m_textureHeaps;
 			std::vector<PassData> m_passes;
 			std::vector<TextureData> m_textures;
 			AttachmentIdToTextureId m_attachmentToTextureMapping;
 			PassIdToPhysicalPassIndex m_passIdToPhysicalPassMapping;
+			UInt64 m_transientMemoryUsage;
 			unsigned int m_height;
 			unsigned int m_width;
 	};
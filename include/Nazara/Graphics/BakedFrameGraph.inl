@@ -6,6 +6,16 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns the memory used by transient textures (textures whose content doesn't persist between frames)
+	*
+	* When the device supports texture memory aliasing, transient textures which aren't used at the same time share their memory and this is the size of their heaps (peak transient memory).
+	* Otherwise this is the (estimated) sum of transient texture sizes.
+	*/
+	inline UInt64 BakedFrameGraph::GetTransientMemoryUsage() const
+	{
+		return m_transientMemoryUsage;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
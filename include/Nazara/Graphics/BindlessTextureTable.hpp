@@ -0,0 +1,80 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_BINDLESSTEXTURETABLE_HPP
+#define NAZARA_GRAPHICS_BINDLESSTEXTURETABLE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Renderer/ShaderBinding.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	class RenderDevice;
+	class RenderFrame;
+	class RenderPipelineLayout;
+	class Texture;
+	class TextureSampler;
+
+	class NAZARA_GRAPHICS_API BindlessTextureTable
+	{
+		public:
+			BindlessTextureTable(std::shared_ptr<RenderDevice> renderDevice, UInt32 capacity, std::shared_ptr<Texture> defaultTexture, std::shared_ptr<TextureSampler> defaultSampler);
+			BindlessTextureTable(const BindlessTextureTable&) = delete;
+			BindlessTextureTable(BindlessTextureTable&&) = delete;
+			~BindlessTextureTable() = default;
+
+			inline UInt32 GetCapacity() const;
+			inline const std::shared_ptr<RenderPipelineLayout>& GetRenderPipelineLayout() const;
+			inline const ShaderBinding& GetShaderBinding() const;
+			inline std::size_t GetTextureCount() const;
+
+			UInt32 RegisterTexture(std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> sampler);
+
+			void UnregisterTexture(UInt32 textureIndex);
+
+			void Update(RenderFrame& renderFrame);
+
+			BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+			BindlessTextureTable& operator=(BindlessTextureTable&&) = delete;
+
+			static constexpr UInt32 DefaultTextureIndex = 0;
+
+		private:
+			void WriteDirtyEntries();
+
+			struct EntryHasher
+			{
+				inline std::size_t operator()(const std::pair<const Texture*, const TextureSampler*>& entry) const;
+			};
+
+			struct Entry
+			{
+				std::shared_ptr<Texture> texture;
+				std::shared_ptr<TextureSampler> sampler;
+				std::size_t refCount = 0;
+			};
+
+			std::shared_ptr<RenderDevice> m_renderDevice;
+			std::shared_ptr<RenderPipelineLayout> m_renderPipelineLayout;
+			std::unordered_map<std::pair<const Texture*, const TextureSampler*>, UInt32, EntryHasher> m_entryByTexture;
+			std::shared_ptr<std::vector<UInt32>> m_recycledEntries;
+			std::vector<Entry> m_entries;
+			std::vector<UInt32> m_releasedEntries;
+			Bitset<UInt64> m_dirtyEntries;
+			Bitset<UInt64> m_freeEntries;
+			ShaderBindingPtr m_shaderBinding;
+	};
+}
+
+#include <Nazara/Graphics/BindlessTextureTable.inl>
+
+#endif // NAZARA_GRAPHICS_BINDLESSTEXTURETABLE_HPP
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <NazaraUtils/Hash.hpp>
+#include <cassert>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	inline UInt32 BindlessTextureTable::GetCapacity() const
+	{
+		return SafeCast<UInt32>(m_entries.size());
+	}
+
+	inline const std::shared_ptr<RenderPipelineLayout>& BindlessTextureTable::GetRenderPipelineLayout() const
+	{
+		return m_renderPipelineLayout;
+	}
+
+	/*!
+	* \brief Returns the shader binding holding the whole texture table
+	*
+	* The binding stays the same for the lifetime of the table, its entries are updated in place.
+	*/
+	inline const ShaderBinding& BindlessTextureTable::GetShaderBinding() const
+	{
+		assert(m_shaderBinding);
+		return *m_shaderBinding;
+	}
+
+	inline std::size_t BindlessTextureTable::GetTextureCount() const
+	{
+		return m_entryByTexture.size();
+	}
+
+	inline std::size_t BindlessTextureTable::EntryHasher::operator()(const std::pair<const Texture*, const TextureSampler*>& entry) const
+	{
+		std::size_t seed = std::hash<const Texture*>{}(entry.first);
+		HashCombine(seed, entry.second);
+
+		return seed;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -11,6 +11,7 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/ElementRenderer.hpp>
 #include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
@@ -18,10 +19,12 @@
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Math/Frustum.hpp>
+#include <optional>
 
 namespace Nz
 {
 	class AbstractViewer;
+	class DepthPyramid;
 	class ElementRendererRegistry;
 	class FrameGraph;
 	class FramePass;
@@ -30,7 +33,7 @@ namespace Nz
 	class NAZARA_GRAPHICS_API DepthPipelinePass : public FramePipelinePass
 	{
 		public:
-			DepthPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, std::size_t passIndex, std::string passName);
+			DepthPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, std::size_t passIndex, std::string passName, bool gpuCulling = false);
 			DepthPipelinePass(const DepthPipelinePass&) = delete;
 			DepthPipelinePass(DepthPipelinePass&&) = delete;
 			~DepthPipelinePass() = default;
@@ -43,6 +46,10 @@ namespace Nz
 			void RegisterMaterialInstance(const MaterialInstance& materialInstance);
 			FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t outputAttachment);
 
+			inline void SetDepthPyramid(const DepthPyramid* depthPyramid);
+
+			inline void SkipRendering(bool skipRendering);
+
 			void UnregisterMaterialInstance(const MaterialInstance& materialInstance);
 
 			DepthPipelinePass& operator=(const DepthPipelinePass&) = delete;
@@ -57,6 +64,8 @@ namespace Nz
 				NazaraSlot(MaterialInstance, OnMaterialInstanceShaderBindingInvalidated, onMaterialInstanceShaderBindingInvalidated);
 			};
 
+			std::size_t m_commandChunkCount;
+			std::size_t m_commandChunkSize;
 			std::size_t m_passIndex;
 			std::size_t m_lastVisibilityHash;
 			std::string m_passName;
@@ -64,13 +73,17 @@ namespace Nz
 			std::vector<ElementRenderer::RenderStates> m_renderStates;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
+			std::unordered_map<const RenderElement*, Boxf> m_aabbPerRenderElement;
+			std::optional<IndirectDrawTable> m_indirectDrawTable;
 			RenderQueue<const RenderElement*> m_renderQueue;
 			RenderQueueRegistry m_renderQueueRegistry;
+			const DepthPyramid* m_depthPyramid;
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
+			bool m_skipRendering;
 	};
 }
 
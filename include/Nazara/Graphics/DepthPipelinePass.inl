@@ -15,6 +15,22 @@ namespace Nz
 	{
 		m_rebuildElements = true;
 	}
+
+	/*!
+	* \brief Sets the depth pyramid draws are tested against when culled on the GPU, or disables occlusion culling if null
+	*/
+	inline void DepthPipelinePass::SetDepthPyramid(const DepthPyramid* depthPyramid)
+	{
+		m_depthPyramid = depthPyramid;
+	}
+
+	/*!
+	* \brief Skips the pass execution, keeping the output attachment content as is
+	*/
+	inline void DepthPipelinePass::SkipRendering(bool skipRendering)
+	{
+		m_skipRendering = skipRendering;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_DEPTHPYRAMID_HPP
+#define NAZARA_GRAPHICS_DEPTHPYRAMID_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Renderer/ShaderBinding.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class AbstractViewer;
+	class BakedFrameGraph;
+	class FrameGraph;
+	class RenderBuffer;
+	class RenderDevice;
+	class RenderFrame;
+	class Texture;
+
+	class NAZARA_GRAPHICS_API DepthPyramid
+	{
+		public:
+			DepthPyramid(std::shared_ptr<RenderDevice> renderDevice, AbstractViewer* viewer);
+			DepthPyramid(const DepthPyramid&) = delete;
+			DepthPyramid(DepthPyramid&&) = delete;
+			~DepthPyramid() = default;
+
+			void Build(RenderFrame& renderFrame);
+
+			inline const ShaderBinding& GetCullingShaderBinding() const;
+			inline std::size_t GetLevelCount() const;
+
+			std::size_t RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t depthBufferIndex);
+
+			void UpdateTextures(RenderFrame& renderFrame, const BakedFrameGraph& frameGraph);
+
+			DepthPyramid& operator=(const DepthPyramid&) = delete;
+			DepthPyramid& operator=(DepthPyramid&&) = delete;
+
+			static constexpr std::size_t MaxLevelCount = 16;
+			static constexpr UInt32 ReductionWorkgroupSize = 8;
+
+		private:
+			struct Level
+			{
+				ShaderBindingPtr shaderBinding;
+				Vector2i offset;
+				Vector2i size;
+			};
+
+			struct LevelDataLayout
+			{
+				std::size_t destOffsetOffset;
+				std::size_t destSizeOffset;
+				std::size_t sourceOffsetOffset;
+				std::size_t sourceSizeOffset;
+				std::size_t totalSize;
+			};
+
+			struct OcclusionDataLayout
+			{
+				std::size_t levelCountOffset;
+				std::size_t levelsOffset;
+				std::size_t totalSize;
+				std::size_t viewportOffset;
+				std::size_t viewProjMatrixOffset;
+			};
+
+			std::shared_ptr<RenderBuffer> m_levelDataBuffer;
+			std::shared_ptr<RenderBuffer> m_occlusionDataBuffer;
+			std::shared_ptr<RenderDevice> m_renderDevice;
+			std::shared_ptr<Texture> m_depthCopyTexture;
+			std::shared_ptr<Texture> m_pyramidTexture;
+			std::size_t m_depthBufferIndex;
+			std::size_t m_depthCopyIndex;
+			std::vector<Level> m_levels;
+			AbstractViewer* m_viewer;
+			LevelDataLayout m_levelDataLayout;
+			OcclusionDataLayout m_occlusionDataLayout;
+			ShaderBindingPtr m_copyShaderBinding;
+			ShaderBindingPtr m_cullingShaderBinding;
+	};
+}
+
+#include <Nazara/Graphics/DepthPyramid.inl>
+
+#endif // NAZARA_GRAPHICS_DEPTHPYRAMID_HPP
@@ -0,0 +1,27 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Returns the shader binding of the depth pyramid and the viewer state it was built with, to bind to the set 1 of the occlusion culling pipeline
+	*
+	* \remark UpdateTextures has to be called once before this
+	*/
+	inline const ShaderBinding& DepthPyramid::GetCullingShaderBinding() const
+	{
+		NazaraAssert(m_cullingShaderBinding, "depth pyramid textures were not created");
+		return *m_cullingShaderBinding;
+	}
+
+	inline std::size_t DepthPyramid::GetLevelCount() const
+	{
+		return m_levels.size();
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -35,12 +35,18 @@ namespace Nz
 			inline Color GetColor() const;
 			inline const Vector3f& GetDirection() const;
 			inline const Quaternionf& GetRotation() const;
+			inline std::size_t GetShadowCascadeCount() const;
+			inline float GetShadowCascadeSplitFactor() const;
+			inline float GetShadowMaxDistance() const;
 
 			inline void UpdateAmbientFactor(float factor);
 			inline void UpdateColor(Color color);
 			inline void UpdateDiffuseFactor(float factor);
 			inline void UpdateDirection(const Vector3f& direction);
 			inline void UpdateRotation(const Quaternionf& rotation);
+			inline void UpdateShadowCascadeCount(std::size_t cascadeCount);
+			inline void UpdateShadowCascadeSplitFactor(float splitFactor);
+			inline void UpdateShadowMaxDistance(float maxDistance);
 
 			void UpdateTransform(const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale) override;
 
@@ -53,8 +59,11 @@ namespace Nz
 			Color m_color;
 			Quaternionf m_rotation;
 			Vector3f m_direction;
+			std::size_t m_shadowCascadeCount;
 			float m_ambientFactor;
 			float m_diffuseFactor;
+			float m_shadowCascadeSplitFactor;
+			float m_shadowMaxDistance;
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/Enums.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <cassert>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -11,8 +12,11 @@ namespace Nz
 	inline DirectionalLight::DirectionalLight() :
 	Light(SafeCast<UInt8>(BasicLightType::Directional)),
 	m_color(Color::White()),
+	m_shadowCascadeCount(4),
 	m_ambientFactor(0.2f),
-	m_diffuseFactor(1.f)
+	m_diffuseFactor(1.f),
+	m_shadowCascadeSplitFactor(0.5f),
+	m_shadowMaxDistance(200.f)
 	{
 		UpdateRotation(Quaternionf::Identity());
 	}
@@ -42,6 +46,21 @@ namespace Nz
 		return m_diffuseFactor;
 	}
 
+	inline std::size_t DirectionalLight::GetShadowCascadeCount() const
+	{
+		return m_shadowCascadeCount;
+	}
+
+	inline float DirectionalLight::GetShadowCascadeSplitFactor() const
+	{
+		return m_shadowCascadeSplitFactor;
+	}
+
+	inline float DirectionalLight::GetShadowMaxDistance() const
+	{
+		return m_shadowMaxDistance;
+	}
+
 	inline void DirectionalLight::UpdateAmbientFactor(float factor)
 	{
 		m_ambientFactor = factor;
@@ -76,6 +95,52 @@ namespace Nz
 		UpdateBoundingVolume();
 	}
 
+	/*!
+	* \brief Sets the number of shadow cascades the viewers frustum is split into (between 2 and 4)
+	*/
+	inline void DirectionalLight::UpdateShadowCascadeCount(std::size_t cascadeCount)
+	{
+		NazaraAssert(cascadeCount >= 2 && cascadeCount <= PredefinedLightData::MaxCascadeCount, "invalid shadow cascade count");
+
+		if (m_shadowCascadeCount != cascadeCount)
+		{
+			m_shadowCascadeCount = cascadeCount;
+
+			OnLightShadowMapSettingChange(this, GetShadowMapFormat(), GetShadowMapSize()); //< shadow maps have to be reallocated
+			OnLightDataInvalided(this);
+		}
+	}
+
+	/*!
+	* \brief Sets the blend factor between logarithmic (1) and uniform (0) cascade splits
+	*/
+	inline void DirectionalLight::UpdateShadowCascadeSplitFactor(float splitFactor)
+	{
+		NazaraAssert(splitFactor >= 0.f && splitFactor <= 1.f, "invalid shadow cascade split factor");
+
+		if (m_shadowCascadeSplitFactor != splitFactor)
+		{
+			m_shadowCascadeSplitFactor = splitFactor;
+
+			OnLightDataInvalided(this); //< cascades have to be fitted again
+		}
+	}
+
+	/*!
+	* \brief Sets the distance from the viewer after which objects no longer receive shadows
+	*/
+	inline void DirectionalLight::UpdateShadowMaxDistance(float maxDistance)
+	{
+		NazaraAssert(maxDistance > 0.f, "invalid shadow max distance");
+
+		if (m_shadowMaxDistance != maxDistance)
+		{
+			m_shadowMaxDistance = maxDistance;
+
+			OnLightDataInvalided(this); //< cascades have to be fitted again
+		}
+	}
+
 	inline void DirectionalLight::UpdateBoundingVolume()
 	{
 		Light::UpdateBoundingVolume(BoundingVolumef::Infinite()); //< will trigger OnLightDataInvalided
@@ -0,0 +1,91 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_DIRECTIONALLIGHTSHADOWDATA_HPP
+#define NAZARA_GRAPHICS_DIRECTIONALLIGHTSHADOWDATA_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/DepthPipelinePass.hpp>
+#include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/LightShadowData.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Graphics/ShadowViewer.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+namespace Nz
+{
+	class DirectionalLight;
+	class FramePipeline;
+
+	class NAZARA_GRAPHICS_API DirectionalLightShadowData : public LightShadowData
+	{
+		public:
+			DirectionalLightShadowData(FramePipeline& pipeline, ElementRendererRegistry& elementRegistry, const DirectionalLight& light);
+			DirectionalLightShadowData(const DirectionalLightShadowData&) = delete;
+			DirectionalLightShadowData(DirectionalLightShadowData&&) = delete;
+			~DirectionalLightShadowData() = default;
+
+			void FillLightData(void* data, const AbstractViewer* viewer) const override;
+
+			void InvalidateShadowmaps() override;
+
+			void PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* viewer) override;
+
+			void RegisterMaterialInstance(const MaterialInstance& matInstance) override;
+			void RegisterPassInputs(FramePass& pass, const AbstractViewer* viewer) override;
+			void RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* viewer) override;
+			void RegisterViewer(const AbstractViewer* viewer) override;
+
+			const Texture* RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* viewer) const override;
+
+			void UnregisterMaterialInstance(const MaterialInstance& matInstance) override;
+			void UnregisterViewer(const AbstractViewer* viewer) override;
+
+			DirectionalLightShadowData& operator=(const DirectionalLightShadowData&) = delete;
+			DirectionalLightShadowData& operator=(DirectionalLightShadowData&&) = delete;
+
+			static void ComputeCascadeSplits(float zNear, float zFar, float splitFactor, std::size_t cascadeCount, float* splitDistances);
+
+		private:
+			struct CascadeData
+			{
+				std::optional<DepthPipelinePass> depthPass;
+				std::size_t attachmentIndex;
+				Matrix4f viewProjMatrix; //< includes texture coordinates bias, as used by shaders
+				Quaternionf lightRotation;
+				ShadowmapCache shadowmapCache;
+				ShadowViewer viewer;
+				Spheref boundingSphere;
+				bool hasProjection = false;
+			};
+
+			struct PerViewerData
+			{
+				std::array<CascadeData, PredefinedLightData::MaxCascadeCount> cascades;
+				std::size_t cascadeCount = 0;
+				std::size_t textureArrayAttachmentIndex;
+			};
+
+			void PrepareCascade(RenderFrame& renderFrame, CascadeData& cascade, const Vector3f* sliceCorners, bool* projectionUpdated);
+
+			NazaraSlot(Light, OnLightShadowMapSettingChange, m_onLightShadowMapSettingChange);
+
+			std::unordered_map<const AbstractViewer*, std::unique_ptr<PerViewerData>> m_viewerData;
+			ElementRendererRegistry& m_elementRegistry;
+			FramePipeline& m_pipeline;
+			const DirectionalLight& m_light;
+	};
+}
+
+#include <Nazara/Graphics/DirectionalLightShadowData.inl>
+
+#endif // NAZARA_GRAPHICS_DIRECTIONALLIGHTSHADOWDATA_HPP
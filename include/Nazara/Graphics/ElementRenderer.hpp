@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/RenderElementPool.hpp>
+#include <Nazara/Math/Box.hpp>
 #include <Nazara/Renderer/RenderBufferView.hpp>
 #include <array>
 #include <memory>
@@ -22,6 +23,7 @@
 namespace Nz
 {
 	class CommandBufferBuilder;
+	class IndirectDrawTable;
 	class RenderElement;
 	class RenderFrame;
 	class ViewerInstance;
@@ -49,10 +51,14 @@ namespace Nz
 				{
 					shadowMaps2D.fill(nullptr);
 					shadowMapsCube.fill(nullptr);
+					shadowMapsDirectional.fill(nullptr);
 				}
 
 				std::array<const Texture*, PredefinedLightData::MaxLightCount> shadowMaps2D;
 				std::array<const Texture*, PredefinedLightData::MaxLightCount> shadowMapsCube;
+				std::array<const Texture*, PredefinedLightData::MaxLightCount> shadowMapsDirectional;
+				Boxf aabb = Boxf::Zero(); //< local bounding box of the element, used for GPU culling
+				IndirectDrawTable* indirectDrawTable = nullptr; //< if set, indexed draws are culled on the GPU and drawn indirectly
 				RenderBufferView lightData;
 			};
 	};
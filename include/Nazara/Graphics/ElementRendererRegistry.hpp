@@ -35,6 +35,7 @@ namespace Nz
 			inline std::size_t GetElementRendererCount() const;
 
 			template<typename F> void ProcessRenderQueue(const RenderQueue<const RenderElement*>& renderQueue, F&& callback);
+			template<typename F> void ProcessRenderQueue(const RenderQueue<const RenderElement*>& renderQueue, std::size_t firstElement, std::size_t elementCount, F&& callback);
 
 			template<typename T> void RegisterElementRenderer(std::unique_ptr<ElementRenderer> renderer);
 			inline void RegisterElementRenderer(std::size_t elementIndex, std::unique_ptr<ElementRenderer> renderer);
@@ -40,11 +40,23 @@ namespace Nz
 	template<typename F>
 	void ElementRendererRegistry::ProcessRenderQueue(const RenderQueue<const RenderElement*>& renderQueue, F&& callback)
 	{
-		if (renderQueue.empty())
+		return ProcessRenderQueue(renderQueue, 0, renderQueue.size(), std::forward<F>(callback));
+	}
+
+	/*!
+	* \brief Calls the callback for each batch of consecutive elements of the same type in a range of the render queue
+	*
+	* Batches are cut at the range boundaries, this allows a render queue to be split in chunks processed independently.
+	*/
+	template<typename F>
+	void ElementRendererRegistry::ProcessRenderQueue(const RenderQueue<const RenderElement*>& renderQueue, std::size_t firstElement, std::size_t elementCount, F&& callback)
+	{
+		assert(firstElement + elementCount <= renderQueue.size());
+		if (elementCount == 0)
 			return;
 
-		auto it = renderQueue.begin();
-		auto itEnd = renderQueue.end();
+		auto it = renderQueue.begin() + firstElement;
+		auto itEnd = it + elementCount;
 		while (it != itEnd)
 		{
 			const RenderElement* element = *it;
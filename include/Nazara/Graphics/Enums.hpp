@@ -103,11 +103,13 @@ namespace Nz
 
 	enum class EngineShaderBinding
 	{
+		InstanceDataBuffer,
 		InstanceDataUbo,
 		LightDataUbo,
 		OverlayTexture,
 		Shadowmap2D,
 		ShadowmapCube,
+		ShadowmapDirectional,
 		SkeletalDataUbo,
 		ViewerDataUbo,
 
@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/DebugDrawPipelinePass.hpp>
 #include <Nazara/Graphics/DepthPipelinePass.hpp>
+#include <Nazara/Graphics/DepthPyramid.hpp>
 #include <Nazara/Graphics/ElementRenderer.hpp>
 #include <Nazara/Graphics/ForwardPipelinePass.hpp>
 #include <Nazara/Graphics/FramePipeline.hpp>
@@ -49,6 +50,8 @@ namespace Nz
 
 			void ForEachRegisteredMaterialInstance(FunctionRef<void(const MaterialInstance& materialInstance)> callback) override;
 
+			inline float GetLodHysteresis() const;
+
 			void QueueTransfer(TransferInterface* transfer) override;
 
 			std::size_t RegisterLight(const Light* light, UInt32 renderMask) override;
@@ -58,10 +61,13 @@ namespace Nz
 			std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) override;
 
 			const Light* RetrieveLight(std::size_t lightIndex) const override;
-			const Texture* RetrieveLightShadowmap(std::size_t lightIndex) const override;
+			const LightShadowData* RetrieveLightShadowData(std::size_t lightIndex) const override;
+			const Texture* RetrieveLightShadowmap(std::size_t lightIndex, const AbstractViewer* viewer) const override;
 
 			void Render(RenderFrame& renderFrame) override;
 
+			inline void SetLodHysteresis(float hysteresis);
+
 			void UnregisterLight(std::size_t lightIndex) override;
 			void UnregisterRenderable(std::size_t renderableIndex) override;
 			void UnregisterSkeleton(std::size_t skeletonIndex) override;
@@ -80,11 +86,16 @@ namespace Nz
 		private:
 			BakedFrameGraph BuildFrameGraph();
 
+			void InstanciateLightShadowData(std::size_t lightIndex, LightData& lightData);
+
 			void RegisterMaterialInstance(MaterialInstance* materialPass);
 			void UnregisterMaterialInstance(MaterialInstance* material);
 
+			struct LightData;
 			struct ViewerData;
 
+			const std::vector<FramePipelinePass::VisibleRenderable>& FrustumCull(const Frustumf* frustum, UInt32 mask, std::size_t& visibilityHash, ViewerData* viewerData) const;
+
 			struct LightData
 			{
 				std::unique_ptr<LightShadowData> shadowData;
@@ -93,6 +104,8 @@ namespace Nz
 
 				NazaraSlot(Light, OnLightDataInvalided, onLightInvalidated);
 				NazaraSlot(Light, OnLightShadowCastingChanged, onLightShadowCastingChanged);
+				NazaraSlot(Light, OnLightShadowMapSettingChange, onLightShadowMapSettingChange);
+				NazaraSlot(LightShadowData, OnShadowDataInvalidated, onShadowDataInvalidated);
 			};
 
 			struct MaterialInstanceData
@@ -135,13 +148,16 @@ namespace Nz
 				std::size_t debugColorAttachment;
 				std::size_t depthStencilAttachment;
 				std::unique_ptr<DepthPipelinePass> depthPrepass;
+				std::unique_ptr<DepthPyramid> depthPyramid; //< built with GPU-driven rendering (if supported) for occlusion culling
 				std::unique_ptr<ForwardPipelinePass> forwardPass;
 				std::unique_ptr<DebugDrawPipelinePass> debugDrawPass;
 				AbstractViewer* viewer;
 				Int32 renderOrder = 0;
+				UInt32 frameGraphRenderMask = 0; //< viewer render mask when the frame graph was built, viewer-dependent shadowmaps depend on it
 				RenderQueueRegistry forwardRegistry;
 				RenderQueue<RenderElement*> forwardRenderQueue;
 				ShaderBindingPtr blitShaderBinding;
+				std::vector<UInt8> renderableLods; //< indexed by renderable index
 
 				NazaraSlot(TransferInterface, OnTransferRequired, onTransferRequired);
 			};
@@ -171,6 +187,8 @@ namespace Nz
 			MemoryPool<ViewerData> m_viewerPool;
 			MemoryPool<WorldInstanceData> m_worldInstances;
 			RenderFrame* m_currentRenderFrame;
+			std::size_t m_firstShadowLight;
+			float m_lodHysteresis;
 			UInt8 m_generationCounter;
 			bool m_rebuildFrameGraph;
 	};
@@ -6,6 +6,24 @@
 
 namespace Nz
 {
+	inline float ForwardFramePipeline::GetLodHysteresis() const
+	{
+		return m_lodHysteresis;
+	}
+
+	/*!
+	* \brief Sets the hysteresis used when switching between levels of detail
+	*
+	* A renderable only switches to another level of detail once its screen size crosses the threshold by this fraction,
+	* which prevents flickering between two levels when the camera hovers around a threshold.
+	*
+	* \param hysteresis Fraction of the threshold (0 disables hysteresis, 0.1 means 10%)
+	*/
+	inline void ForwardFramePipeline::SetLodHysteresis(float hysteresis)
+	{
+		NazaraAssert(hysteresis >= 0.f && hysteresis < 1.f, "hysteresis must be in [0, 1)");
+		m_lodHysteresis = hysteresis;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
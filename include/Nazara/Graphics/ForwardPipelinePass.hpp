@@ -11,6 +11,7 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/ElementRenderer.hpp>
 #include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
 #include <Nazara/Graphics/Light.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
@@ -20,10 +21,12 @@
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/UploadPool.hpp>
+#include <optional>
 
 namespace Nz
 {
 	class AbstractViewer;
+	class DepthPyramid;
 	class ElementRendererRegistry;
 	class FrameGraph;
 	class FramePass;
@@ -33,7 +36,7 @@ namespace Nz
 	class NAZARA_GRAPHICS_API ForwardPipelinePass : public FramePipelinePass
 	{
 		public:
-			ForwardPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer);
+			ForwardPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, bool gpuCulling = false);
 			ForwardPipelinePass(const ForwardPipelinePass&) = delete;
 			ForwardPipelinePass(ForwardPipelinePass&&) = delete;
 			~ForwardPipelinePass() = default;
@@ -46,6 +49,8 @@ namespace Nz
 			void RegisterMaterialInstance(const MaterialInstance& material);
 			FramePass& RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t colorBufferIndex, std::size_t depthBufferIndex, bool hasDepthPrepass);
 
+			inline void SetDepthPyramid(const DepthPyramid* depthPyramid);
+
 			void UnregisterMaterialInstance(const MaterialInstance& material);
 
 			ForwardPipelinePass& operator=(const ForwardPipelinePass&) = delete;
@@ -76,16 +81,17 @@ namespace Nz
 				UploadPool::Allocation* allocation = nullptr;
 			};
 
-			struct LightPerElementData
+			struct LightUboPool
 			{
-				RenderBufferView lightUniformBuffer;
-				std::array<const Texture*, MaxLightCountPerDraw> shadowMaps;
-				std::size_t lightCount;
+				std::vector<std::shared_ptr<RenderBuffer>> lightUboBuffers;
 			};
 
-			struct LightUboPool
+			struct PerElementData
 			{
-				std::vector<std::shared_ptr<RenderBuffer>> lightUboBuffers;
+				Boxf aabb;
+				RenderBufferView lightUniformBuffer;
+				std::array<const Texture*, MaxLightCountPerDraw> shadowMaps;
+				std::size_t lightCount;
 			};
 
 			struct RenderableLight
@@ -95,6 +101,8 @@ namespace Nz
 				float contributionScore;
 			};
 
+			std::size_t m_commandChunkCount;
+			std::size_t m_commandChunkSize;
 			std::size_t m_forwardPassIndex;
 			std::size_t m_lastVisibilityHash;
 			std::shared_ptr<LightUboPool> m_lightUboPool;
@@ -102,12 +110,14 @@ namespace Nz
 			std::vector<ElementRenderer::RenderStates> m_renderStates;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
-			std::unordered_map<const RenderElement*, LightPerElementData> m_lightPerRenderElement;
+			std::unordered_map<const RenderElement*, PerElementData> m_perRenderElementData;
 			std::unordered_map<LightKey, RenderBufferView, LightKeyHasher> m_lightBufferPerLights;
+			std::optional<IndirectDrawTable> m_indirectDrawTable;
 			std::vector<LightDataUbo> m_lightDataBuffers;
 			std::vector<RenderableLight> m_renderableLights;
 			RenderQueue<const RenderElement*> m_renderQueue;
 			RenderQueueRegistry m_renderQueueRegistry;
+			const DepthPyramid* m_depthPyramid;
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
@@ -16,6 +16,14 @@ namespace Nz
 		m_rebuildElements = true;
 	}
 
+	/*!
+	* \brief Sets the depth pyramid draws are tested against when culled on the GPU, or disables occlusion culling if null
+	*/
+	inline void ForwardPipelinePass::SetDepthPyramid(const DepthPyramid* depthPyramid)
+	{
+		m_depthPyramid = depthPyramid;
+	}
+
 	inline std::size_t ForwardPipelinePass::LightKeyHasher::operator()(const LightKey& lightKey) const
 	{
 		std::size_t lightHash = 5;
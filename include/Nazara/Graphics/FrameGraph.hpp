@@ -41,6 +41,8 @@ namespace Nz
 			inline void AddBackbufferOutput(std::size_t backbufferOutput);
 			inline FramePass& AddPass(std::string name);
 
+			inline void MarkAttachmentAsPersistent(std::size_t attachmentId);
+
 			BakedFrameGraph Bake();
 
 			FrameGraph& operator=(const FrameGraph&) = delete;
@@ -100,6 +102,7 @@ namespace Nz
 				};
 
 				std::string name;
+				std::vector<TextureBarrier> skipBarriers;
 				std::vector<TextureBarrier> textureBarrier;
 				std::vector<Subpass> passes;
 			};
@@ -128,6 +131,7 @@ namespace Nz
 			void BuildPhysicalPassDependencies(std::size_t colorAttachmentCount, bool hasDepthStencilAttachment, std::vector<RenderPass::Attachment>& renderPassAttachments, std::vector<RenderPass::SubpassDescription>& subpasses, std::vector<RenderPass::SubpassDependency>& dependencies);
 			void BuildPhysicalPasses();
 			void BuildReadWriteList();
+			void ComputeTextureLifetimes();
 			bool HasAttachment(const std::vector<FramePass::Input>& inputs, std::size_t attachmentIndex) const;
 			void RemoveDuplicatePasses();
 			std::size_t ResolveAttachmentIndex(std::size_t attachmentIndex) const;
@@ -141,6 +145,7 @@ namespace Nz
 			std::vector<std::size_t> m_backbufferOutputs;
 			std::vector<FramePass> m_framePasses;
 			std::vector<AttachmentType> m_attachments;
+			std::unordered_set<std::size_t> m_persistentAttachments;
 			WorkData m_pending;
 	};
 }
@@ -88,6 +88,16 @@ namespace Nz
 		std::size_t id = m_framePasses.size();
 		return m_framePasses.emplace_back(*this, id, std::move(name));
 	}
+
+	/*!
+	* \brief Prevents the texture of an attachment from being reused by other attachments once it has been read
+	*
+	* This is required for attachments whose content is kept from one frame to another (and whose passes may be skipped)
+	*/
+	inline void FrameGraph::MarkAttachmentAsPersistent(std::size_t attachmentId)
+	{
+		m_persistentAttachments.insert(ResolveAttachmentIndex(attachmentId));
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -33,6 +33,9 @@ namespace Nz
 		unsigned int width;
 		unsigned int height;
 		unsigned int layerCount;
+		std::size_t firstUse = 0; //< index of the first physical pass using the texture (or one of its views)
+		std::size_t lastUse = 0; //< index of the last physical pass using the texture (or one of its views)
+		bool persistent = false; //< content is used outside of the graph passes, memory can't be shared with other textures
 	};
 }
 
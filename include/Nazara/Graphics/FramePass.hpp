@@ -42,7 +42,9 @@ namespace Nz
 	class NAZARA_GRAPHICS_API FramePass
 	{
 		public:
+			using ChunkCountCallback = std::function<std::size_t()>;
 			using CommandCallback = std::function<void(CommandBufferBuilder& builder, const FramePassEnvironment& env)>;
+			using CommandChunkCallback = std::function<void(CommandBufferBuilder& builder, const FramePassEnvironment& env, std::size_t chunkIndex)>;
 			using ExecutionCallback = std::function<FramePassExecution()>;
 			struct DepthStencilClear;
 			struct Input;
@@ -58,7 +60,9 @@ namespace Nz
 
 			template<typename F> void ForEachAttachment(F&& func, bool singleDSInputOutputCall = true) const;
 
+			inline const ChunkCountCallback& GetChunkCountCallback() const;
 			inline const CommandCallback& GetCommandCallback() const;
+			inline const CommandChunkCallback& GetCommandChunkCallback() const;
 			inline const std::optional<DepthStencilClear>& GetDepthStencilClear() const;
 			inline std::size_t GetDepthStencilInput() const;
 			inline std::size_t GetDepthStencilOutput() const;
@@ -69,6 +73,7 @@ namespace Nz
 			inline std::size_t GetPassId() const;
 
 			inline void SetCommandCallback(CommandCallback callback);
+			inline void SetCommandChunkCallback(ChunkCountCallback chunkCountCallback, CommandChunkCallback chunkCallback);
 			inline void SetClearColor(std::size_t outputIndex, const std::optional<Color>& color);
 			inline void SetDepthStencilClear(float depth, UInt32 stencil);
 			inline void SetDepthStencilInput(std::size_t attachmentId);
@@ -109,7 +114,9 @@ namespace Nz
 			std::string m_name;
 			std::vector<Input> m_inputs;
 			std::vector<Output> m_outputs;
+			ChunkCountCallback m_chunkCountCallback;
 			CommandCallback m_commandCallback;
+			CommandChunkCallback m_commandChunkCallback;
 			ExecutionCallback m_executionCallback;
 	};
 }
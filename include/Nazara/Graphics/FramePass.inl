@@ -59,11 +59,21 @@ namespace Nz
 			func(m_depthStencilOutput);
 	}
 
+	inline auto FramePass::GetChunkCountCallback() const -> const ChunkCountCallback&
+	{
+		return m_chunkCountCallback;
+	}
+
 	inline auto FramePass::GetCommandCallback() const -> const CommandCallback&
 	{
 		return m_commandCallback;
 	}
 
+	inline auto FramePass::GetCommandChunkCallback() const -> const CommandChunkCallback&
+	{
+		return m_commandChunkCallback;
+	}
+
 	inline auto FramePass::GetDepthStencilClear() const -> const std::optional<DepthStencilClear>&
 	{
 		return m_depthStencilClear;
@@ -109,6 +119,25 @@ namespace Nz
 		m_commandCallback = std::move(callback);
 	}
 
+	/*!
+	* \brief Sets callbacks recording the pass commands in independent chunks
+	*
+	* When the pass has more than one chunk to record, each chunk is recorded in its own secondary command buffer, in parallel.
+	* If recording one of them fails, every chunk is recorded again in the primary command buffer.
+	* Passes recorded in secondary command buffers are recorded again every frame.
+	* The chunk count callback is called from the thread executing the frame graph, before recording the chunks.
+	*
+	* \param chunkCountCallback Callback returning the number of chunks to record
+	* \param chunkCallback Callback recording one chunk, called concurrently from worker threads
+	*
+	* \remark This takes precedence over the command callback
+	*/
+	inline void FramePass::SetCommandChunkCallback(ChunkCountCallback chunkCountCallback, CommandChunkCallback chunkCallback)
+	{
+		m_chunkCountCallback = std::move(chunkCountCallback);
+		m_commandChunkCallback = std::move(chunkCallback);
+	}
+
 	inline void FramePass::SetClearColor(std::size_t outputIndex, const std::optional<Color>& color)
 	{
 		assert(outputIndex < m_outputs.size());
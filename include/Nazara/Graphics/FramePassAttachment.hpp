@@ -9,6 +9,7 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Renderer/Enums.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <string>
 
@@ -27,6 +28,7 @@ namespace Nz
 		FramePassAttachmentSize size = FramePassAttachmentSize::SwapchainFactor;
 		unsigned int width = 100'000;
 		unsigned int height = 100'000;
+		TextureUsageFlags additionalUsage; //< usage by code outside of the frame graph passes (usage from passes is deduced)
 	};
 }
 
@@ -23,6 +23,7 @@ namespace Nz
 	class AbstractViewer;
 	class InstancedRenderable;
 	class Light;
+	class LightShadowData;
 	class MaterialInstance;
 	class RenderFrame;
 
@@ -40,6 +41,7 @@ namespace Nz
 			virtual void ForEachRegisteredMaterialInstance(FunctionRef<void(const MaterialInstance& materialInstance)> callback) = 0;
 
 			inline DebugDrawer& GetDebugDrawer();
+			inline std::size_t GetShadowUpdateBudget() const;
 
 			virtual void QueueTransfer(TransferInterface* transfer) = 0;
 
@@ -50,10 +52,13 @@ namespace Nz
 			virtual std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) = 0;
 
 			virtual const Light* RetrieveLight(std::size_t lightIndex) const = 0;
-			virtual const Texture* RetrieveLightShadowmap(std::size_t lightIndex) const = 0;
+			virtual const LightShadowData* RetrieveLightShadowData(std::size_t lightIndex) const = 0;
+			virtual const Texture* RetrieveLightShadowmap(std::size_t lightIndex, const AbstractViewer* viewer) const = 0;
 
 			virtual void Render(RenderFrame& renderFrame) = 0;
 
+			inline bool RequestShadowUpdate(bool mandatory);
+
 			virtual void UnregisterLight(std::size_t lightIndex) = 0;
 			virtual void UnregisterRenderable(std::size_t renderableIndex) = 0;
 			virtual void UnregisterSkeleton(std::size_t skeletonIndex) = 0;
@@ -64,6 +69,7 @@ namespace Nz
 			virtual void UpdateRenderableRenderMask(std::size_t renderableIndex, UInt32 renderMask) = 0;
 			virtual void UpdateRenderableScissorBox(std::size_t renderableIndex, const Recti& scissorBox) = 0;
 			virtual void UpdateRenderableSkeletonInstance(std::size_t renderableIndex, std::size_t skeletonIndex) = 0;
+			inline void UpdateShadowUpdateBudget(std::size_t shadowUpdateBudget);
 			virtual void UpdateViewerRenderMask(std::size_t viewerIndex, Int32 renderOrder) = 0;
 
 			FramePipeline& operator=(const FramePipeline&) = delete;
@@ -72,9 +78,15 @@ namespace Nz
 			NazaraSignal(OnTransfer, FramePipeline* /*pipeline*/, RenderFrame& /*renderFrame*/, CommandBufferBuilder& /*builder*/);
 
 			static constexpr std::size_t NoSkeletonInstance = std::numeric_limits<std::size_t>::max();
+			static constexpr std::size_t UnlimitedShadowUpdates = std::numeric_limits<std::size_t>::max();
+
+		protected:
+			inline void ResetShadowUpdates();
 
 		private:
 			DebugDrawer m_debugDrawer;
+			std::size_t m_remainingShadowUpdates;
+			std::size_t m_shadowUpdateBudget;
 	};
 }
 
@@ -11,6 +11,47 @@ namespace Nz
 	{
 		return m_debugDrawer;
 	}
+
+	inline std::size_t FramePipeline::GetShadowUpdateBudget() const
+	{
+		return m_shadowUpdateBudget;
+	}
+
+	/*!
+	* \brief Asks for the permission to render a shadowmap this frame
+	* \return True if the shadowmap can be rendered
+	*
+	* \param mandatory If true, the shadowmap has to be rendered (its content is undefined) and the request is always granted, but still counts toward the budget
+	*
+	* \see UpdateShadowUpdateBudget
+	*/
+	inline bool FramePipeline::RequestShadowUpdate(bool mandatory)
+	{
+		if (m_remainingShadowUpdates == 0)
+			return mandatory;
+
+		if (m_remainingShadowUpdates != UnlimitedShadowUpdates)
+			m_remainingShadowUpdates--;
+
+		return true;
+	}
+
+	/*!
+	* \brief Sets the maximum number of shadowmaps (each cubemap face and cascade counting as one) rendered again per frame
+	*
+	* Outdated shadowmaps exceeding the budget keep their previous content until a later frame
+	*
+	* \param shadowUpdateBudget Shadowmap count, UnlimitedShadowUpdates to render all outdated shadowmaps every frame
+	*/
+	inline void FramePipeline::UpdateShadowUpdateBudget(std::size_t shadowUpdateBudget)
+	{
+		m_shadowUpdateBudget = shadowUpdateBudget;
+	}
+
+	inline void FramePipeline::ResetShadowUpdates()
+	{
+		m_remainingShadowUpdates = m_shadowUpdateBudget;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
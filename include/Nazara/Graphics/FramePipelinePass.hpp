@@ -34,7 +34,13 @@ namespace Nz
 				const SkeletonInstance* skeletonInstance;
 				const WorldInstance* worldInstance;
 				Recti scissorBox;
+				std::size_t lodIndex = 0;
 			};
+
+			static constexpr std::size_t MinCommandChunkSize = 256;
+
+		protected:
+			static std::size_t ComputeCommandChunkSize(std::size_t elementCount);
 	};
 }
 
@@ -14,12 +14,14 @@
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <NazaraUtils/Signal.hpp>
 #include <memory>
+#include <vector>
 
 namespace Nz
 {
 	class NAZARA_GRAPHICS_API GraphicalMesh
 	{
 		public:
+			struct Lod;
 			struct SubMesh;
 
 			GraphicalMesh() = default;
@@ -35,6 +37,7 @@ namespace Nz
 			inline const std::shared_ptr<RenderBuffer>& GetIndexBuffer(std::size_t subMesh) const;
 			inline UInt32 GetIndexCount(std::size_t subMesh) const;
 			inline IndexType GetIndexType(std::size_t subMesh) const;
+			inline const std::vector<Lod>& GetLods(std::size_t subMesh) const;
 			inline const std::shared_ptr<RenderBuffer>& GetVertexBuffer(std::size_t subMesh) const;
 			inline const std::shared_ptr<const VertexDeclaration>& GetVertexDeclaration(std::size_t subMesh) const;
 			inline std::size_t GetSubMeshCount() const;
@@ -45,11 +48,19 @@ namespace Nz
 			GraphicalMesh& operator=(const GraphicalMesh&) = delete;
 			GraphicalMesh& operator=(GraphicalMesh&&) = delete;
 
+			struct Lod
+			{
+				std::shared_ptr<RenderBuffer> indexBuffer;
+				UInt32 indexCount;
+				float error; //< in mesh space units
+			};
+
 			struct SubMesh
 			{
 				std::shared_ptr<RenderBuffer> indexBuffer;
 				std::shared_ptr<RenderBuffer> vertexBuffer;
 				std::shared_ptr<const VertexDeclaration> vertexDeclaration;
+				std::vector<Lod> lods; //< simplified versions sharing the vertex buffer, from the most to the least detailed
 				IndexType indexType;
 				UInt32 indexCount;
 			};
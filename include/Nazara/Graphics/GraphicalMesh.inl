@@ -47,6 +47,12 @@ namespace Nz
 		return m_subMeshes[subMesh].indexType;
 	}
 
+	inline auto GraphicalMesh::GetLods(std::size_t subMesh) const -> const std::vector<Lod>&
+	{
+		assert(subMesh < m_subMeshes.size());
+		return m_subMeshes[subMesh].lods;
+	}
+
 	inline const std::shared_ptr<RenderBuffer>& GraphicalMesh::GetVertexBuffer(std::size_t subMesh) const
 	{
 		assert(subMesh < m_subMeshes.size());
@@ -8,16 +8,20 @@
 #define NAZARA_GRAPHICS_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/BindlessTextureTable.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPassRegistry.hpp>
+#include <Nazara/Graphics/RenderBufferPool.hpp>
 #include <Nazara/Graphics/TextureSamplerCache.hpp>
+#include <Nazara/Graphics/ThreadSafeModuleResolver.hpp>
+#include <Nazara/Renderer/ComputePipeline.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderPassCache.hpp>
 #include <Nazara/Renderer/RenderPipelineLayout.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
-#include <NZSL/FilesystemModuleResolver.hpp>
+#include <filesystem>
 #include <optional>
 
 namespace Nz
@@ -40,10 +44,16 @@ namespace Nz
 			Graphics(Config config);
 			~Graphics();
 
+			inline BindlessTextureTable* GetBindlessTextureTable();
+			inline const BindlessTextureTable* GetBindlessTextureTable() const;
 			inline const std::shared_ptr<RenderPipeline>& GetBlitPipeline(bool transparent) const;
 			inline const std::shared_ptr<RenderPipelineLayout>& GetBlitPipelineLayout() const;
 			inline const DefaultMaterials& GetDefaultMaterials() const;
 			inline const DefaultTextures& GetDefaultTextures() const;
+			inline const std::shared_ptr<ComputePipeline>& GetDepthPyramidPipeline() const;
+			inline const std::shared_ptr<RenderPipelineLayout>& GetDepthPyramidPipelineLayout() const;
+			inline const std::shared_ptr<ComputePipeline>& GetDrawCullingPipeline(bool occlusionCulling) const;
+			inline const std::shared_ptr<RenderPipelineLayout>& GetDrawCullingPipelineLayout() const;
 			inline MaterialPassRegistry& GetMaterialPassRegistry();
 			inline const MaterialPassRegistry& GetMaterialPassRegistry() const;
 			inline MaterialInstanceLoader& GetMaterialInstanceLoader();
@@ -55,8 +65,11 @@ namespace Nz
 			inline const std::shared_ptr<RenderDevice>& GetRenderDevice() const;
 			inline const RenderPassCache& GetRenderPassCache() const;
 			inline TextureSamplerCache& GetSamplerCache();
-			inline std::shared_ptr<nzsl::FilesystemModuleResolver>& GetShaderModuleResolver();
-			inline const std::shared_ptr<nzsl::FilesystemModuleResolver>& GetShaderModuleResolver() const;
+			inline std::shared_ptr<ThreadSafeModuleResolver>& GetShaderModuleResolver();
+			inline const std::shared_ptr<ThreadSafeModuleResolver>& GetShaderModuleResolver() const;
+			inline const std::shared_ptr<RenderBufferPool>& GetWorldInstanceBufferPool() const;
+
+			inline bool IsGpuDrivenRenderingEnabled() const;
 
 			void RegisterComponent(AppFilesystemComponent& component);
 
@@ -65,6 +78,10 @@ namespace Nz
 				void Override(const CommandLineParameters& parameters);
 
 				RenderDeviceFeatures forceDisableFeatures;
+				std::filesystem::path pipelineCacheDirectory; //< pipeline cache is loaded from and saved to this directory, if not empty
+				UInt32 bindlessTextureCount = 4096; //< size of the bindless texture table (if supported by the device), zero disables it
+				bool asyncPipelineCompilation = false; //< compile missing shader permutations in the background, using a fallback pipeline meanwhile
+				bool gpuDrivenRendering = false; //< cull viewer draws (frustum and previous frame depth occlusion) in a compute shader and render them through indirect draws (Vulkan only, ignored if unsupported)
 				bool useDedicatedRenderDevice = true;
 			};
 
@@ -77,6 +94,7 @@ namespace Nz
 				};
 
 				EnumArray<MaterialType, MaterialData> materials;
+				std::shared_ptr<MaterialInstance> distanceFieldText; //< transparent basic material rendering distance field glyphes
 			};
 
 			struct DefaultTextures
@@ -86,21 +104,35 @@ namespace Nz
 			};
 
 		private:
+			void BuildBindlessTextureTable(UInt32 capacity);
 			void BuildBlitPipeline();
 			void BuildDefaultMaterials();
 			void BuildDefaultTextures();
+			void BuildDepthPyramidPipeline();
+			void BuildDrawCullingPipeline();
+			std::filesystem::path GetPipelineCachePath() const;
+			void LoadPipelineCache();
 			void RegisterMaterialPasses();
 			void RegisterShaderModules();
 			template<std::size_t N> void RegisterEmbedShaderModule(const UInt8(&content)[N]);
+			void SavePipelineCache();
 			void SelectDepthStencilFormats();
 
+			std::optional<BindlessTextureTable> m_bindlessTextureTable;
 			std::optional<RenderPassCache> m_renderPassCache;
 			std::optional<TextureSamplerCache> m_samplerCache;
-			std::shared_ptr<nzsl::FilesystemModuleResolver> m_shaderModuleResolver;
+			std::filesystem::path m_pipelineCacheDirectory;
+			std::shared_ptr<ThreadSafeModuleResolver> m_shaderModuleResolver;
+			std::shared_ptr<RenderBufferPool> m_worldInstanceBufferPool;
 			std::shared_ptr<RenderDevice> m_renderDevice;
 			std::shared_ptr<RenderPipeline> m_blitPipeline;
 			std::shared_ptr<RenderPipeline> m_blitPipelineTransparent;
 			std::shared_ptr<RenderPipelineLayout> m_blitPipelineLayout;
+			std::shared_ptr<ComputePipeline> m_depthPyramidPipeline;
+			std::shared_ptr<ComputePipeline> m_drawCullingPipeline;
+			std::shared_ptr<ComputePipeline> m_drawOcclusionCullingPipeline;
+			std::shared_ptr<RenderPipelineLayout> m_depthPyramidPipelineLayout;
+			std::shared_ptr<RenderPipelineLayout> m_drawCullingPipelineLayout;
 			DefaultMaterials m_defaultMaterials;
 			DefaultTextures m_defaultTextures;
 			MaterialInstanceLoader m_materialInstanceLoader;
@@ -108,6 +140,7 @@ namespace Nz
 			MaterialPassRegistry m_materialPassRegistry;
 			PixelFormat m_preferredDepthFormat;
 			PixelFormat m_preferredDepthStencilFormat;
+			bool m_gpuDrivenRendering;
 
 			static Graphics* s_instance;
 	};
@@ -6,6 +6,19 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns the bindless texture table, or a null pointer if bindless textures are not supported (or disabled)
+	*/
+	inline BindlessTextureTable* Graphics::GetBindlessTextureTable()
+	{
+		return (m_bindlessTextureTable) ? &*m_bindlessTextureTable : nullptr;
+	}
+
+	inline const BindlessTextureTable* Graphics::GetBindlessTextureTable() const
+	{
+		return (m_bindlessTextureTable) ? &*m_bindlessTextureTable : nullptr;
+	}
+
 	inline const std::shared_ptr<RenderPipeline>& Graphics::GetBlitPipeline(bool transparent) const
 	{
 		return (transparent) ? m_blitPipelineTransparent : m_blitPipeline;
@@ -26,6 +39,36 @@ namespace Nz
 		return m_defaultTextures;
 	}
 
+	/*!
+	* \brief Returns the compute pipeline building depth pyramids, or a null pointer if occlusion culling isn't supported
+	*
+	* Occlusion culling requires GPU-driven rendering and storage textures (textureReadWrite feature).
+	*/
+	inline const std::shared_ptr<ComputePipeline>& Graphics::GetDepthPyramidPipeline() const
+	{
+		return m_depthPyramidPipeline;
+	}
+
+	inline const std::shared_ptr<RenderPipelineLayout>& Graphics::GetDepthPyramidPipelineLayout() const
+	{
+		return m_depthPyramidPipelineLayout;
+	}
+
+	/*!
+	* \brief Returns the compute pipeline culling indirect draws, or a null pointer if GPU-driven rendering is disabled
+	*
+	* \param occlusionCulling Whether the pipeline also tests draws against a depth pyramid (bound to set 1), which may not be supported (see GetDepthPyramidPipeline)
+	*/
+	inline const std::shared_ptr<ComputePipeline>& Graphics::GetDrawCullingPipeline(bool occlusionCulling) const
+	{
+		return (occlusionCulling) ? m_drawOcclusionCullingPipeline : m_drawCullingPipeline;
+	}
+
+	inline const std::shared_ptr<RenderPipelineLayout>& Graphics::GetDrawCullingPipelineLayout() const
+	{
+		return m_drawCullingPipelineLayout;
+	}
+
 	inline MaterialPassRegistry& Graphics::GetMaterialPassRegistry()
 	{
 		return m_materialPassRegistry;
@@ -82,15 +125,31 @@ namespace Nz
 		return *m_samplerCache;
 	}
 
-	inline std::shared_ptr<nzsl::FilesystemModuleResolver>& Graphics::GetShaderModuleResolver()
+	inline std::shared_ptr<ThreadSafeModuleResolver>& Graphics::GetShaderModuleResolver()
 	{
 		return m_shaderModuleResolver;
 	}
 
-	inline const std::shared_ptr<nzsl::FilesystemModuleResolver>& Graphics::GetShaderModuleResolver() const
+	inline const std::shared_ptr<ThreadSafeModuleResolver>& Graphics::GetShaderModuleResolver() const
 	{
 		return m_shaderModuleResolver;
 	}
+
+	inline const std::shared_ptr<RenderBufferPool>& Graphics::GetWorldInstanceBufferPool() const
+	{
+		return m_worldInstanceBufferPool;
+	}
+
+	/*!
+	* \brief Returns true if viewer passes cull their draws on the GPU
+	*
+	* When enabled, materials read their instance data from the world instance buffer using the instance index (IndexedInstanceData option)
+	* and viewer passes render their draws through indirect commands written by the draw culling compute shader.
+	*/
+	inline bool Graphics::IsGpuDrivenRenderingEnabled() const
+	{
+		return m_gpuDrivenRendering;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
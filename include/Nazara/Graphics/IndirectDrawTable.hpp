@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_INDIRECTDRAWTABLE_HPP
+#define NAZARA_GRAPHICS_INDIRECTDRAWTABLE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Renderer/ShaderBinding.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class DepthPyramid;
+	class RenderBuffer;
+	class RenderDevice;
+	class RenderFrame;
+	class ViewerInstance;
+	class WorldInstance;
+
+	class NAZARA_GRAPHICS_API IndirectDrawTable
+	{
+		public:
+			IndirectDrawTable(std::shared_ptr<RenderDevice> renderDevice);
+			IndirectDrawTable(const IndirectDrawTable&) = delete;
+			IndirectDrawTable(IndirectDrawTable&&) = delete;
+			~IndirectDrawTable() = default;
+
+			std::size_t AddIndexedDraw(const WorldInstance& worldInstance, const Boxf& aabb, UInt32 indexCount, UInt32 firstIndex, Int32 vertexOffset = 0);
+
+			void Clear(RenderFrame& renderFrame);
+			void Cull(RenderFrame& renderFrame, const DepthPyramid* depthPyramid = nullptr);
+
+			inline UInt64 GetCommandOffset(std::size_t drawIndex) const;
+			inline UInt32 GetCommandStride() const;
+			inline std::size_t GetDrawCount() const;
+			inline const RenderBuffer& GetIndirectBuffer() const;
+
+			void Upload(RenderFrame& renderFrame, const ViewerInstance& viewerInstance);
+
+			IndirectDrawTable& operator=(const IndirectDrawTable&) = delete;
+			IndirectDrawTable& operator=(IndirectDrawTable&&) = delete;
+
+			static constexpr UInt32 CullingWorkgroupSize = 64;
+
+		private:
+			struct Draw
+			{
+				Boxf aabb;
+				UInt32 commandIndex;
+				UInt32 firstIndex;
+				UInt32 indexCount;
+				UInt32 instanceIndex;
+				Int32 vertexOffset;
+			};
+
+			// Draws whose world instances share the same instance buffer, culled by a single dispatch
+			struct InstanceBlock
+			{
+				RenderBuffer* instanceBuffer;
+				ShaderBindingPtr shaderBinding;
+				std::vector<Draw> draws;
+				UInt64 drawDataOffset = 0;
+			};
+
+			struct DrawDataLayout
+			{
+				std::size_t aabbMaxOffset;
+				std::size_t aabbMinOffset;
+				std::size_t commandIndexOffset;
+				std::size_t drawCountOffset;
+				std::size_t drawSize;
+				std::size_t drawsOffset;
+				std::size_t firstIndexOffset;
+				std::size_t indexCountOffset;
+				std::size_t instanceIndexOffset;
+				std::size_t vertexOffsetOffset;
+			};
+
+			std::shared_ptr<RenderBuffer> m_drawDataBuffer;
+			std::shared_ptr<RenderBuffer> m_indirectBuffer;
+			std::shared_ptr<RenderDevice> m_renderDevice;
+			std::size_t m_drawCount;
+			std::unordered_map<const RenderBuffer*, std::size_t> m_blockByInstanceBuffer;
+			std::vector<InstanceBlock> m_instanceBlocks;
+			DrawDataLayout m_drawDataLayout;
+			UInt32 m_commandStride;
+	};
+}
+
+#include <Nazara/Graphics/IndirectDrawTable.inl>
+
+#endif // NAZARA_GRAPHICS_INDIRECTDRAWTABLE_HPP
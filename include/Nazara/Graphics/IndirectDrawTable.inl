@@ -0,0 +1,43 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Returns the offset of a draw command in the indirect buffer
+	*
+	* Draws added consecutively have consecutive commands, which can be drawn using a single indirect draw with GetCommandStride as stride.
+	*/
+	inline UInt64 IndirectDrawTable::GetCommandOffset(std::size_t drawIndex) const
+	{
+		assert(drawIndex < m_drawCount);
+		return drawIndex * m_commandStride;
+	}
+
+	inline UInt32 IndirectDrawTable::GetCommandStride() const
+	{
+		return m_commandStride;
+	}
+
+	inline std::size_t IndirectDrawTable::GetDrawCount() const
+	{
+		return m_drawCount;
+	}
+
+	/*!
+	* \brief Returns the buffer holding the draw commands written by Cull
+	*
+	* The buffer is only valid after a call to Upload and may change on each call.
+	*/
+	inline const RenderBuffer& IndirectDrawTable::GetIndirectBuffer() const
+	{
+		assert(m_indirectBuffer);
+		return *m_indirectBuffer;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
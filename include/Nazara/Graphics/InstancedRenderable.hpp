@@ -13,6 +13,7 @@
 #include <Nazara/Math/Box.hpp>
 #include <NazaraUtils/Signal.hpp>
 #include <memory>
+#include <vector>
 
 namespace Nz
 {
@@ -36,10 +37,14 @@ namespace Nz
 			virtual void BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const = 0;
 
 			inline const Boxf& GetAABB() const;
+			inline std::size_t GetLodCount() const;
+			inline const std::vector<float>& GetLodScreenSizes() const;
 			virtual const std::shared_ptr<MaterialInstance>& GetMaterial(std::size_t i) const = 0;
 			virtual std::size_t GetMaterialCount() const = 0;
 			inline int GetRenderLayer() const;
 
+			std::size_t SelectLod(float screenSize, std::size_t currentLod = 0, float hysteresis = 0.f) const;
+
 			inline void UpdateRenderLayer(int renderLayer);
 
 			InstancedRenderable& operator=(const InstancedRenderable&) = delete;
@@ -54,12 +59,15 @@ namespace Nz
 				const Recti* scissorBox;
 				const SkeletonInstance* skeletonInstance;
 				const WorldInstance* worldInstance;
+				std::size_t lodIndex = 0;
 			};
 
 		protected:
 			inline void UpdateAABB(Boxf aabb);
+			inline void UpdateLodScreenSizes(std::vector<float> lodScreenSizes);
 
 		private:
+			std::vector<float> m_lodScreenSizes;
 			Boxf m_aabb;
 			int m_renderLayer;
 	};
@@ -17,6 +17,24 @@ namespace Nz
 		return m_aabb;
 	}
 
+	/*!
+	* \brief Returns the number of levels of detail of the renderable, including the most detailed one
+	*/
+	inline std::size_t InstancedRenderable::GetLodCount() const
+	{
+		return m_lodScreenSizes.size() + 1;
+	}
+
+	/*!
+	* \brief Returns the screen sizes below which each level of detail (starting from the second one) is used
+	*
+	* Screen size is the projected bounding sphere diameter relative to the viewport height.
+	*/
+	inline const std::vector<float>& InstancedRenderable::GetLodScreenSizes() const
+	{
+		return m_lodScreenSizes;
+	}
+
 	inline int InstancedRenderable::GetRenderLayer() const
 	{
 		return m_renderLayer;
@@ -36,6 +54,11 @@ namespace Nz
 		OnAABBUpdate(this, aabb);
 		m_aabb = aabb;
 	}
+
+	inline void InstancedRenderable::UpdateLodScreenSizes(std::vector<float> lodScreenSizes)
+	{
+		m_lodScreenSizes = std::move(lodScreenSizes);
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
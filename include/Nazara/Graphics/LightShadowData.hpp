@@ -9,38 +9,81 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <vector>
 
 namespace Nz
 {
+	class AbstractViewer;
 	class BakedFrameGraph;
+	class DepthPipelinePass;
 	class FrameGraph;
 	class FramePass;
+	class FramePipeline;
+	class InstancedRenderable;
 	class MaterialInstance;
 	class RenderFrame;
 	class Texture;
+	class WorldInstance;
 
 	class NAZARA_GRAPHICS_API LightShadowData
 	{
 		public:
-			LightShadowData() = default;
+			inline LightShadowData();
 			LightShadowData(const LightShadowData&) = delete;
 			LightShadowData(LightShadowData&&) = delete;
 			virtual ~LightShadowData();
 
-			virtual void PrepareRendering(RenderFrame& renderFrame) = 0;
+			virtual void FillLightData(void* data, const AbstractViewer* viewer) const;
+
+			virtual void InvalidateShadowmaps();
+
+			inline bool IsPerViewer() const;
+
+			virtual void PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* viewer) = 0;
 
 			virtual void RegisterMaterialInstance(const MaterialInstance& matInstance) = 0;
-			virtual void RegisterPassInputs(FramePass& pass) = 0;
-			virtual void RegisterToFrameGraph(FrameGraph& frameGraph) = 0;
+			virtual void RegisterPassInputs(FramePass& pass, const AbstractViewer* viewer) = 0;
+			virtual void RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* viewer) = 0;
+			virtual void RegisterViewer(const AbstractViewer* viewer);
 
-			virtual const Texture* RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph) const = 0;
+			virtual const Texture* RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* viewer) const = 0;
 
 			virtual void UnregisterMaterialInstance(const MaterialInstance& matInstance) = 0;
+			virtual void UnregisterViewer(const AbstractViewer* viewer);
 
 			LightShadowData& operator=(const LightShadowData&) = delete;
 			LightShadowData& operator=(LightShadowData&&) = delete;
 
+			NazaraSignal(OnShadowDataInvalidated, LightShadowData* /*shadowData*/, const AbstractViewer* /*viewer*/);
+
+			struct NAZARA_GRAPHICS_API ShadowmapCache
+			{
+				struct CasterState
+				{
+					const InstancedRenderable* instancedRenderable;
+					const WorldInstance* worldInstance;
+					Matrix4f worldMatrix;
+				};
+
+				bool IsUpToDate(const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash) const;
+
+				void Update(const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash);
+
+				std::size_t visibilityHash = 0;
+				std::vector<CasterState> casters;
+				bool isValid = false;
+			};
+
+		protected:
+			inline void UpdatePerViewerStatus(bool isPerViewer);
+
+			static void PrepareCachedShadowmap(RenderFrame& renderFrame, FramePipeline& pipeline, DepthPipelinePass& depthPass, const AbstractViewer& shadowViewer, ShadowmapCache& cache);
+
 		private:
+			bool m_isPerViewer;
 	};
 }
 
@@ -6,6 +6,23 @@
 
 namespace Nz
 {
+	inline LightShadowData::LightShadowData() :
+	m_isPerViewer(false)
+	{
+	}
+
+	/*!
+	* \brief Returns true if this shadow data depends on the viewer (and has to be prepared for each of them)
+	*/
+	inline bool LightShadowData::IsPerViewer() const
+	{
+		return m_isPerViewer;
+	}
+
+	inline void LightShadowData::UpdatePerViewerStatus(bool isPerViewer)
+	{
+		m_isPerViewer = isPerViewer;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
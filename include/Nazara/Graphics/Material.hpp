@@ -54,6 +54,7 @@ namespace Nz
 			inline std::size_t FindTextureByTag(const std::string& tag) const;
 			inline std::size_t FindUniformBlockByTag(const std::string& tag) const;
 
+			inline UInt32 GetBindlessTextureSet() const;
 			inline UInt32 GetEngineBindingIndex(EngineShaderBinding shaderBinding) const;
 			inline const std::shared_ptr<RenderPipelineLayout>& GetRenderPipelineLayout() const;
 			inline const MaterialSettings& GetSettings() const;
@@ -101,6 +102,7 @@ namespace Nz
 			EnumArray<EngineShaderBinding, UInt32> m_engineShaderBindings;
 			MaterialSettings m_settings;
 			ShaderReflection m_reflection;
+			UInt32 m_bindlessTextureSet;
 	};
 }
 
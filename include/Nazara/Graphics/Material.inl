@@ -24,6 +24,14 @@ namespace Nz
 		return it->second;
 	}
 
+	/*!
+	* \brief Returns the set at which the bindless texture table has to be bound, or InvalidBindingIndex if the material doesn't use it
+	*/
+	inline UInt32 Material::GetBindlessTextureSet() const
+	{
+		return m_bindlessTextureSet;
+	}
+
 	inline UInt32 Material::GetEngineBindingIndex(EngineShaderBinding shaderBinding) const
 	{
 		return m_engineShaderBindings[shaderBinding];
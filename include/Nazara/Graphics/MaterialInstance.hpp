@@ -8,6 +8,7 @@
 #define NAZARA_GRAPHICS_MATERIALINSTANCE_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/BindlessTextureTable.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/Enums.hpp>
 #include <Nazara/Graphics/MaterialSettings.hpp>
@@ -107,6 +108,7 @@ namespace Nz
 			template<typename F> void UpdatePassesStates(std::initializer_list<std::size_t> passesIndex, F&& stateUpdater);
 			template<typename F> void UpdatePassesStates(F&& stateUpdater, bool ignoreDisabled = true);
 
+			UInt32 UpdateBindlessTexture(std::size_t textureIndex, std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> textureSampler);
 			void UpdateTextureBinding(std::size_t textureBinding, std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> textureSampler);
 			void UpdateUniformBufferData(std::size_t uniformBufferIndex, std::size_t offset, std::size_t size, const void* data);
 
@@ -139,11 +141,19 @@ namespace Nz
 			{
 				mutable MaterialPipelineInfo pipelineInfo;
 				mutable std::shared_ptr<MaterialPipeline> pipeline;
+				mutable NazaraSlot(MaterialPipeline, OnRenderPipelineReady, onRenderPipelineReady);
 				std::vector<PassShader> shaders;
 				MaterialPassFlags flags;
 				bool enabled = false;
 			};
 
+			struct BindlessTexture
+			{
+				std::shared_ptr<Texture> texture;
+				std::shared_ptr<TextureSampler> sampler;
+				UInt32 tableIndex = BindlessTextureTable::DefaultTextureIndex;
+			};
+
 			struct TextureBinding
 			{
 				std::shared_ptr<Texture> texture;
@@ -167,6 +177,7 @@ namespace Nz
 			std::shared_ptr<const Material> m_parent;
 			std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> m_optionValuesOverride;
 			std::vector<MaterialSettings::Value> m_valueOverride;
+			std::vector<BindlessTexture> m_bindlessTextures;
 			std::vector<PassData> m_passes;
 			std::vector<TextureBinding> m_textureBinding;
 			std::vector<TextureProperty> m_textureOverride;
@@ -13,12 +13,16 @@
 #include <Nazara/Graphics/UberShader.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <NazaraUtils/FixedVector.hpp>
+#include <NazaraUtils/Signal.hpp>
 #include <NZSL/Ast/ConstantValue.hpp>
 #include <array>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
+	class RenderPass;
 	class UberShader;
 
 	struct MaterialPipelineInfo : RenderStates
@@ -53,7 +57,7 @@ namespace Nz
 			inline MaterialPipeline(const MaterialPipelineInfo& pipelineInfo, Token);
 			MaterialPipeline(const MaterialPipeline&) = delete;
 			MaterialPipeline(MaterialPipeline&&) = delete;
-			~MaterialPipeline() = default;
+			~MaterialPipeline();
 
 			MaterialPipeline& operator=(const MaterialPipeline&) = delete;
 			MaterialPipeline& operator=(MaterialPipeline&&) = delete;
@@ -61,23 +65,55 @@ namespace Nz
 			inline const MaterialPipelineInfo& GetInfo() const;
 			const std::shared_ptr<RenderPipeline>& GetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const;
 
+			void Prewarm(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, const RenderPass* renderPass = nullptr, std::size_t subpassIndex = 0) const;
+
 			static const std::shared_ptr<MaterialPipeline>& Get(const MaterialPipelineInfo& pipelineInfo);
+			static void UpdatePendingPipelines();
+
+			NazaraSignal(OnRenderPipelineReady, const MaterialPipeline* /*materialPipeline*/);
 
 		private:
-			static bool Initialize();
+			using VertexBufferList = std::vector<RenderPipelineInfo::VertexBufferData>;
+
+			std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> BuildOptionValues() const;
+			const std::shared_ptr<RenderPipeline>& BuildRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, bool allowAsync) const;
+			bool CheckPendingPipelines() const;
+			const std::shared_ptr<RenderPipeline>* FindRenderPipeline(const std::unordered_multimap<std::size_t, std::shared_ptr<RenderPipeline>>& pipelines, std::size_t layoutHash, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const;
+
+			static bool Initialize(bool asyncCompilation);
 			static void Uninitialize();
+			static std::size_t HashVertexBuffers(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount);
+			static bool IsSameVertexBuffers(const VertexBufferList& lhs, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount);
+
+			struct PendingPipeline
+			{
+				struct ShaderConfig
+				{
+					UberShader* uberShader;
+					UberShader::Config config;
+				};
+
+				std::size_t layoutHash;
+				std::vector<ShaderConfig> shaderConfigs;
+				VertexBufferList vertexBuffers;
+			};
 
 			struct UberShaderEntry
 			{
 				NazaraSlot(UberShader, OnShaderUpdated, onShaderUpdated);
 			};
 
-			mutable std::vector<std::shared_ptr<RenderPipeline>> m_renderPipelines;
+			// Indexed by the hash of their vertex buffers
+			mutable std::unordered_multimap<std::size_t, std::shared_ptr<RenderPipeline>> m_fallbackPipelines;
+			mutable std::unordered_multimap<std::size_t, std::shared_ptr<RenderPipeline>> m_renderPipelines;
+			mutable std::vector<PendingPipeline> m_pendingPipelines;
 			std::vector<UberShaderEntry> m_uberShaderEntries;
 			MaterialPipelineInfo m_pipelineInfo;
 
 			using PipelineCache = std::unordered_map<MaterialPipelineInfo, std::shared_ptr<MaterialPipeline>>;
 			static PipelineCache s_pipelineCache;
+			static std::vector<const MaterialPipeline*> s_pendingMaterialPipelines;
+			static bool s_asyncCompilation;
 	};
 }
 
@@ -18,6 +18,8 @@ namespace Nz
 			m_uberShaderEntries[i].onShaderUpdated.Connect(m_pipelineInfo.shaders[i].uberShader->OnShaderUpdated, [this](UberShader*)
 			{
 				// Clear cache
+				m_fallbackPipelines.clear();
+				m_pendingPipelines.clear();
 				m_renderPipelines.clear();
 			});
 		}
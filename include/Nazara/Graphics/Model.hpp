@@ -32,18 +32,22 @@ namespace Nz
 
 			const std::shared_ptr<RenderBuffer>& GetIndexBuffer(std::size_t subMeshIndex) const;
 			std::size_t GetIndexCount(std::size_t subMeshIndex) const;
+			inline float GetLodMaxScreenError() const;
 			const std::shared_ptr<MaterialInstance>& GetMaterial(std::size_t subMeshIndex) const override;
 			std::size_t GetMaterialCount() const override;
 			inline std::size_t GetSubMeshCount() const;
 			const std::vector<RenderPipelineInfo::VertexBufferData>& GetVertexBufferData(std::size_t subMeshIndex) const;
 			const std::shared_ptr<RenderBuffer>& GetVertexBuffer(std::size_t subMeshIndex) const;
 
+			void SetLodMaxScreenError(float maxScreenError);
 			inline void SetMaterial(std::size_t subMeshIndex, std::shared_ptr<MaterialInstance> material);
 
 			Model& operator=(const Model&) = delete;
 			Model& operator=(Model&&) noexcept = default;
 
 		private:
+			void UpdateLods();
+
 			struct SubMeshData
 			{
 				std::shared_ptr<MaterialInstance> material;
@@ -54,6 +58,7 @@ namespace Nz
 
 			std::shared_ptr<GraphicalMesh> m_graphicalMesh;
 			std::vector<SubMeshData> m_submeshes;
+			float m_lodMaxScreenError;
 	};
 }
 
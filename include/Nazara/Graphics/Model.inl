@@ -7,6 +7,14 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns the maximum geometric error (relative to the viewport height) allowed when selecting a level of detail
+	*/
+	inline float Model::GetLodMaxScreenError() const
+	{
+		return m_lodMaxScreenError;
+	}
+
 	inline std::size_t Model::GetSubMeshCount() const
 	{
 		return m_submeshes.size();
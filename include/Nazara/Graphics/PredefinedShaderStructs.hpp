@@ -25,6 +25,7 @@ namespace Nz
 			std::size_t parameter3;
 			std::size_t shadowMapSize;
 			std::size_t viewProjMatrix;
+			std::size_t cascadeViewProjMatrices;
 		};
 
 		std::size_t lightsOffset;
@@ -33,6 +34,7 @@ namespace Nz
 		std::size_t totalSize;
 		Light lightMemberOffsets;
 
+		static constexpr std::size_t MaxCascadeCount = 4;
 		static constexpr std::size_t MaxLightCount = 3;
 
 		static PredefinedLightData GetOffsets();
@@ -34,6 +34,8 @@ namespace Nz
 			TexturePropertyHandler& operator=(TexturePropertyHandler&&) = delete;
 
 		private:
+			std::size_t m_bindlessIndexBlockIndex;
+			std::size_t m_bindlessIndexOffset;
 			std::size_t m_propertyIndex;
 			std::size_t m_textureIndex;
 			std::string m_optionName;
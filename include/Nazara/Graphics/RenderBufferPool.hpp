@@ -15,13 +15,17 @@
 
 namespace Nz
 {
+	class CommandBufferBuilder;
 	class RenderBuffer;
 	class RenderDevice;
+	class RenderFrame;
 
 	class NAZARA_GRAPHICS_API RenderBufferPool
 	{
 		public:
-			RenderBufferPool(std::shared_ptr<RenderDevice> renderDevice, BufferType bufferType, std::size_t bufferSize, std::size_t bufferPerBlock = 2048);
+			struct TransferStats;
+
+			RenderBufferPool(std::shared_ptr<RenderDevice> renderDevice, BufferType bufferType, std::size_t bufferSize, std::size_t bufferPerBlock = 2048, BufferUsageFlags bufferUsage = BufferUsage::DeviceLocal);
 			RenderBufferPool(const RenderBufferPool&) = delete;
 			RenderBufferPool(RenderBufferPool&&) = delete;
 			~RenderBufferPool() = default;
@@ -34,18 +38,40 @@ namespace Nz
 			inline UInt64 GetBufferPerBlock() const;
 			inline UInt64 GetBufferSize() const;
 			inline BufferType GetBufferType() const;
+			inline BufferUsageFlags GetBufferUsage() const;
+			inline const TransferStats& GetTransferStats() const;
+
+			inline bool HasPendingUploads() const;
+
+			void* QueueUpload(std::size_t index);
+
+			inline void ResetTransferStats();
+
+			void Transfer(RenderFrame& renderFrame, CommandBufferBuilder& builder);
 
 			RenderBufferPool& operator=(const RenderBufferPool&) = delete;
 			RenderBufferPool& operator=(RenderBufferPool&&) = delete;
 
+			struct TransferStats
+			{
+				UInt64 copyCount = 0;
+				UInt64 transferCount = 0;
+				UInt64 uploadedBufferCount = 0;
+				UInt64 uploadedSize = 0;
+			};
+
 		private:
 			UInt64 m_bufferAlignedSize;
 			UInt64 m_bufferPerBlock;
 			UInt64 m_bufferSize;
 			std::shared_ptr<RenderDevice> m_renderDevice;
 			std::vector<std::shared_ptr<RenderBuffer>> m_bufferBlocks;
+			std::vector<UInt8> m_uploadData;
 			Bitset<UInt64> m_availableEntries;
+			Bitset<UInt64> m_pendingUploads;
 			BufferType m_bufferType;
+			BufferUsageFlags m_bufferUsage;
+			TransferStats m_transferStats;
 	};
 }
 
@@ -25,6 +25,26 @@ namespace Nz
 	{
 		return m_bufferType;
 	}
+
+	inline BufferUsageFlags RenderBufferPool::GetBufferUsage() const
+	{
+		return m_bufferUsage;
+	}
+
+	inline auto RenderBufferPool::GetTransferStats() const -> const TransferStats&
+	{
+		return m_transferStats;
+	}
+
+	inline bool RenderBufferPool::HasPendingUploads() const
+	{
+		return m_pendingUploads.TestAny();
+	}
+
+	inline void RenderBufferPool::ResetTransferStats()
+	{
+		m_transferStats = TransferStats{};
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -37,6 +37,7 @@ namespace Nz
 			inline const Vector3f& GetPosition() const;
 			inline const Quaternionf& GetRotation() const;
 			inline float GetRadius() const;
+			inline const Matrix4f& GetViewProjMatrix() const;
 
 			std::unique_ptr<LightShadowData> InstanciateShadowData(FramePipeline& pipeline, ElementRendererRegistry& elementRegistry) const override;
 
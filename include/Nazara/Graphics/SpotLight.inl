@@ -66,6 +66,14 @@ namespace Nz
 		return m_radius;
 	}
 
+	/*!
+	* \brief Returns the matrix transforming world positions to shadowmap texture coordinates
+	*/
+	inline const Matrix4f& SpotLight::GetViewProjMatrix() const
+	{
+		return m_viewProjMatrix;
+	}
+
 	inline void SpotLight::UpdateAmbientFactor(float factor)
 	{
 		m_ambientFactor = factor;
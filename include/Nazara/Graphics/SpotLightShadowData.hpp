@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/Light.hpp>
 #include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/ShadowViewer.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -26,28 +27,46 @@ namespace Nz
 			SpotLightShadowData(SpotLightShadowData&&) = delete;
 			~SpotLightShadowData() = default;
 
-			void PrepareRendering(RenderFrame& renderFrame) override;
+			void FillLightData(void* data, const AbstractViewer* viewer) const override;
+
+			inline UInt32 GetShadowMapResolution() const;
+
+			void InvalidateShadowmaps() override;
+
+			void PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* viewer) override;
 
 			void RegisterMaterialInstance(const MaterialInstance& matInstance) override;
-			void RegisterPassInputs(FramePass& pass) override;
-			void RegisterToFrameGraph(FrameGraph& frameGraph) override;
+			void RegisterPassInputs(FramePass& pass, const AbstractViewer* viewer) override;
+			void RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* viewer) override;
+			void RegisterViewer(const AbstractViewer* viewer) override;
 
-			const Texture* RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph) const override;
+			const Texture* RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* viewer) const override;
 
 			void UnregisterMaterialInstance(const MaterialInstance& matInstance) override;
+			void UnregisterViewer(const AbstractViewer* viewer) override;
 
 			SpotLightShadowData& operator=(const SpotLightShadowData&) = delete;
 			SpotLightShadowData& operator=(SpotLightShadowData&&) = delete;
 
+			static UInt32 ComputeShadowMapResolution(UInt32 currentResolution, UInt32 maxResolution, float projectedSize);
+
+			static constexpr UInt32 MinShadowMapResolution = 128;
+
 		private:
+			float ComputeProjectedSize() const;
+			void UpdateShadowMapResolution(UInt32 resolution);
+
 			NazaraSlot(Light, OnLightShadowMapSettingChange, m_onLightShadowMapSettingChange);
 			NazaraSlot(Light, OnLightTransformInvalided, m_onLightTransformInvalidated);
 
 			std::optional<DepthPipelinePass> m_depthPass;
 			std::size_t m_attachmentIndex;
+			std::vector<const AbstractViewer*> m_viewers;
+			ShadowmapCache m_shadowmapCache;
 			FramePipeline& m_pipeline;
 			const SpotLight& m_light;
 			ShadowViewer m_viewer;
+			UInt32 m_shadowMapResolution;
 	};
 }
 
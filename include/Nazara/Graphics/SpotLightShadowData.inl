@@ -6,6 +6,13 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns the resolution shadows are currently rendered at, within the light shadowmap
+	*/
+	inline UInt32 SpotLightShadowData::GetShadowMapResolution() const
+	{
+		return m_shadowMapResolution;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -19,6 +19,7 @@
 
 namespace Nz
 {
+	class IndirectDrawTable;
 	class RenderDevice;
 	class RenderPipeline;
 	class ShaderBinding;
@@ -36,6 +37,11 @@ namespace Nz
 			std::size_t firstIndex;
 			std::size_t quadCount;
 			Recti scissorBox;
+			Boxf aabb; //< union of the local bounding boxes of the drawn sprite chains
+			IndirectDrawTable* indirectDrawTable; //< if set, the draw command is read from the table
+			const WorldInstance* worldInstance;
+			std::size_t indirectDrawIndex;
+			UInt32 firstInstance;
 		};
 
 		struct DrawCallIndices
@@ -15,6 +15,7 @@
 
 namespace Nz
 {
+	class IndirectDrawTable;
 	class RenderPipeline;
 	class ShaderBinding;
 
@@ -41,11 +42,15 @@ namespace Nz
 	{
 		struct DrawCall
 		{
+			const IndirectDrawTable* indirectDrawTable; //< if set, the draw command is read from the table
 			const RenderBuffer* indexBuffer;
 			const RenderBuffer* vertexBuffer;
 			const RenderPipeline* renderPipeline;
 			const ShaderBinding* shaderBinding;
 			std::size_t firstIndex;
+			std::size_t indirectDrawIndex;
+			UInt32 bindlessTextureSet;
+			UInt32 firstInstance;
 			std::size_t indexCount;
 			IndexType indexType;
 			Recti scissorBox;
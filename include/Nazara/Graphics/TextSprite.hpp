@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <Nazara/Utility/AbstractAtlas.hpp>
+#include <Nazara/Utility/AbstractTextDrawer.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
 #include <array>
@@ -19,8 +20,6 @@
 
 namespace Nz
 {
-	class AbstractTextDrawer;
-
 	class NAZARA_GRAPHICS_API TextSprite : public InstancedRenderable
 	{
 		public:
@@ -44,6 +43,8 @@ namespace Nz
 			TextSprite& operator=(TextSprite&&) noexcept = default;
 
 		private:
+			void ClearEdgeMaterials();
+			const std::shared_ptr<MaterialInstance>& GetEdgeMaterial(float distanceFieldEdge) const;
 			void OnAtlasInvalidated(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
 
@@ -55,14 +56,21 @@ namespace Nz
 				NazaraSlot(AbstractAtlas, OnAtlasRelease, releaseSlot);
 			};
 
+			struct EdgeMaterial
+			{
+				float distanceFieldEdge;
+				std::shared_ptr<MaterialInstance> material;
+			};
+
 			struct RenderKey
 			{
 				Texture* texture;
 				int renderOrder;
+				float distanceFieldEdge;
 
 				bool operator==(const RenderKey& rhs) const
 				{
-					return texture == rhs.texture && renderOrder == rhs.renderOrder;
+					return texture == rhs.texture && renderOrder == rhs.renderOrder && distanceFieldEdge == rhs.distanceFieldEdge;
 				}
 
 				bool operator!=(const RenderKey& rhs) const
@@ -75,20 +83,36 @@ namespace Nz
 					if (renderOrder != rhs.renderOrder)
 						return renderOrder < rhs.renderOrder;
 
+					if (distanceFieldEdge != rhs.distanceFieldEdge)
+						return distanceFieldEdge < rhs.distanceFieldEdge;
+
 					return texture < rhs.texture;
 				}
 			};
 
-			struct RenderIndices
+			struct RenderData
 			{
-				unsigned int first;
-				unsigned int count;
+				std::vector<VertexStruct_XYZ_Color_UV> vertices;
 			};
 
-			mutable std::map<RenderKey, RenderIndices> m_renderInfos;
+			struct GlyphVertices
+			{
+				RenderData* renderData; //< nullptr for invisible glyphs
+				std::size_t firstVertex;
+			};
+
+			void GenerateGlyphVertices(const AbstractTextDrawer& drawer, std::size_t firstGlyph, std::size_t glyphCount, float textHeight, float scale);
+			void RemoveGlyphVertices(std::size_t firstGlyph);
+			void UpdateEdgeMaterials();
+
+			std::map<RenderKey, RenderData> m_renderData;
 			std::unordered_map<const AbstractAtlas*, AtlasSlots> m_atlases;
 			std::shared_ptr<MaterialInstance> m_material;
-			std::vector<VertexStruct_XYZ_Color_UV> m_vertices;
+			std::vector<EdgeMaterial> m_edgeMaterials; //< m_material variants rendering distance field outlines
+			std::vector<GlyphVertices> m_glyphVertices;
+			UInt64 m_drawerRevision;
+			float m_scale;
+			float m_textHeight;
 	};
 }
 
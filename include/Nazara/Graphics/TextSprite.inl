@@ -10,7 +10,10 @@ namespace Nz
 	inline void TextSprite::Clear()
 	{
 		m_atlases.clear();
-		m_vertices.clear();
+		m_glyphVertices.clear();
+		m_renderData.clear();
+		ClearEdgeMaterials();
+		m_drawerRevision = AbstractTextDrawer::UntrackedLayoutRevision;
 		OnElementInvalidated(this);
 	}
 
@@ -23,6 +26,10 @@ namespace Nz
 			OnMaterialInvalidated(this, 0, material);
 			m_material = std::move(material);
 
+			// Outline variants have to be cloned from the new material
+			ClearEdgeMaterials();
+			UpdateEdgeMaterials();
+
 			OnElementInvalidated(this);
 		}
 	}
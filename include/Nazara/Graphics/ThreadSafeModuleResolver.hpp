@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_THREADSAFEMODULERESOLVER_HPP
+#define NAZARA_GRAPHICS_THREADSAFEMODULERESOLVER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <NZSL/FilesystemModuleResolver.hpp>
+#include <shared_mutex>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API ThreadSafeModuleResolver : public nzsl::FilesystemModuleResolver
+	{
+		public:
+			ThreadSafeModuleResolver() = default;
+			ThreadSafeModuleResolver(const ThreadSafeModuleResolver&) = delete;
+			ThreadSafeModuleResolver(ThreadSafeModuleResolver&&) = delete;
+			~ThreadSafeModuleResolver() = default;
+
+			void RegisterModule(const std::filesystem::path& realPath);
+			void RegisterModule(std::string_view moduleSource);
+			void RegisterModule(nzsl::Ast::ModulePtr module);
+			void RegisterModuleDirectory(const std::filesystem::path& realPath, bool watchDirectory = false);
+
+			nzsl::Ast::ModulePtr Resolve(const std::string& moduleName) override;
+
+			ThreadSafeModuleResolver& operator=(const ThreadSafeModuleResolver&) = delete;
+			ThreadSafeModuleResolver& operator=(ThreadSafeModuleResolver&&) = delete;
+
+		private:
+			std::shared_mutex m_moduleMutex;
+	};
+}
+
+#endif // NAZARA_GRAPHICS_THREADSAFEMODULERESOLVER_HPP
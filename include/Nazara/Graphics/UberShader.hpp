@@ -9,16 +9,22 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <NazaraUtils/Signal.hpp>
 #include <NZSL/ModuleResolver.hpp>
+#include <NZSL/ShaderWriter.hpp>
 #include <NZSL/Ast/Module.hpp>
+#include <future>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
 	class ShaderModule;
+	class Stream;
 
 	class NAZARA_GRAPHICS_API UberShader
 	{
@@ -35,12 +41,19 @@ namespace Nz
 			inline nzsl::ShaderStageTypeFlags GetSupportedStages() const;
 
 			const std::shared_ptr<ShaderModule>& Get(const Config& config);
+			const std::shared_ptr<ShaderModule>& GetAsync(const Config& config);
+			std::vector<Config> GetCompiledConfigs() const;
 
 			inline bool HasOption(const std::string& optionName, Pointer<const Option>* option = nullptr) const;
 
+			void Prewarm(const std::vector<Config>& configs);
+
 			inline void UpdateConfig(Config& config, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers);
 			inline void UpdateConfigCallback(ConfigCallback callback);
 
+			static bool LoadManifest(Stream& stream, std::vector<Config>* configs);
+			static bool SaveManifest(Stream& stream, const std::vector<Config>& configs);
+
 			struct Config
 			{
 				std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues;
@@ -64,15 +77,23 @@ namespace Nz
 			NazaraSignal(OnShaderUpdated, UberShader* /*uberShader*/);
 
 		private:
+			nzsl::ShaderWriter::States BuildStates(const Config& config) const;
+			std::shared_ptr<ShaderModule> Compile(const Config& config) const;
 			nzsl::Ast::ModulePtr Validate(const nzsl::Ast::Module& module, std::unordered_map<std::string, Option>* options);
 
 			NazaraSlot(nzsl::ModuleResolver, OnModuleUpdated, m_onShaderModuleUpdated);
 
+			static constexpr UInt32 ManifestMagic = 0x4E5A554D; //< "NZUM"
+			static constexpr UInt32 ManifestVersion = 1;
+
 			std::unordered_map<Config, std::shared_ptr<ShaderModule>, ConfigHasher, ConfigEqual> m_combinations;
+			std::unordered_map<Config, std::future<std::shared_ptr<ShaderModule>>, ConfigHasher, ConfigEqual> m_pendingCombinations;
+			TaskGroup m_compilationTasks;
 			std::unordered_map<std::string, Option> m_optionIndexByName;
 			nzsl::Ast::ModulePtr m_shaderModule;
 			ConfigCallback m_configCallback;
 			nzsl::ShaderStageTypeFlags m_shaderStages;
+			mutable std::mutex m_mutex; //< guards m_combinations, m_pendingCombinations and m_shaderModule, as permutations can be retrieved from multiple threads
 	};
 }
 
@@ -11,13 +11,14 @@
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/TransferInterface.hpp>
 #include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Renderer/RenderBufferView.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
 #include <memory>
 
 namespace Nz
 {
 	class CommandBufferBuilder;
-	class RenderBuffer;
+	class RenderBufferPool;
 	class UploadPool;
 	class WorldInstance;
 
@@ -28,11 +29,11 @@ namespace Nz
 		public:
 			WorldInstance();
 			WorldInstance(const WorldInstance&) = delete;
-			WorldInstance(WorldInstance&&) noexcept = default;
-			~WorldInstance() = default;
+			WorldInstance(WorldInstance&&) = delete;
+			~WorldInstance();
 
-			inline std::shared_ptr<RenderBuffer>& GetInstanceBuffer();
-			inline const std::shared_ptr<RenderBuffer>& GetInstanceBuffer() const;
+			inline const RenderBufferView& GetInstanceBuffer() const;
+			inline UInt32 GetInstanceIndex() const;
 			inline const Matrix4f& GetInvWorldMatrix() const;
 			inline const Matrix4f& GetWorldMatrix() const;
 
@@ -42,12 +43,16 @@ namespace Nz
 			inline void UpdateWorldMatrix(const Matrix4f& worldMatrix, const Matrix4f& invWorldMatrix);
 
 			WorldInstance& operator=(const WorldInstance&) = delete;
-			WorldInstance& operator=(WorldInstance&&) noexcept = default;
+			WorldInstance& operator=(WorldInstance&&) = delete;
 
 		private:
 			inline void InvalidateData();
 
-			std::shared_ptr<RenderBuffer> m_instanceDataBuffer;
+			// Instance data of every world instance is suballocated from a shared pool and uploaded in a single batch
+			std::shared_ptr<RenderBufferPool> m_instanceDataPool;
+			std::size_t m_instanceDataIndex;
+			RenderBufferView m_instanceDataBuffer;
+			UInt32 m_instanceIndex;
 			Matrix4f m_invWorldMatrix;
 			Matrix4f m_worldMatrix;
 			bool m_dataInvalided;
@@ -7,14 +7,17 @@
 
 namespace Nz
 {
-	inline std::shared_ptr<RenderBuffer>& WorldInstance::GetInstanceBuffer()
+	inline const RenderBufferView& WorldInstance::GetInstanceBuffer() const
 	{
 		return m_instanceDataBuffer;
 	}
 
-	inline const std::shared_ptr<RenderBuffer>& WorldInstance::GetInstanceBuffer() const
+	/*!
+	* \brief Returns the index of the instance data in its instance buffer, as seen by shaders reading the whole buffer
+	*/
+	inline UInt32 WorldInstance::GetInstanceIndex() const
 	{
-		return m_instanceDataBuffer;
+		return m_instanceIndex;
 	}
 
 	inline const Matrix4f& WorldInstance::GetInvWorldMatrix() const
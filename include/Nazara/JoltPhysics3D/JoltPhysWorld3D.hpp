@@ -8,6 +8,7 @@
 #define NAZARA_JOLTPHYSICS3D_JOLTPHYSWORLD3D_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/JoltPhysics3D/Config.hpp>
 #include <Nazara/Math/Box.hpp>
@@ -61,6 +62,10 @@ namespace Nz
 
 			inline void RegisterStepListener(JoltPhysicsStepListener* character);
 
+			bool RestoreState(const ByteArray& state);
+
+			void SaveState(ByteArray& state);
+
 			void SetGravity(const Vector3f& gravity);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetStepSize(Time stepSize);
@@ -69,6 +74,9 @@ namespace Nz
 
 			inline void UnregisterStepListener(JoltPhysicsStepListener* character);
 
+			static bool ApplyStateDelta(const ByteArray& referenceState, const ByteArray& delta, ByteArray& state);
+			static void ComputeStateDelta(const ByteArray& referenceState, const ByteArray& state, ByteArray& delta);
+
 			JoltPhysWorld3D& operator=(const JoltPhysWorld3D&) = delete;
 			JoltPhysWorld3D& operator=(JoltPhysWorld3D&&) = delete;
 
@@ -87,6 +95,8 @@ namespace Nz
 			class StepListener;
 			friend StepListener;
 
+			class StateRecorder;
+
 			struct JoltWorld;
 
 			std::shared_ptr<JoltCharacterImpl> GetDefaultCharacterImpl();
@@ -94,6 +104,7 @@ namespace Nz
 
 			void OnPreStep(float deltatime);
 
+			void RefreshActiveBodies();
 			void RegisterBody(const JPH::BodyID& bodyID, bool activate, bool removeFromDeactivationList);
 
 			void UnregisterBody(const JPH::BodyID& bodyID, bool destroy, bool removeFromRegisterList);
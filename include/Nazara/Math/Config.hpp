@@ -39,6 +39,12 @@
 // also checks if transform calls are called on transform matrices
 #define NAZARA_MATH_MATRIX4_CHECK_TRANSFORM 0
 
+// Use SIMD instructions (SSE/AVX/NEON, depending on the target) for float matrix and quaternion operations evaluated at runtime
+// (disabled by default, enabled by the math_simd build option)
+#ifndef NAZARA_MATH_ENABLE_SIMD
+#define NAZARA_MATH_ENABLE_SIMD 0
+#endif
+
 // Enable tests of security based on the code (Advised for the development)
 #define NAZARA_MATH_SAFE 1
 
@@ -79,6 +79,8 @@ namespace Nz
 			constexpr Vector2<T> Transform(const Vector2<T>& vector, T z = 0.0, T w = 1.0) const;
 			constexpr Vector3<T> Transform(const Vector3<T>& vector, T w = 1.0) const;
 			constexpr Vector4<T> Transform(const Vector4<T>& vector) const;
+			constexpr void Transform(const Vector3<T>* vectors, std::size_t vectorCount, Vector3<T>* results, T w = 1.0) const;
+			constexpr void Transform(const Vector4<T>* vectors, std::size_t vectorCount, Vector4<T>* results) const;
 
 			constexpr Matrix4& Transpose();
 
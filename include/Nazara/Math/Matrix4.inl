@@ -8,6 +8,7 @@
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
 #include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/SIMD.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Math/Vector4.hpp>
@@ -15,6 +16,7 @@
 #include <limits>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -182,6 +184,17 @@ namespace Nz
 		}
 		#endif
 
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Detail::SimdMatrix4Multiply(&m11, &matrix.m11, &m11);
+				return *this;
+			}
+		}
+		#endif
+
 		return operator=(Matrix4(
 			m11 * matrix.m11 + m12 * matrix.m21 + m13 * matrix.m31 + m14 * matrix.m41,
 			m11 * matrix.m12 + m12 * matrix.m22 + m13 * matrix.m32 + m14 * matrix.m42,
@@ -232,6 +245,22 @@ namespace Nz
 		}
 		#endif
 
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Detail::SimdMatrix4Multiply(&m11, &matrix.m11, &m11);
+				m14 = T(0.0);
+				m24 = T(0.0);
+				m34 = T(0.0);
+				m44 = T(1.0);
+
+				return *this;
+			}
+		}
+		#endif
+
 		return operator=(Matrix4(
 			m11*matrix.m11 + m12*matrix.m21 + m13*matrix.m31,
 			m11*matrix.m12 + m12*matrix.m22 + m13*matrix.m32,
@@ -347,6 +376,14 @@ namespace Nz
 		}
 		#endif
 
+		#if defined(NAZARA_MATH_SIMD) && defined(NAZARA_MATH_SIMD_HAS_INVERSE)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+				return Detail::SimdMatrix4Inverse(&m11, &dest->m11);
+		}
+		#endif
+
 		T det = GetDeterminant();
 		if (det == T(0.0))
 			return false;
@@ -911,6 +948,19 @@ namespace Nz
 	template<typename T>
 	constexpr Vector3<T> Matrix4<T>::Transform(const Vector3<T>& vector, T w) const
 	{
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Vector3<T> result = Vector3<T>::Zero();
+				Detail::SimdMatrix4TransformVec3(&m11, &vector.x, 1, w, &result.x);
+
+				return result;
+			}
+		}
+		#endif
+
 		return Vector3<T>(m11 * vector.x + m21 * vector.y + m31 * vector.z + m41 * w,
 		                  m12 * vector.x + m22 * vector.y + m32 * vector.z + m42 * w,
 		                  m13 * vector.x + m23 * vector.y + m33 * vector.z + m43 * w);
@@ -925,12 +975,76 @@ namespace Nz
 	template<typename T>
 	constexpr Vector4<T> Matrix4<T>::Transform(const Vector4<T>& vector) const
 	{
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Vector4<T> result = Vector4<T>::Zero();
+				Detail::SimdMatrix4TransformVec4(&m11, &vector.x, 1, &result.x);
+
+				return result;
+			}
+		}
+		#endif
+
 		return Vector4<T>(m11 * vector.x + m21 * vector.y + m31 * vector.z + m41 * vector.w,
 		                  m12 * vector.x + m22 * vector.y + m32 * vector.z + m42 * vector.w,
 		                  m13 * vector.x + m23 * vector.y + m33 * vector.z + m43 * vector.w,
 		                  m14 * vector.x + m24 * vector.y + m34 * vector.z + m44 * vector.w);
 	}
 
+	/*!
+	* \brief Transforms an array of Vector3 and one component by the matrix
+	*
+	* \param vectors Vectors to transform
+	* \param vectorCount Number of vectors to transform
+	* \param results Array receiving the transformed vectors (can be the same as vectors)
+	* \param w W Component of the imaginary Vector4
+	*/
+	template<typename T>
+	constexpr void Matrix4<T>::Transform(const Vector3<T>* vectors, std::size_t vectorCount, Vector3<T>* results, T w) const
+	{
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Detail::SimdMatrix4TransformVec3(&m11, &vectors->x, vectorCount, w, &results->x);
+				return;
+			}
+		}
+		#endif
+
+		for (std::size_t i = 0; i < vectorCount; ++i)
+			results[i] = Transform(vectors[i], w);
+	}
+
+	/*!
+	* \brief Transforms an array of Vector4 by the matrix
+	*
+	* \param vectors Vectors to transform
+	* \param vectorCount Number of vectors to transform
+	* \param results Array receiving the transformed vectors (can be the same as vectors)
+	*/
+	template<typename T>
+	constexpr void Matrix4<T>::Transform(const Vector4<T>* vectors, std::size_t vectorCount, Vector4<T>* results) const
+	{
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!NAZARA_MATH_IS_CONSTANT_EVALUATED())
+			{
+				Detail::SimdMatrix4TransformVec4(&m11, &vectors->x, vectorCount, &results->x);
+				return;
+			}
+		}
+		#endif
+
+		for (std::size_t i = 0; i < vectorCount; ++i)
+			results[i] = Transform(vectors[i]);
+	}
+
 	/*!
 	* \brief Transposes the matrix
 	* \return A reference to this matrix transposed
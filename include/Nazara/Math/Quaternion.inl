@@ -5,10 +5,12 @@
 #include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/SIMD.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <cstring>
 #include <limits>
 #include <sstream>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -714,6 +716,16 @@ namespace Nz
 	template<typename T>
 	Quaternion<T> Quaternion<T>::Slerp(const Quaternion& from, const Quaternion& to, T interpolation)
 	{
+		#ifdef NAZARA_MATH_SIMD
+		if constexpr (std::is_same_v<T, float>)
+		{
+			Quaternion result;
+			Detail::SimdQuaternionSlerp(&from.w, &to.w, interpolation, &result.w);
+
+			return result;
+		}
+		#endif
+
 		Quaternion q;
 
 		T cosOmega = from.DotProduct(to);
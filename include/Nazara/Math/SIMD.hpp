@@ -0,0 +1,350 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MATH_SIMD_HPP
+#define NAZARA_MATH_SIMD_HPP
+
+#include <Nazara/Math/Config.hpp>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Instruction set detection, SIMD is only used when enabled in Config.hpp and when the compiler targets a supported instruction set
+#if NAZARA_MATH_ENABLE_SIMD
+	#if defined(__AVX__) || defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+		#define NAZARA_MATH_SIMD_SSE
+
+		#if defined(__AVX__)
+			#define NAZARA_MATH_SIMD_AVX
+			#include <immintrin.h>
+		#elif defined(__SSE4_1__)
+			#define NAZARA_MATH_SIMD_SSE4
+			#include <smmintrin.h>
+		#else
+			#include <xmmintrin.h>
+		#endif
+	#elif defined(__ARM_NEON) || defined(_M_ARM64)
+		#define NAZARA_MATH_SIMD_NEON
+		#include <arm_neon.h>
+	#endif
+
+	// SIMD code can't be used in constant expressions, we need to know when the compiler evaluates a constexpr function at compile-time
+	#if defined(__has_builtin)
+		#if __has_builtin(__builtin_is_constant_evaluated)
+			#define NAZARA_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+		#endif
+	#endif
+
+	#if !defined(NAZARA_MATH_IS_CONSTANT_EVALUATED) && ((defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925))
+		#define NAZARA_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+	#endif
+
+	#if defined(NAZARA_MATH_IS_CONSTANT_EVALUATED) && (defined(NAZARA_MATH_SIMD_SSE) || defined(NAZARA_MATH_SIMD_NEON))
+		#define NAZARA_MATH_SIMD
+	#endif
+#endif
+
+#ifdef NAZARA_MATH_SIMD
+
+// Shuffle mask as a type, allowing it to be passed to lambdas while still being a compile-time constant
+#define NazaraShuffleMask(x, y, z, w) std::integral_constant<int, (x) | ((y) << 2) | ((z) << 4) | ((w) << 6)>{}
+
+namespace Nz::Detail
+{
+	// All matrices are 16 floats stored row by row (as Matrix4), quaternions are stored as (w, x, y, z) and vectors as (x, y, z[, w])
+
+#if defined(NAZARA_MATH_SIMD_SSE)
+	inline __m128 SimdLoadVec3(const float* vec, float w)
+	{
+		return _mm_setr_ps(vec[0], vec[1], vec[2], w);
+	}
+
+	inline void SimdStoreVec3(float* dest, __m128 vec)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64*>(dest), vec);
+		_mm_store_ss(dest + 2, _mm_movehl_ps(vec, vec));
+	}
+
+	inline __m128 SimdTransformRow(__m128 row0, __m128 row1, __m128 row2, __m128 row3, __m128 vec)
+	{
+		__m128 result = _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+		result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+
+		return result;
+	}
+
+	inline void SimdMatrix4Multiply(const float* lhs, const float* rhs, float* result)
+	{
+	#ifdef NAZARA_MATH_SIMD_AVX
+		// Process two rows at once, each 128bits lane handling one row
+		auto BroadcastRow = [](const float* row)
+		{
+			__m128 rowValues = _mm_loadu_ps(row);
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(rowValues), rowValues, 1);
+		};
+
+		__m256 rhsRow0 = BroadcastRow(rhs + 0);
+		__m256 rhsRow1 = BroadcastRow(rhs + 4);
+		__m256 rhsRow2 = BroadcastRow(rhs + 8);
+		__m256 rhsRow3 = BroadcastRow(rhs + 12);
+
+		__m256 lhsRows01 = _mm256_loadu_ps(lhs + 0);
+		__m256 lhsRows23 = _mm256_loadu_ps(lhs + 8);
+
+		auto MultiplyRows = [&](__m256 lhsRows)
+		{
+			__m256 rows = _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+			rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1));
+			rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2));
+			rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3));
+
+			return rows;
+		};
+
+		_mm256_storeu_ps(result + 0, MultiplyRows(lhsRows01));
+		_mm256_storeu_ps(result + 8, MultiplyRows(lhsRows23));
+	#else
+		__m128 rhsRow0 = _mm_loadu_ps(rhs + 0);
+		__m128 rhsRow1 = _mm_loadu_ps(rhs + 4);
+		__m128 rhsRow2 = _mm_loadu_ps(rhs + 8);
+		__m128 rhsRow3 = _mm_loadu_ps(rhs + 12);
+
+		for (std::size_t i = 0; i < 16; i += 4)
+			_mm_storeu_ps(result + i, SimdTransformRow(rhsRow0, rhsRow1, rhsRow2, rhsRow3, _mm_loadu_ps(lhs + i)));
+	#endif
+	}
+
+	inline bool SimdMatrix4Inverse(const float* matrix, float* result)
+	{
+		// Block-wise inversion using 2x2 sub-matrices (A B / C D), see "Fast 4x4 Matrix Inverse with SSE SIMD, Explained" by Eric Zhang
+		auto Swizzle = [](__m128 vec, auto mask) { return _mm_shuffle_ps(vec, vec, decltype(mask)::value); };
+
+		// 2x2 row major matrix multiply lhs * rhs
+		auto Mat2Mul = [&](__m128 lhs, __m128 rhs)
+		{
+			return _mm_add_ps(_mm_mul_ps(lhs, Swizzle(rhs, NazaraShuffleMask(0, 3, 0, 3))), _mm_mul_ps(Swizzle(lhs, NazaraShuffleMask(1, 0, 3, 2)), Swizzle(rhs, NazaraShuffleMask(2, 1, 2, 1))));
+		};
+
+		// 2x2 row major matrix adjugate multiply adj(lhs) * rhs
+		auto Mat2AdjMul = [&](__m128 lhs, __m128 rhs)
+		{
+			return _mm_sub_ps(_mm_mul_ps(Swizzle(lhs, NazaraShuffleMask(3, 3, 0, 0)), rhs), _mm_mul_ps(Swizzle(lhs, NazaraShuffleMask(1, 1, 2, 2)), Swizzle(rhs, NazaraShuffleMask(2, 3, 0, 1))));
+		};
+
+		// 2x2 row major matrix multiply adjugate lhs * adj(rhs)
+		auto Mat2MulAdj = [&](__m128 lhs, __m128 rhs)
+		{
+			return _mm_sub_ps(_mm_mul_ps(lhs, Swizzle(rhs, NazaraShuffleMask(3, 0, 3, 0))), _mm_mul_ps(Swizzle(lhs, NazaraShuffleMask(1, 0, 3, 2)), Swizzle(rhs, NazaraShuffleMask(2, 1, 2, 1))));
+		};
+
+		__m128 row0 = _mm_loadu_ps(matrix + 0);
+		__m128 row1 = _mm_loadu_ps(matrix + 4);
+		__m128 row2 = _mm_loadu_ps(matrix + 8);
+		__m128 row3 = _mm_loadu_ps(matrix + 12);
+
+		__m128 A = _mm_movelh_ps(row0, row1);
+		__m128 B = _mm_movehl_ps(row1, row0);
+		__m128 C = _mm_movelh_ps(row2, row3);
+		__m128 D = _mm_movehl_ps(row3, row2);
+
+		// Determinants of sub-matrices as (|A| |B| |C| |D|)
+		__m128 detSub = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, NazaraShuffleMask(0, 2, 0, 2).value), _mm_shuffle_ps(row1, row3, NazaraShuffleMask(1, 3, 1, 3).value)),
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, NazaraShuffleMask(1, 3, 1, 3).value), _mm_shuffle_ps(row1, row3, NazaraShuffleMask(0, 2, 0, 2).value))
+		);
+
+		__m128 detA = Swizzle(detSub, NazaraShuffleMask(0, 0, 0, 0));
+		__m128 detB = Swizzle(detSub, NazaraShuffleMask(1, 1, 1, 1));
+		__m128 detC = Swizzle(detSub, NazaraShuffleMask(2, 2, 2, 2));
+		__m128 detD = Swizzle(detSub, NazaraShuffleMask(3, 3, 3, 3));
+
+		__m128 D_C = Mat2AdjMul(D, C);
+		__m128 A_B = Mat2AdjMul(A, B);
+
+		__m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+		__m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+		__m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+		__m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+		// |M| = |A|*|D| + |B|*|C| - tr((A#B)(D#C))
+		__m128 trace = _mm_mul_ps(A_B, Swizzle(D_C, NazaraShuffleMask(0, 2, 1, 3)));
+		trace = _mm_add_ps(trace, Swizzle(trace, NazaraShuffleMask(2, 3, 0, 1)));
+		trace = _mm_add_ps(trace, Swizzle(trace, NazaraShuffleMask(1, 0, 3, 2)));
+
+		__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+		if (_mm_cvtss_f32(detM) == 0.f)
+			return false;
+
+		__m128 invDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+
+		X_ = _mm_mul_ps(X_, invDetM);
+		Y_ = _mm_mul_ps(Y_, invDetM);
+		Z_ = _mm_mul_ps(Z_, invDetM);
+		W_ = _mm_mul_ps(W_, invDetM);
+
+		_mm_storeu_ps(result + 0, _mm_shuffle_ps(X_, Y_, NazaraShuffleMask(3, 1, 3, 1).value));
+		_mm_storeu_ps(result + 4, _mm_shuffle_ps(X_, Y_, NazaraShuffleMask(2, 0, 2, 0).value));
+		_mm_storeu_ps(result + 8, _mm_shuffle_ps(Z_, W_, NazaraShuffleMask(3, 1, 3, 1).value));
+		_mm_storeu_ps(result + 12, _mm_shuffle_ps(Z_, W_, NazaraShuffleMask(2, 0, 2, 0).value));
+
+		return true;
+	}
+	#define NAZARA_MATH_SIMD_HAS_INVERSE
+
+	inline void SimdMatrix4TransformVec3(const float* matrix, const float* vectors, std::size_t count, float w, float* results)
+	{
+		__m128 row0 = _mm_loadu_ps(matrix + 0);
+		__m128 row1 = _mm_loadu_ps(matrix + 4);
+		__m128 row2 = _mm_loadu_ps(matrix + 8);
+		__m128 row3 = _mm_mul_ps(_mm_loadu_ps(matrix + 12), _mm_set1_ps(w));
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* vec = vectors + i * 3;
+
+			__m128 result = _mm_mul_ps(_mm_set1_ps(vec[0]), row0);
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(vec[1]), row1));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(vec[2]), row2));
+			result = _mm_add_ps(result, row3);
+
+			SimdStoreVec3(results + i * 3, result);
+		}
+	}
+
+	inline void SimdMatrix4TransformVec4(const float* matrix, const float* vectors, std::size_t count, float* results)
+	{
+		__m128 row0 = _mm_loadu_ps(matrix + 0);
+		__m128 row1 = _mm_loadu_ps(matrix + 4);
+		__m128 row2 = _mm_loadu_ps(matrix + 8);
+		__m128 row3 = _mm_loadu_ps(matrix + 12);
+
+		for (std::size_t i = 0; i < count; ++i)
+			_mm_storeu_ps(results + i * 4, SimdTransformRow(row0, row1, row2, row3, _mm_loadu_ps(vectors + i * 4)));
+	}
+
+	inline float SimdDotProduct4(__m128 lhs, __m128 rhs)
+	{
+	#if defined(NAZARA_MATH_SIMD_AVX) || defined(NAZARA_MATH_SIMD_SSE4)
+		return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xF1));
+	#else
+		__m128 product = _mm_mul_ps(lhs, rhs);
+		product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+		product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(product);
+	#endif
+	}
+#elif defined(NAZARA_MATH_SIMD_NEON)
+	inline float32x4_t SimdTransformRow(float32x4_t row0, float32x4_t row1, float32x4_t row2, float32x4_t row3, float32x4_t vec)
+	{
+		float32x4_t result = vmulq_n_f32(row0, vgetq_lane_f32(vec, 0));
+		result = vmlaq_n_f32(result, row1, vgetq_lane_f32(vec, 1));
+		result = vmlaq_n_f32(result, row2, vgetq_lane_f32(vec, 2));
+		result = vmlaq_n_f32(result, row3, vgetq_lane_f32(vec, 3));
+
+		return result;
+	}
+
+	inline void SimdMatrix4Multiply(const float* lhs, const float* rhs, float* result)
+	{
+		float32x4_t rhsRow0 = vld1q_f32(rhs + 0);
+		float32x4_t rhsRow1 = vld1q_f32(rhs + 4);
+		float32x4_t rhsRow2 = vld1q_f32(rhs + 8);
+		float32x4_t rhsRow3 = vld1q_f32(rhs + 12);
+
+		for (std::size_t i = 0; i < 16; i += 4)
+			vst1q_f32(result + i, SimdTransformRow(rhsRow0, rhsRow1, rhsRow2, rhsRow3, vld1q_f32(lhs + i)));
+	}
+
+	inline void SimdMatrix4TransformVec3(const float* matrix, const float* vectors, std::size_t count, float w, float* results)
+	{
+		float32x4_t row0 = vld1q_f32(matrix + 0);
+		float32x4_t row1 = vld1q_f32(matrix + 4);
+		float32x4_t row2 = vld1q_f32(matrix + 8);
+		float32x4_t row3 = vmulq_n_f32(vld1q_f32(matrix + 12), w);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const float* vec = vectors + i * 3;
+
+			float32x4_t result = vmlaq_n_f32(row3, row0, vec[0]);
+			result = vmlaq_n_f32(result, row1, vec[1]);
+			result = vmlaq_n_f32(result, row2, vec[2]);
+
+			float* dest = results + i * 3;
+			vst1_f32(dest, vget_low_f32(result));
+			dest[2] = vgetq_lane_f32(result, 2);
+		}
+	}
+
+	inline void SimdMatrix4TransformVec4(const float* matrix, const float* vectors, std::size_t count, float* results)
+	{
+		float32x4_t row0 = vld1q_f32(matrix + 0);
+		float32x4_t row1 = vld1q_f32(matrix + 4);
+		float32x4_t row2 = vld1q_f32(matrix + 8);
+		float32x4_t row3 = vld1q_f32(matrix + 12);
+
+		for (std::size_t i = 0; i < count; ++i)
+			vst1q_f32(results + i * 4, SimdTransformRow(row0, row1, row2, row3, vld1q_f32(vectors + i * 4)));
+	}
+#endif
+
+	inline void SimdQuaternionSlerp(const float* from, const float* to, float interpolation, float* result)
+	{
+	#if defined(NAZARA_MATH_SIMD_SSE)
+		__m128 fromQuat = _mm_loadu_ps(from);
+		__m128 toQuat = _mm_loadu_ps(to);
+		float cosOmega = SimdDotProduct4(fromQuat, toQuat);
+	#else
+		float32x4_t fromQuat = vld1q_f32(from);
+		float32x4_t toQuat = vld1q_f32(to);
+		float32x4_t product = vmulq_f32(fromQuat, toQuat);
+		float32x2_t sum = vadd_f32(vget_low_f32(product), vget_high_f32(product));
+		float cosOmega = vget_lane_f32(vpadd_f32(sum, sum), 0);
+	#endif
+
+		// Take the shortest path
+		float sign = 1.f;
+		if (cosOmega < 0.f)
+		{
+			sign = -1.f;
+			cosOmega = -cosOmega;
+		}
+
+		float k0, k1;
+		if (cosOmega > 0.9999f)
+		{
+			// Linear interpolation to avoid division by zero
+			k0 = 1.f - interpolation;
+			k1 = interpolation;
+		}
+		else
+		{
+			float sinOmega = std::sqrt(1.f - cosOmega * cosOmega);
+			float omega = std::atan2(sinOmega, cosOmega);
+
+			float invSinOmega = 1.f / sinOmega;
+
+			k0 = std::sin((1.f - interpolation) * omega) * invSinOmega;
+			k1 = std::sin(interpolation * omega) * invSinOmega;
+		}
+
+		k1 *= sign;
+
+	#if defined(NAZARA_MATH_SIMD_SSE)
+		_mm_storeu_ps(result, _mm_add_ps(_mm_mul_ps(fromQuat, _mm_set1_ps(k0)), _mm_mul_ps(toQuat, _mm_set1_ps(k1))));
+	#else
+		vst1q_f32(result, vmlaq_n_f32(vmulq_n_f32(fromQuat, k0), toQuat, k1));
+	#endif
+	}
+}
+
+#undef NazaraShuffleMask
+
+#endif
+
+#endif // NAZARA_MATH_SIMD_HPP
@@ -22,8 +22,10 @@
 #define NAZARA_NETWORK_ENETCOMPRESSOR_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -37,7 +39,28 @@ namespace Nz
 
 			virtual std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) = 0;
 			virtual std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+
+		protected:
+			static const UInt8* GatherBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, std::vector<UInt8>& storage);
+	};
+
+	struct ENetCompressionStatistics
+	{
+		Time compressionTime = Time::Zero();
+		Time decompressionTime = Time::Zero();
+		UInt64 compressedInputSize = 0;
+		UInt64 compressedOutputSize = 0;
+		UInt64 decompressedInputSize = 0;
+		UInt64 decompressedOutputSize = 0;
+		UInt32 compressedPacketCount = 0;
+		UInt32 decompressedPacketCount = 0;
+		UInt32 incompressiblePacketCount = 0;
+
+		inline float GetCompressionRatio() const;
+		inline float GetDecompressionRatio() const;
 	};
 }
 
+#include <Nazara/Network/ENetCompressor.inl>
+
 #endif // NAZARA_NETWORK_ENETCOMPRESSOR_HPP
@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the size of sent data after compression relative to its size before compression (lower is better)
+	*
+	* Incompressible packets are sent uncompressed and are accounted with their original size.
+	*/
+	inline float ENetCompressionStatistics::GetCompressionRatio() const
+	{
+		if (compressedInputSize == 0)
+			return 1.f;
+
+		return static_cast<float>(static_cast<double>(compressedOutputSize) / compressedInputSize);
+	}
+
+	/*!
+	* \brief Gets the size of received compressed data relative to its size after decompression (lower is better)
+	*/
+	inline float ENetCompressionStatistics::GetDecompressionRatio() const
+	{
+		if (decompressedOutputSize == 0)
+			return 1.f;
+
+		return static_cast<float>(static_cast<double>(decompressedInputSize) / decompressedOutputSize);
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
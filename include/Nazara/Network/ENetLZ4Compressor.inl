@@ -0,0 +1,30 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a LZ4 compressor
+	*
+	* \param acceleration LZ4 acceleration factor, higher values are faster but compress less (1 is the default LZ4 behavior)
+	*/
+	inline ENetLZ4Compressor::ENetLZ4Compressor(int acceleration) :
+	m_acceleration(acceleration)
+	{
+	}
+
+	inline int ENetLZ4Compressor::GetAcceleration() const
+	{
+		return m_acceleration;
+	}
+
+	inline void ENetLZ4Compressor::SetAcceleration(int acceleration)
+	{
+		m_acceleration = acceleration;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -18,6 +18,7 @@
 #define NAZARA_NETWORK_ENETPEER_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
@@ -48,6 +49,7 @@ namespace Nz
 			void DisconnectNow(UInt32 data);
 
 			inline const IpAddress& GetAddress() const;
+			inline const ENetCompressionStatistics& GetCompressionStatistics() const;
 			inline UInt32 GetLastReceiveTime() const;
 			inline UInt32 GetMtu() const;
 			inline UInt32 GetPacketThrottleAcceleration() const;
@@ -195,6 +197,7 @@ namespace Nz
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
 			std::vector<Channel>                  m_channels;
+			ENetCompressionStatistics             m_compressionStatistics;
 			ENetPeerState                         m_state;
 			UInt8                                 m_incomingSessionID;
 			UInt8                                 m_outgoingSessionID;
@@ -22,6 +22,14 @@ namespace Nz
 		return m_address;
 	}
 
+	/*!
+	* \brief Gets compression statistics of packets exchanged with this peer, if the host uses a compressor
+	*/
+	inline const ENetCompressionStatistics& ENetPeer::GetCompressionStatistics() const
+	{
+		return m_compressionStatistics;
+	}
+
 	inline UInt32 ENetPeer::GetLastReceiveTime() const
 	{
 		return m_lastReceiveTime;
@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+/*
+	Copyright(c) 2002 - 2016 Lee Salzman
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetRangeCoderCompressor final : public ENetCompressor
+	{
+		public:
+			ENetRangeCoderCompressor() = default;
+			~ENetRangeCoderCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+		private:
+			struct Symbol
+			{
+				// Binary indexed tree of symbols
+				UInt8 value;
+				UInt8 count;
+				UInt16 under;
+				UInt16 left;
+				UInt16 right;
+
+				// Context defined by this symbol
+				UInt16 symbols;
+				UInt16 escapes;
+				UInt16 total;
+				UInt16 parent;
+			};
+
+			Symbol* CreateContext(std::size_t& nextSymbol, UInt16 escapes, UInt16 minimum);
+			Symbol* CreateSymbol(std::size_t& nextSymbol, UInt8 value, UInt16 count);
+			void DecodeRootSymbol(std::size_t& nextSymbol, Symbol* context, Symbol*& symbol, UInt16 code, UInt8& value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum);
+			void EncodeSymbol(std::size_t& nextSymbol, Symbol* context, Symbol*& symbol, UInt8 value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum);
+			inline UInt16 GetSymbolIndex(const Symbol* symbol) const;
+
+			static void RescaleContext(Symbol* context, UInt16 minimum);
+			static UInt16 RescaleSymbol(Symbol* symbol);
+			static bool TryDecodeSymbol(Symbol* context, Symbol*& symbol, UInt16 code, UInt8& value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum);
+
+			// Only allocate enough symbols for reasonable MTUs, would need to be larger for large file compression
+			std::array<Symbol, 4096> m_symbols;
+	};
+}
+
+#include <Nazara/Network/ENetRangeCoderCompressor.inl>
+
+#endif // NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline UInt16 ENetRangeCoderCompressor::GetSymbolIndex(const Symbol* symbol) const
+	{
+		return static_cast<UInt16>(symbol - m_symbols.data());
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
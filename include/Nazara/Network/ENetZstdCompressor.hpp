@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <vector>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_DDict_s;
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetZstdCompressor final : public ENetCompressor
+	{
+		public:
+			ENetZstdCompressor(int compressionLevel = DefaultCompressionLevel);
+			ENetZstdCompressor(const void* dictionary, std::size_t dictionarySize, int compressionLevel = DefaultCompressionLevel);
+			ENetZstdCompressor(const ENetZstdCompressor&) = delete;
+			ENetZstdCompressor(ENetZstdCompressor&&) = delete;
+			~ENetZstdCompressor();
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			inline int GetCompressionLevel() const;
+
+			inline bool HasDictionary() const;
+
+			bool LoadDictionary(const void* dictionary, std::size_t dictionarySize);
+
+			ENetZstdCompressor& operator=(const ENetZstdCompressor&) = delete;
+			ENetZstdCompressor& operator=(ENetZstdCompressor&&) = delete;
+
+			static std::vector<UInt8> TrainDictionary(const std::vector<std::vector<UInt8>>& samples, std::size_t maxDictionarySize = DefaultDictionarySize);
+
+			static constexpr int DefaultCompressionLevel = 3;
+			static constexpr std::size_t DefaultDictionarySize = 16 * 1024;
+
+		private:
+			void ReleaseDictionary();
+
+			std::vector<UInt8> m_inputBuffer;
+			ZSTD_CCtx_s* m_compressionContext;
+			ZSTD_CDict_s* m_compressionDictionary;
+			ZSTD_DCtx_s* m_decompressionContext;
+			ZSTD_DDict_s* m_decompressionDictionary;
+			int m_compressionLevel;
+	};
+}
+
+#include <Nazara/Network/ENetZstdCompressor.inl>
+
+#endif // NAZARA_NETWORK_ENETZSTDCOMPRESSOR_HPP
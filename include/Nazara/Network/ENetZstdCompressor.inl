@@ -0,0 +1,20 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline int ENetZstdCompressor::GetCompressionLevel() const
+	{
+		return m_compressionLevel;
+	}
+
+	inline bool ENetZstdCompressor::HasDictionary() const
+	{
+		return m_compressionDictionary != nullptr;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
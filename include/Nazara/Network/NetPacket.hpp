@@ -11,7 +11,7 @@
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Network/Config.hpp>
-#include <mutex>
+#include <memory>
 
 namespace Nz
 {
@@ -24,7 +24,7 @@ namespace Nz
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
 			NetPacket(const NetPacket&) = delete;
-			NetPacket(NetPacket&& packet);
+			NetPacket(NetPacket&& packet) noexcept;
 			inline ~NetPacket();
 
 			inline const UInt8* GetConstData() const;
@@ -43,6 +43,8 @@ namespace Nz
 
 			inline void SetNetCode(UInt16 netCode);
 
+			NetPacket Share() const;
+
 			NetPacket& operator=(const NetPacket&) = delete;
 			NetPacket& operator=(NetPacket&& packet);
 
@@ -56,16 +58,14 @@ namespace Nz
 
 			void FreeStream();
 			void InitStream(std::size_t minCapacity, UInt64 cursorPos, OpenModeFlags openMode);
+			bool IsHeaderUpToDate() const;
 
 			static bool Initialize();
 			static void Uninitialize();
 
-			std::unique_ptr<ByteArray> m_buffer;
+			std::shared_ptr<ByteArray> m_buffer;
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
-
-			static std::recursive_mutex s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
@@ -48,7 +48,7 @@ namespace Nz
 	* \param packet NetPacket to move into this
 	*/
 
-	inline NetPacket::NetPacket(NetPacket&& packet) :
+	inline NetPacket::NetPacket(NetPacket&& packet) noexcept :
 	ByteStream(std::move(packet)),
 	m_buffer(std::move(packet.m_buffer)),
 	m_memoryStream(std::move(packet.m_memoryStream)),
@@ -170,11 +170,13 @@ namespace Nz
 	* \param newSize Size for the resizing operation
 	*
 	* \remark Produces a NazaraAssert if internal buffer is invalid
+	* \remark Produces a NazaraAssert if internal buffer is shared with another packet
 	*/
 
 	inline void NetPacket::Resize(std::size_t newSize)
 	{
 		NazaraAssert(m_buffer, "Invalid buffer");
+		NazaraAssert(m_buffer.use_count() == 1, "Cannot resize a shared packet");
 
 		m_buffer->Resize(newSize);
 	}
@@ -183,10 +185,14 @@ namespace Nz
 	* \brief Sets the packet number
 	*
 	* \param netCode Packet number
+	*
+	* \remark Produces a NazaraAssert if internal buffer is shared with another packet
 	*/
 
 	inline void NetPacket::SetNetCode(UInt16 netCode)
 	{
+		NazaraAssert(!m_buffer || m_buffer.use_count() == 1, "Cannot change the net code of a shared packet");
+
 		m_netCode = netCode;
 	}
 
@@ -0,0 +1,69 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_REPLICATIONCLIENT_HPP
+#define NAZARA_NETWORK_REPLICATIONCLIENT_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/ReplicationSnapshot.hpp>
+#include <NazaraUtils/Signal.hpp>
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace Nz
+{
+	class ENetPeer;
+	class NetPacket;
+
+	class NAZARA_NETWORK_API ReplicationClient
+	{
+		public:
+			using Deserializer = std::function<void(ReplicatedEntityId entityId, BitReader& reader)>;
+
+			inline ReplicationClient(UInt8 channelId = 0);
+			ReplicationClient(const ReplicationClient&) = delete;
+			ReplicationClient(ReplicationClient&&) = delete;
+			~ReplicationClient() = default;
+
+			inline UInt8 GetChannelId() const;
+			inline std::size_t GetEntityCount() const;
+			inline UInt32 GetSequence() const;
+
+			bool HandlePacket(ENetPeer* peer, const NetPacket& packet);
+
+			inline bool HasEntity(ReplicatedEntityId entityId) const;
+
+			std::size_t RegisterComponent(Deserializer deserializer);
+
+			void Reset();
+
+			ReplicationClient& operator=(const ReplicationClient&) = delete;
+			ReplicationClient& operator=(ReplicationClient&&) = delete;
+
+			NazaraSignal(OnComponentRemoved, ReplicationClient* /*client*/, ReplicatedEntityId /*entityId*/, std::size_t /*componentIndex*/);
+			NazaraSignal(OnEntityCreated, ReplicationClient* /*client*/, ReplicatedEntityId /*entityId*/);
+			NazaraSignal(OnEntityDestroyed, ReplicationClient* /*client*/, ReplicatedEntityId /*entityId*/);
+
+		private:
+			void ApplySnapshot(const ReplicationSnapshot& snapshot);
+			bool DecodeSnapshot(BitReader& reader, ReplicationSnapshot* snapshot) const;
+			void DeserializeComponent(ReplicatedEntityId entityId, std::size_t componentIndex, const ReplicatedComponentData& componentData);
+			bool ReadEntity(BitReader& reader, const ReplicatedEntityState* baselineState, ReplicatedEntityState* state) const;
+
+			std::array<ReplicationSnapshot, ReplicationSnapshot::HistorySize> m_history;
+			std::vector<Deserializer> m_deserializers;
+			const ReplicationSnapshot* m_currentSnapshot;
+			ReplicationSnapshot m_decodedSnapshot;
+			UInt8 m_channelId;
+	};
+}
+
+#include <Nazara/Network/ReplicationClient.inl>
+
+#endif // NAZARA_NETWORK_REPLICATIONCLIENT_HPP
@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a replication client
+	*
+	* \param channelId ENet channel used for snapshots and acknowledgements, it must match the server one
+	*/
+	inline ReplicationClient::ReplicationClient(UInt8 channelId) :
+	m_currentSnapshot(nullptr),
+	m_channelId(channelId)
+	{
+	}
+
+	inline UInt8 ReplicationClient::GetChannelId() const
+	{
+		return m_channelId;
+	}
+
+	inline std::size_t ReplicationClient::GetEntityCount() const
+	{
+		return (m_currentSnapshot) ? m_currentSnapshot->entities.size() : 0;
+	}
+
+	/*!
+	* \brief Gets the sequence number of the last applied snapshot (0 if none)
+	*/
+	inline UInt32 ReplicationClient::GetSequence() const
+	{
+		return (m_currentSnapshot) ? m_currentSnapshot->sequence : 0;
+	}
+
+	inline bool ReplicationClient::HasEntity(ReplicatedEntityId entityId) const
+	{
+		return m_currentSnapshot && m_currentSnapshot->entities.find(entityId) != m_currentSnapshot->entities.end();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,119 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_REPLICATIONSERVER_HPP
+#define NAZARA_NETWORK_REPLICATIONSERVER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/BitWriter.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <Nazara/Network/ReplicationSnapshot.hpp>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class ENetPeer;
+	class NetPacket;
+
+	class NAZARA_NETWORK_API ReplicationServer
+	{
+		public:
+			using Serializer = std::function<void(ReplicatedEntityId entityId, BitWriter& writer)>;
+
+			inline ReplicationServer(UInt8 channelId = 0);
+			ReplicationServer(const ReplicationServer&) = delete;
+			ReplicationServer(ReplicationServer&&) = delete;
+			~ReplicationServer() = default;
+
+			void AddClient(ENetPeer* peer);
+
+			void CreateEntity(ReplicatedEntityId entityId, UInt32 componentMask, const Vector3f& position = Vector3f::Zero(), float priority = 1.f);
+			void DestroyEntity(ReplicatedEntityId entityId);
+
+			inline UInt8 GetChannelId() const;
+			inline UInt32 GetSequence() const;
+
+			bool HandlePacket(ENetPeer* peer, const NetPacket& packet);
+
+			inline bool HasEntity(ReplicatedEntityId entityId) const;
+
+			std::size_t RegisterComponent(Serializer serializer);
+
+			void RemoveClient(ENetPeer* peer);
+
+			void SetClientBandwidthBudget(ENetPeer* peer, std::size_t byteCount);
+			void SetClientViewer(ENetPeer* peer, const Vector3f& position, float radius);
+			void SetEntityAlwaysRelevant(ReplicatedEntityId entityId, bool alwaysRelevant);
+			void SetEntityComponents(ReplicatedEntityId entityId, UInt32 componentMask);
+			void SetEntityPosition(ReplicatedEntityId entityId, const Vector3f& position);
+			void SetEntityPriority(ReplicatedEntityId entityId, float priority);
+
+			void Tick();
+
+			ReplicationServer& operator=(const ReplicationServer&) = delete;
+			ReplicationServer& operator=(ReplicationServer&&) = delete;
+
+			static constexpr std::size_t DefaultBandwidthBudget = 1200; //< bytes per snapshot, fits in a typical MTU
+
+		private:
+			struct ClientData
+			{
+				std::array<ReplicationSnapshot, ReplicationSnapshot::HistorySize> history;
+				std::unordered_map<ReplicatedEntityId, float> priorityAccumulators;
+				ENetPeer* peer;
+				Vector3f viewerPosition = Vector3f::Zero();
+				UInt32 lastAckedSequence = 0;
+				std::size_t bandwidthBudget = DefaultBandwidthBudget;
+				float viewerRadius = std::numeric_limits<float>::infinity();
+				bool hasAck = false;
+			};
+
+			struct EntityData
+			{
+				std::shared_ptr<const ReplicatedEntityState> state;
+				Vector3f position;
+				UInt32 componentMask;
+				float priority;
+				bool alwaysRelevant = false;
+			};
+
+			struct PendingEntity
+			{
+				ReplicatedEntityId entityId;
+				float priority;
+			};
+
+			ClientData& GetClientData(ENetPeer* peer);
+			EntityData& GetEntityData(ReplicatedEntityId entityId);
+			bool IsRelevant(const ClientData& client, const EntityData& entity, float* priorityFactor) const;
+			void SendSnapshot(ClientData& client);
+			void UpdateEntityStates();
+			void WriteEntity(BitWriter& writer, const ReplicatedEntityState* baselineState, const ReplicatedEntityState& state) const;
+
+			static void AppendBits(BitWriter& writer, const BitWriter& source);
+
+			std::unordered_map<ENetPeer*, std::unique_ptr<ClientData>> m_clients;
+			std::unordered_map<ReplicatedEntityId, EntityData> m_entities;
+			std::vector<PendingEntity> m_pendingEntities;
+			std::vector<ReplicatedEntityId> m_removedEntities;
+			std::vector<Serializer> m_serializers;
+			BitWriter m_componentWriter;
+			BitWriter m_entityWriter;
+			BitWriter m_snapshotWriter;
+			UInt32 m_sequence;
+			UInt8 m_channelId;
+	};
+}
+
+#include <Nazara/Network/ReplicationServer.inl>
+
+#endif // NAZARA_NETWORK_REPLICATIONSERVER_HPP
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a replication server
+	*
+	* \param channelId ENet channel used for snapshots and acknowledgements, it shouldn't be used for anything else
+	*/
+	inline ReplicationServer::ReplicationServer(UInt8 channelId) :
+	m_sequence(0),
+	m_channelId(channelId)
+	{
+	}
+
+	inline UInt8 ReplicationServer::GetChannelId() const
+	{
+		return m_channelId;
+	}
+
+	/*!
+	* \brief Gets the sequence number of the last snapshot sent
+	*/
+	inline UInt32 ReplicationServer::GetSequence() const
+	{
+		return m_sequence;
+	}
+
+	inline bool ReplicationServer::HasEntity(ReplicatedEntityId entityId) const
+	{
+		return m_entities.find(entityId) != m_entities.end();
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_REPLICATIONSNAPSHOT_HPP
+#define NAZARA_NETWORK_REPLICATIONSNAPSHOT_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/Config.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nz
+{
+	class BitReader;
+	class BitWriter;
+
+	using ReplicatedEntityId = UInt32;
+
+	struct ReplicatedComponentData
+	{
+		std::vector<UInt8> data;
+		UInt64 bitCount = 0;
+
+		inline bool operator==(const ReplicatedComponentData& componentData) const;
+		inline bool operator!=(const ReplicatedComponentData& componentData) const;
+	};
+
+	struct ReplicatedEntityState
+	{
+		std::vector<std::shared_ptr<const ReplicatedComponentData>> components; //< indexed by component index, null if the entity doesn't have it
+		UInt32 componentMask = 0;
+	};
+
+	struct ReplicationSnapshot
+	{
+		std::unordered_map<ReplicatedEntityId, std::shared_ptr<const ReplicatedEntityState>> entities;
+		UInt32 sequence = 0;
+
+		static inline bool IsComponentEqual(const std::shared_ptr<const ReplicatedComponentData>& lhs, const std::shared_ptr<const ReplicatedComponentData>& rhs);
+		static inline bool IsSequenceMoreRecent(UInt32 sequence, UInt32 referenceSequence);
+
+		static bool ReadComponentData(BitReader& reader, ReplicatedComponentData* componentData);
+		static void WriteComponentData(BitWriter& writer, const ReplicatedComponentData& componentData);
+
+		static constexpr std::size_t HistorySize = 32; //< how many snapshots are kept as potential delta baselines
+		static constexpr std::size_t MaxComponentCount = 32;
+		static constexpr UInt64 MaxComponentBitCount = 0xFFFF * 8;
+	};
+}
+
+#include <Nazara/Network/ReplicationSnapshot.inl>
+
+#endif // NAZARA_NETWORK_REPLICATIONSNAPSHOT_HPP
@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cstring>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	inline bool ReplicatedComponentData::operator==(const ReplicatedComponentData& componentData) const
+	{
+		if (bitCount != componentData.bitCount)
+			return false;
+
+		// Unused bits of the last byte are always zero
+		return std::memcmp(data.data(), componentData.data.data(), data.size()) == 0;
+	}
+
+	inline bool ReplicatedComponentData::operator!=(const ReplicatedComponentData& componentData) const
+	{
+		return !operator==(componentData);
+	}
+
+	/*!
+	* \brief Checks if two component states hold the same data, states are shared between snapshots so this is most of the time a pointer comparison
+	*/
+	inline bool ReplicationSnapshot::IsComponentEqual(const std::shared_ptr<const ReplicatedComponentData>& lhs, const std::shared_ptr<const ReplicatedComponentData>& rhs)
+	{
+		if (lhs == rhs)
+			return true;
+
+		if (!lhs || !rhs)
+			return false;
+
+		return *lhs == *rhs;
+	}
+
+	/*!
+	* \brief Compares two sequence numbers, handling wrap around
+	*/
+	inline bool ReplicationSnapshot::IsSequenceMoreRecent(UInt32 sequence, UInt32 referenceSequence)
+	{
+		return sequence != referenceSequence && UInt32(sequence - referenceSequence) < 0x80000000;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
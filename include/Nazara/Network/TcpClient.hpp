@@ -12,12 +12,13 @@
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Network/AbstractSocket.hpp>
 #include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <array>
 #include <string>
 
 namespace Nz
 {
 	struct NetBuffer;
-	class NetPacket;
 
 	class NAZARA_NETWORK_API TcpClient : public AbstractSocket, public Stream
 	{
@@ -71,9 +72,9 @@ namespace Nz
 
 			struct PendingPacket
 			{
+				std::array<UInt8, NetPacket::HeaderSize> header;
 				std::size_t received = 0;
-				ByteArray data;
-				UInt16 netcode;
+				NetPacket packet;
 				bool headerReceived = false;
 			};
 
@@ -59,15 +59,20 @@ namespace Nz
 
 			inline void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0);
 			inline void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 firstInstance = 0);
+			inline void DrawIndexedIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer = 0, UInt64 countOffset = 0);
+			inline void DrawIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer = 0, UInt64 countOffset = 0);
 
 			inline void EndDebugRegion();
 
-			void Execute();
+			void Execute() const;
+			inline void ExecuteSecondaryCommandBuffer(const OpenGLCommandBuffer& commandBuffer);
 
 			inline std::size_t GetBindingIndex() const;
 			inline std::size_t GetPoolIndex() const;
 			inline const OpenGLCommandPool& GetOwner() const;
 
+			inline void InheritFramebuffer(const OpenGLFramebuffer& framebuffer);
+
 			inline void InsertMemoryBarrier(GLbitfield barriers);
 
 			inline void SetFramebuffer(const OpenGLFramebuffer& framebuffer, const OpenGLRenderPass& renderPass, const CommandBufferBuilder::ClearValues* clearValues, std::size_t clearValueCount);
@@ -93,7 +98,10 @@ namespace Nz
 	cb(DispatchCommand) \
 	cb(DrawCommand) \
 	cb(DrawIndexedCommand) \
+	cb(DrawIndexedIndirectCommand) \
+	cb(DrawIndirectCommand) \
 	cb(EndDebugRegionCommand) \
+	cb(ExecuteSecondaryCommand) \
 	cb(MemoryBarrier) \
 	lastCb(SetFrameBufferCommand) \
 
@@ -111,21 +119,24 @@ namespace Nz
 
 			>;
 
-			void ApplyBindings(const GL::Context& context, const ShaderBindings& bindings);
-			void ApplyStates(const GL::Context& context, const DrawStates& states);
-
-			inline void Execute(const GL::Context* context, const BeginDebugRegionCommand& command);
-			inline void Execute(const GL::Context* context, const BlitTextureCommand& command);
-			inline void Execute(const GL::Context* context, const BuildTextureMipmapsCommand& command);
-			inline void Execute(const GL::Context* context, const CopyBufferCommand& command);
-			inline void Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command);
-			inline void Execute(const GL::Context* context, const CopyTextureCommand& command);
-			inline void Execute(const GL::Context* context, const DispatchCommand& command);
-			inline void Execute(const GL::Context* context, const DrawCommand& command);
-			inline void Execute(const GL::Context* context, const DrawIndexedCommand& command);
-			inline void Execute(const GL::Context* context, const EndDebugRegionCommand& command);
-			inline void Execute(const GL::Context* context, const MemoryBarrier& command);
-			inline void Execute(const GL::Context*& context, const SetFrameBufferCommand& command);
+			void ApplyBindings(const GL::Context& context, const ShaderBindings& bindings) const;
+			void ApplyStates(const GL::Context& context, const DrawStates& states) const;
+
+			inline void Execute(const GL::Context* context, const BeginDebugRegionCommand& command) const;
+			inline void Execute(const GL::Context* context, const BlitTextureCommand& command) const;
+			inline void Execute(const GL::Context* context, const BuildTextureMipmapsCommand& command) const;
+			inline void Execute(const GL::Context* context, const CopyBufferCommand& command) const;
+			inline void Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command) const;
+			inline void Execute(const GL::Context* context, const CopyTextureCommand& command) const;
+			inline void Execute(const GL::Context* context, const DispatchCommand& command) const;
+			inline void Execute(const GL::Context* context, const DrawCommand& command) const;
+			inline void Execute(const GL::Context* context, const DrawIndexedCommand& command) const;
+			inline void Execute(const GL::Context* context, const DrawIndexedIndirectCommand& command) const;
+			inline void Execute(const GL::Context* context, const DrawIndirectCommand& command) const;
+			inline void Execute(const GL::Context* context, const EndDebugRegionCommand& command) const;
+			inline void Execute(const GL::Context* context, const ExecuteSecondaryCommand& command) const;
+			inline void Execute(const GL::Context* context, const MemoryBarrier& command) const;
+			inline void Execute(const GL::Context*& context, const SetFrameBufferCommand& command) const;
 
 			void Release() override;
 
@@ -233,10 +244,39 @@ namespace Nz
 				UInt32 instanceCount;
 			};
 
+			struct DrawIndexedIndirectCommand
+			{
+				DrawStates states;
+				ShaderBindings bindings;
+				GLuint countBuffer; //< if non-zero, drawCount is the maximum draw count
+				GLuint indirectBuffer;
+				UInt32 drawCount;
+				UInt32 stride;
+				UInt64 countOffset;
+				UInt64 offset;
+			};
+
+			struct DrawIndirectCommand
+			{
+				DrawStates states;
+				ShaderBindings bindings;
+				GLuint countBuffer; //< if non-zero, drawCount is the maximum draw count
+				GLuint indirectBuffer;
+				UInt32 drawCount;
+				UInt32 stride;
+				UInt64 countOffset;
+				UInt64 offset;
+			};
+
 			struct EndDebugRegionCommand
 			{
 			};
 
+			struct ExecuteSecondaryCommand
+			{
+				const OpenGLCommandBuffer* commandBuffer;
+			};
+
 			struct MemoryBarrier
 			{
 				GLbitfield barriers;
@@ -183,11 +183,55 @@ namespace Nz
 		m_commands.emplace_back(std::move(draw));
 	}
 
+	inline void OpenGLCommandBuffer::DrawIndexedIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer, UInt64 countOffset)
+	{
+		if (!m_currentDrawStates.pipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		DrawIndexedIndirectCommand draw;
+		draw.bindings = m_currentGraphicsShaderBindings;
+		draw.states = m_currentDrawStates;
+		draw.countBuffer = countBuffer;
+		draw.countOffset = countOffset;
+		draw.drawCount = drawCount;
+		draw.indirectBuffer = indirectBuffer;
+		draw.offset = offset;
+		draw.stride = stride;
+
+		m_commands.emplace_back(std::move(draw));
+	}
+
+	inline void OpenGLCommandBuffer::DrawIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer, UInt64 countOffset)
+	{
+		if (!m_currentDrawStates.pipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		DrawIndirectCommand draw;
+		draw.bindings = m_currentGraphicsShaderBindings;
+		draw.states = m_currentDrawStates;
+		draw.countBuffer = countBuffer;
+		draw.countOffset = countOffset;
+		draw.drawCount = drawCount;
+		draw.indirectBuffer = indirectBuffer;
+		draw.offset = offset;
+		draw.stride = stride;
+
+		m_commands.emplace_back(std::move(draw));
+	}
+
 	inline void OpenGLCommandBuffer::EndDebugRegion()
 	{
 		m_commands.emplace_back(EndDebugRegionCommand{});
 	}
 
+	inline void OpenGLCommandBuffer::ExecuteSecondaryCommandBuffer(const OpenGLCommandBuffer& commandBuffer)
+	{
+		ExecuteSecondaryCommand executeSecondary;
+		executeSecondary.commandBuffer = &commandBuffer;
+
+		m_commands.emplace_back(std::move(executeSecondary));
+	}
+
 	inline std::size_t OpenGLCommandBuffer::GetBindingIndex() const
 	{
 		return m_bindingIndex;
@@ -204,6 +248,12 @@ namespace Nz
 		return *m_owner;
 	}
 
+	inline void OpenGLCommandBuffer::InheritFramebuffer(const OpenGLFramebuffer& framebuffer)
+	{
+		// Secondary command buffers don't bind framebuffers but must know the one they're going to be executed with
+		m_currentDrawStates.shouldFlipY = (framebuffer.GetType() == FramebufferType::Window);
+	}
+
 	inline void OpenGLCommandBuffer::InsertMemoryBarrier(GLbitfield barriers)
 	{
 		// Merge with previous barrier, if any (may happen because memory barriers are not relative to a texture with OpenGL)
@@ -26,6 +26,7 @@ namespace Nz
 			~OpenGLCommandPool() = default;
 
 			CommandBufferPtr BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback) override;
+			CommandBufferPtr BuildSecondaryCommandBuffer(const Framebuffer& framebuffer, const RenderPass& renderPass, UInt32 subpassIndex, const std::function<void(CommandBufferBuilder& builder)>& callback) override;
 
 			void UpdateDebugName(std::string_view name) override;
 
@@ -36,6 +37,7 @@ namespace Nz
 			struct CommandPool;
 
 			CommandPool& AllocatePool();
+			CommandBufferPtr AllocateCommandBuffer();
 			CommandBufferPtr AllocateFromPool(std::size_t poolIndex);
 			void Release(CommandBuffer& commandBuffer);
 			inline void TryToShrink();
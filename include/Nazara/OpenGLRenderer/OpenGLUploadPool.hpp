@@ -34,6 +34,12 @@ namespace Nz
 			OpenGLUploadPool& operator=(OpenGLUploadPool&&) = delete;
 
 		private:
+			struct Block;
+
+			Allocation& AllocateDedicated(UInt64 size);
+			Block CreateBlock(UInt64 size);
+			Allocation& PushAllocation(Block& block, UInt64 offset, UInt64 size);
+
 			static constexpr std::size_t AllocationPerBlock = 2048;
 
 			using AllocationBlock = std::array<Allocation, AllocationPerBlock>;
@@ -45,9 +51,12 @@ namespace Nz
 				UInt64 size;
 			};
 
+			std::size_t m_currentBlockIndex;
 			std::size_t m_nextAllocationIndex;
 			std::vector<std::unique_ptr<AllocationBlock>> m_allocationBlocks;
 			std::vector<Block> m_blocks;
+			std::vector<Block> m_dedicatedBlocks;
+			std::vector<Block> m_freeDedicatedBlocks;
 			UInt64 m_blockSize;
 	};
 }
@@ -7,6 +7,7 @@
 namespace Nz
 {
 	inline OpenGLUploadPool::OpenGLUploadPool(UInt64 blockSize) :
+	m_currentBlockIndex(0),
 	m_nextAllocationIndex(0),
 	m_blockSize(blockSize)
 	{
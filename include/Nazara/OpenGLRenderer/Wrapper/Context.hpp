@@ -36,7 +36,9 @@ namespace Nz::GL
 		Array,
 		CopyRead,
 		CopyWrite,
+		DrawIndirect,
 		ElementArray,
+		Parameter,
 		PixelPack,
 		PixelUnpack,
 		Storage,
@@ -58,6 +60,9 @@ namespace Nz::GL
 		ComputeShader,
 		DebugOutput,
 		DepthClamp,
+		DrawIndirect,
+		IndirectParameters,
+		MultiDrawIndirect,
 		PolygonMode,
 		ShaderImageLoadFormatted,
 		ShaderImageLoadStore,
@@ -26,6 +26,10 @@ typedef void (GL_APIENTRYP PFNGLPOLYGONMODEPROC) (GLenum face, GLenum mode);
 // Depth clamp (OpenGL 3.2)
 #define GL_DEPTH_CLAMP                     0x864F
 
+// Multi draw indirect (OpenGL 4.3)
+typedef void (GL_APIENTRYP PFNGLMULTIDRAWARRAYSINDIRECTPROC) (GLenum mode, const void* indirect, GLsizei drawcount, GLsizei stride);
+typedef void (GL_APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC) (GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride);
+
 // Texture views (OpenGL 4.3)
 typedef void (GL_APIENTRYP PFNGLTEXTUREVIEWPROC) (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers);
 
@@ -38,6 +42,11 @@ typedef void (GL_APIENTRYP PFNGLTEXTUREVIEWPROC) (GLuint texture, GLenum target,
 #define GL_CLIP_DEPTH_MODE                 0x935D
 typedef void (GL_APIENTRYP PFNGLCLIPCONTROLPROC) (GLenum origin, GLenum depth);
 
+// Indirect parameters (OpenGL 4.6)
+#define GL_PARAMETER_BUFFER                0x80EE
+typedef void (GL_APIENTRYP PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) (GLenum mode, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
+typedef void (GL_APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC) (GLenum mode, GLenum type, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
+
 // SPIR-V shaders (OpenGL 4.6)
 typedef void (GL_APIENTRYP PFNGLSPECIALIZESHADERPROC) (GLuint shader, const GLchar* pEntryPoint, GLuint numSpecializationConstants, const GLuint* pConstantIndex, const GLuint* pConstantValue);
 
@@ -198,6 +207,9 @@ typedef void (GL_APIENTRYP PFNGLSPECIALIZESHADERPROC) (GLuint shader, const GLch
 	extCb(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC) \
 	extCb(glDrawBuffer, PFNGLDRAWBUFFERPROC) \
 	extCb(glPolygonMode, PFNGLPOLYGONMODEPROC) \
+	/* OpenGL 4.0 - OpenGL ES 3.1 */\
+	extCb(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC) \
+	extCb(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC) \
 	/* OpenGL 4.2 - OpenGL ES 3.1 */\
 	extCb(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC) \
 	extCb(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC) \
@@ -211,10 +223,16 @@ typedef void (GL_APIENTRYP PFNGLSPECIALIZESHADERPROC) (GLuint shader, const GLch
 	extCb(glObjectLabel, PFNGLOBJECTLABELPROC) \
 	extCb(glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC) \
 	extCb(glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC) \
+	/* OpenGL 4.3 - GL_ARB_multi_draw_indirect/GL_EXT_multi_draw_indirect */ \
+	extCb(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC) \
+	extCb(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC) \
 	/* OpenGL 4.3 - GL_ARB_texture_view */ \
 	extCb(glTextureView, PFNGLTEXTUREVIEWPROC) \
 	/* OpenGL 4.5 - GL_ARB_clip_control/GL_EXT_clip_control */ \
 	extCb(glClipControl, PFNGLCLIPCONTROLPROC) \
+	/* OpenGL 4.6 - GL_ARB_indirect_parameters */\
+	extCb(glMultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) \
+	extCb(glMultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC) \
 	/* OpenGL 4.6 - GL_ARB_spirv_extensions */\
 	extCb(glSpecializeShader, PFNGLSPECIALIZESHADERPROC) \
 
@@ -20,6 +20,7 @@
 
 namespace Nz
 {
+	class CommandBuffer;
 	class ComputePipeline;
 	class Framebuffer;
 	class RenderPass;
@@ -32,6 +33,8 @@ namespace Nz
 	{
 		public:
 			struct ClearValues;
+			struct DrawIndexedIndirectCommand;
+			struct DrawIndirectCommand;
 
 			CommandBufferBuilder() = default;
 			CommandBufferBuilder(const CommandBufferBuilder&) = delete;
@@ -39,7 +42,7 @@ namespace Nz
 			virtual ~CommandBufferBuilder();
 
 			virtual void BeginDebugRegion(std::string_view regionName, const Color& color) = 0;
-			virtual void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount) = 0;
+			virtual void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount, SubpassContents contents = SubpassContents::Inline) = 0;
 			inline void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect);
 			inline void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, std::initializer_list<ClearValues> clearValues);
 
@@ -64,13 +67,21 @@ namespace Nz
 
 			virtual void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0) = 0;
 			virtual void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 firstInstance = 0) = 0;
+			virtual void DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset = 0, UInt32 drawCount = 1, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+			virtual void DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+			virtual void DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset = 0, UInt32 drawCount = 1, UInt32 stride = sizeof(DrawIndirectCommand)) = 0;
+			virtual void DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndirectCommand)) = 0;
 
 			virtual void Dispatch(UInt32 workgroupX, UInt32 workgroupY, UInt32 workgroupZ) = 0;
 
 			virtual void EndDebugRegion() = 0;
 			virtual void EndRenderPass() = 0;
 
-			virtual void NextSubpass() = 0;
+			virtual void ExecuteSecondaryCommandBuffer(const CommandBuffer& commandBuffer) = 0;
+
+			virtual void MemoryBarrier(PipelineStageFlags srcStageMask, PipelineStageFlags dstStageMask, MemoryAccessFlags srcAccessMask, MemoryAccessFlags dstAccessMask) = 0;
+
+			virtual void NextSubpass(SubpassContents contents = SubpassContents::Inline) = 0;
 
 			virtual void PreTransferBarrier() = 0;
 			virtual void PostTransferBarrier() = 0;
@@ -89,6 +100,24 @@ namespace Nz
 				float depth = 1.f;
 				UInt32 stencil = 0;
 			};
+
+			// Layouts of the commands read from indirect buffers (matches the layout expected by the GPU)
+			struct DrawIndexedIndirectCommand
+			{
+				UInt32 indexCount;
+				UInt32 instanceCount;
+				UInt32 firstIndex;
+				Int32 vertexOffset;
+				UInt32 firstInstance;
+			};
+
+			struct DrawIndirectCommand
+			{
+				UInt32 vertexCount;
+				UInt32 instanceCount;
+				UInt32 firstVertex;
+				UInt32 firstInstance;
+			};
 	};
 }
 
@@ -15,6 +15,8 @@
 namespace Nz
 {
 	class CommandBufferBuilder;
+	class Framebuffer;
+	class RenderPass;
 
 	class NAZARA_RENDERER_API CommandPool
 	{
@@ -25,6 +27,7 @@ namespace Nz
 			virtual ~CommandPool();
 
 			virtual CommandBufferPtr BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback) = 0;
+			virtual CommandBufferPtr BuildSecondaryCommandBuffer(const Framebuffer& framebuffer, const RenderPass& renderPass, UInt32 subpassIndex, const std::function<void(CommandBufferBuilder& builder)>& callback) = 0;
 
 			virtual void UpdateDebugName(std::string_view name) = 0;
 
@@ -202,6 +202,12 @@ namespace Nz
 		SpirV
 	};
 
+	enum class SubpassContents
+	{
+		Inline,                 ///< Subpass commands are recorded directly in the primary command buffer
+		SecondaryCommandBuffers ///< Subpass commands are recorded in secondary command buffers, executed by the primary one
+	};
+
 	enum class TextureAccess
 	{
 		ReadOnly,
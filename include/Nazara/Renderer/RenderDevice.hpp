@@ -20,6 +20,7 @@
 #include <Nazara/Renderer/Swapchain.hpp>
 #include <Nazara/Renderer/SwapchainParameters.hpp>
 #include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/Renderer/TextureHeap.hpp>
 #include <Nazara/Renderer/TextureSampler.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <NazaraUtils/FunctionRef.hpp>
@@ -27,6 +28,7 @@
 #include <NZSL/Ast/Module.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Nz
 {
@@ -42,6 +44,8 @@ namespace Nz
 
 			virtual const RenderDeviceInfo& GetDeviceInfo() const = 0;
 			virtual const RenderDeviceFeatures& GetEnabledFeatures() const = 0;
+			virtual std::vector<UInt8> GetPipelineCacheData() const;
+			virtual TextureMemoryRequirements GetTextureMemoryRequirements(const TextureInfo& textureInfo);
 
 			virtual std::shared_ptr<RenderBuffer> InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData = nullptr) = 0;
 			virtual std::shared_ptr<CommandPool> InstantiateCommandPool(QueueType queueType) = 0;
@@ -56,10 +60,13 @@ namespace Nz
 			virtual std::shared_ptr<Swapchain> InstantiateSwapchain(WindowHandle windowHandle, const Vector2ui& windowSize, const SwapchainParameters& parameters) = 0;
 			virtual std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params) = 0;
 			virtual std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params, const void* initialData, bool buildMipmaps, unsigned int srcWidth = 0, unsigned int srcHeight = 0) = 0;
+			virtual std::shared_ptr<TextureHeap> InstantiateTextureHeap(const TextureMemoryRequirements& heapRequirements);
 			virtual std::shared_ptr<TextureSampler> InstantiateTextureSampler(const TextureSamplerInfo& params) = 0;
 
 			virtual bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const = 0;
 
+			virtual bool LoadPipelineCacheData(const void* data, std::size_t size);
+
 			virtual void WaitForIdle() = 0;
 
 			static void ValidateFeatures(const RenderDeviceFeatures& supportedFeatures, RenderDeviceFeatures& enabledFeatures);
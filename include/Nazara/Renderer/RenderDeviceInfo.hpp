@@ -10,6 +10,7 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Renderer/Enums.hpp>
+#include <array>
 #include <string>
 
 namespace Nz
@@ -17,10 +18,15 @@ namespace Nz
 	struct RenderDeviceFeatures
 	{
 		bool anisotropicFiltering = false;
+		bool bindlessTextures = false; //< large sampled texture arrays can be indexed with dynamic values in shaders, partially bound and updated while in use
 		bool computeShaders = false;
 		bool depthClamping = false;
+		bool drawIndirect = false;
+		bool drawIndirectCount = false;
+		bool multiDrawIndirect = false;
 		bool nonSolidFaceFilling = false;
 		bool storageBuffers = false;
+		bool textureMemoryAliasing = false;
 		bool textureReadWithoutFormat = false;
 		bool textureReadWrite = false;
 		bool textureWriteWithoutFormat = false;
@@ -33,6 +39,7 @@ namespace Nz
 		UInt32 maxComputeWorkGroupInvocations;
 		Vector3ui32 maxComputeWorkGroupCount;
 		Vector3ui32 maxComputeWorkGroupSize;
+		UInt32 maxPerStageSampledTextures;
 		UInt64 maxStorageBufferSize;
 		UInt64 maxUniformBufferSize;
 		UInt64 minStorageBufferOffsetAlignment;
@@ -44,7 +51,9 @@ namespace Nz
 		RenderDeviceFeatures features;
 		RenderDeviceLimits limits;
 		RenderDeviceType type;
+		std::array<UInt8, 16> pipelineCacheUUID = {}; //< identifies compatible pipeline cache data, all zeroes if the device has no pipeline cache
 		std::string name;
+		bool threadSafeShaderCreation = false; //< shader modules can be instantiated from multiple threads at once
 	};
 }
 
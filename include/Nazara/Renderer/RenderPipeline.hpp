@@ -27,6 +27,7 @@ namespace Nz
 	};
 
 	class RenderDevice;
+	class RenderPass;
 
 	class NAZARA_RENDERER_API RenderPipeline
 	{
@@ -36,6 +37,8 @@ namespace Nz
 
 			virtual const RenderPipelineInfo& GetPipelineInfo() const = 0;
 
+			virtual void Prewarm(const RenderPass& renderPass, std::size_t subpassIndex) const;
+
 			virtual void UpdateDebugName(std::string_view name) = 0;
 
 		protected:
@@ -26,6 +26,7 @@ namespace Nz
 			UInt32 arraySize = 1;
 			ShaderBindingType type;
 			nzsl::ShaderStageTypeFlags shaderStageFlags;
+			bool partiallyBound = false; //< array entries don't have to be valid and can be updated while the binding is in use, as long as pending commands don't access them
 		};
 
 		std::vector<Binding> bindings;
@@ -54,6 +54,7 @@ namespace Nz
 			{
 				UInt32 arraySize;
 				const SampledTextureBinding* textureBindings;
+				UInt32 arrayOffset = 0;
 			};
 
 			struct StorageBufferBinding
@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERER_TEXTUREHEAP_HPP
+#define NAZARA_RENDERER_TEXTUREHEAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Renderer/Config.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <memory>
+#include <string_view>
+
+namespace Nz
+{
+	struct TextureMemoryRequirements
+	{
+		UInt64 alignment = 1;
+		UInt64 size = 0;
+		UInt32 memoryTypeBits = 0xFFFFFFFF; //< textures can only share a heap if their memory type bits intersect
+	};
+
+	class NAZARA_RENDERER_API TextureHeap
+	{
+		public:
+			inline TextureHeap(UInt64 size);
+			TextureHeap(const TextureHeap&) = delete;
+			TextureHeap(TextureHeap&&) = delete;
+			virtual ~TextureHeap();
+
+			inline UInt64 GetSize() const;
+
+			virtual std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& textureInfo, UInt64 offset) = 0;
+
+			virtual void UpdateDebugName(std::string_view name) = 0;
+
+			TextureHeap& operator=(const TextureHeap&) = delete;
+			TextureHeap& operator=(TextureHeap&&) = delete;
+
+		private:
+			UInt64 m_size;
+	};
+}
+
+#include <Nazara/Renderer/TextureHeap.inl>
+
+#endif // NAZARA_RENDERER_TEXTUREHEAP_HPP
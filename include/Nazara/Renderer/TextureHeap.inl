@@ -0,0 +1,20 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Renderer module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Renderer/Debug.hpp>
+
+namespace Nz
+{
+	inline TextureHeap::TextureHeap(UInt64 size) :
+	m_size(size)
+	{
+	}
+
+	inline UInt64 TextureHeap::GetSize() const
+	{
+		return m_size;
+	}
+}
+
+#include <Nazara/Renderer/DebugOff.hpp>
@@ -16,6 +16,7 @@ namespace Nz
 	{
 		public:
 			struct Allocation;
+			struct Stats;
 
 			UploadPool() = default;
 			UploadPool(const UploadPool&) = delete;
@@ -25,6 +26,8 @@ namespace Nz
 			virtual Allocation& Allocate(UInt64 size) = 0;
 			virtual Allocation& Allocate(UInt64 size, UInt64 alignment) = 0;
 
+			inline const Stats& GetStats() const;
+
 			virtual void Reset() = 0;
 
 			UploadPool& operator=(const UploadPool&) = delete;
@@ -43,6 +46,18 @@ namespace Nz
 				void* mappedPtr;
 				UInt64 size;
 			};
+
+			struct Stats
+			{
+				UInt64 allocatedMemory = 0;      //< memory currently owned by the pool
+				UInt64 peakUsedMemory = 0;       //< highest memory usage (including alignment padding) reached during a frame
+				UInt64 usedMemory = 0;           //< memory used since the last reset (including alignment padding)
+				std::size_t allocationCount = 0; //< allocations since the last reset
+				std::size_t dedicatedAllocationCount = 0; //< allocations too big for a block since the last reset
+			};
+
+		protected:
+			Stats m_stats;
 	};
 }
 
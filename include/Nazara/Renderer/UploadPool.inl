@@ -6,6 +6,10 @@
 
 namespace Nz
 {
+	inline auto UploadPool::GetStats() const -> const Stats&
+	{
+		return m_stats;
+	}
 }
 
 #include <Nazara/Renderer/DebugOff.hpp>
@@ -35,10 +35,12 @@ namespace Nz
 			virtual std::size_t GetFontCount() const = 0;
 			virtual const Glyph& GetGlyph(std::size_t index) const = 0;
 			virtual std::size_t GetGlyphCount() const = 0;
+			virtual UInt64 GetLayoutRevision() const;
 			virtual const Line& GetLine(std::size_t index) const = 0;
 			virtual std::size_t GetLineCount() const = 0;
 			inline std::size_t GetLineGlyphCount(std::size_t index) const;
 			virtual float GetMaxLineWidth() const = 0;
+			virtual std::size_t GetUnchangedGlyphCount(UInt64 layoutRevision) const;
 
 			virtual void SetMaxLineWidth(float lineWidth) = 0;
 
@@ -50,6 +52,7 @@ namespace Nz
 				Vector2f corners[4];
 				AbstractImage* atlas;
 				bool flipped;
+				float distanceFieldEdge; //< see Font::Glyph::distanceFieldEdge
 				int renderOrder;
 			};
 
@@ -58,6 +61,11 @@ namespace Nz
 				Rectf bounds;
 				std::size_t glyphIndex;
 			};
+
+			static constexpr UInt64 UntrackedLayoutRevision = 0;
+
+		protected:
+			static UInt64 GenerateLayoutRevision();
 	};
 }
 
@@ -17,6 +17,7 @@
 #include <Nazara/Math/Vector4.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <NazaraUtils/SparsePtr.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -27,6 +28,22 @@ namespace Nz
 	using MeshVertex = VertexStruct_XYZ_Normal_UV_Tangent;
 	using SkeletalMeshVertex = VertexStruct_XYZ_Normal_UV_Tangent_Skinning;
 
+	struct Meshlet
+	{
+		Boxf aabb;
+		UInt32 triangleCount;
+		UInt32 triangleOffset; //< in MeshletData::triangles, three local indices per triangle
+		UInt32 vertexCount;
+		UInt32 vertexOffset; //< in MeshletData::vertices
+	};
+
+	struct MeshletData
+	{
+		std::vector<Meshlet> meshlets;
+		std::vector<UInt32> vertices;
+		std::vector<UInt8> triangles;
+	};
+
 	struct SkinningData
 	{
 		const Joint* joints;
@@ -50,6 +67,8 @@ namespace Nz
 		SparsePtr<Vector2f> uvPtr;
 	};
 
+	NAZARA_UTILITY_API MeshletData BuildMeshlets(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, UInt32 maxVertexCount, UInt32 maxTriangleCount);
+
 	NAZARA_UTILITY_API Boxf ComputeAABB(SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount);
 	NAZARA_UTILITY_API void ComputeBoxIndexVertexCount(const Vector3ui& subdivision, UInt32* indexCount, UInt32* vertexCount);
 	NAZARA_UTILITY_API UInt32 ComputeCacheMissCount(IndexIterator indices, UInt32 indexCount);
@@ -67,6 +86,10 @@ namespace Nz
 	NAZARA_UTILITY_API void GenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackCount, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, UInt32 indexOffset = 0);
 
 	NAZARA_UTILITY_API void OptimizeIndices(IndexIterator indices, UInt32 indexCount);
+	NAZARA_UTILITY_API void OptimizeOverdraw(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, float threshold = 1.05f);
+	NAZARA_UTILITY_API UInt32 OptimizeVertexFetch(IndexIterator indices, UInt32 indexCount, UInt32 vertexCount, UInt32* vertexRemap);
+
+	NAZARA_UTILITY_API UInt32 SimplifyIndices(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount, UInt32 targetIndexCount, float targetError, UInt32* outputIndices, float* resultError = nullptr);
 
 	NAZARA_UTILITY_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
 
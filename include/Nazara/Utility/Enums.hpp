@@ -72,11 +72,13 @@ namespace Nz
 		DeviceLocal,
 		DirectMapping,
 		Dynamic,
+		Indirect, //< buffer holds indirect draw commands
 		Read,
 		PersistentMapping,
+		Storage, //< buffer can be bound as a storage buffer, whatever its type
 		Write,
 
-		Max = DirectMapping
+		Max = Write
 	};
 
 	template<>
@@ -17,6 +17,9 @@
 #include <Nazara/Utility/AbstractAtlas.hpp>
 #include <Nazara/Utility/Enums.hpp>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
 #include <unordered_map>
 
 namespace Nz
@@ -28,6 +31,7 @@ namespace Nz
 
 	class Font;
 	class FontData;
+	class Image;
 
 	struct FontGlyph;
 
@@ -57,11 +61,16 @@ namespace Nz
 			bool Create(std::unique_ptr<FontData> data);
 			void Destroy();
 
+			void EnableDistanceField(bool enable = true);
+
 			bool ExtractGlyph(unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* glyph) const;
 
 			const std::shared_ptr<AbstractAtlas>& GetAtlas() const;
+			AbstractImage* GetAtlasLayer(unsigned int layerIndex) const;
 			std::size_t GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
 			std::size_t GetCachedGlyphCount() const;
+			unsigned int GetDistanceFieldReferenceSize() const;
+			unsigned int GetDistanceFieldSpread() const;
 			std::string GetFamilyName() const;
 			int GetKerning(unsigned int characterSize, char32_t first, char32_t second) const;
 			const Glyph& GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
@@ -70,18 +79,23 @@ namespace Nz
 			const SizeInfo& GetSizeInfo(unsigned int characterSize) const;
 			std::string GetStyleName() const;
 
+			bool IsDistanceFieldEnabled() const;
 			bool IsValid() const;
 
 			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
 			bool Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const;
 
 			void SetAtlas(std::shared_ptr<AbstractAtlas> atlas);
+			void SetDistanceFieldReferenceSize(unsigned int characterSize);
+			void SetDistanceFieldSpread(unsigned int spread);
 			void SetGlyphBorder(unsigned int borderSize);
 			void SetMinimumStepSize(unsigned int minimumStepSize);
 
 			Font& operator=(const Font&) = delete;
 			Font& operator=(Font&&) = delete;
 
+			static Image ComputeDistanceField(const Image& coverage, unsigned int spread);
+
 			static std::shared_ptr<AbstractAtlas> GetDefaultAtlas();
 			static const std::shared_ptr<Font>& GetDefault();
 			static unsigned int GetDefaultGlyphBorder();
@@ -103,6 +117,7 @@ namespace Nz
 				bool requireFauxItalic;
 				bool flipped;
 				bool valid;
+				float distanceFieldEdge; //< distance field value of the glyph edge, lower than 0.5 for outlines (distance field glyphes only)
 				float fauxOutlineThickness;
 				int advance;
 				unsigned int layerIndex;
@@ -128,10 +143,17 @@ namespace Nz
 		private:
 			using GlyphMap = std::unordered_map<char32_t, Glyph>;
 
+			float ComputeDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const;
 			UInt64 ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const;
+			bool ExtractDistanceFieldSource(TextStyleFlags style, char32_t character, Glyph& glyph, FontGlyph& fontGlyph) const;
+			const Glyph& InsertDistanceFieldGlyph(GlyphMap& referenceMap, char32_t character, const Glyph& sourceGlyph, const FontGlyph& fontGlyph, const Image& distanceField) const;
+			std::unique_lock<std::mutex> LockData() const;
 			void OnAtlasCleared(const AbstractAtlas* atlas);
 			void OnAtlasLayerChange(const AbstractAtlas* atlas, AbstractImage* oldLayer, AbstractImage* newLayer);
+			const Glyph& PrecacheDistanceFieldGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
+			void PrecacheDistanceFieldGlyphs(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const;
 			const Glyph& PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const;
+			bool StoreGlyph(Glyph& glyph, const FontGlyph& fontGlyph) const;
 
 			static bool Initialize();
 			static void Uninitialize();
@@ -142,11 +164,20 @@ namespace Nz
 			std::shared_ptr<AbstractAtlas> m_atlas;
 			std::unique_ptr<FontData> m_data;
 			mutable std::unordered_map<UInt64, std::unordered_map<UInt64, int>> m_kerningCache;
+			mutable std::unordered_map<UInt64, GlyphMap> m_distanceFieldGlyphes; //< glyphes rendered at reference size, owning the atlas rects
 			mutable std::unordered_map<UInt64, GlyphMap> m_glyphes;
 			mutable std::unordered_map<UInt64, SizeInfo> m_sizeInfoCache;
+			mutable std::mutex m_dataMutex; //< only used if font data doesn't support concurrent extraction
+			mutable std::shared_mutex m_glyphMutex;
+			mutable std::shared_mutex m_kerningMutex;
+			mutable std::shared_mutex m_sizeInfoMutex;
+			unsigned int m_distanceFieldReferenceSize;
+			unsigned int m_distanceFieldSpread;
 			unsigned int m_glyphBorder;
 			unsigned int m_minimumStepSize;
+			bool m_distanceFieldEnabled;
 
+			static std::mutex s_atlasMutex; //< atlases may be shared between fonts
 			static std::shared_ptr<AbstractAtlas> s_defaultAtlas;
 			static std::shared_ptr<Font> s_defaultFont;
 			static unsigned int s_defaultGlyphBorder;
@@ -36,6 +36,7 @@ namespace Nz
 			virtual float QueryUnderlinePosition(unsigned int characterSize) const = 0;
 			virtual float QueryUnderlineThickness(unsigned int characterSize) const = 0;
 
+			virtual bool SupportsConcurrentExtraction() const;
 			virtual bool SupportsOutline(float outlineThickness) const = 0;
 			virtual bool SupportsStyle(TextStyleFlags style) const = 0;
 	};
@@ -21,6 +21,9 @@ namespace Nz
 {
 	struct ImageStreamParams : public ResourceParameters
 	{
+		// Number of threads the decoder may use, 0 lets it choose according to the hardware (if it supports threading)
+		unsigned int decodingThreadCount = 0;
+
 		bool IsValid() const;
 	};
 
@@ -36,6 +39,9 @@ namespace Nz
 			ImageStream() = default;
 			virtual ~ImageStream();
 
+			// Decodes the next frame into frameBuffer (tightly packed, in the stream pixel format), frameTime receives its presentation time
+			// Returns false once the end of the stream is reached, frameTime then receives the end time of the stream (presentation time following the last frame)
+			// frameTime is left untouched if decoding failed for another reason
 			virtual bool DecodeNextFrame(void* frameBuffer, Time* frameTime) = 0;
 
 			virtual UInt64 GetFrameCount() const = 0;
@@ -0,0 +1,90 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_IMAGESTREAMPLAYER_HPP
+#define NAZARA_UTILITY_IMAGESTREAMPLAYER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	class ImageStream;
+
+	class NAZARA_UTILITY_API ImageStreamPlayer
+	{
+		public:
+			ImageStreamPlayer();
+			ImageStreamPlayer(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount = DefaultBufferedFrameCount);
+			ImageStreamPlayer(const ImageStreamPlayer&) = delete;
+			ImageStreamPlayer(ImageStreamPlayer&&) = delete;
+			~ImageStreamPlayer();
+
+			bool Create(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount = DefaultBufferedFrameCount);
+			void Destroy();
+
+			void EnableLooping(bool loop);
+
+			inline std::size_t GetBufferedFrameCount() const;
+			inline const void* GetFramePixels() const;
+			inline Time GetFrameTime() const;
+			inline Time GetPlayingOffset() const;
+			inline const std::shared_ptr<ImageStream>& GetStream() const;
+
+			bool IsFinished() const;
+			inline bool IsLooping() const;
+			inline bool IsValid() const;
+
+			void Seek(UInt64 frameIndex);
+
+			bool Update(Time elapsedTime);
+
+			ImageStreamPlayer& operator=(const ImageStreamPlayer&) = delete;
+			ImageStreamPlayer& operator=(ImageStreamPlayer&&) = delete;
+
+			static constexpr std::size_t DefaultBufferedFrameCount = 3;
+
+		private:
+			struct Frame
+			{
+				std::vector<UInt8> pixels;
+				Time time;
+			};
+
+			void DecodingThread();
+
+			static constexpr std::size_t InvalidFrame = std::numeric_limits<std::size_t>::max();
+
+			std::condition_variable m_decoderCondition;
+			mutable std::mutex m_mutex;
+			std::shared_ptr<ImageStream> m_stream;
+			std::size_t m_currentFrame;
+			std::size_t m_firstQueuedFrame;
+			std::size_t m_queuedFrameCount;
+			std::thread m_thread;
+			std::vector<Frame> m_frames;
+			Time m_playingOffset;
+			UInt64 m_seekFrameIndex;
+			bool m_endOfStream;
+			bool m_looping;
+			bool m_resyncPlayingOffset;
+			bool m_running;
+			bool m_seekRequested;
+	};
+}
+
+#include <Nazara/Utility/ImageStreamPlayer.inl>
+
+#endif // NAZARA_UTILITY_IMAGESTREAMPLAYER_HPP
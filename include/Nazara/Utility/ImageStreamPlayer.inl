@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of frames decoded ahead and waiting to be presented
+	*/
+	inline std::size_t ImageStreamPlayer::GetBufferedFrameCount() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_queuedFrameCount;
+	}
+
+	/*!
+	* \brief Gets the pixels of the presented frame, in the stream pixel format
+	* \return Frame pixels or nullptr if no frame has been presented yet
+	*
+	* \remark Pixels stay valid until the next call to Update or Seek
+	*/
+	inline const void* ImageStreamPlayer::GetFramePixels() const
+	{
+		if (m_currentFrame == InvalidFrame)
+			return nullptr;
+
+		return m_frames[m_currentFrame].pixels.data();
+	}
+
+	inline Time ImageStreamPlayer::GetFrameTime() const
+	{
+		if (m_currentFrame == InvalidFrame)
+			return Time::Zero();
+
+		return m_frames[m_currentFrame].time;
+	}
+
+	inline Time ImageStreamPlayer::GetPlayingOffset() const
+	{
+		return m_playingOffset;
+	}
+
+	inline const std::shared_ptr<ImageStream>& ImageStreamPlayer::GetStream() const
+	{
+		return m_stream;
+	}
+
+	inline bool ImageStreamPlayer::IsLooping() const
+	{
+		return m_looping;
+	}
+
+	inline bool ImageStreamPlayer::IsValid() const
+	{
+		return m_stream != nullptr;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -64,6 +64,24 @@ namespace Nz
 		bool optimizeIndexBuffers = false;
 		#endif
 
+		// Reorder triangles of static meshes to reduce overdraw, allowing the vertex cache efficiency to drop by overdrawThreshold.
+		bool optimizeOverdraw = false;
+		float overdrawThreshold = 1.05f;
+
+		// Reorder vertices of static meshes in the order they are used by the indices (and remove unused ones), improving vertex fetch locality.
+		bool optimizeVertexFetch = false;
+
+		// Split static meshes in meshlets, small clusters of triangles with their own bounding box.
+		bool generateMeshlets = false;
+		UInt32 meshletMaxVertexCount = 64;
+		UInt32 meshletMaxTriangleCount = 124;
+
+		// Number of simplified levels of detail to generate for static meshes, each level having lodReductionFactor times the triangles of the previous one.
+		// Generation stops early if the geometric error (relative to the mesh size) would exceed lodMaxError.
+		std::size_t lodCount = 0;
+		float lodReductionFactor = 0.5f;
+		float lodMaxError = 0.05f;
+
 		/* The declaration must have a Vector3f position component enabled
 		 * If the declaration has a Vector2f UV component enabled, UV are generated
 		 * If the declaration has a Vector3f Normals component enabled, Normals are generated.
@@ -110,6 +128,7 @@ namespace Nz
 			bool CreateStatic();
 			void Destroy();
 
+			void GenerateLods(std::size_t lodCount, float reductionFactor = 0.5f, float maxError = 0.05f);
 			void GenerateNormals();
 			void GenerateNormalsAndTangents();
 			void GenerateTangents();
@@ -11,7 +11,9 @@
 #include <Nazara/Utility/AbstractTextDrawer.hpp>
 #include <Nazara/Utility/Enums.hpp>
 #include <Nazara/Utility/Font.hpp>
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Nz
@@ -53,9 +55,11 @@ namespace Nz
 			std::size_t GetFontCount() const override;
 			const Glyph& GetGlyph(std::size_t index) const override;
 			std::size_t GetGlyphCount() const override;
+			UInt64 GetLayoutRevision() const override;
 			const Line& GetLine(std::size_t index) const override;
 			std::size_t GetLineCount() const override;
 			float GetMaxLineWidth() const override;
+			std::size_t GetUnchangedGlyphCount(UInt64 layoutRevision) const override;
 
 			inline const Color& GetTextColor() const;
 			inline const std::shared_ptr<Font>& GetTextFont() const;
@@ -104,11 +108,12 @@ namespace Nz
 			inline void ConnectFontSlots();
 			inline void DisconnectFontSlots();
 			bool GenerateGlyph(Glyph& glyph, char32_t character, float outlineThickness, bool lineWrap, const Font& font, const Color& color, TextStyleFlags style, float lineSpacingOffset, unsigned int characterSize, int renderOrder, int* advance) const;
-			void GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, const std::string& text) const;
+			void GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, std::string_view text, char32_t previousCharacter = 0) const;
 			inline float GetLineHeight(const Block& block) const;
 			inline float GetLineHeight(float lineSpacingOffset, const Font::SizeInfo& sizeInfo) const;
 			inline std::size_t HandleFontAddition(const std::shared_ptr<Font>& font);
 			inline void InvalidateGlyphs();
+			inline void InvalidateGlyphs(std::size_t firstBlockIndex);
 			inline void ReleaseFont(std::size_t fontIndex);
 			inline bool ShouldLineWrap(float size) const;
 
@@ -116,9 +121,12 @@ namespace Nz
 			void OnFontInvalidated(const Font* font);
 			void OnFontRelease(const Font* object);
 
+			void RestoreBlockLayout(std::size_t blockIndex) const;
+			void SaveBlockLayout(std::size_t blockIndex) const;
 			void UpdateGlyphs() const;
 
 			static constexpr std::size_t InvalidGlyph = std::numeric_limits<std::size_t>::max();
+			static constexpr std::size_t InvalidTextOffset = std::numeric_limits<std::size_t>::max();
 
 			struct Block
 			{
@@ -134,6 +142,20 @@ namespace Nz
 				unsigned int characterSize;
 			};
 
+			// Layout state when a block starts, allowing to generate glyphs again from this block
+			// (glyphs of the current line are saved as next blocks may move them, ex: line wrap or higher line)
+			struct BlockLayout
+			{
+				std::size_t glyphCount;
+				std::size_t lastSeparatorGlyph;
+				std::size_t lineCount;
+				std::vector<Glyph> lineGlyphs;
+				Line line;
+				Rectf bounds;
+				Vector2f drawPos;
+				float lastSeparatorPosition;
+			};
+
 			struct FontData
 			{
 				std::shared_ptr<Font> font;
@@ -149,20 +171,27 @@ namespace Nz
 			Color m_currentOutlineColor;
 			TextStyleFlags m_currentStyle;
 			std::shared_ptr<Font> m_currentFont;
+			mutable std::size_t m_appendedTextOffset;
+			mutable std::size_t m_firstChangedGlyph;
+			mutable std::size_t m_firstInvalidBlock;
 			mutable std::size_t m_lastSeparatorGlyph;
 			std::unordered_map<std::shared_ptr<Font>, std::size_t> m_fontIndexes;
 			std::vector<Block> m_blocks;
 			std::vector<FontData> m_fonts;
+			mutable std::vector<BlockLayout> m_blockLayouts;
 			mutable std::vector<Glyph> m_glyphs;
 			mutable std::vector<Line> m_lines;
 			mutable Rectf m_bounds;
 			mutable Vector2f m_drawPos;
+			mutable UInt64 m_layoutRevision;
+			mutable UInt64 m_previousLayoutRevision;
 			mutable bool m_glyphUpdated;
 			float m_currentCharacterSpacingOffset;
 			float m_currentLineSpacingOffset;
 			float m_currentOutlineThickness;
 			float m_maxLineWidth;
 			unsigned int m_currentCharacterSize;
+			mutable char32_t m_lastCharacter;
 			mutable float m_lastSeparatorPosition;
 	};
 
@@ -265,7 +265,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].characterSize = characterSize;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockCharacterSpacingOffset(std::size_t index, float offset)
@@ -273,7 +273,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].characterSpacingOffset = offset;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockColor(std::size_t index, const Color& color)
@@ -281,7 +281,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].color = color;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockFont(std::size_t index, std::shared_ptr<Font> font)
@@ -298,7 +298,7 @@ namespace Nz
 			m_blocks[index].fontIndex = fontIndex;
 		}
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockLineSpacingOffset(std::size_t index, float offset)
@@ -306,7 +306,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].lineSpacingOffset = offset;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockOutlineColor(std::size_t index, const Color& color)
@@ -314,7 +314,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].outlineColor = color;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockOutlineThickness(std::size_t index, float thickness)
@@ -322,7 +322,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].outlineThickness = thickness;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockStyle(std::size_t index, TextStyleFlags style)
@@ -330,7 +330,7 @@ namespace Nz
 		NazaraAssert(index < m_blocks.size(), "Invalid block index");
 		m_blocks[index].style = style;
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetBlockText(std::size_t index, std::string str)
@@ -349,7 +349,7 @@ namespace Nz
 				m_blocks[i].glyphIndex += delta;
 		}
 
-		InvalidateGlyphs();
+		InvalidateGlyphs(index);
 	}
 
 	inline void RichTextDrawer::SetCharacterSize(unsigned int characterSize)
@@ -394,6 +394,14 @@ namespace Nz
 
 	inline void RichTextDrawer::InvalidateGlyphs()
 	{
+		InvalidateGlyphs(0);
+	}
+
+	inline void RichTextDrawer::InvalidateGlyphs(std::size_t firstBlockIndex)
+	{
+		// Glyphs will be generated again starting from this block
+		m_appendedTextOffset = InvalidTextOffset;
+		m_firstInvalidBlock = std::min(m_firstInvalidBlock, firstBlockIndex);
 		m_glyphUpdated = false;
 	}
 
@@ -8,36 +8,59 @@
 #define NAZARA_UTILITY_STATICMESH_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/SubMesh.hpp>
+#include <vector>
 
 namespace Nz
 {
+	struct MeshParams;
+
+	struct StaticMeshLod
+	{
+		std::shared_ptr<IndexBuffer> indexBuffer;
+		float error; //< geometric error relative to the mesh size
+	};
+
 	class NAZARA_UTILITY_API StaticMesh final : public SubMesh
 	{
 		public:
 			StaticMesh(std::shared_ptr<VertexBuffer> vertexBuffer, std::shared_ptr<IndexBuffer> indexBuffer);
 			~StaticMesh() = default;
 
+			void BuildMeshlets(UInt32 maxVertexCount = 64, UInt32 maxTriangleCount = 124);
+
 			void Center();
 
 			bool GenerateAABB();
+			void GenerateLods(std::size_t lodCount, float reductionFactor, float maxError, BufferUsageFlags usage, const BufferFactory& bufferFactory);
 
 			const Boxf& GetAABB() const override;
 			AnimationType GetAnimationType() const final;
 			const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override;
+			inline const std::vector<StaticMeshLod>& GetLods() const;
+			inline const MeshletData& GetMeshlets() const;
 			const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const;
 			UInt32 GetVertexCount() const override;
 
+			inline bool HasMeshlets() const;
+
 			bool IsAnimated() const final;
 			bool IsValid() const;
 
+			void Optimize(const MeshParams& params);
+			void OptimizeOverdraw(float threshold = 1.05f);
+			void OptimizeVertexFetch();
+
 			void SetAABB(const Boxf& aabb);
 			void SetIndexBuffer(std::shared_ptr<IndexBuffer> indexBuffer);
 
 		private:
 			Boxf m_aabb;
+			MeshletData m_meshlets;
 			std::shared_ptr<IndexBuffer> m_indexBuffer;
 			std::shared_ptr<VertexBuffer> m_vertexBuffer;
+			std::vector<StaticMeshLod> m_lods;
 	};
 }
 
@@ -7,6 +7,25 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns the simplified versions of the mesh, from the most to the least detailed
+	*
+	* Every level of detail shares the vertex buffer of the mesh and only has its own index buffer
+	*/
+	inline const std::vector<StaticMeshLod>& StaticMesh::GetLods() const
+	{
+		return m_lods;
+	}
+
+	inline const MeshletData& StaticMesh::GetMeshlets() const
+	{
+		return m_meshlets;
+	}
+
+	inline bool StaticMesh::HasMeshlets() const
+	{
+		return !m_meshlets.meshlets.empty();
+	}
 }
 
 #include <Nazara/Utility/DebugOff.hpp>
@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
+#define NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <NazaraUtils/Bitset.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	// Data-oriented alternative to Node for large hierarchies:
+	// transforms are stored as arrays sorted by hierarchy depth, so that global transforms can be updated
+	// with a linear pass (level by level, in parallel for large levels) instead of recursive invalidations
+	class NAZARA_UTILITY_API TransformHierarchy
+	{
+		public:
+			TransformHierarchy();
+			TransformHierarchy(const TransformHierarchy&) = default;
+			TransformHierarchy(TransformHierarchy&&) noexcept = default;
+			~TransformHierarchy() = default;
+
+			std::size_t AddNode(std::size_t parentIndex = InvalidNodeIndex, const Vector3f& position = Vector3f::Zero(), const Quaternionf& rotation = Quaternionf::Identity(), const Vector3f& scale = Vector3f::Unit());
+
+			void Clear();
+
+			inline const std::vector<std::size_t>& GetChangedNodes() const;
+			inline Vector3f GetGlobalPosition(std::size_t nodeIndex) const;
+			inline Quaternionf GetGlobalRotation(std::size_t nodeIndex) const;
+			inline Vector3f GetGlobalScale(std::size_t nodeIndex) const;
+			inline std::size_t GetNodeCount() const;
+			inline std::size_t GetParent(std::size_t nodeIndex) const;
+			inline Vector3f GetPosition(std::size_t nodeIndex) const;
+			inline Quaternionf GetRotation(std::size_t nodeIndex) const;
+			inline Vector3f GetScale(std::size_t nodeIndex) const;
+			inline const Matrix4f& GetTransformMatrix(std::size_t nodeIndex) const;
+
+			inline void Invalidate(std::size_t nodeIndex);
+			inline bool IsValid(std::size_t nodeIndex) const;
+
+			void RemoveNode(std::size_t nodeIndex);
+
+			inline void SetParallelThreshold(std::size_t nodeCount);
+			void SetParent(std::size_t nodeIndex, std::size_t parentIndex);
+			inline void SetPosition(std::size_t nodeIndex, const Vector3f& position);
+			inline void SetRotation(std::size_t nodeIndex, const Quaternionf& rotation);
+			inline void SetScale(std::size_t nodeIndex, const Vector3f& scale);
+			inline void SetTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation);
+			inline void SetTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale);
+
+			void Update();
+
+			TransformHierarchy& operator=(const TransformHierarchy&) = default;
+			TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+			static constexpr std::size_t InvalidNodeIndex = std::numeric_limits<std::size_t>::max();
+
+		private:
+			static constexpr UInt32 InvalidSlot = std::numeric_limits<UInt32>::max();
+
+			void RebuildOrder();
+			void UpdateSlots(std::size_t firstSlot, std::size_t lastSlot);
+
+			// Indexed by node index
+			std::vector<std::size_t> m_nodeParents;
+			std::vector<UInt32> m_nodeSlots;
+
+			// Indexed by slot (sorted by depth)
+			std::vector<Matrix4f> m_transformMatrices;
+			std::vector<Quaternionf> m_globalRotations;
+			std::vector<Quaternionf> m_rotations;
+			std::vector<UInt32> m_parentSlots;
+			std::vector<UInt32> m_slotNodes;
+			std::vector<UInt8> m_dirtySlots; //< not a bitset as slots of a same level are updated concurrently
+			std::vector<Vector3f> m_globalPositions;
+			std::vector<Vector3f> m_globalScales;
+			std::vector<Vector3f> m_positions;
+			std::vector<Vector3f> m_scales;
+
+			std::vector<std::size_t> m_changedNodes;
+			std::vector<std::size_t> m_levelOffsets;
+			Bitset<UInt64> m_freeNodeIndices;
+			std::size_t m_parallelThreshold;
+			bool m_orderInvalidated;
+	};
+}
+
+#include <Nazara/Utility/TransformHierarchy.inl>
+
+#endif // NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
@@ -0,0 +1,137 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <cassert>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Returns the nodes whose global transform changed during the last Update call
+	*/
+	inline const std::vector<std::size_t>& TransformHierarchy::GetChangedNodes() const
+	{
+		return m_changedNodes;
+	}
+
+	inline Vector3f TransformHierarchy::GetGlobalPosition(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_globalPositions[m_nodeSlots[nodeIndex]];
+	}
+
+	inline Quaternionf TransformHierarchy::GetGlobalRotation(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_globalRotations[m_nodeSlots[nodeIndex]];
+	}
+
+	inline Vector3f TransformHierarchy::GetGlobalScale(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_globalScales[m_nodeSlots[nodeIndex]];
+	}
+
+	inline std::size_t TransformHierarchy::GetNodeCount() const
+	{
+		return m_nodeSlots.size() - m_freeNodeIndices.Count();
+	}
+
+	inline std::size_t TransformHierarchy::GetParent(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_nodeParents[nodeIndex];
+	}
+
+	inline Vector3f TransformHierarchy::GetPosition(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_positions[m_nodeSlots[nodeIndex]];
+	}
+
+	inline Quaternionf TransformHierarchy::GetRotation(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_rotations[m_nodeSlots[nodeIndex]];
+	}
+
+	inline Vector3f TransformHierarchy::GetScale(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_scales[m_nodeSlots[nodeIndex]];
+	}
+
+	/*!
+	* \brief Returns the global transform matrix of a node, as computed by the last Update call
+	*/
+	inline const Matrix4f& TransformHierarchy::GetTransformMatrix(std::size_t nodeIndex) const
+	{
+		assert(IsValid(nodeIndex));
+		return m_transformMatrices[m_nodeSlots[nodeIndex]];
+	}
+
+	inline void TransformHierarchy::Invalidate(std::size_t nodeIndex)
+	{
+		assert(IsValid(nodeIndex));
+		m_dirtySlots[m_nodeSlots[nodeIndex]] = 1;
+	}
+
+	inline bool TransformHierarchy::IsValid(std::size_t nodeIndex) const
+	{
+		return nodeIndex < m_nodeSlots.size() && !m_freeNodeIndices.Test(nodeIndex);
+	}
+
+	/*!
+	* \brief Sets the minimal node count a hierarchy level must have to be updated using the task scheduler
+	*/
+	inline void TransformHierarchy::SetParallelThreshold(std::size_t nodeCount)
+	{
+		m_parallelThreshold = nodeCount;
+	}
+
+	inline void TransformHierarchy::SetPosition(std::size_t nodeIndex, const Vector3f& position)
+	{
+		assert(IsValid(nodeIndex));
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_positions[slot] = position;
+		m_dirtySlots[slot] = 1;
+	}
+
+	inline void TransformHierarchy::SetRotation(std::size_t nodeIndex, const Quaternionf& rotation)
+	{
+		assert(IsValid(nodeIndex));
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_rotations[slot] = rotation;
+		m_dirtySlots[slot] = 1;
+	}
+
+	inline void TransformHierarchy::SetScale(std::size_t nodeIndex, const Vector3f& scale)
+	{
+		assert(IsValid(nodeIndex));
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_scales[slot] = scale;
+		m_dirtySlots[slot] = 1;
+	}
+
+	inline void TransformHierarchy::SetTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation)
+	{
+		assert(IsValid(nodeIndex));
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_positions[slot] = position;
+		m_rotations[slot] = rotation;
+		m_dirtySlots[slot] = 1;
+	}
+
+	inline void TransformHierarchy::SetTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale)
+	{
+		assert(IsValid(nodeIndex));
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_positions[slot] = position;
+		m_rotations[slot] = rotation;
+		m_scales[slot] = scale;
+		m_dirtySlots[slot] = 1;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
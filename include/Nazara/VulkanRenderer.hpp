@@ -50,6 +50,7 @@
 #include <Nazara/VulkanRenderer/VulkanSwapchain.hpp>
 #include <Nazara/VulkanRenderer/VulkanTexture.hpp>
 #include <Nazara/VulkanRenderer/VulkanTextureFramebuffer.hpp>
+#include <Nazara/VulkanRenderer/VulkanTextureHeap.hpp>
 #include <Nazara/VulkanRenderer/VulkanTextureSampler.hpp>
 #include <Nazara/VulkanRenderer/VulkanUploadPool.hpp>
 #include <Nazara/VulkanRenderer/VulkanWindowFramebuffer.hpp>
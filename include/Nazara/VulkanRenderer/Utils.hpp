@@ -44,6 +44,7 @@ namespace Nz
 	inline VkShaderStageFlagBits ToVulkan(nzsl::ShaderStageType stageType);
 	inline VkShaderStageFlags ToVulkan(nzsl::ShaderStageTypeFlags stageType);
 	inline VkStencilOp ToVulkan(StencilOperation stencilOp);
+	inline VkSubpassContents ToVulkan(SubpassContents subpassContents);
 	inline VkImageLayout ToVulkan(TextureLayout textureLayout);
 	inline VkImageUsageFlagBits ToVulkan(TextureUsage textureLayout);
 	inline VkImageUsageFlags ToVulkan(TextureUsageFlags textureLayout);
@@ -459,6 +459,18 @@ namespace Nz
 		return {};
 	}
 
+	inline VkSubpassContents ToVulkan(SubpassContents subpassContents)
+	{
+		switch (subpassContents)
+		{
+			case SubpassContents::Inline:                  return VK_SUBPASS_CONTENTS_INLINE;
+			case SubpassContents::SecondaryCommandBuffers: return VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+		}
+
+		NazaraError("unhandled SubpassContents {0:#x})", UnderlyingCast(subpassContents));
+		return {};
+	}
+
 	inline VkImageLayout ToVulkan(TextureLayout textureLayout)
 	{
 		switch (textureLayout)
@@ -20,12 +20,13 @@ namespace Nz
 	{
 		public:
 			inline VulkanCommandBufferBuilder(Vk::CommandBuffer& commandBuffer);
+			inline VulkanCommandBufferBuilder(Vk::CommandBuffer& commandBuffer, const VulkanRenderPass& renderPass, std::size_t subpassIndex);
 			VulkanCommandBufferBuilder(const VulkanCommandBufferBuilder&) = delete;
 			VulkanCommandBufferBuilder(VulkanCommandBufferBuilder&&) noexcept = default;
 			~VulkanCommandBufferBuilder() = default;
 
 			void BeginDebugRegion(std::string_view regionName, const Color& color) override;
-			void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount) override;
+			void BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount, SubpassContents contents = SubpassContents::Inline) override;
 
 			void BindComputePipeline(const ComputePipeline& pipeline) override;
 			void BindComputeShaderBinding(UInt32 set, const ShaderBinding& binding) override;
@@ -48,13 +49,21 @@ namespace Nz
 
 			void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0) override;
 			void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 firstInstance = 0) override;
+			void DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset = 0, UInt32 drawCount = 1, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) override;
+			void DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) override;
+			void DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset = 0, UInt32 drawCount = 1, UInt32 stride = sizeof(DrawIndirectCommand)) override;
+			void DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndirectCommand)) override;
 
 			void EndDebugRegion() override;
 			void EndRenderPass() override;
 
+			void ExecuteSecondaryCommandBuffer(const CommandBuffer& commandBuffer) override;
+
 			inline Vk::CommandBuffer& GetCommandBuffer();
-			
-			void NextSubpass() override;
+
+			void MemoryBarrier(PipelineStageFlags srcStageMask, PipelineStageFlags dstStageMask, MemoryAccessFlags srcAccessMask, MemoryAccessFlags dstAccessMask) override;
+
+			void NextSubpass(SubpassContents contents = SubpassContents::Inline) override;
 
 			void PreTransferBarrier() override;
 			void PostTransferBarrier() override;
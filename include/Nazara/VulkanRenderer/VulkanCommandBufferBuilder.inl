@@ -7,7 +7,16 @@
 namespace Nz
 {
 	inline VulkanCommandBufferBuilder::VulkanCommandBufferBuilder(Vk::CommandBuffer& commandBuffer) :
-	m_commandBuffer(commandBuffer)
+	m_commandBuffer(commandBuffer),
+	m_currentRenderPass(nullptr),
+	m_currentSubpassIndex(0)
+	{
+	}
+
+	inline VulkanCommandBufferBuilder::VulkanCommandBufferBuilder(Vk::CommandBuffer& commandBuffer, const VulkanRenderPass& renderPass, std::size_t subpassIndex) :
+	m_commandBuffer(commandBuffer),
+	m_currentRenderPass(&renderPass),
+	m_currentSubpassIndex(subpassIndex)
 	{
 	}
 
@@ -29,6 +29,7 @@ namespace Nz
 			~VulkanCommandPool() = default;
 
 			CommandBufferPtr BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback) override;
+			CommandBufferPtr BuildSecondaryCommandBuffer(const Framebuffer& framebuffer, const RenderPass& renderPass, UInt32 subpassIndex, const std::function<void(CommandBufferBuilder& builder)>& callback) override;
 
 			void UpdateDebugName(std::string_view name) override;
 
@@ -40,6 +41,7 @@ namespace Nz
 
 			CommandPool& AllocatePool();
 			template<typename... Args> CommandBufferPtr AllocateFromPool(std::size_t poolIndex, Args&&... args);
+			CommandBufferPtr RegisterCommandBuffer(Vk::AutoCommandBuffer commandBuffer);
 			void Release(CommandBuffer& commandBuffer);
 			inline void TryToShrink();
 
@@ -10,6 +10,7 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/DescriptorSetLayout.hpp>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -21,6 +22,7 @@ namespace Nz
 	struct VulkanDescriptorSetLayoutInfo
 	{
 		VkDescriptorSetLayoutCreateFlags createFlags = 0;
+		std::vector<VkDescriptorBindingFlags> bindingFlags; //< empty or one entry per binding
 		std::vector<VkDescriptorSetLayoutBinding> bindings;
 	};
 
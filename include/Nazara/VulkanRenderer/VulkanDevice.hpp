@@ -11,6 +11,7 @@
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/VulkanRenderer/VulkanBuffer.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
+#include <Nazara/VulkanRenderer/Wrapper/PipelineCache.hpp>
 #include <vector>
 
 namespace Nz
@@ -23,8 +24,13 @@ namespace Nz
 			VulkanDevice(VulkanDevice&&) = delete; ///TODO?
 			~VulkanDevice();
 
+			bool Create(const Vk::PhysicalDevice& deviceInfo, const VkDeviceCreateInfo& createInfo, const VkAllocationCallbacks* allocator = nullptr);
+
 			const RenderDeviceInfo& GetDeviceInfo() const override;
 			const RenderDeviceFeatures& GetEnabledFeatures() const override;
+			inline VkPipelineCache GetPipelineCache() const;
+			std::vector<UInt8> GetPipelineCacheData() const override;
+			TextureMemoryRequirements GetTextureMemoryRequirements(const TextureInfo& textureInfo) override;
 
 			std::shared_ptr<RenderBuffer> InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData = nullptr) override;
 			std::shared_ptr<CommandPool> InstantiateCommandPool(QueueType queueType) override;
@@ -38,10 +44,13 @@ namespace Nz
 			std::shared_ptr<Swapchain> InstantiateSwapchain(WindowHandle windowHandle, const Vector2ui& windowSize, const SwapchainParameters& parameters) override;
 			std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params) override;
 			std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params, const void* initialData, bool buildMipmaps, unsigned int srcWidth = 0, unsigned int srcHeight = 0) override;
+			std::shared_ptr<TextureHeap> InstantiateTextureHeap(const TextureMemoryRequirements& heapRequirements) override;
 			std::shared_ptr<TextureSampler> InstantiateTextureSampler(const TextureSamplerInfo& params) override;
 
 			bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const override;
 
+			bool LoadPipelineCacheData(const void* data, std::size_t size) override;
+
 			void WaitForIdle() override;
 
 			VulkanDevice& operator=(const VulkanDevice&) = delete;
@@ -50,6 +59,7 @@ namespace Nz
 		private:
 			RenderDeviceFeatures m_enabledFeatures;
 			RenderDeviceInfo m_renderDeviceInfo;
+			Vk::PipelineCache m_pipelineCache;
 	};
 }
 
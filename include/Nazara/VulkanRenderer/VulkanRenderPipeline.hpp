@@ -15,6 +15,7 @@
 #include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/Pipeline.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -36,6 +37,8 @@ namespace Nz
 
 			inline const RenderPipelineInfo& GetPipelineInfo() const override;
 
+			void Prewarm(const RenderPass& renderPass, std::size_t subpassIndex) const override;
+
 			void UpdateDebugName(std::string_view name) override;
 
 			VulkanRenderPipeline& operator=(const VulkanRenderPipeline&) = delete;
@@ -97,6 +100,7 @@ namespace Nz
 			};
 
 			std::string m_debugName;
+			mutable std::shared_mutex m_pipelineMutex;
 			mutable std::unordered_map<std::pair<VkRenderPass, std::size_t>, PipelineData, PipelineHasher> m_pipelines;
 			MovablePtr<Vk::Device> m_device;
 			mutable CreateInfo m_pipelineCreateInfo;
@@ -12,12 +12,14 @@
 #include <Nazara/VulkanRenderer/Config.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/Image.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/ImageView.hpp>
+#include <memory>
 #include <optional>
 
 namespace Nz
 {
 	class VulkanBuffer;
 	class VulkanDevice;
+	class VulkanTextureHeap;
 
 	namespace Vk
 	{
@@ -28,6 +30,7 @@ namespace Nz
 	{
 		public:
 			VulkanTexture(VulkanDevice& device, const TextureInfo& textureInfo);
+			VulkanTexture(std::shared_ptr<VulkanTextureHeap> heap, const TextureInfo& textureInfo, UInt64 heapOffset);
 			VulkanTexture(VulkanDevice& device, const TextureInfo& textureInfo, const void* initialData, bool buildMipmaps, unsigned int srcWidth = 0, unsigned int srcHeight = 0);
 			VulkanTexture(std::shared_ptr<VulkanTexture> parentTexture, const TextureViewInfo& viewInfo);
 			VulkanTexture(const VulkanTexture&) = delete;
@@ -61,11 +64,16 @@ namespace Nz
 			VulkanTexture& operator=(const VulkanTexture&) = delete;
 			VulkanTexture& operator=(VulkanTexture&&) = delete;
 
+			static void BuildCreateInfo(const TextureInfo& textureInfo, VkImageCreateInfo& createInfo, VkImageViewCreateInfo& createInfoView);
+
 		private:
+			void CreateDefaultView(const VkImageCreateInfo& createInfo, VkImageViewCreateInfo& createInfoView);
+
 			static void InitViewForFormat(PixelFormat pixelFormat, VkImageViewCreateInfo& createImageView);
 
 			std::optional<TextureViewInfo> m_viewInfo;
 			std::shared_ptr<VulkanTexture> m_parentTexture;
+			std::shared_ptr<VulkanTextureHeap> m_heap;
 			VulkanDevice& m_device;
 			VkImage m_image;
 			VkImageSubresourceRange m_subresourceRange;
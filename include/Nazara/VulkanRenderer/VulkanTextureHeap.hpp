@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Vulkan renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_VULKANRENDERER_VULKANTEXTUREHEAP_HPP
+#define NAZARA_VULKANRENDERER_VULKANTEXTUREHEAP_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Renderer/TextureHeap.hpp>
+#include <Nazara/VulkanRenderer/Config.hpp>
+#include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class VulkanDevice;
+
+	class NAZARA_VULKANRENDERER_API VulkanTextureHeap final : public TextureHeap, public std::enable_shared_from_this<VulkanTextureHeap>
+	{
+		public:
+			VulkanTextureHeap(VulkanDevice& device, const TextureMemoryRequirements& heapRequirements);
+			VulkanTextureHeap(const VulkanTextureHeap&) = delete;
+			VulkanTextureHeap(VulkanTextureHeap&&) = delete;
+			~VulkanTextureHeap();
+
+			inline VmaAllocation GetAllocation() const;
+			inline VulkanDevice& GetDevice() const;
+
+			std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& textureInfo, UInt64 offset) override;
+
+			void UpdateDebugName(std::string_view name) override;
+
+			VulkanTextureHeap& operator=(const VulkanTextureHeap&) = delete;
+			VulkanTextureHeap& operator=(VulkanTextureHeap&&) = delete;
+
+		private:
+			VmaAllocation m_allocation;
+			VulkanDevice& m_device;
+	};
+}
+
+#include <Nazara/VulkanRenderer/VulkanTextureHeap.inl>
+
+#endif // NAZARA_VULKANRENDERER_VULKANTEXTUREHEAP_HPP
@@ -0,0 +1,20 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Vulkan renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/VulkanRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline VmaAllocation VulkanTextureHeap::GetAllocation() const
+	{
+		return m_allocation;
+	}
+
+	inline VulkanDevice& VulkanTextureHeap::GetDevice() const
+	{
+		return m_device;
+	}
+}
+
+#include <Nazara/VulkanRenderer/DebugOff.hpp>
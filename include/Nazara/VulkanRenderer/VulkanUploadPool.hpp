@@ -12,6 +12,8 @@
 #include <Nazara/VulkanRenderer/Wrapper/Buffer.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/DeviceMemory.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <array>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -40,6 +42,12 @@ namespace Nz
 			VulkanUploadPool& operator=(VulkanUploadPool&&) = delete;
 
 		private:
+			struct Block;
+
+			VulkanAllocation& AllocateDedicated(UInt64 size);
+			Block CreateBlock(UInt64 size);
+			VulkanAllocation& PushAllocation(Block& block, UInt64 offset, UInt64 size);
+
 			static constexpr std::size_t AllocationPerBlock = 2048;
 
 			using AllocationBlock = std::array<VulkanAllocation, AllocationPerBlock>;
@@ -54,9 +62,12 @@ namespace Nz
 
 			UInt64 m_blockSize;
 			Vk::Device& m_device;
+			std::size_t m_currentBlockIndex;
 			std::size_t m_nextAllocationIndex;
 			std::vector<std::unique_ptr<AllocationBlock>> m_allocationBlocks;
 			std::vector<Block> m_blocks;
+			std::vector<Block> m_dedicatedBlocks;
+			std::vector<Block> m_freeDedicatedBlocks;
 	};
 }
 
@@ -9,6 +9,7 @@ namespace Nz
 	inline VulkanUploadPool::VulkanUploadPool(Vk::Device& device, UInt64 blockSize) :
 	m_blockSize(blockSize),
 	m_device(device),
+	m_currentBlockIndex(0),
 	m_nextAllocationIndex(0)
 	{
 	}
@@ -316,6 +316,26 @@ namespace Nz
 			return m_pool->GetDevice()->vkCmdDrawIndexed(m_handle, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 		}
 
+		inline void CommandBuffer::DrawIndexedIndirect(VkBuffer buffer, VkDeviceSize offset, UInt32 drawCount, UInt32 stride)
+		{
+			return m_pool->GetDevice()->vkCmdDrawIndexedIndirect(m_handle, buffer, offset, drawCount, stride);
+		}
+
+		inline void CommandBuffer::DrawIndexedIndirectCount(VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, UInt32 maxDrawCount, UInt32 stride)
+		{
+			return m_pool->GetDevice()->vkCmdDrawIndexedIndirectCount(m_handle, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+
+		inline void CommandBuffer::DrawIndirect(VkBuffer buffer, VkDeviceSize offset, UInt32 drawCount, UInt32 stride)
+		{
+			return m_pool->GetDevice()->vkCmdDrawIndirect(m_handle, buffer, offset, drawCount, stride);
+		}
+
+		inline void CommandBuffer::DrawIndirectCount(VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, UInt32 maxDrawCount, UInt32 stride)
+		{
+			return m_pool->GetDevice()->vkCmdDrawIndirectCount(m_handle, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		}
+
 		inline bool CommandBuffer::End()
 		{
 			m_lastErrorCode = m_pool->GetDevice()->vkEndCommandBuffer(m_handle);
@@ -340,6 +360,16 @@ namespace Nz
 			return m_pool->GetDevice()->vkCmdEndRenderPass(m_handle);
 		}
 
+		inline void CommandBuffer::ExecuteCommands(VkCommandBuffer commandBuffer)
+		{
+			return ExecuteCommands(1U, &commandBuffer);
+		}
+
+		inline void CommandBuffer::ExecuteCommands(UInt32 commandBufferCount, const VkCommandBuffer* commandBuffers)
+		{
+			return m_pool->GetDevice()->vkCmdExecuteCommands(m_handle, commandBufferCount, commandBuffers);
+		}
+
 		inline void CommandBuffer::Free()
 		{
 			if (m_handle)
@@ -131,6 +131,7 @@ NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetFenceStatus)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetPipelineCacheData)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetRenderAreaGranularity)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkInvalidateMappedMemoryRanges)
 NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkMapMemory)
@@ -150,6 +151,9 @@ NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkWaitForFences)
 NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkBindBufferMemory2, VK_API_VERSION_1_1, KHR, bind_memory2)
 NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkBindImageMemory2, VK_API_VERSION_1_1, KHR, bind_memory2)
 
+NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkCmdDrawIndexedIndirectCount, VK_API_VERSION_1_2, KHR, draw_indirect_count)
+NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkCmdDrawIndirectCount, VK_API_VERSION_1_2, KHR, draw_indirect_count)
+
 NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkGetBufferMemoryRequirements2, VK_API_VERSION_1_1, KHR, get_memory_requirements2)
 NAZARA_VULKANRENDERER_DEVICE_CORE_EXT_FUNCTION(vkGetImageMemoryRequirements2, VK_API_VERSION_1_1, KHR, get_memory_requirements2)
 
@@ -17,6 +17,7 @@ namespace Nz::Vk
 	struct PhysicalDevice
 	{
 		VkPhysicalDevice physDevice;
+		VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures;
 		VkPhysicalDeviceFeatures features;
 		VkPhysicalDeviceMemoryProperties memoryProperties;
 		VkPhysicalDeviceProperties properties;
@@ -2,12 +2,64 @@
 // This file is part of the "Nazara Engine - Vulkan renderer"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <cassert>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
 namespace Nz
 {
 	namespace Vk
 	{
+		inline bool PipelineCache::Create(Device& device, const void* initialData, std::size_t initialDataSize, const VkAllocationCallbacks* allocator)
+		{
+			VkPipelineCacheCreateInfo createInfo = {
+				VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+				nullptr,
+				0U,
+				initialDataSize,
+				initialData
+			};
+
+			return Create(device, createInfo, allocator);
+		}
+
+		inline bool PipelineCache::GetData(std::vector<UInt8>* data) const
+		{
+			assert(data);
+
+			std::size_t dataSize = 0;
+			m_lastErrorCode = m_device->vkGetPipelineCacheData(*m_device, m_handle, &dataSize, nullptr);
+			if (m_lastErrorCode != VK_SUCCESS)
+			{
+				NazaraError("failed to query pipeline cache data size: {0}", TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			data->resize(dataSize);
+			m_lastErrorCode = m_device->vkGetPipelineCacheData(*m_device, m_handle, &dataSize, data->data());
+			if (m_lastErrorCode != VK_SUCCESS && m_lastErrorCode != VK_INCOMPLETE)
+			{
+				NazaraError("failed to retrieve pipeline cache data: {0}", TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			data->resize(dataSize);
+			return true;
+		}
+
+		inline bool PipelineCache::Merge(const PipelineCache& pipelineCache)
+		{
+			VkPipelineCache sourceCache = pipelineCache;
+
+			m_lastErrorCode = m_device->vkMergePipelineCaches(*m_device, m_handle, 1U, &sourceCache);
+			if (m_lastErrorCode != VK_SUCCESS)
+			{
+				NazaraError("failed to merge pipeline caches: {0}", TranslateVulkanError(m_lastErrorCode));
+				return false;
+			}
+
+			return true;
+		}
+
 		inline VkResult PipelineCache::CreateHelper(Device& device, const VkPipelineCacheCreateInfo* createInfo, const VkAllocationCallbacks* allocator, VkPipelineCache* handle)
 		{
 			return device.vkCreatePipelineCache(device, createInfo, allocator, handle);
@@ -10,8 +10,11 @@
 #include <Nazara/Platform/CursorController.hpp>
 #include <Nazara/Platform/WindowEventHandler.hpp>
 #include <Nazara/Widgets/BaseWidget.hpp>
+#include <NazaraUtils/Bitset.hpp>
 #include <entt/entity/registry.hpp>
 #include <bitset>
+#include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -69,15 +72,25 @@ namespace Nz
 			void OnEventTextEntered(const WindowEventHandler* eventHandler, const WindowEvent::TextEvent& event);
 			void OnEventTextEdited(const WindowEventHandler* eventHandler, const WindowEvent::EditEvent& event);
 
+			void IndexWidget(std::size_t index);
+			void UnindexWidget(std::size_t index);
 			void UpdateHoveredWidget(int x, int y);
+			void UpdateWidgetBoxes();
+
+			static inline UInt64 GetCellKey(int x, int y);
 
 			struct WidgetEntry
 			{
 				BaseWidget* widget;
 				Boxf box;
+				Recti cells; //< cell range in the hover grid (empty if not indexed)
 				SystemCursor cursor;
+				bool isLargeWidget; //< too many cells covered, tested on every hover update
 			};
 
+			static constexpr float GridCellSize = 64.f;
+			static constexpr int MaxWidgetCellCount = 64;
+
 			NazaraSlot(WindowEventHandler, OnKeyPressed, m_keyPressedSlot);
 			NazaraSlot(WindowEventHandler, OnKeyReleased, m_keyReleasedSlot);
 			NazaraSlot(WindowEventHandler, OnMouseButtonPressed, m_mouseButtonPressedSlot);
@@ -95,7 +108,11 @@ namespace Nz
 			std::size_t m_keyboardOwner;
 			std::size_t m_hoveredWidget;
 			std::size_t m_mouseOwner;
+			std::unordered_map<UInt64, std::vector<std::size_t>> m_widgetGrid;
+			std::vector<std::size_t> m_hoverCandidates;
+			std::vector<std::size_t> m_largeWidgets;
 			std::vector<WidgetEntry> m_widgetEntries;
+			Bitset<UInt64> m_dirtyWidgetBoxes;
 			entt::registry& m_registry;
 	};
 }
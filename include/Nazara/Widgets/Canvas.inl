@@ -63,12 +63,8 @@ namespace Nz
 
 	inline void Canvas::NotifyWidgetBoxUpdate(std::size_t index)
 	{
-		WidgetEntry& entry = m_widgetEntries[index];
-
-		Nz::Vector3f pos = entry.widget->GetPosition(Nz::CoordSys::Global);
-		Nz::Vector2f size = entry.widget->GetSize();
-
-		entry.box = Boxf(pos.x, pos.y, pos.z, size.x, size.y, 1.f);
+		// Boxes are only needed for mouse events, update them lazily as moving a widget invalidates all its children
+		m_dirtyWidgetBoxes.UnboundedSet(index);
 	}
 
 	inline void Canvas::NotifyWidgetCursorUpdate(std::size_t index)
@@ -100,6 +96,11 @@ namespace Nz
 	{
 		m_mouseOwner = canvasIndex;
 	}
+
+	inline UInt64 Canvas::GetCellKey(int x, int y)
+	{
+		return (UInt64(UInt32(x)) << 32) | UInt32(y);
+	}
 }
 
 #include <Nazara/Widgets/DebugOff.hpp>
@@ -26,6 +26,8 @@ SOFTWARE.
 #include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/Image.hpp>
@@ -47,6 +49,7 @@ SOFTWARE.
 #include <assimp/mesh.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <exception>
 #include <limits>
 #include <unordered_map>
 #include <unordered_set>
@@ -392,7 +395,176 @@ Nz::Result<std::shared_ptr<Nz::Animation>, Nz::ResourceLoadingError> LoadAnimati
 using EmbeddedTextures = std::unordered_map<const aiTexture*, std::filesystem::path>;
 using MaterialData = std::unordered_map<unsigned int, std::pair<Nz::UInt32, Nz::ParameterList>>;
 
-std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originPath, const Nz::MeshParams& parameters, const aiScene* scene, const aiMesh* meshData, bool isSkeletalMesh, MaterialData& materialData, const std::unordered_map<const aiBone*, unsigned int>& boneToJointIndex, EmbeddedTextures& embeddedTextures)
+Nz::ParameterList ProcessMaterial(const std::filesystem::path& originPath, const aiScene* scene, unsigned int materialIndex, EmbeddedTextures& embeddedTextures)
+{
+	Nz::ParameterList matData;
+	const aiMaterial* aiMat = scene->mMaterials[materialIndex];
+
+	auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const char* colorKey)
+	{
+		aiColor4D color;
+		if (aiGetMaterialColor(aiMat, aiKey, aiType, aiIndex, &color) == aiReturn_SUCCESS)
+		{
+			matData.SetParameter(colorKey, Nz::Color(color.r, color.g, color.b, color.a));
+			return true;
+		}
+
+		return false;
+	};
+
+	auto SaveEmbeddedTextureToFile = [](const aiTexture* embeddedTexture, const std::filesystem::path& basePath, const char* filename) -> std::filesystem::path
+	{
+		if (basePath.empty())
+		{
+			NazaraError("can't create embedded resource folder (empty base path)");
+			return {};
+		}
+
+		std::filesystem::path targetPath = basePath / "embedded";
+
+		if (!std::filesystem::is_directory(targetPath))
+		{
+			if (!std::filesystem::create_directory(targetPath))
+			{
+				NazaraError("can't create embedded resource folder (folder creation failed)");
+				return {};
+			}
+		}
+
+		targetPath /= std::filesystem::u8path(filename);
+
+		if (embeddedTexture->mHeight == 0)
+		{
+			// Compressed data (PNG, JPG, etc.)
+			if (!embeddedTexture->achFormatHint[0])
+			{
+				NazaraError("can't create embedded texture file (no format hint)");
+				return {};
+			}
+
+			targetPath.replace_extension(std::filesystem::u8path(embeddedTexture->achFormatHint));
+
+			if (!Nz::File::WriteWhole(targetPath, embeddedTexture->pcData, embeddedTexture->mWidth))
+				return {};
+
+			return targetPath;
+		}
+		else
+		{
+			// Uncompressed data (always ARGB8 it seems)
+			Nz::Image uncompressedData(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8_SRGB, embeddedTexture->mWidth, embeddedTexture->mHeight);
+			const aiTexel* sourceData = embeddedTexture->pcData;
+			Nz::UInt8* imageData = uncompressedData.GetPixels();
+			for (unsigned int y = 0; y < embeddedTexture->mHeight; ++y)
+			{
+				for (unsigned int x = 0; x < embeddedTexture->mWidth; ++x)
+				{
+					*imageData++ = sourceData->r;
+					*imageData++ = sourceData->g;
+					*imageData++ = sourceData->b;
+					*imageData++ = sourceData->a;
+
+					++sourceData;
+				}
+			}
+
+			// Compress to PNG
+			targetPath.replace_extension(".png");
+
+			if (!uncompressedData.SaveToFile(targetPath))
+				return {};
+
+			return targetPath;
+		}
+	};
+
+	auto ConvertTexture = [&] (aiTextureType aiType, const char* textureKey, const char* wrapKey = nullptr)
+	{
+		aiString path;
+		aiTextureMapMode mapMode[3];
+		if (aiGetMaterialTexture(aiMat, aiType, 0, &path, nullptr, nullptr, nullptr, nullptr, &mapMode[0], nullptr) == aiReturn_SUCCESS)
+		{
+			if (const aiTexture* embeddedTexture = scene->GetEmbeddedTexture(path.C_Str()))
+			{
+				std::filesystem::path embeddedTexturePath;
+				if (auto it = embeddedTextures.find(embeddedTexture); it == embeddedTextures.end())
+				{
+					embeddedTexturePath = SaveEmbeddedTextureToFile(embeddedTexture, originPath, aiScene::GetShortFilename(path.C_Str()));
+					if (embeddedTexturePath.empty())
+						NazaraError("failed to save embedded texture to file");
+
+					embeddedTextures.emplace(embeddedTexture, embeddedTexturePath);
+				}
+				else
+					embeddedTexturePath = it->second;
+
+				matData.SetParameter(textureKey, Nz::PathToString(embeddedTexturePath));
+			}
+			else
+				matData.SetParameter(textureKey, Nz::PathToString((originPath / std::filesystem::u8path(path.data, path.data + path.length))));
+
+			if (wrapKey)
+			{
+				Nz::SamplerWrap wrap = Nz::SamplerWrap::Clamp;
+				switch (mapMode[0])
+				{
+					case aiTextureMapMode_Clamp:
+					case aiTextureMapMode_Decal:
+						wrap = Nz::SamplerWrap::Clamp;
+						break;
+
+					case aiTextureMapMode_Mirror:
+						wrap = Nz::SamplerWrap::MirroredRepeat;
+						break;
+
+					case aiTextureMapMode_Wrap:
+						wrap = Nz::SamplerWrap::Repeat;
+						break;
+
+					default:
+						NazaraWarning("Assimp texture map mode 0x" + Nz::NumberToString(mapMode[0], 16) + " not handled");
+						break;
+				}
+
+				matData.SetParameter(wrapKey, static_cast<long long>(wrap));
+			}
+
+			return true;
+		}
+
+		return false;
+	};
+
+	ConvertColor(AI_MATKEY_COLOR_AMBIENT,  Nz::MaterialData::AmbientColor);
+
+	if (!ConvertColor(AI_MATKEY_BASE_COLOR, Nz::MaterialData::BaseColor))
+		ConvertColor(AI_MATKEY_COLOR_DIFFUSE, Nz::MaterialData::BaseColor);
+
+	ConvertColor(AI_MATKEY_COLOR_SPECULAR, Nz::MaterialData::SpecularColor);
+
+	if (!ConvertTexture(aiTextureType_BASE_COLOR, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap))
+		ConvertTexture(aiTextureType_DIFFUSE, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap);
+
+	ConvertTexture(aiTextureType_DIFFUSE_ROUGHNESS, Nz::MaterialData::RoughnessTexturePath, Nz::MaterialData::RoughnessWrap);
+	ConvertTexture(aiTextureType_EMISSIVE,          Nz::MaterialData::EmissiveTexturePath,  Nz::MaterialData::EmissiveWrap);
+	ConvertTexture(aiTextureType_HEIGHT,            Nz::MaterialData::HeightTexturePath,    Nz::MaterialData::HeightWrap);
+	ConvertTexture(aiTextureType_METALNESS,         Nz::MaterialData::MetallicTexturePath,  Nz::MaterialData::MetallicWrap);
+	ConvertTexture(aiTextureType_NORMALS,           Nz::MaterialData::NormalTexturePath,    Nz::MaterialData::NormalWrap);
+	ConvertTexture(aiTextureType_OPACITY,           Nz::MaterialData::AlphaTexturePath,     Nz::MaterialData::AlphaWrap);
+	ConvertTexture(aiTextureType_SPECULAR,          Nz::MaterialData::SpecularTexturePath,  Nz::MaterialData::SpecularWrap);
+
+	aiString name;
+	if (aiGetMaterialString(aiMat, AI_MATKEY_NAME, &name) == aiReturn_SUCCESS)
+		matData.SetParameter(Nz::MaterialData::Name, std::string(name.data, name.length));
+
+	int iValue;
+	if (aiGetMaterialInteger(aiMat, AI_MATKEY_TWOSIDED, &iValue) == aiReturn_SUCCESS)
+		matData.SetParameter(Nz::MaterialData::FaceCulling, !iValue);
+
+	return matData;
+}
+
+std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const Nz::MeshParams& parameters, const aiMesh* meshData, bool isSkeletalMesh, const std::unordered_map<const aiBone*, unsigned int>& boneToJointIndex)
 {
 	unsigned int indexCount = meshData->mNumFaces * 3;
 	unsigned int vertexCount = meshData->mNumVertices;
@@ -590,175 +762,8 @@ std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originP
 
 	subMesh->SetMaterialIndex(meshData->mMaterialIndex);
 
-	auto matIt = materialData.find(meshData->mMaterialIndex);
-	if (matIt == materialData.end())
-	{
-		Nz::ParameterList matData;
-		const aiMaterial* aiMat = scene->mMaterials[meshData->mMaterialIndex];
-
-		auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const char* colorKey)
-		{
-			aiColor4D color;
-			if (aiGetMaterialColor(aiMat, aiKey, aiType, aiIndex, &color) == aiReturn_SUCCESS)
-			{
-				matData.SetParameter(colorKey, Nz::Color(color.r, color.g, color.b, color.a));
-				return true;
-			}
-
-			return false;
-		};
-
-		auto SaveEmbeddedTextureToFile = [](const aiTexture* embeddedTexture, const std::filesystem::path& basePath, const char* filename) -> std::filesystem::path
-		{
-			if (basePath.empty())
-			{
-				NazaraError("can't create embedded resource folder (empty base path)");
-				return {};
-			}
-
-			std::filesystem::path targetPath = basePath / "embedded";
-
-			if (!std::filesystem::is_directory(targetPath))
-			{
-				if (!std::filesystem::create_directory(targetPath))
-				{
-					NazaraError("can't create embedded resource folder (folder creation failed)");
-					return {};
-				}
-			}
-
-			targetPath /= std::filesystem::u8path(filename);
-
-			if (embeddedTexture->mHeight == 0)
-			{
-				// Compressed data (PNG, JPG, etc.)
-				if (!embeddedTexture->achFormatHint[0])
-				{
-					NazaraError("can't create embedded texture file (no format hint)");
-					return {};
-				}
-
-				targetPath.replace_extension(std::filesystem::u8path(embeddedTexture->achFormatHint));
-
-				if (!Nz::File::WriteWhole(targetPath, embeddedTexture->pcData, embeddedTexture->mWidth))
-					return {};
-
-				return targetPath;
-			}
-			else
-			{
-				// Uncompressed data (always ARGB8 it seems)
-				Nz::Image uncompressedData(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8_SRGB, embeddedTexture->mWidth, embeddedTexture->mHeight);
-				const aiTexel* sourceData = embeddedTexture->pcData;
-				Nz::UInt8* imageData = uncompressedData.GetPixels();
-				for (unsigned int y = 0; y < embeddedTexture->mHeight; ++y)
-				{
-					for (unsigned int x = 0; x < embeddedTexture->mWidth; ++x)
-					{
-						*imageData++ = sourceData->r;
-						*imageData++ = sourceData->g;
-						*imageData++ = sourceData->b;
-						*imageData++ = sourceData->a;
-
-						++sourceData;
-					}
-				}
-
-				// Compress to PNG
-				targetPath.replace_extension(".png");
-
-				if (!uncompressedData.SaveToFile(targetPath))
-					return {};
-
-				return targetPath;
-			}
-		};
-
-		auto ConvertTexture = [&] (aiTextureType aiType, const char* textureKey, const char* wrapKey = nullptr)
-		{
-			aiString path;
-			aiTextureMapMode mapMode[3];
-			if (aiGetMaterialTexture(aiMat, aiType, 0, &path, nullptr, nullptr, nullptr, nullptr, &mapMode[0], nullptr) == aiReturn_SUCCESS)
-			{
-				if (const aiTexture* embeddedTexture = scene->GetEmbeddedTexture(path.C_Str()))
-				{
-					std::filesystem::path embeddedTexturePath;
-					if (auto it = embeddedTextures.find(embeddedTexture); it == embeddedTextures.end())
-					{
-						embeddedTexturePath = SaveEmbeddedTextureToFile(embeddedTexture, originPath, aiScene::GetShortFilename(path.C_Str()));
-						if (embeddedTexturePath.empty())
-							NazaraError("failed to save embedded texture to file");
-
-						embeddedTextures.emplace(embeddedTexture, embeddedTexturePath);
-					}
-					else
-						embeddedTexturePath = it->second;
-
-					matData.SetParameter(textureKey, Nz::PathToString(embeddedTexturePath));
-				}
-				else
-					matData.SetParameter(textureKey, Nz::PathToString((originPath / std::filesystem::u8path(path.data, path.data + path.length))));
-
-				if (wrapKey)
-				{
-					Nz::SamplerWrap wrap = Nz::SamplerWrap::Clamp;
-					switch (mapMode[0])
-					{
-						case aiTextureMapMode_Clamp:
-						case aiTextureMapMode_Decal:
-							wrap = Nz::SamplerWrap::Clamp;
-							break;
-
-						case aiTextureMapMode_Mirror:
-							wrap = Nz::SamplerWrap::MirroredRepeat;
-							break;
-
-						case aiTextureMapMode_Wrap:
-							wrap = Nz::SamplerWrap::Repeat;
-							break;
-
-						default:
-							NazaraWarning("Assimp texture map mode 0x" + Nz::NumberToString(mapMode[0], 16) + " not handled");
-							break;
-					}
-
-					matData.SetParameter(wrapKey, static_cast<long long>(wrap));
-				}
-
-				return true;
-			}
-
-			return false;
-		};
-
-		ConvertColor(AI_MATKEY_COLOR_AMBIENT,  Nz::MaterialData::AmbientColor);
-
-		if (!ConvertColor(AI_MATKEY_BASE_COLOR, Nz::MaterialData::BaseColor))
-			ConvertColor(AI_MATKEY_COLOR_DIFFUSE, Nz::MaterialData::BaseColor);
-
-		ConvertColor(AI_MATKEY_COLOR_SPECULAR, Nz::MaterialData::SpecularColor);
-
-		if (!ConvertTexture(aiTextureType_BASE_COLOR, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap))
-			ConvertTexture(aiTextureType_DIFFUSE, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap);
-
-		ConvertTexture(aiTextureType_DIFFUSE_ROUGHNESS, Nz::MaterialData::RoughnessTexturePath, Nz::MaterialData::RoughnessWrap);
-		ConvertTexture(aiTextureType_EMISSIVE,          Nz::MaterialData::EmissiveTexturePath,  Nz::MaterialData::EmissiveWrap);
-		ConvertTexture(aiTextureType_HEIGHT,            Nz::MaterialData::HeightTexturePath,    Nz::MaterialData::HeightWrap);
-		ConvertTexture(aiTextureType_METALNESS,         Nz::MaterialData::MetallicTexturePath,  Nz::MaterialData::MetallicWrap);
-		ConvertTexture(aiTextureType_NORMALS,           Nz::MaterialData::NormalTexturePath,    Nz::MaterialData::NormalWrap);
-		ConvertTexture(aiTextureType_OPACITY,           Nz::MaterialData::AlphaTexturePath,     Nz::MaterialData::AlphaWrap);
-		ConvertTexture(aiTextureType_SPECULAR,          Nz::MaterialData::SpecularTexturePath,  Nz::MaterialData::SpecularWrap);
-
-		aiString name;
-		if (aiGetMaterialString(aiMat, AI_MATKEY_NAME, &name) == aiReturn_SUCCESS)
-			matData.SetParameter(Nz::MaterialData::Name, std::string(name.data, name.length));
-
-		int iValue;
-		if (aiGetMaterialInteger(aiMat, AI_MATKEY_TWOSIDED, &iValue) == aiReturn_SUCCESS)
-			matData.SetParameter(Nz::MaterialData::FaceCulling, !iValue);
-
-		matIt = materialData.insert(std::make_pair(meshData->mMaterialIndex, std::make_pair(Nz::UInt32(materialData.size()), std::move(matData)))).first;
-	}
+	if (!isSkeletalMesh)
+		static_cast<Nz::StaticMesh&>(*subMesh).Optimize(parameters);
 
 	return subMesh;
 }
@@ -828,9 +833,65 @@ Nz::Result<std::shared_ptr<Nz::Mesh>, Nz::ResourceLoadingError> LoadMesh(Nz::Str
 
 	std::shared_ptr<Nz::Mesh> mesh = std::make_shared<Nz::Mesh>();
 
+	std::filesystem::path originPath = stream.GetDirectory();
+	// Submeshes can be converted in parallel, but their buffers are then created from worker threads: parameters.bufferFactory has to be thread-safe
+	bool multithreaded = parameters.custom.GetBooleanParameter("AssimpLoader_Multithreaded").GetValueOr(false);
+
 	EmbeddedTextures embeddedTextures;
 	MaterialData materialData;
 
+	// Materials are converted first (in submesh order) as it may write embedded textures to disk, leaving only independent work to submeshes
+	auto RegisterMaterial = [&](const aiMesh* meshData)
+	{
+		if (materialData.find(meshData->mMaterialIndex) == materialData.end())
+		{
+			Nz::UInt32 materialIndex = Nz::UInt32(materialData.size());
+			materialData.emplace(meshData->mMaterialIndex, std::make_pair(materialIndex, ProcessMaterial(originPath, scene, meshData->mMaterialIndex, embeddedTextures)));
+		}
+	};
+
+	// Converting a submesh (and optimizing it) is the most expensive step for big scenes, process them in parallel
+	auto AddSubMeshes = [&](const std::vector<const aiMesh*>& meshes, bool isSkeletalMesh, const std::unordered_map<const aiBone*, unsigned int>& boneToJointIndex)
+	{
+		std::vector<std::shared_ptr<Nz::SubMesh>> subMeshes(meshes.size());
+		auto ProcessMesh = [&](std::size_t meshIndex)
+		{
+			try
+			{
+				subMeshes[meshIndex] = ProcessSubMesh(parameters, meshes[meshIndex], isSkeletalMesh, boneToJointIndex);
+			}
+			catch (const std::exception& e)
+			{
+				NazaraError("failed to process submesh #{0}: {1}", meshIndex, e.what());
+			}
+		};
+
+		if (multithreaded && meshes.size() > 1 && Nz::TaskScheduler::GetWorkerCount() > 1)
+		{
+			// Use a dedicated task group, so loading doesn't wait for tasks started by other threads
+			Nz::TaskGroup meshTasks;
+			for (std::size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+				meshTasks.AddTask([&, meshIndex] { ProcessMesh(meshIndex); });
+
+			meshTasks.Wait();
+		}
+		else
+		{
+			for (std::size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+				ProcessMesh(meshIndex);
+		}
+
+		for (std::shared_ptr<Nz::SubMesh>& subMesh : subMeshes)
+		{
+			if (!subMesh)
+				return false;
+
+			mesh->AddSubMesh(std::move(subMesh));
+		}
+
+		return true;
+	};
+
 	if (handleSkeletalMeshes)
 	{
 		auto& skeletalRoot = sceneInfo.nodes[sceneInfo.skeletonRootIndex];
@@ -845,14 +906,26 @@ Nz::Result<std::shared_ptr<Nz::Mesh>, Nz::ResourceLoadingError> LoadMesh(Nz::Str
 		for (auto& skeletalMesh : sceneInfo.skeletalMeshes)
 			ProcessJoints(parameters, transformMatrix, invTransformMatrix, skeletalMesh, mesh->GetSkeleton(), sceneInfo.nodes[sceneInfo.skeletonRootIndex].node, jointIndex, sceneInfo.assimpBoneToJointIndex, seenNodes);
 
+		std::vector<const aiMesh*> meshes;
 		for (auto& skeletalMesh : sceneInfo.skeletalMeshes)
-			mesh->AddSubMesh(ProcessSubMesh(stream.GetDirectory(), parameters, scene, skeletalMesh.mesh, true, materialData, sceneInfo.assimpBoneToJointIndex, embeddedTextures));
+		{
+			RegisterMaterial(skeletalMesh.mesh);
+			meshes.push_back(skeletalMesh.mesh);
+		}
+
+		if (!AddSubMeshes(meshes, true, sceneInfo.assimpBoneToJointIndex))
+			return Nz::Err(Nz::ResourceLoadingError::DecodingError);
 	}
 	else
 	{
 		mesh->CreateStatic();
-		for (unsigned int meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex)
-			mesh->AddSubMesh(ProcessSubMesh(stream.GetDirectory(), parameters, scene, scene->mMeshes[meshIndex], false, materialData, {}, embeddedTextures));
+
+		std::vector<const aiMesh*> meshes(scene->mMeshes, scene->mMeshes + scene->mNumMeshes);
+		for (const aiMesh* meshData : meshes)
+			RegisterMaterial(meshData);
+
+		if (!AddSubMeshes(meshes, false, {}))
+			return Nz::Err(Nz::ResourceLoadingError::DecodingError);
 
 		if (parameters.center)
 			mesh->Recenter();
@@ -24,6 +24,7 @@ extern "C"
 	#include <libswscale/swscale.h>
 }
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 
@@ -37,10 +38,11 @@ namespace
 			m_codecContext(nullptr),
 			m_formatContext(nullptr),
 			m_rawFrame(nullptr),
-			m_rgbaFrame(nullptr),
+			m_packet(nullptr),
 			m_ioContext(nullptr),
 			m_conversionContext(nullptr),
 			m_ioBuffer(nullptr),
+			m_endTimestamp(0),
 			m_videoStream(-1)
 			{
 			}
@@ -53,15 +55,12 @@ namespace
 				if (m_rawFrame)
 					av_frame_free(&m_rawFrame);
 
-				if (m_rgbaFrame)
-					av_frame_free(&m_rgbaFrame);
+				if (m_packet)
+					av_packet_free(&m_packet);
 
 				if (m_codecContext)
 					avcodec_free_context(&m_codecContext);
 
-				if (m_rawFrame)
-					av_frame_free(&m_rawFrame);
-
 				if (m_formatContext)
 					avformat_close_input(&m_formatContext);
 
@@ -133,70 +132,58 @@ namespace
 
 			bool DecodeNextFrame(void* frameBuffer, Nz::Time* frameTime) override
 			{
-				AVPacket packet;
-
 				for (;;)
 				{
-					if (int errCode = av_read_frame(m_formatContext, &packet); errCode < 0)
+					// Decoder may hold several frames (when using frame threading), retrieve them before sending more packets
+					int errCode = avcodec_receive_frame(m_codecContext, m_rawFrame);
+					if (errCode == 0)
+						break;
+
+					if (errCode == AVERROR_EOF)
 					{
-						if (errCode == AVERROR_EOF)
+						if (frameTime)
 						{
-							if (frameTime)
+							// Stream duration is optional (AV_NOPTS_VALUE), use the end of the last decoded frame if it's missing
+							const AVStream* stream = m_formatContext->streams[m_videoStream];
+
+							Nz::Int64 endTimestamp = m_endTimestamp;
+							if (stream->duration != AV_NOPTS_VALUE)
 							{
-								AVRational timebase = m_formatContext->streams[m_videoStream]->time_base;
-								*frameTime = Nz::Time::Milliseconds(1000 * m_formatContext->streams[m_videoStream]->duration * timebase.num / timebase.den);
+								Nz::Int64 startTimestamp = (stream->start_time != AV_NOPTS_VALUE) ? stream->start_time : 0;
+								endTimestamp = std::max(endTimestamp, startTimestamp + stream->duration);
 							}
 
-							return false;
+							*frameTime = TimestampToTime(endTimestamp);
 						}
 
-						NazaraError("failed to read frame: {0}", ErrorToString(errCode));
 						return false;
 					}
 
-					if (packet.stream_index != m_videoStream)
-						continue;
-
-					if (int errCode = avcodec_send_packet(m_codecContext, &packet); errCode < 0)
-					{
-						NazaraError("failed to send packet: {0}", ErrorToString(errCode));
-						return false;
-					}
-
-					if (int errCode = avcodec_receive_frame(m_codecContext, m_rawFrame); errCode < 0)
+					if (errCode != AVERROR(EAGAIN))
 					{
-						if (errCode == AVERROR(EAGAIN))
-							continue;
-
 						NazaraError("failed to receive frame: {0}", ErrorToString(errCode));
 						return false;
 					}
 
-					break;
+					if (!SendNextPacket())
+						return false;
 				}
 
-				sws_scale(m_conversionContext, m_rawFrame->data, m_rawFrame->linesize, 0, m_codecContext->height, m_rgbaFrame->data, m_rgbaFrame->linesize);
+				// Convert directly into the frame buffer, which is tightly packed
+				Nz::UInt8* dstData[4] = { static_cast<Nz::UInt8*>(frameBuffer), nullptr, nullptr, nullptr };
+				int dstLinesize[4] = { m_codecContext->width * 4, 0, 0, 0 };
 
-				Nz::UInt8* dst = static_cast<Nz::UInt8*>(frameBuffer);
-				Nz::UInt8* src = m_rgbaFrame->data[0];
-				std::size_t lineSize = m_rgbaFrame->width * 4;
-				if (lineSize != m_rgbaFrame->linesize[0])
-				{
-					for (int i = 0; i < m_rgbaFrame->height; ++i)
-					{
-						std::memcpy(dst, src, lineSize);
-						dst += lineSize;
-						src += m_rgbaFrame->linesize[0];
-					}
-				}
-				else
-					std::memcpy(dst, src, lineSize * m_rgbaFrame->height);
+				sws_scale(m_conversionContext, m_rawFrame->data, m_rawFrame->linesize, 0, m_codecContext->height, dstData, dstLinesize);
+
+				// Frames without timestamp are assumed to follow the previous one
+				Nz::Int64 timestamp = m_rawFrame->best_effort_timestamp;
+				if (timestamp == AV_NOPTS_VALUE)
+					timestamp = m_endTimestamp;
+
+				m_endTimestamp = timestamp + GetFrameDuration();
 
 				if (frameTime)
-				{
-					AVRational timebase = m_formatContext->streams[m_videoStream]->time_base;
-					*frameTime = Nz::Time::Milliseconds(1000 * m_rawFrame->pts * timebase.num / timebase.den);
-				}
+					*frameTime = TimestampToTime(timestamp);
 
 				return true;
 			}
@@ -219,7 +206,7 @@ namespace
 				return { width, height };
 			}
 
-			Nz::Result<void, Nz::ResourceLoadingError> Open()
+			Nz::Result<void, Nz::ResourceLoadingError> Open(const Nz::ImageStreamParams& parameters)
 			{
 				auto checkResult = Check();
 				if (!checkResult)
@@ -240,6 +227,10 @@ namespace
 					return Nz::Err(Nz::ResourceLoadingError::Internal);
 				}
 
+				// 0 lets FFmpeg pick a thread count according to the CPU
+				m_codecContext->thread_count = Nz::SafeCast<int>(parameters.decodingThreadCount);
+				m_codecContext->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
 				if (int errCode = avcodec_open2(m_codecContext, m_codec, nullptr); errCode < 0)
 				{
 					NazaraError("could not open codec: {0}", ErrorToString(errCode));
@@ -247,20 +238,10 @@ namespace
 				}
 
 				m_rawFrame = av_frame_alloc();
-				m_rgbaFrame = av_frame_alloc();
-				if (!m_rawFrame || !m_rgbaFrame)
+				m_packet = av_packet_alloc();
+				if (!m_rawFrame || !m_packet)
 				{
-					NazaraError("failed to allocate frames");
-					return Nz::Err(Nz::ResourceLoadingError::Internal);
-				}
-
-				m_rgbaFrame->format = AVPixelFormat::AV_PIX_FMT_RGBA;
-				m_rgbaFrame->width = codecParameters->width;
-				m_rgbaFrame->height = codecParameters->height;
-
-				if (int errCode = av_frame_get_buffer(m_rgbaFrame, 0); errCode < 0)
-				{
-					NazaraError("failed to open input: {0}", ErrorToString(errCode));
+					NazaraError("failed to allocate frame");
 					return Nz::Err(Nz::ResourceLoadingError::Internal);
 				}
 
@@ -279,6 +260,10 @@ namespace
 				// TODO
 				avio_seek(m_ioContext, 0, SEEK_SET);
 				avformat_seek_file(m_formatContext, m_videoStream, std::numeric_limits<Nz::Int64>::min(), 0, std::numeric_limits<Nz::Int64>::max(), 0);
+
+				// Drop frames buffered by the decoder (and leave draining mode)
+				avcodec_flush_buffers(m_codecContext);
+				m_endTimestamp = 0;
 			}
 
 			bool SetFile(const std::filesystem::path& filePath)
@@ -332,6 +317,74 @@ namespace
 				return errMessage;
 			}
 
+			// Duration of the last decoded frame, in stream timebase
+			Nz::Int64 GetFrameDuration() const
+			{
+				#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 30, 100)
+				Nz::Int64 frameDuration = m_rawFrame->duration;
+				#else
+				Nz::Int64 frameDuration = m_rawFrame->pkt_duration;
+				#endif
+				if (frameDuration > 0)
+					return frameDuration;
+
+				// Fallback on the stream frame rate
+				const AVStream* stream = m_formatContext->streams[m_videoStream];
+				AVRational frameRate = (stream->avg_frame_rate.num > 0 && stream->avg_frame_rate.den > 0) ? stream->avg_frame_rate : stream->r_frame_rate;
+				if (frameRate.num <= 0 || frameRate.den <= 0)
+					return 0;
+
+				return av_rescale_q(1, av_inv_q(frameRate), stream->time_base);
+			}
+
+			bool SendNextPacket()
+			{
+				for (;;)
+				{
+					if (int errCode = av_read_frame(m_formatContext, m_packet); errCode < 0)
+					{
+						if (errCode != AVERROR_EOF)
+						{
+							NazaraError("failed to read frame: {0}", ErrorToString(errCode));
+							return false;
+						}
+
+						// Enter draining mode, the decoder will output the frames it still holds
+						if (int drainErrCode = avcodec_send_packet(m_codecContext, nullptr); drainErrCode < 0 && drainErrCode != AVERROR_EOF)
+						{
+							NazaraError("failed to send flush packet: {0}", ErrorToString(drainErrCode));
+							return false;
+						}
+
+						return true;
+					}
+
+					if (m_packet->stream_index != m_videoStream)
+					{
+						av_packet_unref(m_packet);
+						continue;
+					}
+
+					int errCode = avcodec_send_packet(m_codecContext, m_packet);
+					av_packet_unref(m_packet);
+
+					if (errCode < 0)
+					{
+						NazaraError("failed to send packet: {0}", ErrorToString(errCode));
+						return false;
+					}
+
+					return true;
+				}
+			}
+
+			Nz::Time TimestampToTime(Nz::Int64 timestamp) const
+			{
+				// Rescaling through FFmpeg prevents overflows of (timestamp * timebase.num) with long streams or fine timebases
+				AVRational timebase = m_formatContext->streams[m_videoStream]->time_base;
+				return Nz::Time::Microseconds(av_rescale_q(timestamp, timebase, AVRational{ 1, 1'000'000 }));
+			}
+
 			static int Read(void* opaque, Nz::UInt8* buf, int buf_size)
 			{
 				Nz::ByteStream& stream = *static_cast<Nz::ByteStream*>(opaque);
@@ -384,12 +437,13 @@ namespace
 			AVCodecContext* m_codecContext;
 			AVFormatContext* m_formatContext;
 			AVFrame* m_rawFrame;
-			AVFrame* m_rgbaFrame;
+			AVPacket* m_packet;
 			AVIOContext* m_ioContext;
 			SwsContext* m_conversionContext;
 			void* m_ioBuffer;
 			std::unique_ptr<Nz::Stream> m_ownedStream;
 			Nz::ByteStream m_byteStream;
+			Nz::Int64 m_endTimestamp; //< end of the last decoded frame, in stream timebase
 			int m_videoStream;
 	};
 
@@ -402,30 +456,30 @@ namespace
 		return format->video_codec != AV_CODEC_ID_NONE;
 	}
 
-	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadFile(const std::filesystem::path& filePath, const Nz::ImageStreamParams& /*parameters*/)
+	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadFile(const std::filesystem::path& filePath, const Nz::ImageStreamParams& parameters)
 	{
 		std::shared_ptr<FFmpegStream> ffmpegStream = std::make_shared<FFmpegStream>();
 		ffmpegStream->SetFile(filePath);
 
-		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open();
+		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open(parameters);
 		return status.Map([&] { return std::move(ffmpegStream); });
 	}
 
-	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadMemory(const void* ptr, std::size_t size, const Nz::ImageStreamParams& /*parameters*/)
+	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadMemory(const void* ptr, std::size_t size, const Nz::ImageStreamParams& parameters)
 	{
 		std::shared_ptr<FFmpegStream> ffmpegStream = std::make_shared<FFmpegStream>();
 		ffmpegStream->SetMemory(ptr, size);
 
-		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open();
+		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open(parameters);
 		return status.Map([&] { return std::move(ffmpegStream); });
 	}
 
-	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadStream(Nz::Stream& stream, const Nz::ImageStreamParams& /*parameters*/)
+	Nz::Result<std::shared_ptr<Nz::ImageStream>, Nz::ResourceLoadingError> LoadStream(Nz::Stream& stream, const Nz::ImageStreamParams& parameters)
 	{
 		std::shared_ptr<FFmpegStream> ffmpegStream = std::make_shared<FFmpegStream>();
 		ffmpegStream->SetStream(stream);
 
-		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open();
+		Nz::Result<void, Nz::ResourceLoadingError> status = ffmpegStream->Open(parameters);
 		return status.Map([&] { return std::move(ffmpegStream); });
 	}
 
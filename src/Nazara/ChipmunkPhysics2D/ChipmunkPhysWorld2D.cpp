@@ -6,6 +6,7 @@
 #include <Nazara/ChipmunkPhysics2D/ChipmunkArbiter2D.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
+#include <chipmunk/chipmunk_private.h>
 #include <Nazara/ChipmunkPhysics2D/Debug.hpp>
 
 namespace Nz
@@ -131,6 +132,31 @@ namespace Nz
 		cpSpaceDebugDraw(m_handle, &drawOptions);
 	}
 
+	void ChipmunkPhysWorld2D::ForEachAwakeBody(const FunctionRef<void(ChipmunkRigidBody2D& body)>& callback)
+	{
+		// Chipmunk keeps awake dynamic and kinematic bodies in this array, sleeping bodies are moved out of it
+		cpArray* dynamicBodies = m_handle->dynamicBodies;
+		for (int i = 0; i < dynamicBodies->num; ++i)
+		{
+			cpBody* body = static_cast<cpBody*>(dynamicBodies->arr[i]);
+			callback(*static_cast<ChipmunkRigidBody2D*>(cpBodyGetUserData(body)));
+		}
+	}
+
+	void ChipmunkPhysWorld2D::ForEachMovedBody(const FunctionRef<void(ChipmunkRigidBody2D& body)>& callback, bool resetMovedBodies)
+	{
+		for (std::size_t bodyIndex = m_movedBodyIndices.FindFirst(); bodyIndex != m_movedBodyIndices.npos; bodyIndex = m_movedBodyIndices.FindNext(bodyIndex))
+		{
+			ChipmunkRigidBody2D* rigidBody = m_bodies[bodyIndex];
+			assert(rigidBody);
+
+			callback(*rigidBody);
+		}
+
+		if (resetMovedBodies)
+			m_movedBodyIndices.Clear();
+	}
+
 	float ChipmunkPhysWorld2D::GetDamping() const
 	{
 		return float(cpSpaceGetDamping(m_handle));
@@ -364,6 +390,12 @@ namespace Nz
 		{
 			OnPhysWorld2DPreStep(this, invStepCount);
 
+			// Every body awake at this point will be integrated by this step (including those falling asleep during it)
+			ForEachAwakeBody([this](ChipmunkRigidBody2D& rigidBody)
+			{
+				MarkBodyAsMoved(rigidBody.GetBodyIndex());
+			});
+
 			cpSpaceStep(m_handle, dt);
 
 			OnPhysWorld2DPostStep(this, invStepCount);
@@ -394,6 +394,8 @@ namespace Nz
 	{
 		// Use cpTransformVect to rotate/scale the position offset
 		cpBodySetPosition(m_handle, cpvadd(ToChipmunk(position), cpTransformVect(m_handle->transform, ToChipmunk(m_positionOffset))));
+		m_world->MarkBodyAsMoved(m_bodyIndex);
+
 		if (m_isStatic)
 		{
 			m_world->DeferBodyAction(*this, [](ChipmunkRigidBody2D* body)
@@ -413,6 +415,8 @@ namespace Nz
 	void ChipmunkRigidBody2D::SetRotation(const RadianAnglef& rotation)
 	{
 		cpBodySetAngle(m_handle, rotation.value);
+		m_world->MarkBodyAsMoved(m_bodyIndex);
+
 		if (m_isStatic)
 		{
 			m_world->DeferBodyAction(*this, [](ChipmunkRigidBody2D* body)
@@ -481,6 +485,8 @@ namespace Nz
 		// Use cpTransformVect to rotate/scale the position offset
 		cpBodySetPosition(m_handle, cpvadd(ToChipmunk(position), cpTransformVect(m_handle->transform, ToChipmunk(m_positionOffset))));
 		cpBodySetAngle(m_handle, rotation.value);
+		m_world->MarkBodyAsMoved(m_bodyIndex);
+
 		if (m_isStatic)
 		{
 			m_world->DeferBodyAction(*this, [](ChipmunkRigidBody2D* body)
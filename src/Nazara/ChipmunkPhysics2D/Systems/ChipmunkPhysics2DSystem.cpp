@@ -5,6 +5,8 @@
 #include <Nazara/ChipmunkPhysics2D/Systems/ChipmunkPhysics2DSystem.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <algorithm>
+#include <cmath>
 #include <Nazara/ChipmunkPhysics2D/Debug.hpp>
 
 namespace Nz
@@ -22,7 +24,9 @@ namespace Nz
 
 	ChipmunkPhysics2DSystem::ChipmunkPhysics2DSystem(entt::registry& registry) :
 	m_registry(registry),
-	m_physicsConstructObserver(m_registry, entt::collector.group<ChipmunkRigidBody2DComponent, NodeComponent>())
+	m_physicsConstructObserver(m_registry, entt::collector.group<ChipmunkRigidBody2DComponent, NodeComponent>()),
+	m_hasStepped(false),
+	m_isInterpolationEnabled(false)
 	{
 		m_bodyConstructConnection = registry.on_construct<ChipmunkRigidBody2DComponent>().connect<&ChipmunkPhysics2DSystem::OnBodyConstruct>(this);
 		m_bodyDestructConnection = registry.on_destroy<ChipmunkRigidBody2DComponent>().connect<&ChipmunkPhysics2DSystem::OnBodyDestruct>(this);
@@ -38,6 +42,45 @@ namespace Nz
 			rigidBodyComponent.Destroy();
 	}
 
+	void ChipmunkPhysics2DSystem::EnableInterpolation(bool enable)
+	{
+		if (m_isInterpolationEnabled == enable)
+			return;
+
+		m_isInterpolationEnabled = enable;
+		if (enable)
+		{
+			m_onPreStep.Connect(m_physWorld.OnPhysWorld2DPreStep, [this](const ChipmunkPhysWorld2D* /*physWorld*/, float /*invStepCount*/)
+			{
+				OnPreStep();
+			});
+		}
+		else
+		{
+			m_onPreStep.Disconnect();
+
+			// Make sure no node is left at an interpolated transform
+			auto SnapBodies = [&](const Bitset<UInt64>& bodies)
+			{
+				for (std::size_t bodyIndex = bodies.FindFirst(); bodyIndex != bodies.npos; bodyIndex = bodies.FindNext(bodyIndex))
+				{
+					entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+					if (entity == entt::null)
+						continue;
+
+					const ChipmunkRigidBody2DComponent& rigidBody = m_registry.get<ChipmunkRigidBody2DComponent>(entity);
+					ReplicateTransform(rigidBody, rigidBody.GetPosition(), rigidBody.GetRotation());
+				}
+			};
+
+			SnapBodies(m_interpolatedBodies);
+			SnapBodies(m_settlingBodies);
+
+			m_interpolatedBodies.Clear();
+			m_settlingBodies.Clear();
+		}
+	}
+
 	void ChipmunkPhysics2DSystem::Update(Time elapsedTime)
 	{
 		// Move newly-created physics entities to their node position/rotation
@@ -49,16 +92,69 @@ namespace Nz
 			entityPhysics.TeleportTo(Vector2f(entityNode.GetPosition()), AngleFromQuaternion(entityNode.GetRotation()));
 		});
 
+		m_hasStepped = false;
 		m_physWorld.Step(elapsedTime);
 
-		// Replicate rigid body position to their node components
-		auto view = m_registry.view<NodeComponent, const ChipmunkRigidBody2DComponent>(entt::exclude<DisabledComponent>);
-		for (auto [entity, nodeComponent, rigidBodyComponent] : view.each())
+		// Replicate rigid body position to their node components, only for bodies which moved (sleeping bodies are skipped)
+		if (m_isInterpolationEnabled)
 		{
-			if (rigidBodyComponent.IsSleeping())
-				continue;
+			// Render bodies between their two last simulated states depending on how much time was left in the accumulator
+			float alpha = std::clamp(m_physWorld.GetTimestepAccumulator().AsSeconds<float>() / m_physWorld.GetStepSize().AsSeconds<float>(), 0.f, 1.f);
+
+			auto RetrieveRigidBody = [&](std::size_t bodyIndex) -> const ChipmunkRigidBody2D*
+			{
+				entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+				if (entity == entt::null)
+					return nullptr;
+
+				return &m_registry.get<ChipmunkRigidBody2DComponent>(entity);
+			};
+
+			// Bodies moved outside of a step (teleported) have no previous state and are snapped
+			m_physWorld.ForEachMovedBody([&](ChipmunkRigidBody2D& rigidBody)
+			{
+				UInt32 bodyIndex = rigidBody.GetBodyIndex();
+				if (!m_hasStepped)
+					m_interpolatedBodies.UnboundedReset(bodyIndex);
+				else if (m_interpolatedBodies.UnboundedTest(bodyIndex))
+					return; //< interpolated below
+
+				ReplicateTransform(rigidBody, rigidBody.GetPosition(), rigidBody.GetRotation());
+			}, true);
+
+			// Bodies simulated by the last step are interpolated until the next one, as alpha changes even on updates without steps
+			for (std::size_t bodyIndex = m_interpolatedBodies.FindFirst(); bodyIndex != m_interpolatedBodies.npos; bodyIndex = m_interpolatedBodies.FindNext(bodyIndex))
+			{
+				const ChipmunkRigidBody2D* rigidBody = RetrieveRigidBody(bodyIndex);
+				if (!rigidBody)
+					continue;
+
+				const PreviousTransform& previousTransform = m_previousTransforms[bodyIndex];
 
-			nodeComponent.SetTransform(rigidBodyComponent.GetPosition(), rigidBodyComponent.GetRotation());
+				Vector2f position = rigidBody->GetPosition();
+				RadianAnglef rotation = rigidBody->GetRotation();
+
+				position = Lerp(previousTransform.position, position, alpha);
+				rotation = previousTransform.rotation + RadianAnglef(alpha * std::remainder(rotation.value - previousTransform.rotation.value, 2.f * Pi<float>));
+
+				ReplicateTransform(*rigidBody, position, rotation);
+			}
+
+			// Bodies interpolated until the last step which weren't simulated by it (fell asleep) have to be snapped to their final transform
+			for (std::size_t bodyIndex = m_settlingBodies.FindFirst(); bodyIndex != m_settlingBodies.npos; bodyIndex = m_settlingBodies.FindNext(bodyIndex))
+			{
+				if (const ChipmunkRigidBody2D* rigidBody = RetrieveRigidBody(bodyIndex))
+					ReplicateTransform(*rigidBody, rigidBody->GetPosition(), rigidBody->GetRotation());
+			}
+
+			m_settlingBodies.Clear();
+		}
+		else
+		{
+			m_physWorld.ForEachMovedBody([&](ChipmunkRigidBody2D& rigidBody)
+			{
+				ReplicateTransform(rigidBody, rigidBody.GetPosition(), rigidBody.GetRotation());
+			}, true);
 		}
 	}
 
@@ -122,5 +218,49 @@ namespace Nz
 		assert(uniqueIndex <= m_bodyIndicesToEntity.size());
 
 		m_bodyIndicesToEntity[uniqueIndex] = entt::null;
+
+		m_interpolatedBodies.UnboundedReset(uniqueIndex);
+		m_settlingBodies.UnboundedReset(uniqueIndex);
+	}
+
+	void ChipmunkPhysics2DSystem::OnPreStep()
+	{
+		if (!m_hasStepped)
+		{
+			// Bodies interpolated until now which won't be simulated anymore will have to be snapped to their final transform
+			std::swap(m_settlingBodies, m_interpolatedBodies);
+			m_interpolatedBodies.Clear();
+
+			m_hasStepped = true;
+		}
+
+		// Save the transform of bodies about to be simulated, to interpolate between it and the next one
+		m_physWorld.ForEachAwakeBody([&](ChipmunkRigidBody2D& rigidBody)
+		{
+			UInt32 bodyIndex = rigidBody.GetBodyIndex();
+			if (bodyIndex >= m_previousTransforms.size())
+				m_previousTransforms.resize(bodyIndex + 1);
+
+			PreviousTransform& previousTransform = m_previousTransforms[bodyIndex];
+			previousTransform.position = rigidBody.GetPosition();
+			previousTransform.rotation = rigidBody.GetRotation();
+
+			m_interpolatedBodies.UnboundedSet(bodyIndex);
+			m_settlingBodies.UnboundedReset(bodyIndex);
+		});
+	}
+
+	void ChipmunkPhysics2DSystem::ReplicateTransform(const ChipmunkRigidBody2D& rigidBody, const Vector2f& position, const RadianAnglef& rotation)
+	{
+		UInt32 bodyIndex = rigidBody.GetBodyIndex();
+		if (bodyIndex >= m_bodyIndicesToEntity.size())
+			return;
+
+		entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+		if (entity == entt::null || m_registry.all_of<DisabledComponent>(entity))
+			return;
+
+		if (NodeComponent* nodeComponent = m_registry.try_get<NodeComponent>(entity))
+			nodeComponent->SetTransform(position, rotation);
 	}
 }
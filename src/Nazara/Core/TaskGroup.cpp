@@ -0,0 +1,105 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::TaskGroup
+	* \brief Core class that represents a set of tasks executed by the TaskScheduler workers and waited on together
+	*
+	* Task groups are independent from each other, they can be used from any thread and from inside other tasks.
+	* While waiting, the calling thread executes the tasks of the group which weren't picked by a worker yet,
+	* so waiting on a group from a task can't deadlock.
+	*
+	* Tasks are executed with the error flags of the thread that added them, an exception thrown by a task is rethrown by Wait.
+	*
+	* \remark A group shouldn't be fed by several threads at once, but its tasks may add other tasks to it
+	*/
+
+	/*!
+	* \brief Waits for the remaining tasks before destroying the group
+	*/
+	TaskGroup::~TaskGroup()
+	{
+		WaitForCompletion();
+		TaskScheduler::Unschedule(*this);
+	}
+
+	/*!
+	* \brief Adds a task to the group, which will be executed as soon as possible
+	*
+	* \param task Task to execute
+	*/
+	void TaskGroup::AddTask(Task task)
+	{
+		NazaraAssert(task, "invalid task");
+
+		TaskScheduler::Submit(*this, std::move(task));
+	}
+
+	/*!
+	* \brief Waits for every task of the group to be executed, helping the workers meanwhile
+	*
+	* \remark If a task threw an exception, it is rethrown here once every task has been executed
+	*/
+	void TaskGroup::Wait()
+	{
+		WaitForCompletion();
+
+		std::exception_ptr exception;
+		{
+			std::unique_lock lock(m_mutex);
+			exception = std::exchange(m_exception, nullptr);
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	void TaskGroup::OnTaskDone(std::exception_ptr exception)
+	{
+		std::unique_lock lock(m_mutex);
+		if (exception && !m_exception)
+			m_exception = std::move(exception);
+
+		if (--m_remainingTaskCount == 0)
+			m_conditionVariable.notify_all();
+	}
+
+	void TaskGroup::OnTaskQueued()
+	{
+		std::unique_lock lock(m_mutex);
+		m_remainingTaskCount++;
+		m_queuedTaskCount++;
+
+		// Wake up a waiting thread so it can execute the task itself
+		m_conditionVariable.notify_all();
+	}
+
+	void TaskGroup::OnTaskStarted()
+	{
+		std::unique_lock lock(m_mutex);
+		m_queuedTaskCount--;
+	}
+
+	void TaskGroup::WaitForCompletion()
+	{
+		for (;;)
+		{
+			while (TaskScheduler::RunPendingTask(*this))
+				;
+
+			std::unique_lock lock(m_mutex);
+			m_conditionVariable.wait(lock, [&] { return m_remainingTaskCount == 0 || m_queuedTaskCount > 0; });
+			if (m_remainingTaskCount == 0)
+				break;
+		}
+	}
+}
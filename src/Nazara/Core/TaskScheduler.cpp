@@ -5,23 +5,31 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
-
-#if defined(NAZARA_PLATFORM_WINDOWS)
-	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
-#elif defined(NAZARA_PLATFORM_POSIX)
-	#include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
-#else
-	#error Lack of implementation: Task Scheduler
-#endif
-
+#include <Nazara/Core/ThreadExt.hpp>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	namespace
+	namespace NAZARA_ANONYMOUS_NAMESPACE
 	{
-		std::vector<Functor*> s_pendingWorks;
+		std::condition_variable s_workerConditionVariable;
+		std::deque<TaskGroup*> s_scheduledGroups; //< groups which may have queued tasks, served in turn
+		std::mutex s_initializationMutex;
+		std::mutex s_schedulerMutex;
+		std::vector<std::thread> s_workers;
+		std::atomic_bool s_isInitialized = false;
+		bool s_shouldStop = false;
 		unsigned int s_workerCount = 0;
+
+		// Legacy interface, tasks are grouped per calling thread
+		thread_local std::vector<Functor*> s_pendingWorks;
+		thread_local TaskGroup s_pendingWorksGroup;
 	}
 
 	/*!
@@ -29,7 +37,12 @@ namespace Nz
 	* \class Nz::TaskScheduler
 	* \brief Core class that represents a pool of threads
 	*
-	* \remark Initialized should be called first
+	* Tasks are added through TaskGroup, which can safely be used from any thread and from inside tasks.
+	*
+	* The static AddTask/Run/WaitForTasks interface is kept for compatibility, it groups tasks per calling thread
+	* and shouldn't be used from a task.
+	*
+	* \see TaskGroup
 	*/
 
 	/*!
@@ -39,6 +52,8 @@ namespace Nz
 
 	unsigned int TaskScheduler::GetWorkerCount()
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		return (s_workerCount > 0) ? s_workerCount : Core::Instance()->GetHardwareInfo().GetCpuThreadCount();
 	}
 
@@ -49,28 +64,54 @@ namespace Nz
 
 	bool TaskScheduler::Initialize()
 	{
-		return TaskSchedulerImpl::Initialize(GetWorkerCount());
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (s_isInitialized.load(std::memory_order_acquire))
+			return true;
+
+		std::unique_lock initLock(s_initializationMutex);
+		if (s_isInitialized.load(std::memory_order_relaxed))
+			return true;
+
+		unsigned int workerCount = GetWorkerCount();
+		if (workerCount == 0)
+		{
+			NazaraError("invalid worker count (0)");
+			return false;
+		}
+
+		{
+			std::unique_lock lock(s_schedulerMutex);
+			s_shouldStop = false;
+		}
+
+		s_workers.reserve(workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i)
+			s_workers.emplace_back(&TaskScheduler::WorkerProc);
+
+		s_isInitialized.store(true, std::memory_order_release);
+		return true;
 	}
 
 	/*!
-	* \brief Runs the pending works
+	* \brief Runs the pending works added on this thread
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	*/
 
 	void TaskScheduler::Run()
 	{
-		if (!Initialize())
-		{
-			NazaraError("Failed to initialize Task Scheduler");
-			return;
-		}
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		if (!s_pendingWorks.empty())
+		for (Functor* functor : s_pendingWorks)
 		{
-			TaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
-			s_pendingWorks.clear();
+			s_pendingWorksGroup.AddTask([task = std::shared_ptr<Functor>(functor)]
+			{
+				task->Run();
+			});
 		}
+
+		s_pendingWorks.clear();
 	}
 
 	/*!
@@ -83,8 +124,10 @@ namespace Nz
 
 	void TaskScheduler::SetWorkerCount(unsigned int workerCount)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
 		#ifdef NAZARA_CORE_SAFE
-		if (TaskSchedulerImpl::IsInitialized())
+		if (s_isInitialized)
 		{
 			NazaraError("Worker count cannot be set while initialized");
 			return;
@@ -96,48 +139,199 @@ namespace Nz
 
 	/*!
 	* \brief Uninitializes the TaskScheduler class
+	*
+	* Pending tasks are executed before the workers are stopped.
 	*/
 
 	void TaskScheduler::Uninitialize()
 	{
-		if (TaskSchedulerImpl::IsInitialized())
-			TaskSchedulerImpl::Uninitialize();
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::unique_lock initLock(s_initializationMutex);
+		if (!s_isInitialized)
+			return;
+
+		{
+			std::unique_lock lock(s_schedulerMutex);
+			s_shouldStop = true;
+		}
+		s_workerConditionVariable.notify_all();
+
+		for (std::thread& worker : s_workers)
+			worker.join();
+
+		s_workers.clear();
+		s_isInitialized = false;
 	}
 
 	/*!
-	* \brief Waits for tasks to be done
+	* \brief Waits for tasks run on this thread to be done
 	*
-	* \remark Produce a NazaraError if the class is not initialized
+	* \remark Exceptions thrown by tasks are reported as errors
 	*/
 
 	void TaskScheduler::WaitForTasks()
 	{
-		if (!Initialize())
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		try
 		{
-			NazaraError("Failed to initialize Task Scheduler");
-			return;
+			s_pendingWorksGroup.Wait();
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError("task failed: {0}", e.what());
 		}
-
-		TaskSchedulerImpl::WaitForTasks();
 	}
 
 	/*!
-	* \brief Adds a task on the pending list
+	* \brief Adds a task on the pending list of this thread
 	*
 	* \param taskFunctor Functor represeting a task to be done
 	*
-	* \remark Produce a NazaraError if the class is not initialized
-	* \remark A task containing a call on this class is undefined behaviour
+	* \remark A task containing a call on this class is undefined behaviour, use TaskGroup instead
 	*/
 
 	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		s_pendingWorks.push_back(taskFunctor);
+	}
+
+	void TaskScheduler::ExecuteTask(TaskGroup& group, TaskGroup::Task& task, ErrorModeFlags errorFlags)
+	{
+		ErrorModeFlags previousFlags = Error::SetFlags(errorFlags);
+
+		std::exception_ptr exception;
+		try
+		{
+			task();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		Error::SetFlags(previousFlags);
+
+		group.OnTaskDone(std::move(exception));
+	}
+
+	bool TaskScheduler::RunPendingTask(TaskGroup& group)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		TaskGroup::QueuedTask queuedTask;
+		{
+			std::unique_lock lock(s_schedulerMutex);
+			if (group.m_queuedTasks.empty())
+				return false;
+
+			// The group may stay scheduled with no task left, workers will drop it
+			queuedTask = std::move(group.m_queuedTasks.front());
+			group.m_queuedTasks.pop_front();
+
+			group.OnTaskStarted();
+		}
+
+		ExecuteTask(group, queuedTask.task, queuedTask.errorFlags);
+		return true;
+	}
+
+	void TaskScheduler::Submit(TaskGroup& group, TaskGroup::Task&& task)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		TaskGroup::QueuedTask queuedTask;
+		queuedTask.errorFlags = Error::GetFlags();
+		queuedTask.task = std::move(task);
+
 		if (!Initialize())
 		{
-			NazaraError("Failed to initialize Task Scheduler");
+			NazaraError("failed to initialize task scheduler, running task on the calling thread");
+
+			group.OnTaskQueued();
+			group.OnTaskStarted();
+			ExecuteTask(group, queuedTask.task, queuedTask.errorFlags);
 			return;
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		{
+			std::unique_lock lock(s_schedulerMutex);
+			group.m_queuedTasks.push_back(std::move(queuedTask));
+			if (!group.m_isScheduled)
+			{
+				s_scheduledGroups.push_back(&group);
+				group.m_isScheduled = true;
+			}
+
+			group.OnTaskQueued();
+		}
+		s_workerConditionVariable.notify_one();
+	}
+
+	void TaskScheduler::Unschedule(TaskGroup& group)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::unique_lock lock(s_schedulerMutex);
+		if (!group.m_isScheduled)
+			return;
+
+		// Only happens when the group tasks were executed by waiting threads before a worker dropped it
+		auto it = std::find(s_scheduledGroups.begin(), s_scheduledGroups.end(), &group);
+		assert(it != s_scheduledGroups.end());
+		s_scheduledGroups.erase(it);
+
+		group.m_isScheduled = false;
+	}
+
+	void TaskScheduler::WorkerProc()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		SetCurrentThreadName("NzTaskWorker");
+
+		for (;;)
+		{
+			TaskGroup* group;
+			TaskGroup::QueuedTask queuedTask;
+			{
+				std::unique_lock lock(s_schedulerMutex);
+				s_workerConditionVariable.wait(lock, [] { return s_shouldStop || !s_scheduledGroups.empty(); });
+
+				// Pending tasks are still executed when stopping, as some thread may be waiting on them
+				if (s_scheduledGroups.empty())
+					break;
+
+				group = s_scheduledGroups.front();
+				s_scheduledGroups.pop_front();
+
+				if (group->m_queuedTasks.empty())
+				{
+					group->m_isScheduled = false;
+					continue;
+				}
+
+				queuedTask = std::move(group->m_queuedTasks.front());
+				group->m_queuedTasks.pop_front();
+
+				group->OnTaskStarted();
+
+				// Groups are served in turn, so a group with many tasks can't starve the others
+				if (!group->m_queuedTasks.empty())
+				{
+					s_scheduledGroups.push_back(group);
+
+					lock.unlock();
+					s_workerConditionVariable.notify_one();
+				}
+				else
+					group->m_isScheduled = false;
+			}
+
+			ExecuteTask(*group, queuedTask.task, queuedTask.errorFlags);
+		}
 	}
 }
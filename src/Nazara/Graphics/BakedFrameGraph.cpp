@@ -3,9 +3,15 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <stdexcept>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -15,6 +21,7 @@ namespace Nz
 	m_textures(std::move(textures)),
 	m_attachmentToTextureMapping(std::move(attachmentIdToTextureMapping)),
 	m_passIdToPhysicalPassMapping(std::move(passIdToPhysicalPassMapping)),
+	m_transientMemoryUsage(0),
 	m_height(0),
 	m_width(0)
 	{
@@ -26,7 +33,11 @@ namespace Nz
 	{
 		for (auto& passData : m_passes)
 		{
-			bool regenerateCommandBuffer = (passData.forceCommandBufferRegeneration || passData.commandBuffer == nullptr);
+			// Secondary command buffers aren't recorded for simultaneous use, a primary command buffer executing them
+			// can't be submitted again while a previous frame may still be using it
+			bool usesSecondaryCommandBuffers = std::any_of(passData.subpasses.begin(), passData.subpasses.end(), [](const SubpassData& subpass) { return !subpass.secondaryCommandBuffers.empty(); });
+
+			bool regenerateCommandBuffer = (passData.forceCommandBufferRegeneration || passData.commandBuffer == nullptr || usesSecondaryCommandBuffers);
 			if (passData.executionCallback)
 			{
 				switch (passData.executionCallback())
@@ -35,12 +46,28 @@ namespace Nz
 						break;
 
 					case FramePassExecution::Skip:
-						if (passData.commandBuffer)
+					{
+						// Following passes barriers expect textures to be in the layout this pass would have left them in
+						if (regenerateCommandBuffer || !passData.isSkipped)
 						{
-							renderFrame.PushForRelease(std::move(passData.commandBuffer));
-							passData.commandBuffer.reset();
+							ReleaseCommandBuffers(renderFrame, passData);
+							if (!passData.skipBarriers.empty())
+							{
+								passData.commandBuffer = m_commandPool->BuildCommandBuffer([&](CommandBufferBuilder& builder)
+								{
+									for (auto& textureTransition : passData.skipBarriers)
+									{
+										const std::shared_ptr<Texture>& texture = m_textures[textureTransition.textureId].texture;
+										builder.TextureBarrier(textureTransition.srcStageMask, textureTransition.dstStageMask, textureTransition.srcAccessMask, textureTransition.dstAccessMask, textureTransition.oldLayout, textureTransition.newLayout, *texture);
+									}
+								});
+							}
+
+							passData.forceCommandBufferRegeneration = false;
+							passData.isSkipped = true;
 						}
 						continue; //< Skip the pass
+					}
 
 					case FramePassExecution::UpdateAndExecute:
 						regenerateCommandBuffer = true;
@@ -48,46 +75,82 @@ namespace Nz
 				}
 			}
 
+			if (passData.isSkipped)
+			{
+				regenerateCommandBuffer = true;
+				passData.isSkipped = false;
+			}
+
 			if (!regenerateCommandBuffer)
 				continue;
 
-			if (passData.commandBuffer)
-				renderFrame.PushForRelease(std::move(passData.commandBuffer));
+			ReleaseCommandBuffers(renderFrame, passData);
+
+			FramePassEnvironment env{
+				*this,
+				passData.renderRect,
+				renderFrame
+			};
+
+			// Chunked subpasses with more than one chunk are recorded in secondary command buffers, if that fails they're recorded in the primary one
+			for (std::size_t subpassIndex = 0; subpassIndex < passData.subpasses.size(); ++subpassIndex)
+			{
+				auto& subpass = passData.subpasses[subpassIndex];
+				subpass.chunkCount = (subpass.commandChunkCallback) ? subpass.chunkCountCallback() : 0;
+				if (subpass.chunkCount > 1)
+					RecordSecondaryCommandBuffers(passData, subpassIndex, env);
+			}
+
+			auto GetSubpassContents = [](const SubpassData& subpass)
+			{
+				return (!subpass.secondaryCommandBuffers.empty()) ? SubpassContents::SecondaryCommandBuffers : SubpassContents::Inline;
+			};
 
 			passData.commandBuffer = m_commandPool->BuildCommandBuffer([&](CommandBufferBuilder& builder)
 			{
+				// Textures sharing memory with textures used by previous passes have to wait for them to be done
+				if (passData.aliasingBarrier)
+				{
+					PipelineStageFlags stages = PipelineStage::ColorOutput | PipelineStage::FragmentShader | PipelineStage::FragmentTestsEarly | PipelineStage::FragmentTestsLate;
+					builder.MemoryBarrier(stages, stages, MemoryAccess::ColorWrite | MemoryAccess::DepthStencilWrite, MemoryAccess::ColorRead | MemoryAccess::ColorWrite | MemoryAccess::DepthStencilRead | MemoryAccess::DepthStencilWrite | MemoryAccess::ShaderRead);
+				}
+
 				for (auto& textureTransition : passData.invalidationBarriers)
 				{
 					const std::shared_ptr<Texture>& texture = m_textures[textureTransition.textureId].texture;
 					builder.TextureBarrier(textureTransition.srcStageMask, textureTransition.dstStageMask, textureTransition.srcAccessMask, textureTransition.dstAccessMask, textureTransition.oldLayout, textureTransition.newLayout, *texture);
 				}
 
-				builder.BeginRenderPass(*passData.framebuffer, *passData.renderPass, passData.renderRect, passData.outputClearValues.data(), passData.outputClearValues.size());
-
+				// Debug region is opened outside of the render pass, as subpasses executing secondary command buffers can't record anything else
 				if (!passData.name.empty())
 					builder.BeginDebugRegion(passData.name, Color::Green());
 
-				FramePassEnvironment env{
-					*this,
-					passData.renderRect,
-					renderFrame
-				};
+				builder.BeginRenderPass(*passData.framebuffer, *passData.renderPass, passData.renderRect, passData.outputClearValues.data(), passData.outputClearValues.size(), GetSubpassContents(passData.subpasses.front()));
 
-				bool first = true;
-				for (auto& subpass : passData.subpasses)
+				for (std::size_t subpassIndex = 0; subpassIndex < passData.subpasses.size(); ++subpassIndex)
 				{
-					if (!first)
-						builder.NextSubpass();
-
-					first = false;
-
-					subpass.commandCallback(builder, env);
+					auto& subpass = passData.subpasses[subpassIndex];
+					if (subpassIndex > 0)
+						builder.NextSubpass(GetSubpassContents(subpass));
+
+					if (!subpass.secondaryCommandBuffers.empty())
+					{
+						for (const CommandBufferPtr& commandBuffer : subpass.secondaryCommandBuffers)
+							builder.ExecuteSecondaryCommandBuffer(*commandBuffer);
+					}
+					else if (subpass.commandChunkCallback)
+					{
+						for (std::size_t chunkIndex = 0; chunkIndex < subpass.chunkCount; ++chunkIndex)
+							subpass.commandChunkCallback(builder, env, chunkIndex);
+					}
+					else
+						subpass.commandCallback(builder, env);
 				}
 
+				builder.EndRenderPass();
+
 				if (!passData.name.empty())
 					builder.EndDebugRegion();
-
-				builder.EndRenderPass();
 			});
 
 			passData.forceCommandBufferRegeneration = false;
@@ -140,15 +203,51 @@ namespace Nz
 		// Delete previous textures to make some room in VRAM
 		for (auto& passData : m_passes)
 		{
-			renderFrame.PushForRelease(std::move(passData.commandBuffer));
+			ReleaseCommandBuffers(renderFrame, passData);
 			renderFrame.PushForRelease(std::move(passData.framebuffer));
 		}
 
 		for (auto& textureData : m_textures)
 			renderFrame.PushForRelease(std::move(textureData.texture));
 
-		for (auto& textureData : m_textures)
+		std::vector<TextureInfo> textureInfos(m_textures.size());
+		for (std::size_t textureId = 0; textureId < m_textures.size(); ++textureId)
 		{
+			const TextureData& textureData = m_textures[textureId];
+			if (textureData.viewData)
+				continue;
+
+			TextureInfo& textureCreationParams = textureInfos[textureId];
+			textureCreationParams.type = textureData.type;
+			textureCreationParams.usageFlags = textureData.usage;
+			textureCreationParams.pixelFormat = textureData.format;
+			textureCreationParams.levelCount = 1;
+
+			textureCreationParams.layerCount = textureData.layerCount;
+			if (textureCreationParams.type == ImageType::Cubemap)
+				textureCreationParams.layerCount *= 6;
+
+			textureCreationParams.width = 1;
+			textureCreationParams.height = 1;
+			switch (textureData.size)
+			{
+				case FramePassAttachmentSize::Fixed:
+					textureCreationParams.width = textureData.width;
+					textureCreationParams.height = textureData.height;
+					break;
+
+				case FramePassAttachmentSize::SwapchainFactor:
+					textureCreationParams.width = frameWidth * textureData.width / 100'000;
+					textureCreationParams.height = frameHeight * textureData.height / 100'000;
+					break;
+			}
+		}
+
+		AllocateTransientTextures(renderFrame, textureInfos);
+
+		for (std::size_t textureId = 0; textureId < m_textures.size(); ++textureId)
+		{
+			TextureData& textureData = m_textures[textureId];
 			if (textureData.viewData)
 			{
 				TextureData& parentTexture = m_textures[textureData.viewData->parentTextureId];
@@ -163,33 +262,11 @@ namespace Nz
 			}
 			else
 			{
+				if (textureData.heapIndex)
+					textureData.texture = m_textureHeaps[*textureData.heapIndex]->InstantiateTexture(textureInfos[textureId], textureData.heapOffset);
+				else
+					textureData.texture = renderDevice->InstantiateTexture(textureInfos[textureId]);
 
-				TextureInfo textureCreationParams;
-				textureCreationParams.type = textureData.type;
-				textureCreationParams.usageFlags = textureData.usage;
-				textureCreationParams.pixelFormat = textureData.format;
-				textureCreationParams.levelCount = 1;
-
-				textureCreationParams.layerCount = textureData.layerCount;
-				if (textureCreationParams.type == ImageType::Cubemap)
-					textureCreationParams.layerCount *= 6;
-
-				textureCreationParams.width = 1;
-				textureCreationParams.height = 1;
-				switch (textureData.size)
-				{
-					case FramePassAttachmentSize::Fixed:
-						textureCreationParams.width = textureData.width;
-						textureCreationParams.height = textureData.height;
-						break;
-
-					case FramePassAttachmentSize::SwapchainFactor:
-						textureCreationParams.width = frameWidth * textureData.width / 100'000;
-						textureCreationParams.height = frameHeight * textureData.height / 100'000;
-						break;
-				}
-
-				textureData.texture = renderDevice->InstantiateTexture(textureCreationParams);
 				if (!textureData.name.empty())
 					textureData.texture->UpdateDebugName(textureData.name);
 			}
@@ -240,4 +317,211 @@ namespace Nz
 
 		return true;
 	}
+
+	void BakedFrameGraph::AllocateTransientTextures(RenderFrame& renderFrame, const std::vector<TextureInfo>& textureInfos)
+	{
+		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+
+		for (auto& heap : m_textureHeaps)
+			renderFrame.PushForRelease(std::move(heap));
+
+		m_textureHeaps.clear();
+
+		for (auto& passData : m_passes)
+			passData.aliasingBarrier = false;
+
+		// Textures whose content doesn't have to persist between frames can share memory with textures not used at the same time
+		std::vector<std::size_t> transientTextures;
+		std::vector<TextureMemoryRequirements> memoryRequirements(m_textures.size());
+		UInt64 transientMemory = 0;
+		for (std::size_t textureId = 0; textureId < m_textures.size(); ++textureId)
+		{
+			TextureData& textureData = m_textures[textureId];
+			textureData.heapIndex.reset();
+
+			if (textureData.viewData || textureData.persistent)
+				continue;
+
+			memoryRequirements[textureId] = renderDevice->GetTextureMemoryRequirements(textureInfos[textureId]);
+			transientMemory += memoryRequirements[textureId].size;
+
+			transientTextures.push_back(textureId);
+		}
+
+		if (!renderDevice->GetEnabledFeatures().textureMemoryAliasing)
+		{
+			// Fallback: every texture gets its own memory
+			m_transientMemoryUsage = transientMemory;
+			return;
+		}
+
+		// Place biggest textures first to reduce fragmentation
+		std::sort(transientTextures.begin(), transientTextures.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			if (memoryRequirements[lhs].size != memoryRequirements[rhs].size)
+				return memoryRequirements[lhs].size > memoryRequirements[rhs].size;
+
+			return lhs < rhs;
+		});
+
+		struct HeapData
+		{
+			TextureMemoryRequirements requirements;
+			std::vector<std::size_t> textures;
+		};
+
+		std::vector<HeapData> heaps;
+
+		auto IsAliveAtTheSameTime = [&](const TextureData& lhs, const TextureData& rhs)
+		{
+			return lhs.firstUse <= rhs.lastUse && rhs.firstUse <= lhs.lastUse;
+		};
+
+		auto IsOverlappingMemory = [&](std::size_t lhsTextureId, std::size_t rhsTextureId)
+		{
+			UInt64 lhsOffset = m_textures[lhsTextureId].heapOffset;
+			UInt64 rhsOffset = m_textures[rhsTextureId].heapOffset;
+
+			return lhsOffset < rhsOffset + memoryRequirements[rhsTextureId].size && rhsOffset < lhsOffset + memoryRequirements[lhsTextureId].size;
+		};
+
+		std::vector<std::pair<UInt64 /*begin*/, UInt64 /*end*/>> occupiedRanges;
+		for (std::size_t textureId : transientTextures)
+		{
+			TextureData& textureData = m_textures[textureId];
+			const TextureMemoryRequirements& requirements = memoryRequirements[textureId];
+
+			auto heapIt = std::find_if(heaps.begin(), heaps.end(), [&](const HeapData& heap) { return (heap.requirements.memoryTypeBits & requirements.memoryTypeBits) != 0; });
+			if (heapIt == heaps.end())
+			{
+				auto& heap = heaps.emplace_back();
+				heap.requirements.memoryTypeBits = requirements.memoryTypeBits;
+
+				heapIt = heaps.end() - 1;
+			}
+
+			HeapData& heap = *heapIt;
+
+			// Find the lowest offset not overlapping any texture alive at the same time
+			occupiedRanges.clear();
+			for (std::size_t otherTextureId : heap.textures)
+			{
+				const TextureData& otherTexture = m_textures[otherTextureId];
+				if (IsAliveAtTheSameTime(textureData, otherTexture))
+					occupiedRanges.emplace_back(otherTexture.heapOffset, otherTexture.heapOffset + memoryRequirements[otherTextureId].size);
+			}
+
+			std::sort(occupiedRanges.begin(), occupiedRanges.end());
+
+			UInt64 offset = 0;
+			for (const auto& [begin, end] : occupiedRanges)
+			{
+				if (offset + requirements.size <= begin)
+					break;
+
+				offset = std::max(offset, AlignPow2(end, requirements.alignment));
+			}
+
+			textureData.heapIndex = static_cast<std::size_t>(std::distance(heaps.begin(), heapIt));
+			textureData.heapOffset = offset;
+
+			heap.requirements.alignment = std::max(heap.requirements.alignment, requirements.alignment);
+			heap.requirements.memoryTypeBits &= requirements.memoryTypeBits;
+			heap.requirements.size = std::max(heap.requirements.size, offset + requirements.size);
+			heap.textures.push_back(textureId);
+		}
+
+		m_transientMemoryUsage = 0;
+		for (std::size_t heapIndex = 0; heapIndex < heaps.size(); ++heapIndex)
+		{
+			const HeapData& heap = heaps[heapIndex];
+
+			std::shared_ptr<TextureHeap>& textureHeap = m_textureHeaps.emplace_back(renderDevice->InstantiateTextureHeap(heap.requirements));
+			textureHeap->UpdateDebugName("Frame graph transient heap #" + std::to_string(heapIndex));
+
+			m_transientMemoryUsage += heap.requirements.size;
+
+			// Memory written by a texture has to be released before another one can use it (even when it was written the previous frame)
+			for (std::size_t textureId : heap.textures)
+			{
+				for (std::size_t otherTextureId : heap.textures)
+				{
+					if (textureId != otherTextureId && IsOverlappingMemory(textureId, otherTextureId))
+					{
+						m_passes[m_textures[textureId].firstUse].aliasingBarrier = true;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	bool BakedFrameGraph::RecordSecondaryCommandBuffers(PassData& passData, std::size_t subpassIndex, const FramePassEnvironment& env)
+	{
+		SubpassData& subpass = passData.subpasses[subpassIndex];
+		std::size_t chunkCount = subpass.chunkCount;
+
+		// Command pools aren't thread-safe, each chunk gets its own
+		if (m_secondaryCommandPools.size() < chunkCount)
+		{
+			const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+
+			std::size_t poolIndex = m_secondaryCommandPools.size();
+			m_secondaryCommandPools.resize(chunkCount);
+			for (; poolIndex < chunkCount; ++poolIndex)
+				m_secondaryCommandPools[poolIndex] = renderDevice->InstantiateCommandPool(QueueType::Graphics);
+		}
+
+		assert(subpass.secondaryCommandBuffers.empty());
+		subpass.secondaryCommandBuffers.resize(chunkCount);
+
+		// Use a dedicated task group, so recording doesn't interfere with tasks started by other threads
+		TaskGroup recordingTasks;
+		for (std::size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+		{
+			recordingTasks.AddTask([&, chunkIndex]
+			{
+				subpass.secondaryCommandBuffers[chunkIndex] = m_secondaryCommandPools[chunkIndex]->BuildSecondaryCommandBuffer(*passData.framebuffer, *passData.renderPass, SafeCast<UInt32>(subpassIndex), [&](CommandBufferBuilder& secondaryBuilder)
+				{
+					subpass.commandChunkCallback(secondaryBuilder, env, chunkIndex);
+				});
+
+				if (!subpass.secondaryCommandBuffers[chunkIndex])
+					throw std::runtime_error("failed to build secondary command buffer");
+			});
+		}
+
+		try
+		{
+			recordingTasks.Wait();
+		}
+		catch (const std::exception& e)
+		{
+			// Every chunk has to be recorded, or the pass would silently miss some of its commands
+			NazaraError("failed to record pass {0} chunks in secondary command buffers ({1}), recording them in the primary command buffer", passData.name, e.what());
+
+			// Those were never submitted and can be freed right away
+			subpass.secondaryCommandBuffers.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	void BakedFrameGraph::ReleaseCommandBuffers(RenderFrame& renderFrame, PassData& passData)
+	{
+		if (passData.commandBuffer)
+		{
+			renderFrame.PushForRelease(std::move(passData.commandBuffer));
+			passData.commandBuffer.reset();
+		}
+
+		for (auto& subpass : passData.subpasses)
+		{
+			for (CommandBufferPtr& commandBuffer : subpass.secondaryCommandBuffers)
+				renderFrame.PushForRelease(std::move(commandBuffer));
+
+			subpass.secondaryCommandBuffers.clear();
+		}
+	}
 }
@@ -0,0 +1,183 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/BindlessTextureTable.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <array>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::BindlessTextureTable
+	* \brief Graphics class that holds a single big array of textures, referenced by index from shaders
+	*
+	* Materials whose shader declare a "Bindless" external block (with a "Textures" sampler2D array of BindlessTextureCount elements)
+	* fetch their textures from this table, which is bound once per pipeline instead of once per material.
+	* The first entry of the table is reserved to the default texture and is used for every unused entry.
+	*
+	* The table is a single partially bound shader binding whose entries are written in place, entries are only reused once the GPU is done with them.
+	*/
+	BindlessTextureTable::BindlessTextureTable(std::shared_ptr<RenderDevice> renderDevice, UInt32 capacity, std::shared_ptr<Texture> defaultTexture, std::shared_ptr<TextureSampler> defaultSampler) :
+	m_renderDevice(std::move(renderDevice)),
+	m_recycledEntries(std::make_shared<std::vector<UInt32>>())
+	{
+		NazaraAssert(capacity > 0, "capacity must be at least one");
+		NazaraAssert(defaultTexture, "invalid default texture");
+		NazaraAssert(defaultSampler, "invalid default sampler");
+
+		RenderPipelineLayoutInfo layoutInfo;
+		auto& textureBinding = layoutInfo.bindings.emplace_back();
+		textureBinding.arraySize = capacity;
+		textureBinding.bindingIndex = 0;
+		textureBinding.partiallyBound = true;
+		textureBinding.setIndex = 0;
+		textureBinding.shaderStageFlags = nzsl::ShaderStageType_All; //< has to match reflected pipeline layouts for descriptor set compatibility
+		textureBinding.type = ShaderBindingType::Sampler;
+
+		m_renderPipelineLayout = m_renderDevice->InstantiateRenderPipelineLayout(std::move(layoutInfo));
+		m_shaderBinding = m_renderPipelineLayout->AllocateShaderBinding(0);
+
+		m_entries.resize(capacity);
+		m_dirtyEntries.Resize(capacity, true);
+		m_freeEntries.Resize(capacity, true);
+
+		auto& defaultEntry = m_entries[DefaultTextureIndex];
+		defaultEntry.texture = std::move(defaultTexture);
+		defaultEntry.sampler = std::move(defaultSampler);
+		defaultEntry.refCount = 1; //< never released
+		m_freeEntries.Reset(DefaultTextureIndex);
+
+		// Fill the whole table with the default texture
+		WriteDirtyEntries();
+	}
+
+	/*!
+	* \brief Registers a texture/sampler pair and returns its index in the table
+	*
+	* Registering the same pair multiple times returns the same index, each call must be matched by a UnregisterTexture call.
+	* The texture becomes visible to shaders on the next Update call.
+	*
+	* \return Index of the texture in the table, or DefaultTextureIndex if the table is full
+	*/
+	UInt32 BindlessTextureTable::RegisterTexture(std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> sampler)
+	{
+		NazaraAssert(texture, "invalid texture");
+		NazaraAssert(sampler, "invalid sampler");
+
+		auto it = m_entryByTexture.find({ texture.get(), sampler.get() });
+		if (it != m_entryByTexture.end())
+		{
+			m_entries[it->second].refCount++;
+			return it->second;
+		}
+
+		std::size_t entryIndex = m_freeEntries.FindFirst();
+		if (entryIndex == m_freeEntries.npos)
+		{
+			NazaraWarning("bindless texture table is full ({0} textures), falling back to default texture", m_entries.size());
+			return DefaultTextureIndex;
+		}
+
+		m_freeEntries.Reset(entryIndex);
+		m_entryByTexture.emplace(std::make_pair(texture.get(), sampler.get()), SafeCast<UInt32>(entryIndex));
+
+		auto& entry = m_entries[entryIndex];
+		entry.refCount = 1;
+		entry.sampler = std::move(sampler);
+		entry.texture = std::move(texture);
+
+		m_dirtyEntries.Set(entryIndex);
+
+		return SafeCast<UInt32>(entryIndex);
+	}
+
+	void BindlessTextureTable::UnregisterTexture(UInt32 textureIndex)
+	{
+		NazaraAssert(textureIndex < m_entries.size(), "texture index out of range");
+		if (textureIndex == DefaultTextureIndex)
+			return;
+
+		auto& entry = m_entries[textureIndex];
+		NazaraAssert(entry.refCount > 0, "texture is not registered");
+		if (--entry.refCount > 0)
+			return;
+
+		m_entryByTexture.erase({ entry.texture.get(), entry.sampler.get() });
+
+		// Frames in flight may still sample the texture, the entry is kept as-is until the GPU is done with them
+		m_releasedEntries.push_back(textureIndex);
+	}
+
+	/*!
+	* \brief Writes the entries registered since last call into the shader binding
+	*
+	* Only the modified entries are written, which is allowed while the binding is used by pending commands as long as they don't access them.
+	* Entries unregistered since last call become available again once the frame is over.
+	*/
+	void BindlessTextureTable::Update(RenderFrame& renderFrame)
+	{
+		// Entries released during previous frames are no longer accessed by the GPU
+		for (UInt32 entryIndex : *m_recycledEntries)
+		{
+			m_entries[entryIndex] = Entry{};
+			m_dirtyEntries.Set(entryIndex); //< reset to the default texture
+			m_freeEntries.Set(entryIndex);
+		}
+		m_recycledEntries->clear();
+
+		if (!m_releasedEntries.empty())
+		{
+			// The table may be destroyed before the frame is over
+			renderFrame.PushReleaseCallback([recycledEntries = std::weak_ptr<std::vector<UInt32>>(m_recycledEntries), releasedEntries = std::move(m_releasedEntries)]
+			{
+				if (std::shared_ptr<std::vector<UInt32>> entries = recycledEntries.lock())
+					entries->insert(entries->end(), releasedEntries.begin(), releasedEntries.end());
+			});
+
+			m_releasedEntries.clear();
+		}
+
+		WriteDirtyEntries();
+	}
+
+	void BindlessTextureTable::WriteDirtyEntries()
+	{
+		constexpr std::size_t MaxEntryPerUpdate = 64;
+
+		std::array<ShaderBinding::Binding, MaxEntryPerUpdate> bindings;
+		std::array<ShaderBinding::SampledTextureBinding, MaxEntryPerUpdate> textureBindings;
+		std::size_t bindingCount = 0;
+
+		const Entry& defaultEntry = m_entries[DefaultTextureIndex];
+		for (std::size_t entryIndex = m_dirtyEntries.FindFirst(); entryIndex != m_dirtyEntries.npos; entryIndex = m_dirtyEntries.FindNext(entryIndex))
+		{
+			// Unused entries are filled with the default texture
+			const Entry& entry = (m_entries[entryIndex].texture) ? m_entries[entryIndex] : defaultEntry;
+
+			textureBindings[bindingCount].texture = entry.texture.get();
+			textureBindings[bindingCount].sampler = entry.sampler.get();
+
+			bindings[bindingCount].bindingIndex = 0;
+			bindings[bindingCount].content = ShaderBinding::SampledTextureBindings {
+				1, &textureBindings[bindingCount], SafeCast<UInt32>(entryIndex)
+			};
+
+			if (++bindingCount == MaxEntryPerUpdate)
+			{
+				m_shaderBinding->Update(bindings.data(), bindingCount);
+				bindingCount = 0;
+			}
+		}
+
+		if (bindingCount > 0)
+			m_shaderBinding->Update(bindings.data(), bindingCount);
+
+		m_dirtyEntries.Reset();
+	}
+}
@@ -8,23 +8,32 @@
 #include <Nazara/Graphics/ElementRendererRegistry.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/FramePipeline.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
-	DepthPipelinePass::DepthPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, std::size_t passIndex, std::string passName) :
+	DepthPipelinePass::DepthPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, std::size_t passIndex, std::string passName, bool gpuCulling) :
+	m_commandChunkCount(0),
+	m_commandChunkSize(0),
 	m_passIndex(passIndex),
 	m_lastVisibilityHash(0),
 	m_passName(std::move(passName)),
+	m_depthPyramid(nullptr),
 	m_viewer(viewer),
 	m_elementRegistry(elementRegistry),
 	m_pipeline(owner),
 	m_rebuildCommandBuffer(false),
-	m_rebuildElements(false)
+	m_rebuildElements(false),
+	m_skipRendering(false)
 	{
+		// Visible renderables are not frustum culled by the pipeline in this case, draws are culled on the GPU every frame
+		if (gpuCulling)
+			m_indirectDrawTable.emplace(Graphics::Instance()->GetRenderDevice());
 	}
 
 	void DepthPipelinePass::Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash)
@@ -33,16 +42,25 @@ namespace Nz
 		{
 			renderFrame.PushForRelease(std::move(m_renderElements));
 			m_renderElements.clear();
+			m_aabbPerRenderElement.clear();
 
 			for (const auto& renderableData : visibleRenderables)
 			{
 				InstancedRenderable::ElementData elementData{
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
-					renderableData.worldInstance
+					renderableData.worldInstance,
+					renderableData.lodIndex
 				};
 
+				std::size_t previousCount = m_renderElements.size();
 				renderableData.instancedRenderable->BuildElement(m_elementRegistry, elementData, m_passIndex, m_renderElements);
+
+				if (m_indirectDrawTable)
+				{
+					for (std::size_t i = previousCount; i < m_renderElements.size(); ++i)
+						m_aabbPerRenderElement.emplace(m_renderElements[i].GetElement(), renderableData.instancedRenderable->GetAABB());
+				}
 			}
 
 			m_renderQueueRegistry.Clear();
@@ -81,26 +99,55 @@ namespace Nz
 				elementRenderer.Reset(*m_elementRendererData[elementType], renderFrame);
 			});
 
+			if (m_indirectDrawTable)
+				m_indirectDrawTable->Clear(renderFrame);
+
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+			// Chunks are recorded in parallel, batches must be split at their boundaries
+			std::size_t queueSize = m_renderQueue.size();
+			m_commandChunkSize = ComputeCommandChunkSize(queueSize);
+			m_commandChunkCount = (m_commandChunkSize > 0) ? (queueSize + m_commandChunkSize - 1) / m_commandChunkSize : 0;
+
+			for (std::size_t firstElement = 0; firstElement < queueSize; firstElement += m_commandChunkSize)
 			{
-				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
+				m_elementRegistry.ProcessRenderQueue(m_renderQueue, firstElement, std::min(m_commandChunkSize, queueSize - firstElement), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+				{
+					ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 
-				m_renderStates.clear();
-				m_renderStates.resize(elementCount);
+					m_renderStates.clear();
+					m_renderStates.resize(elementCount);
 
-				elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], renderFrame, elementCount, elements, m_renderStates.data());
-			});
+					if (m_indirectDrawTable)
+					{
+						for (std::size_t i = 0; i < elementCount; ++i)
+						{
+							auto it = m_aabbPerRenderElement.find(elements[i]);
+							assert(it != m_aabbPerRenderElement.end());
+
+							m_renderStates[i].aabb = it->second;
+							m_renderStates[i].indirectDrawTable = &*m_indirectDrawTable;
+						}
+					}
+
+					elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], renderFrame, elementCount, elements, m_renderStates.data());
+				});
+			}
 
 			m_elementRegistry.ForEachElementRenderer([&](std::size_t elementType, ElementRenderer& elementRenderer)
 			{
 				elementRenderer.PrepareEnd(renderFrame, *m_elementRendererData[elementType]);
 			});
 
+			if (m_indirectDrawTable)
+				m_indirectDrawTable->Upload(renderFrame, viewerInstance);
+
 			m_rebuildCommandBuffer = true;
 			m_rebuildElements = false;
 		}
+
+		if (m_indirectDrawTable)
+			m_indirectDrawTable->Cull(renderFrame, m_depthPyramid);
 	}
 
 	void DepthPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance)
@@ -137,11 +184,21 @@ namespace Nz
 
 		depthPrepass.SetExecutionCallback([&]()
 		{
+			// Skipping releases the command buffer, it will be rebuilt on next execution anyway
+			if (m_skipRendering)
+				return FramePassExecution::Skip;
+
 			return (m_rebuildCommandBuffer) ? FramePassExecution::UpdateAndExecute : FramePassExecution::Execute;
 		});
 
-		depthPrepass.SetCommandCallback([this](CommandBufferBuilder& builder, const FramePassEnvironment& /*env*/)
+		depthPrepass.SetCommandChunkCallback([this]()
 		{
+			m_rebuildCommandBuffer = false;
+			return m_commandChunkCount;
+		},
+		[this](CommandBufferBuilder& builder, const FramePassEnvironment& /*env*/, std::size_t chunkIndex)
+		{
+			// Called from worker threads
 			Recti viewport = m_viewer->GetViewport();
 
 			builder.SetScissor(viewport);
@@ -149,13 +206,12 @@ namespace Nz
 
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+			std::size_t firstElement = chunkIndex * m_commandChunkSize;
+			m_elementRegistry.ProcessRenderQueue(m_renderQueue, firstElement, std::min(m_commandChunkSize, m_renderQueue.size() - firstElement), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 			{
 				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 				elementRenderer.Render(viewerInstance, *m_elementRendererData[elementType], builder, elementCount, elements);
 			});
-
-			m_rebuildCommandBuffer = false;
 		});
 
 		return depthPrepass;
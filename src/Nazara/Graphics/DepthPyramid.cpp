@@ -0,0 +1,331 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/DepthPyramid.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Graphics/FrameGraph.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <Nazara/Renderer/UploadPool.hpp>
+#include <NZSL/Math/FieldOffsets.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::DepthPyramid
+	* \brief Graphics class building a hierarchical depth buffer (Hi-Z) from the depth buffer of a viewer, used for occlusion culling
+	*
+	* The depth buffer is copied to a color attachment at the end of the frame graph, then reduced in a compute shader:
+	* every level is half the size of the previous one and stores the farthest depth of the texels it covers.
+	* Levels are packed in a single storage texture (the first one on the left, the others stacked on its right) so they can be read without texture views.
+	*
+	* The pyramid is built at the end of a frame and used to cull draws of the next one (see IndirectDrawTable::Cull),
+	* with the view-projection matrix and viewport it was built with.
+	* Draws visible this frame but hidden behind last frame depth are culled for a frame, which is the usual trade-off of reprojecting the previous frame.
+	*/
+	DepthPyramid::DepthPyramid(std::shared_ptr<RenderDevice> renderDevice, AbstractViewer* viewer) :
+	m_renderDevice(std::move(renderDevice)),
+	m_viewer(viewer)
+	{
+		// Has to match LevelData from the DepthPyramid shader
+		nzsl::FieldOffsets levelStruct(nzsl::StructLayout::Std140);
+		m_levelDataLayout.sourceOffsetOffset = levelStruct.AddField(nzsl::StructFieldType::Int2);
+		m_levelDataLayout.sourceSizeOffset = levelStruct.AddField(nzsl::StructFieldType::Int2);
+		m_levelDataLayout.destOffsetOffset = levelStruct.AddField(nzsl::StructFieldType::Int2);
+		m_levelDataLayout.destSizeOffset = levelStruct.AddField(nzsl::StructFieldType::Int2);
+
+		m_levelDataLayout.totalSize = levelStruct.GetAlignedSize();
+
+		// Has to match OcclusionData from the DrawCulling shader
+		nzsl::FieldOffsets occlusionStruct(nzsl::StructLayout::Std140);
+		m_occlusionDataLayout.viewProjMatrixOffset = occlusionStruct.AddMatrix(nzsl::StructFieldType::Float1, 4, 4, true);
+		m_occlusionDataLayout.viewportOffset = occlusionStruct.AddField(nzsl::StructFieldType::Float4);
+		m_occlusionDataLayout.levelCountOffset = occlusionStruct.AddField(nzsl::StructFieldType::Int1);
+		m_occlusionDataLayout.levelsOffset = occlusionStruct.AddFieldArray(nzsl::StructFieldType::Int4, MaxLevelCount);
+
+		m_occlusionDataLayout.totalSize = occlusionStruct.GetAlignedSize();
+
+		m_occlusionDataBuffer = m_renderDevice->InstantiateBuffer(BufferType::Uniform, m_occlusionDataLayout.totalSize, BufferUsage::DeviceLocal);
+		m_occlusionDataBuffer->UpdateDebugName("Occlusion data");
+	}
+
+	/*!
+	* \brief Builds the pyramid from the depth buffer rendered this frame
+	*
+	* Has to be called after the frame graph was executed, draws culled afterwards are tested against this frame depth.
+	*/
+	void DepthPyramid::Build(RenderFrame& renderFrame)
+	{
+		if (m_levels.empty())
+			return;
+
+		Graphics* graphics = Graphics::Instance();
+		const std::shared_ptr<ComputePipeline>& pyramidPipeline = graphics->GetDepthPyramidPipeline();
+		NazaraAssert(pyramidPipeline, "occlusion culling is not supported");
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Depth pyramid", Color::Blue());
+			{
+				// The depth copy is left as a color output by the frame graph, and the pyramid may still be read by the culling of this frame
+				builder.TextureBarrier(PipelineStage::ColorOutput, PipelineStage::ComputeShader, MemoryAccess::ColorWrite, MemoryAccess::ShaderRead, TextureLayout::ColorOutput, TextureLayout::General, *m_depthCopyTexture);
+				builder.MemoryBarrier(PipelineStage::ComputeShader, PipelineStage::ComputeShader, MemoryAccess::ShaderRead, MemoryAccess::ShaderWrite);
+
+				builder.BindComputePipeline(*pyramidPipeline);
+				for (const Level& level : m_levels)
+				{
+					builder.BindComputeShaderBinding(0, *level.shaderBinding);
+					builder.Dispatch((level.size.x + ReductionWorkgroupSize - 1) / ReductionWorkgroupSize, (level.size.y + ReductionWorkgroupSize - 1) / ReductionWorkgroupSize, 1);
+
+					// Next level is reduced from this one, and the last one is read by the culling of the next frame
+					builder.MemoryBarrier(PipelineStage::ComputeShader, PipelineStage::ComputeShader, MemoryAccess::ShaderWrite, MemoryAccess::ShaderRead);
+				}
+
+				// Back to the layout the frame graph expects
+				builder.TextureBarrier(PipelineStage::ComputeShader, PipelineStage::ColorOutput, MemoryAccess::ShaderRead, MemoryAccess::ColorWrite, TextureLayout::General, TextureLayout::ColorOutput, *m_depthCopyTexture);
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Compute);
+
+		// Draws of the next frame are projected like the depth they're tested against
+		UploadPool::Allocation& allocation = renderFrame.GetUploadPool().Allocate(m_occlusionDataLayout.totalSize);
+
+		Recti viewport = m_viewer->GetViewport();
+
+		std::memset(allocation.mappedPtr, 0, m_occlusionDataLayout.totalSize);
+		AccessByOffset<Matrix4f&>(allocation.mappedPtr, m_occlusionDataLayout.viewProjMatrixOffset) = m_viewer->GetViewerInstance().GetViewProjMatrix();
+		AccessByOffset<Vector4f&>(allocation.mappedPtr, m_occlusionDataLayout.viewportOffset) = Vector4f(float(viewport.x), float(viewport.y), float(viewport.width), float(viewport.height));
+		AccessByOffset<Int32&>(allocation.mappedPtr, m_occlusionDataLayout.levelCountOffset) = SafeCast<Int32>(m_levels.size());
+
+		Vector4i* levels = AccessByOffset<Vector4i*>(allocation.mappedPtr, m_occlusionDataLayout.levelsOffset);
+		for (std::size_t i = 0; i < m_levels.size(); ++i)
+			levels[i] = Vector4i(m_levels[i].offset.x, m_levels[i].offset.y, m_levels[i].size.x, m_levels[i].size.y);
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Occlusion data upload", Color::Yellow());
+			{
+				builder.PreTransferBarrier();
+				builder.CopyBuffer(allocation, m_occlusionDataBuffer.get());
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+	}
+
+	/*!
+	* \brief Adds the pass copying the depth buffer of the viewer to the frame graph
+	*
+	* The depth buffer has to be in a depth-only format (as a depth-stencil view can't be sampled).
+	*
+	* \return Index of the depth copy attachment
+	*/
+	std::size_t DepthPyramid::RegisterToFrameGraph(FrameGraph& frameGraph, std::size_t depthBufferIndex)
+	{
+		m_depthBufferIndex = depthBufferIndex;
+		m_depthCopyIndex = frameGraph.AddAttachment({
+			"Depth pyramid source",
+			PixelFormat::R32F,
+			FramePassAttachmentSize::SwapchainFactor,
+			100'000,
+			100'000,
+			TextureUsage::ShaderReadWrite
+		});
+
+		FramePass& depthCopyPass = frameGraph.AddPass("Depth pyramid copy");
+		depthCopyPass.AddInput(depthBufferIndex);
+		depthCopyPass.AddOutput(m_depthCopyIndex);
+
+		depthCopyPass.SetCommandCallback([this](CommandBufferBuilder& builder, const FramePassEnvironment& env)
+		{
+			builder.SetScissor(env.renderRect);
+			builder.SetViewport(env.renderRect);
+
+			builder.BindRenderPipeline(*Graphics::Instance()->GetBlitPipeline(false));
+			builder.BindRenderShaderBinding(0, *m_copyShaderBinding);
+			builder.Draw(3);
+		});
+
+		// Read after the frame graph execution, keep it out of memory aliasing and the backbuffer outputs keep the pass alive
+		frameGraph.MarkAttachmentAsPersistent(m_depthCopyIndex);
+		frameGraph.AddBackbufferOutput(m_depthCopyIndex);
+
+		return m_depthCopyIndex;
+	}
+
+	/*!
+	* \brief Recreates the pyramid to match the frame graph textures
+	*
+	* Has to be called after every frame graph rebuild or resize, occlusion culling is disabled until the next Build call.
+	*/
+	void DepthPyramid::UpdateTextures(RenderFrame& renderFrame, const BakedFrameGraph& frameGraph)
+	{
+		Graphics* graphics = Graphics::Instance();
+		const std::shared_ptr<RenderPipelineLayout>& pyramidPipelineLayout = graphics->GetDepthPyramidPipelineLayout();
+		NazaraAssert(pyramidPipelineLayout, "occlusion culling is not supported");
+
+		m_depthCopyTexture = frameGraph.GetAttachmentTexture(m_depthCopyIndex);
+
+		// Nearest filtering keeps the exact depth (and linear filtering isn't supported by every depth format)
+		TextureSamplerInfo samplerInfo;
+		samplerInfo.magFilter = SamplerFilter::Nearest;
+		samplerInfo.minFilter = SamplerFilter::Nearest;
+		samplerInfo.mipmapMode = SamplerMipmapMode::Nearest;
+
+		if (m_copyShaderBinding)
+			renderFrame.PushForRelease(std::move(m_copyShaderBinding));
+
+		m_copyShaderBinding = graphics->GetBlitPipelineLayout()->AllocateShaderBinding(0);
+		m_copyShaderBinding->Update({
+			{
+				0,
+				ShaderBinding::SampledTextureBinding {
+					frameGraph.GetAttachmentTexture(m_depthBufferIndex).get(),
+					graphics->GetSamplerCache().Get(samplerInfo).get()
+				}
+			}
+		});
+
+		// Level sizes are rounded down, the last row and column of a level also cover the odd row and column of the previous one
+		const TextureInfo& depthInfo = m_depthCopyTexture->GetTextureInfo();
+		Vector2i levelSize(SafeCast<int>(depthInfo.width), SafeCast<int>(depthInfo.height));
+
+		for (Level& level : m_levels)
+			renderFrame.PushForRelease(std::move(level.shaderBinding));
+
+		m_levels.clear();
+
+		int stackHeight = 0;
+		while (m_levels.size() < MaxLevelCount)
+		{
+			levelSize = Vector2i(std::max(levelSize.x / 2, 1), std::max(levelSize.y / 2, 1));
+
+			Level& level = m_levels.emplace_back();
+			level.size = levelSize;
+
+			if (m_levels.size() > 1)
+			{
+				level.offset = Vector2i(m_levels.front().size.x, stackHeight);
+				stackHeight += levelSize.y;
+			}
+			else
+				level.offset = Vector2i::Zero();
+
+			if (levelSize == Vector2i(1, 1))
+				break;
+		}
+
+		TextureInfo pyramidInfo;
+		pyramidInfo.pixelFormat = PixelFormat::R32F;
+		pyramidInfo.type = ImageType::E2D;
+		pyramidInfo.usageFlags = TextureUsage::ShaderReadWrite;
+		pyramidInfo.levelCount = 1;
+		pyramidInfo.width = SafeCast<unsigned int>(m_levels.front().size.x + ((m_levels.size() > 1) ? m_levels[1].size.x : 0));
+		pyramidInfo.height = SafeCast<unsigned int>(std::max(m_levels.front().size.y, stackHeight));
+
+		if (m_pyramidTexture)
+			renderFrame.PushForRelease(std::move(m_pyramidTexture));
+
+		m_pyramidTexture = m_renderDevice->InstantiateTexture(pyramidInfo);
+		m_pyramidTexture->UpdateDebugName("Depth pyramid");
+
+		// Every level has its own range in the level data buffer
+		UInt64 levelDataStride = AlignPow2(UInt64(m_levelDataLayout.totalSize), m_renderDevice->GetDeviceInfo().limits.minUniformBufferOffsetAlignment);
+		UInt64 levelDataSize = levelDataStride * m_levels.size();
+
+		if (!m_levelDataBuffer || m_levelDataBuffer->GetSize() < levelDataSize)
+		{
+			renderFrame.PushForRelease(std::move(m_levelDataBuffer));
+
+			m_levelDataBuffer = m_renderDevice->InstantiateBuffer(BufferType::Uniform, levelDataStride * MaxLevelCount, BufferUsage::DeviceLocal);
+			m_levelDataBuffer->UpdateDebugName("Depth pyramid levels");
+		}
+
+		UploadPool::Allocation& levelAllocation = renderFrame.GetUploadPool().Allocate(levelDataSize);
+
+		for (std::size_t i = 0; i < m_levels.size(); ++i)
+		{
+			Level& level = m_levels[i];
+
+			// The first level is reduced from the depth copy, the other ones from the previous level
+			const Texture* sourceTexture = (i == 0) ? m_depthCopyTexture.get() : m_pyramidTexture.get();
+			Vector2i sourceOffset = (i == 0) ? Vector2i::Zero() : m_levels[i - 1].offset;
+			Vector2i sourceSize = (i == 0) ? Vector2i(SafeCast<int>(depthInfo.width), SafeCast<int>(depthInfo.height)) : m_levels[i - 1].size;
+
+			UInt8* levelPtr = static_cast<UInt8*>(levelAllocation.mappedPtr) + i * levelDataStride;
+			AccessByOffset<Vector2i&>(levelPtr, m_levelDataLayout.sourceOffsetOffset) = sourceOffset;
+			AccessByOffset<Vector2i&>(levelPtr, m_levelDataLayout.sourceSizeOffset) = sourceSize;
+			AccessByOffset<Vector2i&>(levelPtr, m_levelDataLayout.destOffsetOffset) = level.offset;
+			AccessByOffset<Vector2i&>(levelPtr, m_levelDataLayout.destSizeOffset) = level.size;
+
+			level.shaderBinding = pyramidPipelineLayout->AllocateShaderBinding(0);
+			level.shaderBinding->Update({
+				{
+					0,
+					ShaderBinding::TextureBinding {
+						sourceTexture, TextureAccess::ReadOnly
+					}
+				},
+				{
+					1,
+					ShaderBinding::TextureBinding {
+						m_pyramidTexture.get(), TextureAccess::WriteOnly
+					}
+				},
+				{
+					2,
+					ShaderBinding::UniformBufferBinding {
+						m_levelDataBuffer.get(), i * levelDataStride, m_levelDataLayout.totalSize
+					}
+				}
+			});
+		}
+
+		if (m_cullingShaderBinding)
+			renderFrame.PushForRelease(std::move(m_cullingShaderBinding));
+
+		m_cullingShaderBinding = graphics->GetDrawCullingPipelineLayout()->AllocateShaderBinding(1);
+		m_cullingShaderBinding->Update({
+			{
+				0,
+				ShaderBinding::TextureBinding {
+					m_pyramidTexture.get(), TextureAccess::ReadOnly
+				}
+			},
+			{
+				1,
+				ShaderBinding::UniformBufferBinding {
+					m_occlusionDataBuffer.get(), 0, m_occlusionDataBuffer->GetSize()
+				}
+			}
+		});
+
+		// The new pyramid is empty, don't test draws against it until it's built
+		UploadPool::Allocation& occlusionAllocation = renderFrame.GetUploadPool().Allocate(m_occlusionDataLayout.totalSize);
+		std::memset(occlusionAllocation.mappedPtr, 0, m_occlusionDataLayout.totalSize);
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Depth pyramid upload", Color::Yellow());
+			{
+				builder.TextureBarrier(PipelineStage::TopOfPipe, PipelineStage::ComputeShader, {}, MemoryAccess::ShaderRead | MemoryAccess::ShaderWrite, TextureLayout::Undefined, TextureLayout::General, *m_pyramidTexture);
+
+				builder.PreTransferBarrier();
+				builder.CopyBuffer(levelAllocation, RenderBufferView(m_levelDataBuffer.get(), 0, levelDataSize));
+				builder.CopyBuffer(occlusionAllocation, m_occlusionDataBuffer.get());
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+	}
+}
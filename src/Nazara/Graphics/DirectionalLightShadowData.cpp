@@ -0,0 +1,343 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/DirectionalLightShadowData.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Graphics/DirectionalLight.hpp>
+#include <Nazara/Graphics/FrameGraph.hpp>
+#include <Nazara/Graphics/FramePipeline.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <algorithm>
+#include <cmath>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::array<std::string_view, PredefinedLightData::MaxCascadeCount> s_cascadeNames = {
+			"Directional-light shadow mapping (cascade #1)",
+			"Directional-light shadow mapping (cascade #2)",
+			"Directional-light shadow mapping (cascade #3)",
+			"Directional-light shadow mapping (cascade #4)"
+		};
+
+		// Cascade projections are made a bit larger than the slice they cover so they can be kept while the viewer moves
+		constexpr float s_cascadeMargin = 1.1f;
+
+		// Distance (relative to the cascade radius) before the cascade where casters are still rendered
+		constexpr float s_casterDistanceFactor = 3.f;
+
+		constexpr Matrix4f s_biasMatrix(0.5f, 0.0f, 0.0f, 0.0f,
+		                                0.0f, 0.5f, 0.0f, 0.0f,
+		                                0.0f, 0.0f, 1.0f, 0.0f,
+		                                0.5f, 0.5f, 0.0f, 1.0f);
+	}
+
+	DirectionalLightShadowData::DirectionalLightShadowData(FramePipeline& pipeline, ElementRendererRegistry& elementRegistry, const DirectionalLight& light) :
+	m_elementRegistry(elementRegistry),
+	m_pipeline(pipeline),
+	m_light(light)
+	{
+		UpdatePerViewerStatus(true);
+
+		m_onLightShadowMapSettingChange.Connect(m_light.OnLightShadowMapSettingChange, [this](Light* /*light*/, PixelFormat /*newPixelFormat*/, UInt32 newSize)
+		{
+			// Shadowmaps will be reallocated by the frame graph (which also handles cascade count changes)
+			for (auto&& [viewer, viewerData] : m_viewerData)
+			{
+				for (CascadeData& cascade : viewerData->cascades)
+				{
+					cascade.viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(newSize), SafeCast<int>(newSize)));
+					cascade.hasProjection = false; //< texel snapping depends on the shadowmap size
+				}
+			}
+		});
+	}
+
+	void DirectionalLightShadowData::FillLightData(void* data, const AbstractViewer* viewer) const
+	{
+		auto it = m_viewerData.find(viewer);
+		if (it == m_viewerData.end())
+			return;
+
+		const PerViewerData& viewerData = *it->second;
+
+		auto lightOffset = PredefinedLightData::GetOffsets();
+		for (std::size_t i = 0; i < viewerData.cascadeCount; ++i)
+			AccessByOffset<Matrix4f&>(data, lightOffset.lightMemberOffsets.cascadeViewProjMatrices + i * sizeof(Matrix4f)) = viewerData.cascades[i].viewProjMatrix;
+	}
+
+	void DirectionalLightShadowData::InvalidateShadowmaps()
+	{
+		for (auto&& [viewer, viewerData] : m_viewerData)
+		{
+			for (CascadeData& cascade : viewerData->cascades)
+				cascade.shadowmapCache.isValid = false;
+		}
+	}
+
+	void DirectionalLightShadowData::PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* viewer)
+	{
+		assert(viewer);
+		PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
+
+		const ViewerInstance& viewerInstance = viewer->GetViewerInstance();
+
+		// Compute viewer near and far distances along its direction from its frustum corners
+		EnumArray<BoxCorner, Vector3f> frustumCorners = Frustumf::Extract(viewerInstance.GetViewProjMatrix()).ComputeCorners();
+
+		Vector3f farCenter = Vector3f::Zero();
+		Vector3f nearCenter = Vector3f::Zero();
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			farCenter += frustumCorners[static_cast<BoxCorner>(i)];
+			nearCenter += frustumCorners[static_cast<BoxCorner>(i + 4)];
+		}
+		farCenter /= 4.f;
+		nearCenter /= 4.f;
+
+		const Vector3f& eyePosition = viewerInstance.GetEyePosition();
+		Vector3f viewerDir = (farCenter - nearCenter).GetNormal();
+
+		float zNear = viewerDir.DotProduct(nearCenter - eyePosition);
+		float zFar = viewerDir.DotProduct(farCenter - eyePosition);
+		if (zFar <= zNear)
+			return;
+
+		float shadowFar = std::clamp(m_light.GetShadowMaxDistance(), zNear, zFar);
+
+		std::array<float, PredefinedLightData::MaxCascadeCount> splitDistances;
+		ComputeCascadeSplits(zNear, shadowFar, m_light.GetShadowCascadeSplitFactor(), viewerData.cascadeCount, splitDistances.data());
+
+		bool projectionUpdated = false;
+
+		float sliceStart = zNear;
+		for (std::size_t cascadeIndex = 0; cascadeIndex < viewerData.cascadeCount; ++cascadeIndex)
+		{
+			float sliceEnd = splitDistances[cascadeIndex];
+
+			// Slice corners are interpolated on the frustum edges
+			float startFactor = (sliceStart - zNear) / (zFar - zNear);
+			float endFactor = (sliceEnd - zNear) / (zFar - zNear);
+
+			std::array<Vector3f, BoxCornerCount> sliceCorners;
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				const Vector3f& farCorner = frustumCorners[static_cast<BoxCorner>(i)];
+				const Vector3f& nearCorner = frustumCorners[static_cast<BoxCorner>(i + 4)];
+
+				sliceCorners[i] = Vector3f::Lerp(nearCorner, farCorner, endFactor);
+				sliceCorners[i + 4] = Vector3f::Lerp(nearCorner, farCorner, startFactor);
+			}
+
+			PrepareCascade(renderFrame, viewerData.cascades[cascadeIndex], sliceCorners.data(), &projectionUpdated);
+
+			sliceStart = sliceEnd;
+		}
+
+		// Cascade matrices are part of the light data
+		if (projectionUpdated)
+			OnShadowDataInvalidated(this, viewer);
+	}
+
+	void DirectionalLightShadowData::RegisterMaterialInstance(const MaterialInstance& matInstance)
+	{
+		for (auto&& [viewer, viewerData] : m_viewerData)
+		{
+			for (CascadeData& cascade : viewerData->cascades)
+				cascade.depthPass->RegisterMaterialInstance(matInstance);
+		}
+	}
+
+	void DirectionalLightShadowData::RegisterPassInputs(FramePass& pass, const AbstractViewer* viewer)
+	{
+		assert(viewer);
+		const PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
+
+		std::size_t arrayInputIndex = pass.AddInput(viewerData.textureArrayAttachmentIndex);
+		pass.SetInputLayout(arrayInputIndex, TextureLayout::ColorInput);
+
+		for (std::size_t i = 0; i < viewerData.cascadeCount; ++i)
+			pass.AddInput(viewerData.cascades[i].attachmentIndex);
+	}
+
+	void DirectionalLightShadowData::RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* viewer)
+	{
+		assert(viewer);
+		PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
+		viewerData.cascadeCount = m_light.GetShadowCascadeCount();
+
+		UInt32 shadowMapSize = m_light.GetShadowMapSize();
+
+		viewerData.textureArrayAttachmentIndex = frameGraph.AddAttachmentArray({
+			"Directional-light cascaded shadowmap",
+			m_light.GetShadowMapFormat(),
+			FramePassAttachmentSize::Fixed,
+			shadowMapSize, shadowMapSize,
+		}, viewerData.cascadeCount);
+
+		// Cascades may be kept from previous frames
+		frameGraph.MarkAttachmentAsPersistent(viewerData.textureArrayAttachmentIndex);
+
+		for (std::size_t i = 0; i < viewerData.cascadeCount; ++i)
+		{
+			CascadeData& cascade = viewerData.cascades[i];
+			cascade.attachmentIndex = frameGraph.AddAttachmentArrayLayer(viewerData.textureArrayAttachmentIndex, i);
+			cascade.depthPass->RegisterToFrameGraph(frameGraph, cascade.attachmentIndex);
+			cascade.shadowmapCache.isValid = false;
+		}
+	}
+
+	void DirectionalLightShadowData::RegisterViewer(const AbstractViewer* viewer)
+	{
+		assert(m_viewerData.find(viewer) == m_viewerData.end());
+
+		std::unique_ptr<PerViewerData>& viewerData = m_viewerData[viewer];
+		viewerData = std::make_unique<PerViewerData>();
+
+		std::size_t shadowPassIndex = Graphics::Instance()->GetMaterialPassRegistry().GetPassIndex("ShadowPass");
+
+		UInt32 shadowMapSize = m_light.GetShadowMapSize();
+		for (std::size_t i = 0; i < viewerData->cascades.size(); ++i)
+		{
+			CascadeData& cascade = viewerData->cascades[i];
+			cascade.viewer.UpdateRenderMask(0xFFFFFFFF);
+			cascade.viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(shadowMapSize), SafeCast<int>(shadowMapSize)));
+
+			cascade.depthPass.emplace(m_pipeline, m_elementRegistry, &cascade.viewer, shadowPassIndex, std::string(s_cascadeNames[i]));
+		}
+
+		m_pipeline.ForEachRegisteredMaterialInstance([&](const MaterialInstance& matInstance)
+		{
+			for (CascadeData& cascade : viewerData->cascades)
+				cascade.depthPass->RegisterMaterialInstance(matInstance);
+		});
+	}
+
+	const Texture* DirectionalLightShadowData::RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* viewer) const
+	{
+		assert(viewer);
+		const PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
+
+		return bakedGraph.GetAttachmentTexture(viewerData.textureArrayAttachmentIndex).get();
+	}
+
+	void DirectionalLightShadowData::UnregisterMaterialInstance(const MaterialInstance& matInstance)
+	{
+		for (auto&& [viewer, viewerData] : m_viewerData)
+		{
+			for (CascadeData& cascade : viewerData->cascades)
+				cascade.depthPass->UnregisterMaterialInstance(matInstance);
+		}
+	}
+
+	void DirectionalLightShadowData::UnregisterViewer(const AbstractViewer* viewer)
+	{
+		m_viewerData.erase(viewer);
+	}
+
+	/*!
+	* \brief Computes cascades far distances using the practical split scheme
+	*
+	* \param zNear Viewer near distance, logarithmic splits are only used if it's positive
+	* \param zFar Distance up to which shadows are rendered, clamped to zNear
+	* \param splitFactor Blend factor between uniform (0) and logarithmic (1) splits
+	* \param cascadeCount Cascade count
+	* \param splitDistances Array receiving the far distance of each cascade, must be able to hold cascadeCount values
+	*/
+	void DirectionalLightShadowData::ComputeCascadeSplits(float zNear, float zFar, float splitFactor, std::size_t cascadeCount, float* splitDistances)
+	{
+		// Shadow max distance may be lower than the viewer near distance
+		zFar = std::max(zFar, zNear);
+
+		// Orthographic viewers may have a null or negative near distance, where logarithmic splits are undefined (and pointless)
+		if (zNear <= 0.f)
+			splitFactor = 0.f;
+
+		for (std::size_t i = 1; i <= cascadeCount; ++i)
+		{
+			float ratio = float(i) / float(cascadeCount);
+
+			float uniformSplit = zNear + (zFar - zNear) * ratio;
+			if (splitFactor > 0.f)
+			{
+				float logSplit = zNear * std::pow(zFar / zNear, ratio);
+				splitDistances[i - 1] = Lerp(uniformSplit, logSplit, splitFactor);
+			}
+			else
+				splitDistances[i - 1] = uniformSplit;
+		}
+	}
+
+	void DirectionalLightShadowData::PrepareCascade(RenderFrame& renderFrame, CascadeData& cascade, const Vector3f* sliceCorners, bool* projectionUpdated)
+	{
+		// Use the bounding sphere of the slice, its radius only depends on the slice shape and not on the viewer rotation
+		Vector3f sliceCenter = Vector3f::Zero();
+		for (std::size_t i = 0; i < BoxCornerCount; ++i)
+			sliceCenter += sliceCorners[i];
+		sliceCenter /= float(BoxCornerCount);
+
+		float sliceRadius = 0.f;
+		for (std::size_t i = 0; i < BoxCornerCount; ++i)
+			sliceRadius = std::max(sliceRadius, Vector3f::Distance(sliceCenter, sliceCorners[i]));
+
+		// Round it to prevent floating-point errors from changing the projection
+		sliceRadius = std::ceil(sliceRadius * 16.f) / 16.f;
+
+		float cascadeRadius = sliceRadius * s_cascadeMargin;
+
+		// Keep the previous projection as long as the slice is inside it, this is what allows static shadowmaps to be reused
+		const Quaternionf& lightRotation = m_light.GetRotation();
+		if (!cascade.hasProjection || cascade.lightRotation != lightRotation || !NumberEquals(cascade.boundingSphere.radius, cascadeRadius) ||
+		    Vector3f::Distance(sliceCenter, cascade.boundingSphere.GetPosition()) + sliceRadius > cascadeRadius)
+		{
+			// Snap the cascade center to shadowmap texels (in light space) so shadow edges don't shimmer when the projection moves
+			float texelSize = 2.f * cascadeRadius / m_light.GetShadowMapSize();
+
+			Vector3f lightSpaceCenter = lightRotation.GetConjugate() * sliceCenter;
+			lightSpaceCenter.x = std::floor(lightSpaceCenter.x / texelSize) * texelSize;
+			lightSpaceCenter.y = std::floor(lightSpaceCenter.y / texelSize) * texelSize;
+
+			Vector3f cascadeCenter = lightRotation * lightSpaceCenter;
+
+			// Casters between the light and the cascade have to be rendered as well
+			Vector3f eyePosition = cascadeCenter - m_light.GetDirection() * (cascadeRadius * s_casterDistanceFactor);
+
+			Matrix4f projectionMatrix = Matrix4f::Ortho(-cascadeRadius, cascadeRadius, -cascadeRadius, cascadeRadius, 0.f, cascadeRadius * (s_casterDistanceFactor + 1.f));
+			Matrix4f viewMatrix = Matrix4f::TransformInverse(eyePosition, lightRotation);
+
+			ViewerInstance& viewerInstance = cascade.viewer.GetViewerInstance();
+			viewerInstance.UpdateEyePosition(eyePosition);
+			viewerInstance.UpdateProjViewMatrices(projectionMatrix, viewMatrix);
+
+			// Cascade is rendered this frame, its viewer data can't wait for the next transfer
+			renderFrame.Execute([&](CommandBufferBuilder& builder)
+			{
+				builder.BeginDebugRegion("Shadow cascade viewer update", Color::Yellow());
+				{
+					builder.PreTransferBarrier();
+					viewerInstance.OnTransfer(renderFrame, builder);
+					builder.PostTransferBarrier();
+				}
+				builder.EndDebugRegion();
+			}, QueueType::Transfer);
+
+			cascade.boundingSphere = Spheref(cascadeCenter, cascadeRadius);
+			cascade.hasProjection = true;
+			cascade.shadowmapCache.isValid = false;
+			cascade.lightRotation = lightRotation;
+			cascade.viewProjMatrix = viewMatrix * projectionMatrix * s_biasMatrix;
+
+			*projectionUpdated = true;
+		}
+
+		PrepareCachedShadowmap(renderFrame, m_pipeline, *cascade.depthPass, cascade.viewer, cascade.shadowmapCache);
+	}
+}
@@ -8,6 +8,7 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Graphics/PointLight.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
@@ -22,7 +23,9 @@
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Renderer/UploadPool.hpp>
 #include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -34,6 +37,8 @@ namespace Nz
 	m_skeletonInstances(1024),
 	m_viewerPool(8),
 	m_worldInstances(2048),
+	m_firstShadowLight(std::numeric_limits<std::size_t>::max()),
+	m_lodHysteresis(0.f),
 	m_generationCounter(0),
 	m_rebuildFrameGraph(true)
 	{
@@ -46,15 +51,37 @@ namespace Nz
 	}
 
 	const std::vector<Nz::FramePipelinePass::VisibleRenderable>& ForwardFramePipeline::FrustumCull(const Frustumf& frustum, UInt32 mask, std::size_t& visibilityHash) const
+	{
+		// Without a viewer (e.g. shadowmaps) levels of detail can't be selected
+		return FrustumCull(&frustum, mask, visibilityHash, nullptr);
+	}
+
+	// A null frustum disables culling (when draws are culled on the GPU), levels of detail are still selected
+	const std::vector<Nz::FramePipelinePass::VisibleRenderable>& ForwardFramePipeline::FrustumCull(const Frustumf* frustum, UInt32 mask, std::size_t& visibilityHash, ViewerData* viewerData) const
 	{
 		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
 		{
 			return currentHash * 23 + newHash;
 		};
 
+		// Screen size of an object is computed as its projected bounding sphere diameter relative to the viewport height
+		float projectionScale = 0.f;
+		bool perspective = false;
+		Vector3f eyePosition = Vector3f::Zero();
+		if (viewerData)
+		{
+			const ViewerInstance& viewerInstance = viewerData->viewer->GetViewerInstance();
+			const Matrix4f& projectionMatrix = viewerInstance.GetProjectionMatrix();
+
+			projectionScale = std::abs(projectionMatrix.m22);
+			perspective = (projectionMatrix.m44 == 0.f);
+			eyePosition = viewerInstance.GetEyePosition();
+		}
+
 		m_visibleRenderables.clear();
-		for (const RenderableData& renderableData : m_renderablePool)
+		for (auto it = m_renderablePool.begin(); it != m_renderablePool.end(); ++it)
 		{
+			const RenderableData& renderableData = *it;
 			if ((mask & renderableData.renderMask) == 0)
 				continue;
 
@@ -64,7 +91,7 @@ namespace Nz
 			BoundingVolumef boundingVolume(renderableData.renderable->GetAABB());
 			boundingVolume.Update(worldInstance->GetWorldMatrix());
 
-			if (frustum.Intersect(boundingVolume) == IntersectionSide::Outside)
+			if (frustum && frustum->Intersect(boundingVolume) == IntersectionSide::Outside)
 				continue;
 
 			auto& visibleRenderable = m_visibleRenderables.emplace_back();
@@ -78,6 +105,25 @@ namespace Nz
 				visibleRenderable.skeletonInstance = nullptr;
 
 			visibilityHash = CombineHash(visibilityHash, std::hash<const void*>()(&renderableData) + renderableData.generation);
+
+			if (viewerData && renderableData.renderable->GetLodCount() > 1)
+			{
+				const Boxf& aabb = boundingVolume.aabb;
+
+				float screenSize = aabb.GetRadius() * projectionScale;
+				if (perspective)
+					screenSize /= std::max(aabb.GetCenter().Distance(eyePosition), 0.0001f);
+
+				std::size_t renderableIndex = it.GetIndex();
+				if (renderableIndex >= viewerData->renderableLods.size())
+					viewerData->renderableLods.resize(renderableIndex + 1, 0);
+
+				UInt8& renderableLod = viewerData->renderableLods[renderableIndex];
+				renderableLod = SafeCast<UInt8>(renderableData.renderable->SelectLod(screenSize, renderableLod, m_lodHysteresis));
+
+				visibleRenderable.lodIndex = renderableLod;
+				visibilityHash = CombineHash(visibilityHash, renderableLod);
+			}
 		}
 
 		return m_visibleRenderables;
@@ -119,26 +165,34 @@ namespace Nz
 			}
 		});
 
-		lightData->onLightShadowCastingChanged.Connect(lightData->light->OnLightShadowCastingChanged, [=](Light* light, bool isCastingShadows)
+		lightData->onLightShadowCastingChanged.Connect(lightData->light->OnLightShadowCastingChanged, [=](Light* /*light*/, bool isCastingShadows)
 		{
 			if (isCastingShadows)
 			{
 				m_shadowCastingLights.UnboundedSet(lightIndex);
-				lightData->shadowData = light->InstanciateShadowData(*this, m_elementRegistry);
+				InstanciateLightShadowData(lightIndex, *lightData);
 			}
 			else
 			{
 				m_shadowCastingLights.Reset(lightIndex);
+				lightData->onShadowDataInvalidated.Disconnect();
 				lightData->shadowData.reset();
 			}
 
 			m_rebuildFrameGraph = true;
 		});
 
+		lightData->onLightShadowMapSettingChange.Connect(lightData->light->OnLightShadowMapSettingChange, [=](Light* /*light*/, PixelFormat /*newPixelFormat*/, UInt32 /*newSize*/)
+		{
+			// Shadowmaps attachments have to be recreated
+			if (m_shadowCastingLights.UnboundedTest(lightIndex))
+				m_rebuildFrameGraph = true;
+		});
+
 		if (lightData->light->IsShadowCaster())
 		{
 			m_shadowCastingLights.UnboundedSet(lightIndex);
-			lightData->shadowData = light->InstanciateShadowData(*this, m_elementRegistry);
+			InstanciateLightShadowData(lightIndex, *lightData);
 			m_rebuildFrameGraph = true;
 		}
 
@@ -156,6 +210,13 @@ namespace Nz
 		renderableData->skeletonInstanceIndex = skeletonInstanceIndex;
 		renderableData->worldInstanceIndex = worldInstanceIndex;
 
+		// Renderable index may have been used by another renderable
+		for (auto& viewerData : m_viewerPool)
+		{
+			if (renderableIndex < viewerData.renderableLods.size())
+				viewerData.renderableLods[renderableIndex] = 0;
+		}
+
 		renderableData->onElementInvalidated.Connect(instancedRenderable->OnElementInvalidated, [=](InstancedRenderable* /*instancedRenderable*/)
 		{
 			// TODO: Invalidate only relevant viewers and passes
@@ -239,15 +300,28 @@ namespace Nz
 
 	std::size_t ForwardFramePipeline::RegisterViewer(AbstractViewer* viewerInstance, Int32 renderOrder)
 	{
-		std::size_t depthPassIndex = Graphics::Instance()->GetMaterialPassRegistry().GetPassIndex("DepthPass");
+		Graphics* graphics = Graphics::Instance();
+		std::size_t depthPassIndex = graphics->GetMaterialPassRegistry().GetPassIndex("DepthPass");
+
+		// Viewer draws are culled on the GPU, shadowmaps are still culled on the CPU
+		bool gpuDrivenRendering = graphics->IsGpuDrivenRenderingEnabled();
 
 		std::size_t viewerIndex;
 		auto& viewerData = *m_viewerPool.Allocate(viewerIndex);
 		viewerData.renderOrder = renderOrder;
 		viewerData.debugDrawPass = std::make_unique<DebugDrawPipelinePass>(*this, viewerInstance);
-		viewerData.depthPrepass = std::make_unique<DepthPipelinePass>(*this, m_elementRegistry, viewerInstance, depthPassIndex, "Depth pre-pass");
-		viewerData.forwardPass = std::make_unique<ForwardPipelinePass>(*this, m_elementRegistry, viewerInstance);
+		viewerData.depthPrepass = std::make_unique<DepthPipelinePass>(*this, m_elementRegistry, viewerInstance, depthPassIndex, "Depth pre-pass", gpuDrivenRendering);
+		viewerData.forwardPass = std::make_unique<ForwardPipelinePass>(*this, m_elementRegistry, viewerInstance, gpuDrivenRendering);
 		viewerData.viewer = viewerInstance;
+
+		// Viewer draws are also tested against the depth of the previous frame
+		if (gpuDrivenRendering && graphics->GetDepthPyramidPipeline())
+		{
+			viewerData.depthPyramid = std::make_unique<DepthPyramid>(graphics->GetRenderDevice(), viewerInstance);
+			viewerData.depthPrepass->SetDepthPyramid(viewerData.depthPyramid.get());
+			viewerData.forwardPass->SetDepthPyramid(viewerData.depthPyramid.get());
+		}
+
 		viewerData.onTransferRequired.Connect(viewerInstance->GetViewerInstance().OnTransferRequired, [this](TransferInterface* transferInterface)
 		{
 			m_transferSet.insert(transferInterface);
@@ -255,6 +329,12 @@ namespace Nz
 
 		m_transferSet.insert(&viewerInstance->GetViewerInstance());
 
+		for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+		{
+			LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+			lightData->shadowData->RegisterViewer(viewerInstance);
+		}
+
 		m_rebuildFrameGraph = true;
 
 		return viewerIndex;
@@ -280,12 +360,21 @@ namespace Nz
 		return m_lightPool.RetrieveFromIndex(lightIndex)->light;
 	}
 
-	const Texture* ForwardFramePipeline::RetrieveLightShadowmap(std::size_t lightIndex) const
+	const LightShadowData* ForwardFramePipeline::RetrieveLightShadowData(std::size_t lightIndex) const
+	{
+		if (!m_shadowCastingLights.UnboundedTest(lightIndex))
+			return nullptr;
+
+		return m_lightPool.RetrieveFromIndex(lightIndex)->shadowData.get();
+	}
+
+	const Texture* ForwardFramePipeline::RetrieveLightShadowmap(std::size_t lightIndex, const AbstractViewer* viewer) const
 	{
 		if (!m_shadowCastingLights.UnboundedTest(lightIndex))
 			return nullptr;
 
-		return m_lightPool.RetrieveFromIndex(lightIndex)->shadowData->RetrieveLightShadowmap(m_bakedFrameGraph);
+		const LightShadowData* shadowData = m_lightPool.RetrieveFromIndex(lightIndex)->shadowData.get();
+		return shadowData->RetrieveLightShadowmap(m_bakedFrameGraph, (shadowData->IsPerViewer()) ? viewer : nullptr);
 	}
 
 	void ForwardFramePipeline::Render(RenderFrame& renderFrame)
@@ -294,6 +383,13 @@ namespace Nz
 
 		Graphics* graphics = Graphics::Instance();
 
+		// Pipelines whose shaders finished compiling invalidate the elements using them
+		MaterialPipeline::UpdatePendingPipelines();
+
+		// Textures registered since last frame have to be visible in the bindless texture table before recording command buffers
+		if (BindlessTextureTable* bindlessTextureTable = graphics->GetBindlessTextureTable())
+			bindlessTextureTable->Update(renderFrame);
+
 		// Destroy instances at the end of the frame
 		for (std::size_t skeletonInstanceIndex = m_removedSkeletonInstances.FindFirst(); skeletonInstanceIndex != m_removedSkeletonInstances.npos; skeletonInstanceIndex = m_removedSkeletonInstances.FindNext(skeletonInstanceIndex))
 		{
@@ -304,7 +400,14 @@ namespace Nz
 
 		for (std::size_t viewerIndex = m_removedViewerInstances.FindFirst(); viewerIndex != m_removedViewerInstances.npos; viewerIndex = m_removedViewerInstances.FindNext(viewerIndex))
 		{
-			renderFrame.PushForRelease(std::move(*m_viewerPool.RetrieveFromIndex(viewerIndex)));
+			ViewerData* viewerData = m_viewerPool.RetrieveFromIndex(viewerIndex);
+			for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+			{
+				LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+				lightData->shadowData->UnregisterViewer(viewerData->viewer);
+			}
+
+			renderFrame.PushForRelease(std::move(*viewerData));
 			m_viewerPool.Free(viewerIndex);
 		}
 		m_removedViewerInstances.Clear();
@@ -316,6 +419,13 @@ namespace Nz
 		}
 		m_removedWorldInstances.Clear();
 
+		// Viewer-dependent shadowmaps are only part of the frame graph for viewers whose render mask matches the light one
+		for (auto& viewerData : m_viewerPool)
+		{
+			if (viewerData.viewer->GetRenderMask() != viewerData.frameGraphRenderMask)
+				m_rebuildFrameGraph = true;
+		}
+
 		bool frameGraphInvalidated;
 		if (m_rebuildFrameGraph)
 		{
@@ -327,6 +437,23 @@ namespace Nz
 		else
 			frameGraphInvalidated = m_bakedFrameGraph.Resize(renderFrame);
 
+		if (frameGraphInvalidated)
+		{
+			// Shadowmaps textures were recreated, their content is lost
+			for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+			{
+				LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+				lightData->shadowData->InvalidateShadowmaps();
+			}
+
+			// Depth pyramids have to be recreated before draws are culled
+			for (auto& viewerData : m_viewerPool)
+			{
+				if (viewerData.depthPyramid)
+					viewerData.depthPyramid->UpdateTextures(renderFrame, m_bakedFrameGraph);
+			}
+		}
+
 		// Update UBOs and materials
 		renderFrame.Execute([&](CommandBufferBuilder& builder)
 		{
@@ -338,6 +465,9 @@ namespace Nz
 					transferInterface->OnTransfer(renderFrame, builder);
 				m_transferSet.clear();
 
+				// World instances only queue their data, upload it in one go
+				graphics->GetWorldInstanceBufferPool()->Transfer(renderFrame, builder);
+
 				OnTransfer(this, renderFrame, builder);
 
 				builder.PostTransferBarrier();
@@ -346,23 +476,43 @@ namespace Nz
 		}, QueueType::Transfer);
 
 		// Shadow map handling
-		for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+		ResetShadowUpdates();
+
+		auto PrepareShadowData = [&](std::size_t lightIndex)
 		{
-			LightData* lightData = m_lightPool.RetrieveFromIndex(i);
-			lightData->shadowData->PrepareRendering(renderFrame);
-		}
+			LightData* lightData = m_lightPool.RetrieveFromIndex(lightIndex);
+			if (!lightData->shadowData->IsPerViewer())
+				lightData->shadowData->PrepareRendering(renderFrame, nullptr);
+		};
+
+		// Start with a different light every frame so that outdated shadowmaps exceeding the update budget are eventually rendered
+		std::size_t firstShadowLight = m_shadowCastingLights.npos;
+		if (m_firstShadowLight < m_shadowCastingLights.GetSize())
+			firstShadowLight = m_shadowCastingLights.FindNext(m_firstShadowLight);
+
+		if (firstShadowLight == m_shadowCastingLights.npos)
+			firstShadowLight = m_shadowCastingLights.FindFirst();
+
+		m_firstShadowLight = firstShadowLight;
+
+		for (std::size_t i = firstShadowLight; i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+			PrepareShadowData(i);
+
+		for (std::size_t i = m_shadowCastingLights.FindFirst(); i != firstShadowLight; i = m_shadowCastingLights.FindNext(i))
+			PrepareShadowData(i);
 
 		// Render queues handling
+		bool gpuDrivenRendering = graphics->IsGpuDrivenRenderingEnabled();
 		for (auto& viewerData : m_viewerPool)
 		{
 			UInt32 renderMask = viewerData.viewer->GetRenderMask();
 
-			// Frustum culling
+			// Frustum culling (done by the viewer passes themselves with GPU-driven rendering)
 			const Matrix4f& viewProjMatrix = viewerData.viewer->GetViewerInstance().GetViewProjMatrix();
 
 			Frustumf frustum = Frustumf::Extract(viewProjMatrix);
 			std::size_t visibilityHash = 5;
-			const auto& visibleRenderables = FrustumCull(frustum, renderMask, visibilityHash);
+			const auto& visibleRenderables = FrustumCull((gpuDrivenRendering) ? nullptr : &frustum, renderMask, visibilityHash, &viewerData);
 
 			// Lights update don't trigger a rebuild of the depth pre-pass
 			std::size_t depthVisibilityHash = visibilityHash;
@@ -389,6 +539,14 @@ namespace Nz
 				}
 			}
 
+			// Viewer-dependent shadowmaps (may invalidate the forward pass light data)
+			for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+			{
+				LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+				if (lightData->shadowData->IsPerViewer() && (renderMask & lightData->renderMask) != 0)
+					lightData->shadowData->PrepareRendering(renderFrame, viewerData.viewer);
+			}
+
 			if (viewerData.depthPrepass)
 				viewerData.depthPrepass->Prepare(renderFrame, frustum, visibleRenderables, depthVisibilityHash);
 
@@ -438,6 +596,13 @@ namespace Nz
 		m_bakedFrameGraph.Execute(renderFrame);
 		m_rebuildFrameGraph = false;
 
+		// Depth pyramids are built from this frame depth to cull the draws of the next one
+		for (auto& viewerData : m_viewerPool)
+		{
+			if (viewerData.depthPyramid)
+				viewerData.depthPyramid->Build(renderFrame);
+		}
+
 		// Final blit (TODO: Make part of frame graph)
 		const Vector2ui& frameSize = renderFrame.GetSize();
 		for (auto&& [renderTargetPtr, renderTargetData] : m_renderTargets)
@@ -530,7 +695,14 @@ namespace Nz
 	void ForwardFramePipeline::UpdateLightRenderMask(std::size_t lightIndex, UInt32 renderMask)
 	{
 		LightData* lightData = m_lightPool.RetrieveFromIndex(lightIndex);
-		lightData->renderMask = renderMask;
+		if (lightData->renderMask != renderMask)
+		{
+			lightData->renderMask = renderMask;
+
+			// Viewer-dependent shadowmaps are only rendered for viewers the light affects
+			if (m_shadowCastingLights.UnboundedTest(lightIndex) && lightData->shadowData->IsPerViewer())
+				m_rebuildFrameGraph = true;
+		}
 	}
 
 	void ForwardFramePipeline::UpdateRenderableRenderMask(std::size_t renderableIndex, UInt32 renderMask)
@@ -596,11 +768,20 @@ namespace Nz
 		for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
 		{
 			LightData* lightData = m_lightPool.RetrieveFromIndex(i);
-			lightData->shadowData->RegisterToFrameGraph(frameGraph);
+			if (!lightData->shadowData->IsPerViewer())
+				lightData->shadowData->RegisterToFrameGraph(frameGraph, nullptr);
 		}
 
 		for (auto& viewerData : m_viewerPool)
 		{
+			UInt32 viewerRenderMask = viewerData.viewer->GetRenderMask();
+			viewerData.frameGraphRenderMask = viewerRenderMask;
+
+			auto IsAffectedByShadowData = [&](const LightData& lightData)
+			{
+				return !lightData.shadowData->IsPerViewer() || (viewerRenderMask & lightData.renderMask) != 0;
+			};
+
 			viewerData.forwardColorAttachment = frameGraph.AddAttachment({
 				"Forward output",
 				PixelFormat::RGBA8
@@ -608,11 +789,19 @@ namespace Nz
 			
 			viewerData.debugColorAttachment = frameGraph.AddAttachmentProxy("Debug draw output", viewerData.forwardColorAttachment);
 
+			// Depth-stencil views can't be sampled, depth pyramids are built from a depth-only buffer
 			viewerData.depthStencilAttachment = frameGraph.AddAttachment({
 				"Depth-stencil buffer",
-				Graphics::Instance()->GetPreferredDepthStencilFormat()
+				(viewerData.depthPyramid) ? Graphics::Instance()->GetPreferredDepthFormat() : Graphics::Instance()->GetPreferredDepthStencilFormat()
 			});
 
+			for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
+			{
+				LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+				if (lightData->shadowData->IsPerViewer() && IsAffectedByShadowData(*lightData))
+					lightData->shadowData->RegisterToFrameGraph(frameGraph, viewerData.viewer);
+			}
+
 			if (viewerData.depthPrepass)
 				viewerData.depthPrepass->RegisterToFrameGraph(frameGraph, viewerData.depthStencilAttachment);
 
@@ -620,10 +809,14 @@ namespace Nz
 			for (std::size_t i = m_shadowCastingLights.FindFirst(); i != m_shadowCastingLights.npos; i = m_shadowCastingLights.FindNext(i))
 			{
 				LightData* lightData = m_lightPool.RetrieveFromIndex(i);
-				lightData->shadowData->RegisterPassInputs(forwardPass);
+				if (IsAffectedByShadowData(*lightData))
+					lightData->shadowData->RegisterPassInputs(forwardPass, (lightData->shadowData->IsPerViewer()) ? viewerData.viewer : nullptr);
 			}
 
 			viewerData.debugDrawPass->RegisterToFrameGraph(frameGraph, viewerData.forwardColorAttachment, viewerData.debugColorAttachment);
+
+			if (viewerData.depthPyramid)
+				viewerData.depthPyramid->RegisterToFrameGraph(frameGraph, viewerData.depthStencilAttachment);
 		}
 
 		using ViewerPair = std::pair<const RenderTarget*, const ViewerData*>;
@@ -699,6 +892,27 @@ namespace Nz
 		return frameGraph.Bake();
 	}
 
+	void ForwardFramePipeline::InstanciateLightShadowData(std::size_t lightIndex, LightData& lightData)
+	{
+		lightData.shadowData = lightData.light->InstanciateShadowData(*this, m_elementRegistry);
+
+		// Viewers are also registered to shadow data which isn't per-viewer, as they may use them to select a shadowmap resolution
+		for (auto& viewerData : m_viewerPool)
+			lightData.shadowData->RegisterViewer(viewerData.viewer);
+
+		lightData.onShadowDataInvalidated.Connect(lightData.shadowData->OnShadowDataInvalidated, [this, lightIndex](LightShadowData* /*shadowData*/, const AbstractViewer* viewer)
+		{
+			UInt32 lightRenderMask = m_lightPool.RetrieveFromIndex(lightIndex)->renderMask;
+
+			// Light data sent to shaders depends on the viewer (or on every viewer if none is specified)
+			for (auto& viewerData : m_viewerPool)
+			{
+				if ((!viewer || viewerData.viewer == viewer) && (viewerData.viewer->GetRenderMask() & lightRenderMask) != 0)
+					viewerData.forwardPass->InvalidateElements();
+			}
+		});
+	}
+
 	void ForwardFramePipeline::RegisterMaterialInstance(MaterialInstance* materialInstance)
 	{
 		auto it = m_materialInstances.find(materialInstance);
@@ -9,17 +9,22 @@
 #include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
-	ForwardPipelinePass::ForwardPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer) :
+	ForwardPipelinePass::ForwardPipelinePass(FramePipeline& owner, ElementRendererRegistry& elementRegistry, AbstractViewer* viewer, bool gpuCulling) :
+	m_commandChunkCount(0),
+	m_commandChunkSize(0),
 	m_lastVisibilityHash(0),
+	m_depthPyramid(nullptr),
 	m_viewer(viewer),
 	m_elementRegistry(elementRegistry),
 	m_pipeline(owner),
@@ -29,6 +34,10 @@ namespace Nz
 		Graphics* graphics = Graphics::Instance();
 		m_forwardPassIndex = graphics->GetMaterialPassRegistry().GetPassIndex("ForwardPass");
 		m_lightUboPool = std::make_shared<LightUboPool>();
+
+		// Visible renderables are not frustum culled by the pipeline in this case, draws are culled on the GPU every frame
+		if (gpuCulling)
+			m_indirectDrawTable.emplace(graphics->GetRenderDevice());
 	}
 
 	void ForwardPipelinePass::Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, const std::vector<std::size_t>& visibleLights, std::size_t visibilityHash)
@@ -40,7 +49,7 @@ namespace Nz
 			m_renderQueueRegistry.Clear();
 			m_renderQueue.Clear();
 			m_lightBufferPerLights.clear();
-			m_lightPerRenderElement.clear();
+			m_perRenderElementData.clear();
 
 			for (auto& lightDataUbo : m_lightDataBuffers)
 			{
@@ -136,6 +145,12 @@ namespace Nz
 					for (std::size_t i = 0; i < lightCount; ++i)
 					{
 						m_renderableLights[i].light->FillLightData(lightPtr);
+
+						// Some shadow techniques (such as cascaded shadow maps or shadowmaps resolution) override the light data
+						const LightShadowData* shadowData = m_pipeline.RetrieveLightShadowData(m_renderableLights[i].lightIndex);
+						if (shadowData)
+							shadowData->FillLightData(lightPtr, m_viewer);
+
 						lightPtr += lightOffsets.lightSize;
 					}
 
@@ -152,7 +167,8 @@ namespace Nz
 				InstancedRenderable::ElementData elementData{
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
-					renderableData.worldInstance
+					renderableData.worldInstance,
+					renderableData.lodIndex
 				};
 
 				std::size_t previousCount = m_renderElements.size();
@@ -161,14 +177,15 @@ namespace Nz
 				{
 					const RenderElement* element = m_renderElements[i].GetElement();
 
-					LightPerElementData perElementData;
+					PerElementData perElementData;
+					perElementData.aabb = renderableData.instancedRenderable->GetAABB();
 					perElementData.lightCount = lightCount;
 					perElementData.lightUniformBuffer = lightUboView;
 
 					for (std::size_t j = 0; j < lightCount; ++j)
-						perElementData.shadowMaps[j] = m_pipeline.RetrieveLightShadowmap(m_renderableLights[j].lightIndex);
+						perElementData.shadowMaps[j] = m_pipeline.RetrieveLightShadowmap(m_renderableLights[j].lightIndex, m_viewer);
 
-					m_lightPerRenderElement.emplace(element, perElementData);
+					m_perRenderElementData.emplace(element, perElementData);
 				}
 			}
 
@@ -220,53 +237,76 @@ namespace Nz
 				elementRenderer.Reset(*m_elementRendererData[elementType], renderFrame);
 			});
 
+			if (m_indirectDrawTable)
+				m_indirectDrawTable->Clear(renderFrame);
+
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			auto& lightPerRenderElement = m_lightPerRenderElement;
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
-			{
-				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
+			auto& perRenderElementData = m_perRenderElementData;
+			IndirectDrawTable* indirectDrawTable = (m_indirectDrawTable) ? &*m_indirectDrawTable : nullptr;
 
-				m_renderStates.clear();
+			// Chunks are recorded in parallel, batches must be split at their boundaries
+			std::size_t queueSize = m_renderQueue.size();
+			m_commandChunkSize = ComputeCommandChunkSize(queueSize);
+			m_commandChunkCount = (m_commandChunkSize > 0) ? (queueSize + m_commandChunkSize - 1) / m_commandChunkSize : 0;
 
-				m_renderStates.reserve(elementCount);
-				for (std::size_t i = 0; i < elementCount; ++i)
+			for (std::size_t firstElement = 0; firstElement < queueSize; firstElement += m_commandChunkSize)
+			{
+				m_elementRegistry.ProcessRenderQueue(m_renderQueue, firstElement, std::min(m_commandChunkSize, queueSize - firstElement), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 				{
-					auto it = lightPerRenderElement.find(elements[i]);
-					assert(it != lightPerRenderElement.end());
-
-					const LightPerElementData& lightData = it->second;
+					ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 
-					auto& renderStates = m_renderStates.emplace_back();
-					renderStates.lightData = lightData.lightUniformBuffer;
+					m_renderStates.clear();
 
-					for (std::size_t j = 0; j < lightData.lightCount; ++j)
+					m_renderStates.reserve(elementCount);
+					for (std::size_t i = 0; i < elementCount; ++i)
 					{
-						const Texture* texture = lightData.shadowMaps[j];
-						if (!texture)
-							continue;
+						auto it = perRenderElementData.find(elements[i]);
+						assert(it != perRenderElementData.end());
 
-						if (texture->GetType() == ImageType::E2D)
-							renderStates.shadowMaps2D[j] = texture;
-						else
+						const PerElementData& elementData = it->second;
+
+						auto& renderStates = m_renderStates.emplace_back();
+						renderStates.aabb = elementData.aabb;
+						renderStates.indirectDrawTable = indirectDrawTable;
+						renderStates.lightData = elementData.lightUniformBuffer;
+
+						for (std::size_t j = 0; j < elementData.lightCount; ++j)
 						{
-							assert(texture->GetType() == ImageType::Cubemap);
-							renderStates.shadowMapsCube[j] = texture;
+							const Texture* texture = elementData.shadowMaps[j];
+							if (!texture)
+								continue;
+
+							if (texture->GetType() == ImageType::E2D)
+								renderStates.shadowMaps2D[j] = texture;
+							else if (texture->GetType() == ImageType::E2D_Array)
+								renderStates.shadowMapsDirectional[j] = texture;
+							else
+							{
+								assert(texture->GetType() == ImageType::Cubemap);
+								renderStates.shadowMapsCube[j] = texture;
+							}
 						}
 					}
-				}
 
-				elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], renderFrame, elementCount, elements, m_renderStates.data());
-			});
+					elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], renderFrame, elementCount, elements, m_renderStates.data());
+				});
+			}
 
 			m_elementRegistry.ForEachElementRenderer([&](std::size_t elementType, ElementRenderer& elementRenderer)
 			{
 				elementRenderer.PrepareEnd(renderFrame, *m_elementRendererData[elementType]);
 			});
 
+			if (m_indirectDrawTable)
+				m_indirectDrawTable->Upload(renderFrame, viewerInstance);
+
 			m_rebuildCommandBuffer = true;
 			m_rebuildElements = false;
 		}
+
+		if (m_indirectDrawTable)
+			m_indirectDrawTable->Cull(renderFrame, m_depthPyramid);
 	}
 
 	void ForwardPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance)
@@ -312,8 +352,14 @@ namespace Nz
 			return (m_rebuildCommandBuffer) ? FramePassExecution::UpdateAndExecute : FramePassExecution::Execute;
 		});
 
-		forwardPass.SetCommandCallback([this](CommandBufferBuilder& builder, const FramePassEnvironment& /*env*/)
+		forwardPass.SetCommandChunkCallback([this]()
+		{
+			m_rebuildCommandBuffer = false;
+			return m_commandChunkCount;
+		},
+		[this](CommandBufferBuilder& builder, const FramePassEnvironment& /*env*/, std::size_t chunkIndex)
 		{
+			// Called from worker threads
 			Recti viewport = m_viewer->GetViewport();
 
 			builder.SetScissor(viewport);
@@ -321,13 +367,12 @@ namespace Nz
 
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+			std::size_t firstElement = chunkIndex * m_commandChunkSize;
+			m_elementRegistry.ProcessRenderQueue(m_renderQueue, firstElement, std::min(m_commandChunkSize, m_renderQueue.size() - firstElement), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 			{
 				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 				elementRenderer.Render(viewerInstance, *m_elementRendererData[elementType], builder, elementCount, elements);
 			});
-
-			m_rebuildCommandBuffer = false;
 		});
 
 		return forwardPass;
@@ -10,6 +10,7 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <NazaraUtils/Bitset.hpp>
 #include <NazaraUtils/StackArray.hpp>
+#include <algorithm>
 #include <stdexcept>
 #include <unordered_set>
 #include <Nazara/Graphics/Debug.hpp>
@@ -41,6 +42,7 @@ namespace Nz
 		m_pending.renderPasses.clear();
 		m_pending.textures.clear();
 		m_pending.texture2DPool.clear();
+		m_pending.texture2DArrayPool.clear();
 		m_pending.textureCubePool.clear();
 
 		BuildReadWriteList();
@@ -62,6 +64,7 @@ namespace Nz
 		ReorderPasses();
 		AssignPhysicalTextures();
 		AssignPhysicalPasses();
+		ComputeTextureLifetimes();
 		BuildPhysicalPasses();
 		BuildBarriers();
 		BuildPhysicalBarriers();
@@ -76,6 +79,7 @@ namespace Nz
 			bakedPass.name = std::move(physicalPass.name);
 			bakedPass.renderPass = std::move(m_pending.renderPasses[renderPassIndex++]);
 			bakedPass.invalidationBarriers = std::move(physicalPass.textureBarrier);
+			bakedPass.skipBarriers = std::move(physicalPass.skipBarriers);
 
 			for (auto& subpass : physicalPass.passes)
 			{
@@ -83,7 +87,9 @@ namespace Nz
 				bakedPass.executionCallback = framePass.GetExecutionCallback(); //< FIXME
 
 				auto& bakedSubpass = bakedPass.subpasses.emplace_back();
+				bakedSubpass.chunkCountCallback = framePass.GetChunkCountCallback();
 				bakedSubpass.commandCallback = framePass.GetCommandCallback();
+				bakedSubpass.commandChunkCallback = framePass.GetCommandChunkCallback();
 
 				for (const auto& output : framePass.GetOutputs())
 				{
@@ -247,8 +253,8 @@ namespace Nz
 
 				auto it = m_pending.attachmentLastUse.find(attachmentId);
 
-				// If this pass is the last one where this attachment is used, push the texture to the reuse pool
-				if (it != m_pending.attachmentLastUse.end() && passIndex == it->second)
+				// If this pass is the last one where this attachment is used, push the texture to the reuse pool (unless its content has to persist between frames)
+				if (it != m_pending.attachmentLastUse.end() && passIndex == it->second && m_persistentAttachments.find(attachmentId) == m_persistentAttachments.end())
 				{
 					const auto& attachmentData = m_attachments[attachmentId];
 					if (std::holds_alternative<FramePassAttachment>(attachmentData))
@@ -262,7 +268,7 @@ namespace Nz
 					{
 						std::size_t textureId = Retrieve(m_pending.attachmentToTextures, attachmentId);
 
-						assert(std::find(m_pending.textureCubePool.begin(), m_pending.textureCubePool.end(), textureId) == m_pending.textureCubePool.end());
+						assert(std::find(m_pending.texture2DArrayPool.begin(), m_pending.texture2DArrayPool.end(), textureId) == m_pending.texture2DArrayPool.end());
 						m_pending.texture2DArrayPool.push_back(textureId);
 					}
 					else if (std::holds_alternative<AttachmentCube>(attachmentData))
@@ -405,6 +411,7 @@ namespace Nz
 			PipelineStageFlags flushedStages;
 			TextureLayout initialLayout = TextureLayout::Undefined;
 			TextureLayout finalLayout = TextureLayout::Undefined;
+			TextureLayout previousLayout = TextureLayout::Undefined; //< layout before the pass, undefined if it's the first use in the frame
 		};
 
 		struct TextureStates
@@ -438,6 +445,7 @@ namespace Nz
 						states.invalidatedAccesses |= invalidation.access;
 						states.invalidatedStages |= invalidation.stages;
 						states.initialLayout = invalidation.layout;
+						states.previousLayout = textureStates[invalidation.textureId].currentLayout;
 					}
 
 					states.finalLayout = invalidation.layout;
@@ -458,6 +466,7 @@ namespace Nz
 						states.initialLayout = flush.layout;
 						states.invalidatedAccesses = flush.access;
 						states.invalidatedStages = flush.stages;
+						states.previousLayout = textureStates[flush.textureId].currentLayout;
 
 						textureStates[flush.textureId].currentLayout = flush.layout;
 
@@ -503,11 +512,42 @@ namespace Nz
 					textureStates[textureId].flushedStages = 0;
 				}
 
+				// A skipped pass has to leave the texture in the layout it would have been left in, as following barriers rely on it
+				auto& skipBarrier = physicalPass.skipBarriers.emplace_back();
+				skipBarrier.textureId = textureId;
+				skipBarrier.srcAccessMask = MemoryAccess::ColorWrite | MemoryAccess::DepthStencilWrite;
+				skipBarrier.srcStageMask = PipelineStage::ColorOutput | PipelineStage::FragmentShader | PipelineStage::FragmentTestsEarly | PipelineStage::FragmentTestsLate;
+				skipBarrier.dstAccessMask = state.invalidatedAccesses | state.flushedAccesses;
+				skipBarrier.dstStageMask = state.invalidatedStages | state.flushedStages;
+				skipBarrier.oldLayout = state.previousLayout;
+				skipBarrier.newLayout = state.finalLayout;
+
 				textureStates[textureId].currentLayout = state.finalLayout;
 				textureStates[textureId].flushedAccesses |= state.flushedAccesses;
 				textureStates[textureId].flushedStages |= state.flushedStages;
 			}
 		}
+
+		// When skipped, the first pass using a persistent texture finds it in the layout the last pass of the previous frame left it in
+		auto IsPersistent = [&](std::size_t textureId)
+		{
+			while (const auto& viewData = m_pending.textures[textureId].viewData)
+				textureId = viewData->parentTextureId;
+
+			return m_pending.textures[textureId].persistent;
+		};
+
+		for (auto& physicalPass : m_pending.physicalPasses)
+		{
+			for (auto& skipBarrier : physicalPass.skipBarriers)
+			{
+				if (skipBarrier.oldLayout == TextureLayout::Undefined && IsPersistent(skipBarrier.textureId))
+					skipBarrier.oldLayout = textureStates[skipBarrier.textureId].currentLayout;
+			}
+
+			auto it = std::remove_if(physicalPass.skipBarriers.begin(), physicalPass.skipBarriers.end(), [](const TextureBarrier& barrier) { return barrier.oldLayout == barrier.newLayout; });
+			physicalPass.skipBarriers.erase(it, physicalPass.skipBarriers.end());
+		}
 	}
 
 	void FrameGraph::BuildPhysicalPassDependencies(std::size_t colorAttachmentCount, bool hasDepthStencilAttachment, std::vector<RenderPass::Attachment>& renderPassAttachments, std::vector<RenderPass::SubpassDescription>& subpasses, std::vector<RenderPass::SubpassDependency>& dependencies)
@@ -949,6 +989,55 @@ namespace Nz
 		}
 	}
 
+	void FrameGraph::ComputeTextureLifetimes()
+	{
+		// Texture views share the memory of their parent texture
+		auto ResolveRootTexture = [&](std::size_t textureId)
+		{
+			while (const auto& viewData = m_pending.textures[textureId].viewData)
+				textureId = viewData->parentTextureId;
+
+			return textureId;
+		};
+
+		Bitset<> usedTextures(m_pending.textures.size(), false);
+		for (std::size_t passIndex : m_pending.passList)
+		{
+			std::size_t physicalPassIndex = Retrieve(m_pending.passIdToPhysicalPassIndex, passIndex);
+
+			const FramePass& framePass = m_framePasses[passIndex];
+			framePass.ForEachAttachment([&](std::size_t attachmentId)
+			{
+				std::size_t textureId = ResolveRootTexture(Retrieve(m_pending.attachmentToTextures, ResolveAttachmentIndex(attachmentId)));
+
+				FrameGraphTextureData& textureData = m_pending.textures[textureId];
+				if (!usedTextures[textureId])
+				{
+					textureData.firstUse = physicalPassIndex;
+					usedTextures[textureId] = true;
+				}
+
+				textureData.lastUse = physicalPassIndex;
+			});
+		}
+
+		// Persistent attachments and backbuffer outputs are read after the graph execution
+		auto MarkAsPersistent = [&](std::size_t attachmentId)
+		{
+			auto it = m_pending.attachmentToTextures.find(ResolveAttachmentIndex(attachmentId));
+			if (it == m_pending.attachmentToTextures.end())
+				return;
+
+			m_pending.textures[ResolveRootTexture(it->second)].persistent = true;
+		};
+
+		for (std::size_t attachmentId : m_persistentAttachments)
+			MarkAsPersistent(attachmentId);
+
+		for (std::size_t output : m_backbufferOutputs)
+			MarkAsPersistent(output);
+	}
+
 	bool FrameGraph::HasAttachment(const std::vector<FramePass::Input>& inputs, std::size_t attachmentIndex) const
 	{
 		attachmentIndex = ResolveAttachmentIndex(attachmentIndex);
@@ -1008,6 +1097,8 @@ namespace Nz
 					if (!attachmentData.name.empty() && data.name != attachmentData.name)
 						data.name += " / " + attachmentData.name;
 
+					data.usage |= attachmentData.additionalUsage;
+
 					return textureId;
 				}
 
@@ -1021,6 +1112,7 @@ namespace Nz
 				data.width = attachmentData.width;
 				data.height = attachmentData.height;
 				data.size = attachmentData.size;
+				data.usage = attachmentData.additionalUsage;
 				data.layerCount = 1;
 
 				return textureId;
@@ -1044,7 +1136,7 @@ namespace Nz
 						data.layerCount != attachmentData.layerCount)
 						continue;
 
-					m_pending.textureCubePool.erase(it);
+					m_pending.texture2DArrayPool.erase(it);
 					m_pending.attachmentToTextures.emplace(attachmentIndex, textureId);
 
 					if (!attachmentData.name.empty() && data.name != attachmentData.name)
@@ -9,7 +9,9 @@
 namespace Nz
 {
 	FramePipeline::FramePipeline() :
-	m_debugDrawer(*Graphics::Instance()->GetRenderDevice())
+	m_debugDrawer(*Graphics::Instance()->GetRenderDevice()),
+	m_remainingShadowUpdates(UnlimitedShadowUpdates),
+	m_shadowUpdateBudget(UnlimitedShadowUpdates)
 	{
 	}
 
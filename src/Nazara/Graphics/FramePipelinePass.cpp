@@ -3,9 +3,28 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	FramePipelinePass::~FramePipelinePass() = default;
+
+	/*!
+	* \brief Computes how many render queue elements should be recorded together, for the passes recording their commands in parallel
+	*
+	* \param elementCount Number of elements in the render queue
+	*
+	* \return Chunk size, or zero if there's no element to record
+	*/
+	std::size_t FramePipelinePass::ComputeCommandChunkSize(std::size_t elementCount)
+	{
+		if (elementCount == 0)
+			return 0;
+
+		// Recording a secondary command buffer has a cost, only split big render queues
+		std::size_t chunkCount = std::clamp<std::size_t>(elementCount / MinCommandChunkSize, 1, TaskScheduler::GetWorkerCount());
+		return (elementCount + chunkCount - 1) / chunkCount;
+	}
 }
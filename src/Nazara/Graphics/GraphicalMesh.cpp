@@ -6,6 +6,7 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Utility/SoftwareBuffer.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
+#include <algorithm>
 #include <cassert>
 #include <Nazara/Graphics/Debug.hpp>
 
@@ -41,6 +42,24 @@ namespace Nz
 
 				submeshData.indexCount = indexBuffer->GetIndexCount();
 				submeshData.indexType = indexBuffer->GetIndexType();
+
+				// Level of detail errors are relative to the submesh size
+				Vector3f subMeshSize = staticMesh.GetAABB().GetLengths();
+				float errorScale = std::max({ subMeshSize.x, subMeshSize.y, subMeshSize.z });
+
+				for (const StaticMeshLod& staticMeshLod : staticMesh.GetLods())
+				{
+					const IndexBuffer& lodIndexBuffer = *staticMeshLod.indexBuffer;
+					assert(lodIndexBuffer.GetBuffer()->GetStorage() == DataStorage::Software);
+					const SoftwareBuffer* lodIndexBufferContent = static_cast<const SoftwareBuffer*>(lodIndexBuffer.GetBuffer().get());
+
+					auto& lod = submeshData.lods.emplace_back();
+					lod.error = staticMeshLod.error * errorScale;
+					lod.indexCount = lodIndexBuffer.GetIndexCount();
+					lod.indexBuffer = renderDevice->InstantiateBuffer(BufferType::Index, lodIndexBuffer.GetStride() * lodIndexBuffer.GetIndexCount(), BufferUsage::DeviceLocal | BufferUsage::Write);
+					if (!lod.indexBuffer->Fill(lodIndexBufferContent->GetData() + lodIndexBuffer.GetStartOffset(), 0, lodIndexBuffer.GetEndOffset() - lodIndexBuffer.GetStartOffset()))
+						throw std::runtime_error("failed to fill level of detail index buffer");
+				}
 			}
 			else
 				submeshData.indexCount = vertexBuffer->GetVertexCount();
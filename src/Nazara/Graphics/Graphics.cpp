@@ -5,6 +5,7 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Core/AppFilesystemComponent.hpp>
 #include <Nazara/Core/CommandLineParameters.hpp>
+#include <Nazara/Core/File.hpp>
 #include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPipeline.hpp>
@@ -14,6 +15,7 @@
 #include <Nazara/Utility/Font.hpp>
 #include <NZSL/Ast/AstSerializer.hpp>
 #include <NZSL/Ast/Module.hpp>
+#include <algorithm>
 #include <array>
 #include <stdexcept>
 #include <Nazara/Graphics/Debug.hpp>
@@ -30,6 +32,14 @@ namespace Nz
 			#include <Nazara/Graphics/Resources/Shaders/BasicMaterial.nzslb.h>
 		};
 
+		const UInt8 r_depthPyramidShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/DepthPyramid.nzslb.h>
+		};
+
+		const UInt8 r_drawCullingShader[] = {
+			#include <Nazara/Graphics/Resources/Shaders/DrawCulling.nzslb.h>
+		};
+
 		const UInt8 r_fullscreenVertexShader[] = {
 			#include <Nazara/Graphics/Resources/Shaders/FullscreenVertex.nzslb.h>
 		};
@@ -83,8 +93,10 @@ namespace Nz
 	*/
 	Graphics::Graphics(Config config) :
 	ModuleBase("Graphics", this),
+	m_pipelineCacheDirectory(std::move(config.pipelineCacheDirectory)),
 	m_preferredDepthFormat(PixelFormat::Undefined),
-	m_preferredDepthStencilFormat(PixelFormat::Undefined)
+	m_preferredDepthStencilFormat(PixelFormat::Undefined),
+	m_gpuDrivenRendering(false)
 	{
 		Renderer* renderer = Renderer::Instance();
 
@@ -110,10 +122,15 @@ namespace Nz
 
 		RenderDeviceFeatures enabledFeatures;
 		enabledFeatures.anisotropicFiltering = !config.forceDisableFeatures.anisotropicFiltering && renderDeviceInfo[bestRenderDeviceIndex].features.anisotropicFiltering;
+		enabledFeatures.bindlessTextures = !config.forceDisableFeatures.bindlessTextures && renderDeviceInfo[bestRenderDeviceIndex].features.bindlessTextures;
 		enabledFeatures.computeShaders = !config.forceDisableFeatures.computeShaders && renderDeviceInfo[bestRenderDeviceIndex].features.computeShaders;
 		enabledFeatures.depthClamping = !config.forceDisableFeatures.depthClamping && renderDeviceInfo[bestRenderDeviceIndex].features.depthClamping;
+		enabledFeatures.drawIndirect = !config.forceDisableFeatures.drawIndirect && renderDeviceInfo[bestRenderDeviceIndex].features.drawIndirect;
+		enabledFeatures.drawIndirectCount = !config.forceDisableFeatures.drawIndirectCount && renderDeviceInfo[bestRenderDeviceIndex].features.drawIndirectCount;
+		enabledFeatures.multiDrawIndirect = !config.forceDisableFeatures.multiDrawIndirect && renderDeviceInfo[bestRenderDeviceIndex].features.multiDrawIndirect;
 		enabledFeatures.nonSolidFaceFilling = !config.forceDisableFeatures.nonSolidFaceFilling && renderDeviceInfo[bestRenderDeviceIndex].features.nonSolidFaceFilling;
 		enabledFeatures.storageBuffers = !config.forceDisableFeatures.storageBuffers && renderDeviceInfo[bestRenderDeviceIndex].features.storageBuffers;
+		enabledFeatures.textureMemoryAliasing = !config.forceDisableFeatures.textureMemoryAliasing && renderDeviceInfo[bestRenderDeviceIndex].features.textureMemoryAliasing;
 		enabledFeatures.textureReadWithoutFormat = !config.forceDisableFeatures.textureReadWithoutFormat && renderDeviceInfo[bestRenderDeviceIndex].features.textureReadWithoutFormat;
 		enabledFeatures.textureReadWrite = !config.forceDisableFeatures.textureReadWrite && renderDeviceInfo[bestRenderDeviceIndex].features.textureReadWrite;
 		enabledFeatures.textureWriteWithoutFormat = !config.forceDisableFeatures.textureWriteWithoutFormat && renderDeviceInfo[bestRenderDeviceIndex].features.textureWriteWithoutFormat;
@@ -123,16 +140,38 @@ namespace Nz
 		if (!m_renderDevice)
 			throw std::runtime_error("failed to instantiate render device");
 
+		if (config.gpuDrivenRendering)
+		{
+			// Instance data is indexed using the first instance of draws, which isn't part of the instance index with OpenGL
+			const RenderDeviceFeatures& deviceFeatures = m_renderDevice->GetEnabledFeatures();
+			m_gpuDrivenRendering = renderer->QueryAPI() == RenderAPI::Vulkan && deviceFeatures.computeShaders && deviceFeatures.storageBuffers && deviceFeatures.multiDrawIndirect;
+			if (!m_gpuDrivenRendering)
+				NazaraWarning("GPU-driven rendering requires Vulkan with compute shaders, storage buffers and multi draw indirect support, draws will be culled on the CPU");
+		}
+
+		if (!m_pipelineCacheDirectory.empty())
+			LoadPipelineCache();
+
 		m_renderPassCache.emplace(*m_renderDevice);
 		m_samplerCache.emplace(m_renderDevice);
 
+		// With GPU-driven rendering, instance data blocks are also read as storage buffers (by materials and the draw culling shader)
+		BufferUsageFlags instanceBufferUsage = BufferUsage::DeviceLocal;
+		if (m_gpuDrivenRendering)
+			instanceBufferUsage |= BufferUsage::Storage;
+
+		m_worldInstanceBufferPool = std::make_shared<RenderBufferPool>(m_renderDevice, BufferType::Uniform, PredefinedInstanceData::GetOffsets().totalSize, 2048, instanceBufferUsage);
+
 		BuildDefaultTextures();
+		BuildBindlessTextureTable(config.bindlessTextureCount);
 		RegisterShaderModules();
 		BuildBlitPipeline();
+		BuildDrawCullingPipeline();
+		BuildDepthPyramidPipeline();
 		RegisterMaterialPasses();
 		SelectDepthStencilFormats();
 
-		MaterialPipeline::Initialize();
+		MaterialPipeline::Initialize(config.asyncPipelineCompilation);
 		BuildDefaultMaterials();
 
 		Font::SetDefaultAtlas(std::make_shared<GuillotineTextureAtlas>(*m_renderDevice));
@@ -167,12 +206,22 @@ namespace Nz
 
 		defaultAtlas.reset();
 
+		if (!m_pipelineCacheDirectory.empty())
+			SavePipelineCache();
+
 		MaterialPipeline::Uninitialize();
 		m_renderPassCache.reset();
 		m_samplerCache.reset();
+		m_worldInstanceBufferPool.reset();
 		m_blitPipeline.reset();
 		m_blitPipelineLayout.reset();
+		m_depthPyramidPipeline.reset();
+		m_depthPyramidPipelineLayout.reset();
+		m_drawCullingPipeline.reset();
+		m_drawOcclusionCullingPipeline.reset();
+		m_drawCullingPipelineLayout.reset();
 		m_defaultMaterials = DefaultMaterials{};
+		m_bindlessTextureTable.reset();
 		m_defaultTextures = DefaultTextures{};
 	}
 
@@ -184,6 +233,24 @@ namespace Nz
 		component.SetDefaultResourceParameters<Texture>(defaultTexParams);
 	}
 
+	void Graphics::BuildBindlessTextureTable(UInt32 capacity)
+	{
+		// Without bindless textures support, materials keep binding their textures in their own shader binding
+		if (capacity == 0 || !m_renderDevice->GetEnabledFeatures().bindlessTextures)
+			return;
+
+		// Keep some room for the textures bound by materials and the engine (shadowmaps, ...)
+		constexpr UInt32 ReservedTextureCount = 32;
+
+		UInt32 maxTextureCount = m_renderDevice->GetDeviceInfo().limits.maxPerStageSampledTextures;
+		if (maxTextureCount <= ReservedTextureCount)
+			return;
+
+		capacity = std::min(capacity, maxTextureCount - ReservedTextureCount);
+
+		m_bindlessTextureTable.emplace(m_renderDevice, capacity, m_defaultTextures.whiteTextures[ImageType::E2D], m_samplerCache->Get({}));
+	}
+
 	void Graphics::BuildBlitPipeline()
 	{
 		RenderPipelineLayoutInfo layoutInfo;
@@ -227,6 +294,122 @@ namespace Nz
 		m_blitPipelineTransparent = m_renderDevice->InstantiateRenderPipeline(std::move(pipelineInfo));
 	}
 
+	void Graphics::BuildDrawCullingPipeline()
+	{
+		if (!m_gpuDrivenRendering)
+			return;
+
+		RenderPipelineLayoutInfo layoutInfo;
+		layoutInfo.bindings.assign({
+			{
+				0, 0, 1,
+				ShaderBindingType::StorageBuffer,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 1, 1,
+				ShaderBindingType::StorageBuffer,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 2, 1,
+				ShaderBindingType::StorageBuffer,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 3, 1,
+				ShaderBindingType::UniformBuffer,
+				nzsl::ShaderStageType::Compute
+			},
+			// Depth pyramid (see DepthPyramid), only used by the occlusion culling pipeline
+			{
+				1, 0, 1,
+				ShaderBindingType::Texture,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				1, 1, 1,
+				ShaderBindingType::UniformBuffer,
+				nzsl::ShaderStageType::Compute
+			}
+		});
+
+		m_drawCullingPipelineLayout = m_renderDevice->InstantiateRenderPipelineLayout(std::move(layoutInfo));
+		if (!m_drawCullingPipelineLayout)
+			throw std::runtime_error("failed to instantiate draw culling pipeline layout");
+
+		nzsl::Ast::ModulePtr cullingShaderModule = m_shaderModuleResolver->Resolve("DrawCulling");
+
+		auto BuildPipeline = [&](bool occlusionCulling)
+		{
+			nzsl::ShaderWriter::States states;
+			states.optionValues[CRC32("OcclusionCulling")] = occlusionCulling;
+			states.shaderModuleResolver = m_shaderModuleResolver;
+
+			ComputePipelineInfo pipelineInfo;
+			pipelineInfo.pipelineLayout = m_drawCullingPipelineLayout;
+			pipelineInfo.shaderModule = m_renderDevice->InstantiateShaderModule(nzsl::ShaderStageType::Compute, *cullingShaderModule, states);
+			if (!pipelineInfo.shaderModule)
+				throw std::runtime_error("failed to instantiate draw culling shader");
+
+			std::shared_ptr<ComputePipeline> pipeline = m_renderDevice->InstantiateComputePipeline(std::move(pipelineInfo));
+			if (!pipeline)
+				throw std::runtime_error("failed to instantiate draw culling pipeline");
+
+			return pipeline;
+		};
+
+		m_drawCullingPipeline = BuildPipeline(false);
+
+		// Depth pyramids are read as storage textures
+		if (m_renderDevice->GetEnabledFeatures().textureReadWrite)
+			m_drawOcclusionCullingPipeline = BuildPipeline(true);
+	}
+
+	void Graphics::BuildDepthPyramidPipeline()
+	{
+		if (!m_drawOcclusionCullingPipeline)
+			return;
+
+		RenderPipelineLayoutInfo layoutInfo;
+		layoutInfo.bindings.assign({
+			{
+				0, 0, 1,
+				ShaderBindingType::Texture,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 1, 1,
+				ShaderBindingType::Texture,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 2, 1,
+				ShaderBindingType::UniformBuffer,
+				nzsl::ShaderStageType::Compute
+			}
+		});
+
+		m_depthPyramidPipelineLayout = m_renderDevice->InstantiateRenderPipelineLayout(std::move(layoutInfo));
+		if (!m_depthPyramidPipelineLayout)
+			throw std::runtime_error("failed to instantiate depth pyramid pipeline layout");
+
+		nzsl::Ast::ModulePtr pyramidShaderModule = m_shaderModuleResolver->Resolve("DepthPyramid");
+
+		nzsl::ShaderWriter::States states;
+		states.shaderModuleResolver = m_shaderModuleResolver;
+
+		ComputePipelineInfo pipelineInfo;
+		pipelineInfo.pipelineLayout = m_depthPyramidPipelineLayout;
+		pipelineInfo.shaderModule = m_renderDevice->InstantiateShaderModule(nzsl::ShaderStageType::Compute, *pyramidShaderModule, states);
+		if (!pipelineInfo.shaderModule)
+			throw std::runtime_error("failed to instantiate depth pyramid shader");
+
+		m_depthPyramidPipeline = m_renderDevice->InstantiateComputePipeline(std::move(pipelineInfo));
+		if (!m_depthPyramidPipeline)
+			throw std::runtime_error("failed to instantiate depth pyramid pipeline");
+	}
+
 	void Graphics::BuildDefaultMaterials()
 	{
 		std::size_t depthPassIndex = m_materialPassRegistry.GetPassIndex("DepthPass");
@@ -330,6 +513,9 @@ namespace Nz
 				renderStates.blend.dstAlpha = BlendFunc::One;
 			});
 		}
+
+		m_defaultMaterials.distanceFieldText = m_defaultMaterials.materials[MaterialType::Basic].presets[MaterialInstancePreset::Transparent]->Clone();
+		m_defaultMaterials.distanceFieldText->SetValueProperty("DistanceField", true);
 	}
 
 	void Graphics::BuildDefaultTextures()
@@ -385,6 +571,39 @@ namespace Nz
 		}
 	}
 
+	std::filesystem::path Graphics::GetPipelineCachePath() const
+	{
+		// Name the cache after the device cache UUID so that data from another GPU/driver is never loaded
+		constexpr char hexDigits[] = "0123456789abcdef";
+
+		std::string fileName;
+		for (UInt8 byte : m_renderDevice->GetDeviceInfo().pipelineCacheUUID)
+		{
+			fileName.push_back(hexDigits[byte >> 4]);
+			fileName.push_back(hexDigits[byte & 0x0F]);
+		}
+		fileName += ".bin";
+
+		return m_pipelineCacheDirectory / fileName;
+	}
+
+	void Graphics::LoadPipelineCache()
+	{
+		std::filesystem::path cachePath = GetPipelineCachePath();
+		if (!std::filesystem::is_regular_file(cachePath))
+			return;
+
+		std::optional<std::vector<UInt8>> cacheData = File::ReadWhole(cachePath);
+		if (!cacheData)
+		{
+			NazaraWarning("failed to read pipeline cache {0}", cachePath);
+			return;
+		}
+
+		if (!m_renderDevice->LoadPipelineCacheData(cacheData->data(), cacheData->size()))
+			NazaraWarning("pipeline cache {0} was not loaded", cachePath);
+	}
+
 	void Graphics::RegisterMaterialPasses()
 	{
 		m_materialPassRegistry.RegisterPass("ForwardPass");
@@ -394,8 +613,10 @@ namespace Nz
 
 	void Graphics::RegisterShaderModules()
 	{
-		m_shaderModuleResolver = std::make_shared<nzsl::FilesystemModuleResolver>();
+		m_shaderModuleResolver = std::make_shared<ThreadSafeModuleResolver>();
 		RegisterEmbedShaderModule(r_basicMaterialShader);
+		RegisterEmbedShaderModule(r_depthPyramidShader);
+		RegisterEmbedShaderModule(r_drawCullingShader);
 		RegisterEmbedShaderModule(r_fullscreenVertexShader);
 		RegisterEmbedShaderModule(r_instanceDataModule);
 		RegisterEmbedShaderModule(r_lightDataModule);
@@ -427,6 +648,25 @@ namespace Nz
 		m_shaderModuleResolver->RegisterModule(nzsl::Ast::UnserializeShader(unserializer));
 	}
 
+	void Graphics::SavePipelineCache()
+	{
+		std::vector<UInt8> cacheData = m_renderDevice->GetPipelineCacheData();
+		if (cacheData.empty())
+			return;
+
+		std::error_code ec;
+		std::filesystem::create_directories(m_pipelineCacheDirectory, ec);
+		if (ec)
+		{
+			NazaraWarning("failed to create pipeline cache directory {0}: {1}", m_pipelineCacheDirectory, ec.message());
+			return;
+		}
+
+		std::filesystem::path cachePath = GetPipelineCachePath();
+		if (!File::WriteWhole(cachePath, cacheData.data(), cacheData.size()))
+			NazaraWarning("failed to save pipeline cache to {0}", cachePath);
+	}
+
 	void Graphics::SelectDepthStencilFormats()
 	{
 		for (PixelFormat depthStencilCandidate : { PixelFormat::Depth24, PixelFormat::Depth32F, PixelFormat::Depth16 })
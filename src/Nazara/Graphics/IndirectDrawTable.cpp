@@ -0,0 +1,256 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Graphics/DepthPyramid.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <Nazara/Renderer/UploadPool.hpp>
+#include <NZSL/Math/FieldOffsets.hpp>
+#include <algorithm>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::IndirectDrawTable
+	* \brief Graphics class that culls indexed draws in a compute shader and writes them as indirect draw commands
+	*
+	* Each draw references the instance data of a world instance by index, which requires the world instance buffer pool to be usable as storage buffers
+	* and materials to read instance data using the instance index (see Graphics::IsGpuDrivenRenderingEnabled).
+	* Culled draws keep their command with an instance count of zero, so recorded command buffers stay valid whatever the visibility.
+	*/
+	IndirectDrawTable::IndirectDrawTable(std::shared_ptr<RenderDevice> renderDevice) :
+	m_renderDevice(std::move(renderDevice)),
+	m_drawCount(0)
+	{
+		// Has to match DrawInfo and DrawInfoBuffer from the DrawCulling shader
+		nzsl::FieldOffsets drawStruct(nzsl::StructLayout::Std140);
+		m_drawDataLayout.aabbMinOffset = drawStruct.AddField(nzsl::StructFieldType::Float3);
+		m_drawDataLayout.instanceIndexOffset = drawStruct.AddField(nzsl::StructFieldType::UInt1);
+		m_drawDataLayout.aabbMaxOffset = drawStruct.AddField(nzsl::StructFieldType::Float3);
+		m_drawDataLayout.commandIndexOffset = drawStruct.AddField(nzsl::StructFieldType::UInt1);
+		m_drawDataLayout.indexCountOffset = drawStruct.AddField(nzsl::StructFieldType::UInt1);
+		m_drawDataLayout.firstIndexOffset = drawStruct.AddField(nzsl::StructFieldType::UInt1);
+		m_drawDataLayout.vertexOffsetOffset = drawStruct.AddField(nzsl::StructFieldType::Int1);
+
+		m_drawDataLayout.drawSize = drawStruct.GetAlignedSize();
+
+		nzsl::FieldOffsets drawBufferStruct(nzsl::StructLayout::Std140);
+		m_drawDataLayout.drawCountOffset = drawBufferStruct.AddField(nzsl::StructFieldType::UInt1);
+		m_drawDataLayout.drawsOffset = drawBufferStruct.AddStructArray(drawStruct, 1);
+
+		// Has to match DrawIndexedCommand from the DrawCulling shader (and the layout expected by the GPU)
+		nzsl::FieldOffsets commandStruct(nzsl::StructLayout::Std140);
+		commandStruct.AddField(nzsl::StructFieldType::UInt1); //< indexCount
+		commandStruct.AddField(nzsl::StructFieldType::UInt1); //< instanceCount
+		commandStruct.AddField(nzsl::StructFieldType::UInt1); //< firstIndex
+		commandStruct.AddField(nzsl::StructFieldType::Int1);  //< vertexOffset
+		commandStruct.AddField(nzsl::StructFieldType::UInt1); //< firstInstance
+
+		m_commandStride = SafeCast<UInt32>(commandStruct.GetAlignedSize());
+	}
+
+	/*!
+	* \brief Adds an indexed draw of a world instance, culled against its local bounding box
+	*
+	* Draws become valid on the next Upload call and stay valid until Clear is called.
+	*
+	* \return Index of the draw, to use with GetCommandOffset
+	*/
+	std::size_t IndirectDrawTable::AddIndexedDraw(const WorldInstance& worldInstance, const Boxf& aabb, UInt32 indexCount, UInt32 firstIndex, Int32 vertexOffset)
+	{
+		RenderBuffer* instanceBuffer = worldInstance.GetInstanceBuffer().GetBuffer();
+
+		auto it = m_blockByInstanceBuffer.find(instanceBuffer);
+		if (it == m_blockByInstanceBuffer.end())
+		{
+			it = m_blockByInstanceBuffer.emplace(instanceBuffer, m_instanceBlocks.size()).first;
+
+			auto& instanceBlock = m_instanceBlocks.emplace_back();
+			instanceBlock.instanceBuffer = instanceBuffer;
+		}
+
+		std::size_t drawIndex = m_drawCount++;
+
+		auto& draw = m_instanceBlocks[it->second].draws.emplace_back();
+		draw.aabb = aabb;
+		draw.commandIndex = SafeCast<UInt32>(drawIndex);
+		draw.firstIndex = firstIndex;
+		draw.indexCount = indexCount;
+		draw.instanceIndex = worldInstance.GetInstanceIndex();
+		draw.vertexOffset = vertexOffset;
+
+		return drawIndex;
+	}
+
+	void IndirectDrawTable::Clear(RenderFrame& renderFrame)
+	{
+		for (auto& instanceBlock : m_instanceBlocks)
+			renderFrame.PushForRelease(std::move(instanceBlock.shaderBinding));
+
+		m_blockByInstanceBuffer.clear();
+		m_instanceBlocks.clear();
+		m_drawCount = 0;
+	}
+
+	/*!
+	* \brief Writes the draw commands of the current frame, according to the viewer and world instances data
+	*
+	* Has to be called every frame after the viewer and world instances data were transferred, and before draws are executed.
+	*
+	* \param renderFrame Frame to record the culling to
+	* \param depthPyramid If not null, draws are also tested against this depth pyramid (built from the previous frame of the same viewer)
+	*/
+	void IndirectDrawTable::Cull(RenderFrame& renderFrame, const DepthPyramid* depthPyramid)
+	{
+		if (m_drawCount == 0)
+			return;
+
+		Graphics* graphics = Graphics::Instance();
+		const std::shared_ptr<ComputePipeline>& cullingPipeline = graphics->GetDrawCullingPipeline(depthPyramid != nullptr);
+		NazaraAssert(cullingPipeline, "GPU-driven rendering is not enabled or doesn't support occlusion culling");
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Draw culling", Color::Blue());
+			{
+				// The previous frame may still be reading the draw commands
+				builder.MemoryBarrier(PipelineStage::DrawIndirect, PipelineStage::ComputeShader, MemoryAccess::IndirectCommandRead, MemoryAccess::ShaderWrite);
+
+				builder.BindComputePipeline(*cullingPipeline);
+				if (depthPyramid)
+					builder.BindComputeShaderBinding(1, depthPyramid->GetCullingShaderBinding());
+
+				for (const auto& instanceBlock : m_instanceBlocks)
+				{
+					UInt32 drawCount = SafeCast<UInt32>(instanceBlock.draws.size());
+
+					builder.BindComputeShaderBinding(0, *instanceBlock.shaderBinding);
+					builder.Dispatch((drawCount + CullingWorkgroupSize - 1) / CullingWorkgroupSize, 1, 1);
+				}
+
+				builder.MemoryBarrier(PipelineStage::ComputeShader, PipelineStage::DrawIndirect, MemoryAccess::ShaderWrite, MemoryAccess::IndirectCommandRead);
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Compute);
+	}
+
+	/*!
+	* \brief Uploads the draws added since last Clear call to the GPU
+	*
+	* Buffers are only reallocated when they grow, which invalidates GetIndirectBuffer.
+	*/
+	void IndirectDrawTable::Upload(RenderFrame& renderFrame, const ViewerInstance& viewerInstance)
+	{
+		if (m_drawCount == 0)
+			return;
+
+		Graphics* graphics = Graphics::Instance();
+		const std::shared_ptr<RenderPipelineLayout>& cullingPipelineLayout = graphics->GetDrawCullingPipelineLayout();
+		NazaraAssert(cullingPipelineLayout, "GPU-driven rendering is not enabled");
+
+		// Every instance block has its own range in the draw data buffer
+		UInt64 storageAlignment = m_renderDevice->GetDeviceInfo().limits.minStorageBufferOffsetAlignment;
+
+		UInt64 drawDataSize = 0;
+		for (auto& instanceBlock : m_instanceBlocks)
+		{
+			instanceBlock.drawDataOffset = drawDataSize;
+			drawDataSize = AlignPow2(drawDataSize + m_drawDataLayout.drawsOffset + instanceBlock.draws.size() * m_drawDataLayout.drawSize, storageAlignment);
+		}
+
+		if (!m_drawDataBuffer || m_drawDataBuffer->GetSize() < drawDataSize)
+		{
+			UInt64 bufferSize = (m_drawDataBuffer) ? std::max(drawDataSize, m_drawDataBuffer->GetSize() * 2) : drawDataSize;
+			renderFrame.PushForRelease(std::move(m_drawDataBuffer));
+
+			m_drawDataBuffer = m_renderDevice->InstantiateBuffer(BufferType::Storage, bufferSize, BufferUsage::DeviceLocal);
+		}
+
+		UInt64 indirectSize = m_drawCount * m_commandStride;
+		if (!m_indirectBuffer || m_indirectBuffer->GetSize() < indirectSize)
+		{
+			UInt64 bufferSize = (m_indirectBuffer) ? std::max(indirectSize, m_indirectBuffer->GetSize() * 2) : indirectSize;
+			renderFrame.PushForRelease(std::move(m_indirectBuffer));
+
+			m_indirectBuffer = m_renderDevice->InstantiateBuffer(BufferType::Storage, bufferSize, BufferUsage::DeviceLocal | BufferUsage::Indirect);
+		}
+
+		UploadPool::Allocation& allocation = renderFrame.GetUploadPool().Allocate(drawDataSize);
+
+		const auto& viewerBuffer = viewerInstance.GetViewerBuffer();
+
+		for (auto& instanceBlock : m_instanceBlocks)
+		{
+			UInt8* blockPtr = static_cast<UInt8*>(allocation.mappedPtr) + instanceBlock.drawDataOffset;
+			AccessByOffset<UInt32&>(blockPtr, m_drawDataLayout.drawCountOffset) = SafeCast<UInt32>(instanceBlock.draws.size());
+
+			UInt8* drawPtr = blockPtr + m_drawDataLayout.drawsOffset;
+			for (const Draw& draw : instanceBlock.draws)
+			{
+				AccessByOffset<Vector3f&>(drawPtr, m_drawDataLayout.aabbMinOffset) = draw.aabb.GetMinimum();
+				AccessByOffset<Vector3f&>(drawPtr, m_drawDataLayout.aabbMaxOffset) = draw.aabb.GetMaximum();
+				AccessByOffset<UInt32&>(drawPtr, m_drawDataLayout.commandIndexOffset) = draw.commandIndex;
+				AccessByOffset<UInt32&>(drawPtr, m_drawDataLayout.firstIndexOffset) = draw.firstIndex;
+				AccessByOffset<UInt32&>(drawPtr, m_drawDataLayout.indexCountOffset) = draw.indexCount;
+				AccessByOffset<UInt32&>(drawPtr, m_drawDataLayout.instanceIndexOffset) = draw.instanceIndex;
+				AccessByOffset<Int32&>(drawPtr, m_drawDataLayout.vertexOffsetOffset) = draw.vertexOffset;
+
+				drawPtr += m_drawDataLayout.drawSize;
+			}
+
+			UInt64 blockSize = m_drawDataLayout.drawsOffset + instanceBlock.draws.size() * m_drawDataLayout.drawSize;
+
+			if (instanceBlock.shaderBinding)
+				renderFrame.PushForRelease(std::move(instanceBlock.shaderBinding));
+
+			instanceBlock.shaderBinding = cullingPipelineLayout->AllocateShaderBinding(0);
+			instanceBlock.shaderBinding->Update({
+				{
+					0,
+					ShaderBinding::StorageBufferBinding {
+						instanceBlock.instanceBuffer, 0, instanceBlock.instanceBuffer->GetSize()
+					}
+				},
+				{
+					1,
+					ShaderBinding::StorageBufferBinding {
+						m_drawDataBuffer.get(), instanceBlock.drawDataOffset, blockSize
+					}
+				},
+				{
+					2,
+					ShaderBinding::StorageBufferBinding {
+						m_indirectBuffer.get(), 0, m_indirectBuffer->GetSize()
+					}
+				},
+				{
+					3,
+					ShaderBinding::UniformBufferBinding {
+						viewerBuffer.get(), 0, viewerBuffer->GetSize()
+					}
+				}
+			});
+		}
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Draw data upload", Color::Yellow());
+			{
+				builder.PreTransferBarrier();
+				builder.CopyBuffer(allocation, RenderBufferView(m_drawDataBuffer.get(), 0, drawDataSize));
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+	}
+}
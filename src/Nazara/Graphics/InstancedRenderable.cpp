@@ -3,9 +3,31 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	InstancedRenderable::~InstancedRenderable() = default;
+
+	/*!
+	* \brief Selects the level of detail to use for a projected size
+	* \return Level of detail index, zero being the most detailed one
+	*
+	* \param screenSize Projected bounding sphere diameter relative to the viewport height
+	* \param currentLod Level of detail used until now
+	* \param hysteresis Screen size ratio by which a threshold has to be crossed before leaving the current level (0.1 means 10%), preventing popping when the size oscillates around a threshold
+	*/
+	std::size_t InstancedRenderable::SelectLod(float screenSize, std::size_t currentLod, float hysteresis) const
+	{
+		std::size_t lodIndex = std::min(currentLod, m_lodScreenSizes.size());
+
+		while (lodIndex < m_lodScreenSizes.size() && screenSize < m_lodScreenSizes[lodIndex] * (1.f - hysteresis))
+			lodIndex++;
+
+		while (lodIndex > 0 && screenSize >= m_lodScreenSizes[lodIndex - 1] * (1.f + hysteresis))
+			lodIndex--;
+
+		return lodIndex;
+	}
 }
@@ -3,9 +3,123 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/LightShadowData.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/DepthPipelinePass.hpp>
+#include <Nazara/Graphics/FramePipeline.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	LightShadowData::~LightShadowData() = default;
+
+	/*!
+	* \brief Fills the shadow-dependent part of the light shader data (on top of what Light::FillLightData wrote)
+	*/
+	void LightShadowData::FillLightData(void* /*data*/, const AbstractViewer* /*viewer*/) const
+	{
+	}
+
+	/*!
+	* \brief Notifies the shadow data that the shadowmaps textures were recreated and that their content is lost
+	*/
+	void LightShadowData::InvalidateShadowmaps()
+	{
+	}
+
+	void LightShadowData::RegisterViewer(const AbstractViewer* /*viewer*/)
+	{
+	}
+
+	void LightShadowData::UnregisterViewer(const AbstractViewer* /*viewer*/)
+	{
+	}
+
+	/*!
+	* \brief Prepares a depth pass rendering a shadowmap whose content is kept between frames
+	*
+	* The shadowmap is only rendered again if the casters visible from the shadow viewer changed or if the cache was invalidated.
+	* An outdated (but valid) shadowmap is kept as is when the pipeline shadow update budget is exhausted.
+	*
+	* \param renderFrame Frame being prepared
+	* \param pipeline Pipeline owning the shadow data
+	* \param depthPass Depth pass rendering the shadowmap
+	* \param shadowViewer Viewer used to render the shadowmap
+	* \param cache Shadowmap state, isValid has to be reset when the shadowmap content is lost or when the shadow viewer changed
+	*/
+	void LightShadowData::PrepareCachedShadowmap(RenderFrame& renderFrame, FramePipeline& pipeline, DepthPipelinePass& depthPass, const AbstractViewer& shadowViewer, ShadowmapCache& cache)
+	{
+		Frustumf frustum = Frustumf::Extract(shadowViewer.GetViewerInstance().GetViewProjMatrix());
+
+		std::size_t visibilityHash = 5U;
+		const auto& visibleRenderables = pipeline.FrustumCull(frustum, 0xFFFFFFFF, visibilityHash);
+
+		bool isUpToDate = cache.IsUpToDate(visibleRenderables, visibilityHash);
+
+		// Invalid shadowmaps content is undefined, they have to be rendered even if it exceeds the budget
+		bool renderShadowmap = !isUpToDate && pipeline.RequestShadowUpdate(!cache.isValid);
+
+		depthPass.SkipRendering(!renderShadowmap);
+		if (!renderShadowmap)
+			return;
+
+		depthPass.Prepare(renderFrame, frustum, visibleRenderables, visibilityHash);
+
+		cache.Update(visibleRenderables, visibilityHash);
+	}
+
+	/*!
+	* \brief Checks if a shadowmap rendered with the cached casters is still valid for the currently visible casters
+	* \return True if the cache is valid and no caster moved, appeared or disappeared since the last update
+	*
+	* Transforms are compared exactly (so -0 and +0 are considered equal), skeletal animations are not tracked and always invalidate the cache.
+	*
+	* \param visibleRenderables Casters visible from the shadow viewer
+	* \param visibilityHash Visibility hash computed by the frame pipeline culling, changes when a renderable is modified
+	*/
+	bool LightShadowData::ShadowmapCache::IsUpToDate(const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash) const
+	{
+		if (!isValid || this->visibilityHash != visibilityHash || casters.size() != visibleRenderables.size())
+			return false;
+
+		for (std::size_t i = 0; i < visibleRenderables.size(); ++i)
+		{
+			const auto& renderableData = visibleRenderables[i];
+			if (renderableData.skeletonInstance)
+				return false;
+
+			const CasterState& caster = casters[i];
+			if (caster.instancedRenderable != renderableData.instancedRenderable || caster.worldInstance != renderableData.worldInstance)
+				return false;
+
+			if (caster.worldMatrix != renderableData.worldInstance->GetWorldMatrix())
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Stores the casters a shadowmap was rendered with and marks the cache as valid
+	*
+	* \param visibleRenderables Casters visible from the shadow viewer
+	* \param visibilityHash Visibility hash computed by the frame pipeline culling
+	*/
+	void LightShadowData::ShadowmapCache::Update(const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t visibilityHash)
+	{
+		casters.clear();
+		casters.reserve(visibleRenderables.size());
+		for (const auto& renderableData : visibleRenderables)
+		{
+			auto& caster = casters.emplace_back();
+			caster.instancedRenderable = renderableData.instancedRenderable;
+			caster.worldInstance = renderableData.worldInstance;
+			caster.worldMatrix = renderableData.worldInstance->GetWorldMatrix();
+		}
+
+		this->visibilityHash = visibilityHash;
+		isValid = true;
+	}
 }
@@ -31,6 +31,7 @@ namespace Nz
 		Graphics* graphics = Graphics::Instance();
 
 		const std::shared_ptr<RenderDevice>& renderDevice = graphics->GetRenderDevice();
+		const BindlessTextureTable* bindlessTextureTable = graphics->GetBindlessTextureTable();
 
 		nzsl::Ast::SanitizeVisitor::Options options;
 		options.forceAutoBindingResolve = true;
@@ -38,12 +39,40 @@ namespace Nz
 		options.moduleResolver = graphics->GetShaderModuleResolver();
 		options.optionValues[CRC32("MaxLightCount")] = SafeCast<UInt32>(PredefinedLightData::MaxLightCount);
 		options.optionValues[CRC32("MaxJointCount")] = SafeCast<UInt32>(PredefinedSkeletalData::MaxMatricesCount);
+		options.optionValues[CRC32("BindlessTextureCount")] = (bindlessTextureTable) ? bindlessTextureTable->GetCapacity() : 1U;
+		options.optionValues[CRC32("BindlessTextures")] = (bindlessTextureTable != nullptr);
+		options.optionValues[CRC32("IndexedInstanceData")] = graphics->IsGpuDrivenRenderingEnabled();
 
 		nzsl::Ast::ModulePtr sanitizedModule = nzsl::Ast::Sanitize(*referenceModule, options);
 
 		m_reflection.Reflect(*sanitizedModule);
 
-		m_renderPipelineLayout = renderDevice->InstantiateRenderPipelineLayout(m_reflection.GetPipelineLayoutInfo());
+		// Without bindless textures support, shaders are expected to fallback to regular material textures using the BindlessTextures option
+		m_bindlessTextureSet = InvalidBindingIndex;
+		if (const ShaderReflection::ExternalBlockData* block = m_reflection.GetExternalBlockByTag("Bindless"); block && bindlessTextureTable)
+		{
+			if (auto it = block->samplers.find("Textures"); it != block->samplers.end())
+			{
+				const auto& textureArray = it->second;
+				if (textureArray.bindingIndex != 0 || textureArray.arraySize != bindlessTextureTable->GetCapacity() || textureArray.imageType != nzsl::ImageType::E2D)
+					NazaraError("bindless textures must be declared as a sampler2D array of BindlessTextureCount elements at binding 0 of their set");
+				else
+					m_bindlessTextureSet = textureArray.bindingSet;
+			}
+		}
+
+		RenderPipelineLayoutInfo pipelineLayoutInfo = m_reflection.GetPipelineLayoutInfo();
+		if (m_bindlessTextureSet != InvalidBindingIndex)
+		{
+			// The bindless set layout has to match the table one to be compatible
+			for (auto& binding : pipelineLayoutInfo.bindings)
+			{
+				if (binding.setIndex == m_bindlessTextureSet)
+					binding.partiallyBound = true;
+			}
+		}
+
+		m_renderPipelineLayout = renderDevice->InstantiateRenderPipelineLayout(std::move(pipelineLayoutInfo));
 
 		if (const ShaderReflection::ExternalBlockData* block = m_reflection.GetExternalBlockByTag("Material"))
 		{
@@ -100,6 +129,9 @@ namespace Nz
 			if (auto it = block->samplers.find("ShadowMapsCube"); it != block->samplers.end())
 				m_engineShaderBindings[EngineShaderBinding::ShadowmapCube] = it->second.bindingIndex;
 
+			if (auto it = block->samplers.find("ShadowMapsDirectional"); it != block->samplers.end())
+				m_engineShaderBindings[EngineShaderBinding::ShadowmapDirectional] = it->second.bindingIndex;
+
 			if (auto it = block->uniformBlocks.find("SkeletalData"); it != block->uniformBlocks.end())
 				m_engineShaderBindings[EngineShaderBinding::SkeletalDataUbo] = it->second.bindingIndex;
 
@@ -107,6 +139,16 @@ namespace Nz
 				m_engineShaderBindings[EngineShaderBinding::OverlayTexture] = it->second.bindingIndex;
 		}
 
+		// With GPU-driven rendering, shaders may read the instance data of the whole instance buffer (indexed by instance index) instead of a single instance
+		if (const ShaderReflection::ExternalBlockData* block = m_reflection.GetExternalBlockByTag("InstanceDataBuffer"))
+		{
+			if (auto it = block->storageBlocks.find("Instances"); it != block->storageBlocks.end())
+				m_engineShaderBindings[EngineShaderBinding::InstanceDataBuffer] = it->second.bindingIndex;
+		}
+
+		UInt32 bindlessTextureCount = (m_bindlessTextureSet != InvalidBindingIndex) ? bindlessTextureTable->GetCapacity() : 0;
+		bool indexedInstanceData = (m_engineShaderBindings[EngineShaderBinding::InstanceDataBuffer] != InvalidBindingIndex);
+
 		for (const auto& handlerPtr : m_settings.GetPropertyHandlers())
 			handlerPtr->Setup(*this, m_reflection);
 
@@ -119,6 +161,15 @@ namespace Nz
 			{
 				uberShader->UpdateConfigCallback([=](UberShader::Config& config, const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers)
 				{
+					if (bindlessTextureCount > 0)
+					{
+						config.optionValues[CRC32("BindlessTextureCount")] = bindlessTextureCount;
+						config.optionValues[CRC32("BindlessTextures")] = true;
+					}
+
+					if (indexedInstanceData)
+						config.optionValues[CRC32("IndexedInstanceData")] = true;
+
 					if (vertexBuffers.empty())
 						return;
 
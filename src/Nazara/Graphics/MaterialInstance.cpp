@@ -29,6 +29,7 @@ namespace Nz
 			m_textureOverride[i].samplerInfo = settings.GetTextureProperty(i).defaultSamplerInfo;
 
 		m_valueOverride.resize(settings.GetValuePropertyCount());
+		m_bindlessTextures.resize(settings.GetTexturePropertyCount());
 
 		const auto& passSettings = settings.GetPasses();
 		m_passes.resize(passSettings.size());
@@ -80,6 +81,7 @@ namespace Nz
 	m_parent(material.m_parent),
 	m_optionValuesOverride(material.m_optionValuesOverride),
 	m_valueOverride(material.m_valueOverride),
+	m_bindlessTextures(material.m_bindlessTextures),
 	m_textureBinding(material.m_textureBinding),
 	m_textureOverride(material.m_textureOverride),
 	m_materialSettings(material.m_materialSettings)
@@ -112,10 +114,30 @@ namespace Nz
 			assert(material.m_uniformBuffers[i].values.size() == uniformBlockData.bufferPool->GetBufferSize());
 			uniformBuffer.values = material.m_uniformBuffers[i].values;
 		}
+
+		// Bindless texture indices were copied along with uniform values, references have to be taken on them
+		if (BindlessTextureTable* bindlessTextureTable = Graphics::Instance()->GetBindlessTextureTable())
+		{
+			for (const BindlessTexture& bindlessTexture : m_bindlessTextures)
+			{
+				if (bindlessTexture.tableIndex != BindlessTextureTable::DefaultTextureIndex)
+					bindlessTextureTable->RegisterTexture(bindlessTexture.texture, bindlessTexture.sampler);
+			}
+		}
 	}
 
 	MaterialInstance::~MaterialInstance()
 	{
+		// Graphics may have been destroyed before the last material instances
+		if (Graphics* graphics = Graphics::Instance())
+		{
+			if (BindlessTextureTable* bindlessTextureTable = graphics->GetBindlessTextureTable())
+			{
+				for (const BindlessTexture& bindlessTexture : m_bindlessTextures)
+					bindlessTextureTable->UnregisterTexture(bindlessTexture.tableIndex);
+			}
+		}
+
 		for (std::size_t i = 0; i < m_uniformBuffers.size(); ++i)
 		{
 			auto& uniformBuffer = m_uniformBuffers[i];
@@ -212,7 +234,13 @@ namespace Nz
 			// make option values consistent (required for hash/equality)
 			std::sort(pass.pipelineInfo.optionValues.begin(), pass.pipelineInfo.optionValues.end(), [](const auto& lhs, const auto& rhs) { return lhs.hash < rhs.hash; });
 
-			m_passes[passIndex].pipeline = MaterialPipeline::Get(pass.pipelineInfo);
+			pass.pipeline = MaterialPipeline::Get(pass.pipelineInfo);
+
+			// Elements using a fallback pipeline have to be rebuilt once the real one is compiled
+			pass.onRenderPipelineReady.Connect(pass.pipeline->OnRenderPipelineReady, [this, passIndex](const MaterialPipeline*)
+			{
+				OnMaterialInstancePipelineInvalidated(this, passIndex);
+			});
 		}
 
 		return m_passes[passIndex].pipeline;
@@ -323,6 +351,42 @@ namespace Nz
 			InvalidatePassPipeline(i);
 	}
 
+	/*!
+	* \brief Registers a texture in the bindless texture table in place of the previous texture of a property
+	*
+	* Unlike texture bindings, changing a bindless texture doesn't invalidate the shader binding of the material instance,
+	* only the returned index has to be updated in the material data.
+	*
+	* \param textureIndex Texture property index
+	* \param texture New texture, or null to use the default texture
+	* \param textureSampler Sampler to use with the texture
+	*
+	* \return Index of the texture in the bindless texture table
+	*/
+	UInt32 MaterialInstance::UpdateBindlessTexture(std::size_t textureIndex, std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> textureSampler)
+	{
+		assert(textureIndex < m_bindlessTextures.size());
+		auto& bindlessTexture = m_bindlessTextures[textureIndex];
+		if (bindlessTexture.texture == texture && bindlessTexture.sampler == textureSampler)
+			return bindlessTexture.tableIndex;
+
+		BindlessTextureTable* bindlessTextureTable = Graphics::Instance()->GetBindlessTextureTable();
+		NazaraAssert(bindlessTextureTable, "bindless textures are not supported");
+
+		UInt32 tableIndex = BindlessTextureTable::DefaultTextureIndex;
+		if (texture)
+			tableIndex = bindlessTextureTable->RegisterTexture(texture, textureSampler);
+
+		// Unregister after registering, to keep the entry if the texture is the same
+		bindlessTextureTable->UnregisterTexture(bindlessTexture.tableIndex);
+
+		bindlessTexture.sampler = std::move(textureSampler);
+		bindlessTexture.tableIndex = tableIndex;
+		bindlessTexture.texture = std::move(texture);
+
+		return tableIndex;
+	}
+
 	void MaterialInstance::UpdateTextureBinding(std::size_t textureBinding, std::shared_ptr<Texture> texture, std::shared_ptr<TextureSampler> textureSampler)
 	{
 		assert(textureBinding < m_textureBinding.size());
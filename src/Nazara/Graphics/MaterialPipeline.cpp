@@ -8,6 +8,8 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
 #include <Nazara/Graphics/UberShader.hpp>
+#include <NazaraUtils/Hash.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -19,35 +21,123 @@ namespace Nz
 	* \brief Graphics class used to contains all rendering states that are not allowed to change individually on rendering devices
 	*/
 
+	MaterialPipeline::~MaterialPipeline()
+	{
+		if (auto it = std::find(s_pendingMaterialPipelines.begin(), s_pendingMaterialPipelines.end(), this); it != s_pendingMaterialPipelines.end())
+			s_pendingMaterialPipelines.erase(it);
+	}
+
 	/*!
 	* \brief Retrieve (and generate if required) a pipeline instance using shader flags without applying it
 	*
-	* \param flags Shader flags
+	* When asynchronous compilation is enabled, a fallback pipeline using the base shader permutations (without material options) is returned
+	* while the required permutations are being compiled. OnRenderPipelineReady is then triggered once they are available.
+	*
+	* \param vertexBuffers Vertex buffers description
+	* \param vertexBufferCount Vertex buffer count
 	*
 	* \return Pipeline instance
 	*/
 	const std::shared_ptr<RenderPipeline>& MaterialPipeline::GetRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
 	{
-		for (const auto& pipeline : m_renderPipelines)
+		std::size_t layoutHash = HashVertexBuffers(vertexBuffers, vertexBufferCount);
+		if (const std::shared_ptr<RenderPipeline>* renderPipeline = FindRenderPipeline(m_renderPipelines, layoutHash, vertexBuffers, vertexBufferCount))
+			return *renderPipeline;
+
+		if (s_asyncCompilation)
 		{
-			const auto& pipelineInfo = pipeline->GetPipelineInfo();
-			if (pipelineInfo.vertexBuffers.size() != vertexBufferCount)
-				continue;
+			// Already compiling
+			if (const std::shared_ptr<RenderPipeline>* fallbackPipeline = FindRenderPipeline(m_fallbackPipelines, layoutHash, vertexBuffers, vertexBufferCount))
+				return *fallbackPipeline;
+		}
+
+		return BuildRenderPipeline(vertexBuffers, vertexBufferCount, s_asyncCompilation);
+	}
+
+	/*!
+	* \brief Compiles shader permutations and creates the render pipeline for a vertex layout ahead of its first use
+	*
+	* Shader permutations are compiled first (see UberShader::Prewarm).
+	* If a render pass is given, the backend pipeline object is also created for it, filling the render device pipeline cache (see RenderPipeline::Prewarm).
+	*
+	* \param vertexBuffers Vertex buffers description
+	* \param vertexBufferCount Vertex buffer count
+	* \param renderPass Optional render pass compatible with the one the pipeline will be used with
+	* \param subpassIndex Subpass index of the render pass
+	*
+	* \remark Unlike UberShader::Prewarm, this has to be called from the thread rendering frames
+	*/
+	void MaterialPipeline::Prewarm(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, const RenderPass* renderPass, std::size_t subpassIndex) const
+	{
+		std::size_t layoutHash = HashVertexBuffers(vertexBuffers, vertexBufferCount);
+
+		const std::shared_ptr<RenderPipeline>* renderPipeline = FindRenderPipeline(m_renderPipelines, layoutHash, vertexBuffers, vertexBufferCount);
+		if (!renderPipeline)
+		{
+			std::vector<RenderPipelineInfo::VertexBufferData> vertexBufferList(vertexBuffers, vertexBuffers + vertexBufferCount);
+			std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues = BuildOptionValues();
 
-			bool isEqual = std::equal(pipelineInfo.vertexBuffers.begin(), pipelineInfo.vertexBuffers.end(), vertexBuffers, [](const auto& v1, const auto& v2)
+			for (const auto& shader : m_pipelineInfo.shaders)
 			{
-				return v1.binding == v2.binding && v1.declaration == v2.declaration;
-			});
+				if (shader.uberShader)
+				{
+					UberShader::Config config{ optionValues };
+					shader.uberShader->UpdateConfig(config, vertexBufferList);
 
-			if (isEqual)
-				return pipeline;
+					shader.uberShader->Prewarm({ std::move(config) });
+				}
+			}
+
+			renderPipeline = &BuildRenderPipeline(vertexBuffers, vertexBufferCount, false);
 		}
 
-		RenderPipelineInfo renderPipelineInfo;
-		static_cast<RenderStates&>(renderPipelineInfo) = m_pipelineInfo;
+		if (renderPass)
+			(*renderPipeline)->Prewarm(*renderPass, subpassIndex);
+	}
 
-		renderPipelineInfo.pipelineLayout = m_pipelineInfo.pipelineLayout;
+	/*!
+	* \brief Returns a reference to a MaterialPipeline built with MaterialPipelineInfo
+	*
+	* This function is using a cache, calling it multiples times with the same MaterialPipelineInfo will returns references to a single MaterialPipeline
+	*
+	* \param pipelineInfo Pipeline informations used to build/retrieve a MaterialPipeline object
+	*/
+	const std::shared_ptr<MaterialPipeline>& MaterialPipeline::Get(const MaterialPipelineInfo& pipelineInfo)
+	{
+		auto it = s_pipelineCache.find(pipelineInfo);
+		if (it == s_pipelineCache.end())
+			it = s_pipelineCache.insert(it, PipelineCache::value_type(pipelineInfo, std::make_shared<MaterialPipeline>(pipelineInfo, Token{})));
 
+		return it->second;
+	}
+
+	/*!
+	* \brief Checks the pipelines being compiled asynchronously, triggering OnRenderPipelineReady for those which are available
+	*
+	* This is called by the frame pipeline at the beginning of every frame.
+	*/
+	void MaterialPipeline::UpdatePendingPipelines()
+	{
+		std::vector<const MaterialPipeline*> readyPipelines;
+		for (auto it = s_pendingMaterialPipelines.begin(); it != s_pendingMaterialPipelines.end();)
+		{
+			const MaterialPipeline* materialPipeline = *it;
+			if (materialPipeline->CheckPendingPipelines())
+				readyPipelines.push_back(materialPipeline);
+
+			if (materialPipeline->m_pendingPipelines.empty())
+				it = s_pendingMaterialPipelines.erase(it);
+			else
+				++it;
+		}
+
+		// Signals are triggered last as they may lead to new pipelines being requested
+		for (const MaterialPipeline* materialPipeline : readyPipelines)
+			materialPipeline->OnRenderPipelineReady(materialPipeline);
+	}
+
+	std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> MaterialPipeline::BuildOptionValues() const
+	{
 		std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues;
 		for (std::size_t i = 0; i < m_pipelineInfo.optionValues.size(); ++i)
 		{
@@ -56,8 +146,23 @@ namespace Nz
 			optionValues[option.hash] = option.value;
 		}
 
+		return optionValues;
+	}
+
+	const std::shared_ptr<RenderPipeline>& MaterialPipeline::BuildRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount, bool allowAsync) const
+	{
+		std::size_t layoutHash = HashVertexBuffers(vertexBuffers, vertexBufferCount);
+
+		RenderPipelineInfo renderPipelineInfo;
+		static_cast<RenderStates&>(renderPipelineInfo) = m_pipelineInfo;
+
+		renderPipelineInfo.pipelineLayout = m_pipelineInfo.pipelineLayout;
+
+		std::unordered_map<UInt32, nzsl::Ast::ConstantSingleValue> optionValues = BuildOptionValues();
+
 		renderPipelineInfo.vertexBuffers.assign(vertexBuffers, vertexBuffers + vertexBufferCount);
 
+		PendingPipeline pendingPipeline;
 		for (const auto& shader : m_pipelineInfo.shaders)
 		{
 			if (shader.uberShader)
@@ -65,31 +170,104 @@ namespace Nz
 				UberShader::Config config{ optionValues };
 				shader.uberShader->UpdateConfig(config, renderPipelineInfo.vertexBuffers);
 
-				renderPipelineInfo.shaderModules.push_back(shader.uberShader->Get(config));
+				if (allowAsync)
+				{
+					const std::shared_ptr<ShaderModule>& shaderModule = shader.uberShader->GetAsync(config);
+					if (!shaderModule)
+					{
+						pendingPipeline.shaderConfigs.push_back({ shader.uberShader.get(), std::move(config) });
+						continue;
+					}
+
+					renderPipelineInfo.shaderModules.push_back(shaderModule);
+				}
+				else
+					renderPipelineInfo.shaderModules.push_back(shader.uberShader->Get(config));
+			}
+		}
+
+		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+		if (pendingPipeline.shaderConfigs.empty())
+			return m_renderPipelines.emplace(layoutHash, renderDevice->InstantiateRenderPipeline(std::move(renderPipelineInfo)))->second;
+
+		if (std::find(s_pendingMaterialPipelines.begin(), s_pendingMaterialPipelines.end(), this) == s_pendingMaterialPipelines.end())
+			s_pendingMaterialPipelines.push_back(this);
+
+		pendingPipeline.layoutHash = layoutHash;
+		pendingPipeline.vertexBuffers = std::move(renderPipelineInfo.vertexBuffers);
+		m_pendingPipelines.push_back(std::move(pendingPipeline));
+
+		// Use the base permutations (without material options) while the real ones are compiling, they are shared by every material using these shaders
+		RenderPipelineInfo fallbackPipelineInfo;
+		static_cast<RenderStates&>(fallbackPipelineInfo) = m_pipelineInfo;
+
+		fallbackPipelineInfo.pipelineLayout = m_pipelineInfo.pipelineLayout;
+		fallbackPipelineInfo.vertexBuffers.assign(vertexBuffers, vertexBuffers + vertexBufferCount);
+
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (shader.uberShader)
+			{
+				UberShader::Config config;
+				shader.uberShader->UpdateConfig(config, fallbackPipelineInfo.vertexBuffers);
+
+				fallbackPipelineInfo.shaderModules.push_back(shader.uberShader->Get(config));
 			}
 		}
 
-		return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
+		return m_fallbackPipelines.emplace(layoutHash, renderDevice->InstantiateRenderPipeline(std::move(fallbackPipelineInfo)))->second;
 	}
 
-	/*!
-	* \brief Returns a reference to a MaterialPipeline built with MaterialPipelineInfo
-	*
-	* This function is using a cache, calling it multiples times with the same MaterialPipelineInfo will returns references to a single MaterialPipeline
-	*
-	* \param pipelineInfo Pipeline informations used to build/retrieve a MaterialPipeline object
-	*/
-	const std::shared_ptr<MaterialPipeline>& MaterialPipeline::Get(const MaterialPipelineInfo& pipelineInfo)
+	bool MaterialPipeline::CheckPendingPipelines() const
 	{
-		auto it = s_pipelineCache.find(pipelineInfo);
-		if (it == s_pipelineCache.end())
-			it = s_pipelineCache.insert(it, PipelineCache::value_type(pipelineInfo, std::make_shared<MaterialPipeline>(pipelineInfo, Token{})));
+		bool pipelineReady = false;
+		for (auto it = m_pendingPipelines.begin(); it != m_pendingPipelines.end();)
+		{
+			bool isReady = std::all_of(it->shaderConfigs.begin(), it->shaderConfigs.end(), [](const PendingPipeline::ShaderConfig& shaderConfig)
+			{
+				return shaderConfig.uberShader->GetAsync(shaderConfig.config) != nullptr;
+			});
 
-		return it->second;
+			if (!isReady)
+			{
+				++it;
+				continue;
+			}
+
+			// Fallback is still referenced by render elements until they get rebuilt
+			auto range = m_fallbackPipelines.equal_range(it->layoutHash);
+			for (auto fallbackIt = range.first; fallbackIt != range.second; ++fallbackIt)
+			{
+				if (IsSameVertexBuffers(fallbackIt->second->GetPipelineInfo().vertexBuffers, it->vertexBuffers.data(), it->vertexBuffers.size()))
+				{
+					m_fallbackPipelines.erase(fallbackIt);
+					break;
+				}
+			}
+
+			it = m_pendingPipelines.erase(it);
+			pipelineReady = true;
+		}
+
+		return pipelineReady;
 	}
 
-	bool MaterialPipeline::Initialize()
+	const std::shared_ptr<RenderPipeline>* MaterialPipeline::FindRenderPipeline(const std::unordered_multimap<std::size_t, std::shared_ptr<RenderPipeline>>& pipelines, std::size_t layoutHash, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
 	{
+		auto range = pipelines.equal_range(layoutHash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (IsSameVertexBuffers(it->second->GetPipelineInfo().vertexBuffers, vertexBuffers, vertexBufferCount))
+				return &it->second;
+		}
+
+		return nullptr;
+	}
+
+	bool MaterialPipeline::Initialize(bool asyncCompilation)
+	{
+		s_asyncCompilation = asyncCompilation;
+
 		/*BasicMaterialPass::Initialize();
 		DepthMaterialPass::Initialize();
 		PhongLightingMaterialPass::Initialize();
@@ -100,6 +278,10 @@ namespace Nz
 
 	void MaterialPipeline::Uninitialize()
 	{
+		for (const MaterialPipeline* materialPipeline : s_pendingMaterialPipelines)
+			materialPipeline->m_pendingPipelines.clear();
+
+		s_pendingMaterialPipelines.clear();
 		s_pipelineCache.clear();
 		/*PhysicallyBasedMaterialPass::Uninitialize();
 		PhongLightingMaterialPass::Uninitialize();
@@ -107,5 +289,31 @@ namespace Nz
 		BasicMaterialPass::Uninitialize();*/
 	}
 
+	std::size_t MaterialPipeline::HashVertexBuffers(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount)
+	{
+		// Vertex declarations are compared by pointer
+		std::size_t seed = 0;
+		for (std::size_t i = 0; i < vertexBufferCount; ++i)
+		{
+			HashCombine(seed, vertexBuffers[i].binding);
+			HashCombine(seed, vertexBuffers[i].declaration.get());
+		}
+
+		return seed;
+	}
+
+	bool MaterialPipeline::IsSameVertexBuffers(const VertexBufferList& lhs, const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount)
+	{
+		if (lhs.size() != vertexBufferCount)
+			return false;
+
+		return std::equal(lhs.begin(), lhs.end(), vertexBuffers, [](const auto& v1, const auto& v2)
+		{
+			return v1.binding == v2.binding && v1.declaration == v2.declaration;
+		});
+	}
+
 	MaterialPipeline::PipelineCache MaterialPipeline::s_pipelineCache;
+	std::vector<const MaterialPipeline*> MaterialPipeline::s_pendingMaterialPipelines;
+	bool MaterialPipeline::s_asyncCompilation = false;
 }
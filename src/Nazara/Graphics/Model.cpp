@@ -9,12 +9,15 @@
 #include <Nazara/Graphics/RenderSubmesh.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <algorithm>
+#include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	Model::Model(std::shared_ptr<GraphicalMesh> graphicalMesh) :
-	m_graphicalMesh(std::move(graphicalMesh))
+	m_graphicalMesh(std::move(graphicalMesh)),
+	m_lodMaxScreenError(0.001f)
 	{
 		m_submeshes.reserve(m_graphicalMesh->GetSubMeshCount());
 		for (std::size_t i = 0; i < m_graphicalMesh->GetSubMeshCount(); ++i)
@@ -32,10 +35,12 @@ namespace Nz
 		m_onInvalidated.Connect(m_graphicalMesh->OnInvalidated, [this](GraphicalMesh*)
 		{
 			UpdateAABB(m_graphicalMesh->GetAABB());
+			UpdateLods();
 			OnElementInvalidated(this);
 		});
 
 		UpdateAABB(m_graphicalMesh->GetAABB());
+		UpdateLods();
 	}
 
 	void Model::BuildElement(ElementRendererRegistry& registry, const ElementData& elementData, std::size_t passIndex, std::vector<RenderElementOwner>& elements) const
@@ -50,14 +55,23 @@ namespace Nz
 
 			MaterialPassFlags passFlags = submeshData.material->GetPassFlags(passIndex);
 
-			const auto& indexBuffer = m_graphicalMesh->GetIndexBuffer(i);
 			const auto& vertexBuffer = m_graphicalMesh->GetVertexBuffer(i);
 			const auto& renderPipeline = materialPipeline->GetRenderPipeline(submeshData.vertexBufferData.data(), submeshData.vertexBufferData.size());
 
+			const std::shared_ptr<RenderBuffer>* indexBuffer = &m_graphicalMesh->GetIndexBuffer(i);
 			std::size_t indexCount = m_graphicalMesh->GetIndexCount(i);
 			IndexType indexType = m_graphicalMesh->GetIndexType(i);
 
-			elements.emplace_back(registry.AllocateElement<RenderSubmesh>(GetRenderLayer(), submeshData.material, passFlags, renderPipeline, *elementData.worldInstance, elementData.skeletonInstance, indexCount, indexType, indexBuffer, vertexBuffer, *elementData.scissorBox));
+			// Submeshes may have less levels of detail than the model
+			const auto& lods = m_graphicalMesh->GetLods(i);
+			if (std::size_t lodIndex = std::min(elementData.lodIndex, lods.size()); lodIndex > 0)
+			{
+				const GraphicalMesh::Lod& lod = lods[lodIndex - 1];
+				indexBuffer = &lod.indexBuffer;
+				indexCount = lod.indexCount;
+			}
+
+			elements.emplace_back(registry.AllocateElement<RenderSubmesh>(GetRenderLayer(), submeshData.material, passFlags, renderPipeline, *elementData.worldInstance, elementData.skeletonInstance, indexCount, indexType, *indexBuffer, vertexBuffer, *elementData.scissorBox));
 		}
 	}
 
@@ -94,4 +108,48 @@ namespace Nz
 	{
 		return m_graphicalMesh->GetVertexBuffer(subMeshIndex);
 	}
+
+	/*!
+	* \brief Sets the maximum geometric error allowed when selecting a level of detail
+	*
+	* Levels of detail are used as long as their error, once projected, doesn't exceed this value.
+	*
+	* \param maxScreenError Maximum error relative to the viewport height (0.001 is about one pixel on a 1080p viewport)
+	*/
+	void Model::SetLodMaxScreenError(float maxScreenError)
+	{
+		m_lodMaxScreenError = maxScreenError;
+		UpdateLods();
+	}
+
+	void Model::UpdateLods()
+	{
+		std::size_t lodCount = 0;
+		for (std::size_t i = 0; i < m_graphicalMesh->GetSubMeshCount(); ++i)
+			lodCount = std::max(lodCount, m_graphicalMesh->GetLods(i).size());
+
+		// A level of detail is used when its error, projected on screen, is below the max screen error
+		// With s the screen size of the bounding sphere of radius r, an error e is projected as e * s / (2r)
+		float diameter = 2.f * GetAABB().GetRadius();
+
+		std::vector<float> lodScreenSizes(lodCount);
+		for (std::size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+		{
+			float error = 0.f;
+			for (std::size_t i = 0; i < m_graphicalMesh->GetSubMeshCount(); ++i)
+			{
+				const auto& lods = m_graphicalMesh->GetLods(i);
+				if (!lods.empty())
+					error = std::max(error, lods[std::min(lodIndex, lods.size() - 1)].error);
+			}
+
+			float screenSize = (error > 0.f) ? m_lodMaxScreenError * diameter / error : std::numeric_limits<float>::infinity();
+			if (lodIndex > 0)
+				screenSize = std::min(screenSize, lodScreenSizes[lodIndex - 1]);
+
+			lodScreenSizes[lodIndex] = screenSize;
+		}
+
+		UpdateLodScreenSizes(std::move(lodScreenSizes));
+	}
 }
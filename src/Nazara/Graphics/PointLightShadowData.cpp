@@ -58,6 +58,8 @@ namespace Nz
 				viewerInstance.UpdateViewMatrix(Matrix4f::TransformInverse(m_light.GetPosition(), s_dirRotations[i]));
 
 				m_pipeline.QueueTransfer(&viewerInstance);
+
+				direction.shadowmapCache.isValid = false;
 			}
 		});
 
@@ -90,19 +92,17 @@ namespace Nz
 		});
 	}
 
-	void PointLightShadowData::PrepareRendering(RenderFrame& renderFrame)
+	void PointLightShadowData::InvalidateShadowmaps()
 	{
 		for (DirectionData& direction : m_directions)
-		{
-			const Matrix4f& viewProjMatrix = direction.viewer.GetViewerInstance().GetViewProjMatrix();
-
-			Frustumf frustum = Frustumf::Extract(viewProjMatrix);
-
-			std::size_t visibilityHash = 5U;
-			const auto& visibleRenderables = m_pipeline.FrustumCull(frustum, 0xFFFFFFFF, visibilityHash);
+			direction.shadowmapCache.isValid = false;
+	}
 
-			direction.depthPass->Prepare(renderFrame, frustum, visibleRenderables, visibilityHash);
-		}
+	void PointLightShadowData::PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* /*viewer*/)
+	{
+		// Each face is cached independently, a moving caster usually only affects a few of them
+		for (DirectionData& direction : m_directions)
+			PrepareCachedShadowmap(renderFrame, m_pipeline, *direction.depthPass, direction.viewer, direction.shadowmapCache);
 	}
 
 	void PointLightShadowData::RegisterMaterialInstance(const MaterialInstance& matInstance)
@@ -111,7 +111,7 @@ namespace Nz
 			direction.depthPass->RegisterMaterialInstance(matInstance);
 	}
 
-	void PointLightShadowData::RegisterPassInputs(FramePass& pass)
+	void PointLightShadowData::RegisterPassInputs(FramePass& pass, const AbstractViewer* /*viewer*/)
 	{
 		std::size_t cubeInputIndex = pass.AddInput(m_cubeAttachmentIndex);
 		pass.SetInputLayout(cubeInputIndex, TextureLayout::ColorInput);
@@ -120,7 +120,7 @@ namespace Nz
 			pass.AddInput(direction.attachmentIndex);
 	}
 
-	void PointLightShadowData::RegisterToFrameGraph(FrameGraph& frameGraph)
+	void PointLightShadowData::RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* /*viewer*/)
 	{
 		UInt32 shadowMapSize = m_light.GetShadowMapSize();
 
@@ -131,15 +131,19 @@ namespace Nz
 			shadowMapSize, shadowMapSize,
 		});
 
+		// Faces are kept between frames
+		frameGraph.MarkAttachmentAsPersistent(m_cubeAttachmentIndex);
+
 		for (std::size_t i = 0; i < m_directions.size(); ++i)
 		{
 			DirectionData& direction = m_directions[i];
 			direction.attachmentIndex = frameGraph.AddAttachmentCubeFace(m_cubeAttachmentIndex, static_cast<CubemapFace>(i));
 			direction.depthPass->RegisterToFrameGraph(frameGraph, direction.attachmentIndex);
+			direction.shadowmapCache.isValid = false;
 		}
 	}
 
-	const Texture* PointLightShadowData::RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph) const
+	const Texture* PointLightShadowData::RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* /*viewer*/) const
 	{
 		return bakedGraph.GetAttachmentTexture(m_cubeAttachmentIndex).get();
 	}
@@ -16,13 +16,19 @@ namespace Nz
 		settings.AddValueProperty<Color>("BaseColor", Color::White());
 		settings.AddValueProperty<bool>("AlphaTest", false);
 		settings.AddValueProperty<float>("AlphaTestThreshold", 0.2f);
+		settings.AddValueProperty<bool>("DistanceField", false);
+		settings.AddValueProperty<float>("DistanceFieldEdge", 0.5f);
+		settings.AddValueProperty<float>("DistanceFieldSmoothing", 1.f);
 		settings.AddTextureProperty("BaseColorMap", ImageType::E2D);
 		settings.AddTextureProperty("AlphaMap", ImageType::E2D);
 		settings.AddPropertyHandler(std::make_unique<OptionValuePropertyHandler>("AlphaTest", "AlphaTest"));
+		settings.AddPropertyHandler(std::make_unique<OptionValuePropertyHandler>("DistanceField", "DistanceField"));
 		settings.AddPropertyHandler(std::make_unique<TexturePropertyHandler>("BaseColorMap", "HasBaseColorTexture"));
 		settings.AddPropertyHandler(std::make_unique<TexturePropertyHandler>("AlphaMap", "HasAlphaTexture"));
 		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("BaseColor"));
 		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("AlphaTestThreshold"));
+		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("DistanceFieldEdge"));
+		settings.AddPropertyHandler(std::make_unique<UniformValuePropertyHandler>("DistanceFieldSmoothing"));
 	}
 
 	void PredefinedMaterials::AddPbrSettings(MaterialSettings& settings)
@@ -22,6 +22,7 @@ namespace Nz
 		lightData.lightMemberOffsets.parameter3 = lightStruct.AddField(nzsl::StructFieldType::Float4);
 		lightData.lightMemberOffsets.shadowMapSize = lightStruct.AddField(nzsl::StructFieldType::Float2);
 		lightData.lightMemberOffsets.viewProjMatrix = lightStruct.AddMatrix(nzsl::StructFieldType::Float1, 4, 4, true);
+		lightData.lightMemberOffsets.cascadeViewProjMatrices = lightStruct.AddMatrixArray(nzsl::StructFieldType::Float1, 4, 4, true, MaxCascadeCount);
 
 		lightData.lightSize = lightStruct.GetAlignedSize();
 
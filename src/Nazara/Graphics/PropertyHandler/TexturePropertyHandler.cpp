@@ -28,17 +28,43 @@ namespace Nz
 		const auto& textureProperty = settings.GetTextureProperty(propertyIndex);
 
 		m_textureIndex = material.FindTextureByTag(m_samplerTag);
-		if (m_textureIndex == Material::InvalidIndex)
-			return;
+		if (m_textureIndex != Material::InvalidIndex)
+		{
+			const auto& textureData = material.GetTextureData(m_textureIndex);
+			if (textureProperty.type != textureData.imageType)
+			{
+				// TODO: Use EnumToString to show image type as string
+				NazaraError("unmatching texture type: material property is of type {0} but shader sampler is of type {1}", UnderlyingCast(textureProperty.type), UnderlyingCast(textureData.imageType));
+				return;
+			}
+		}
 
-		const auto& textureData = material.GetTextureData(m_textureIndex);
-		if (textureProperty.type != textureData.imageType)
+		// Bindless textures are referenced by their index in the texture table, stored in the material settings
+		m_bindlessIndexBlockIndex = Material::InvalidIndex;
+		if (material.GetBindlessTextureSet() != Material::InvalidBindingIndex && textureProperty.type == ImageType::E2D)
 		{
-			// TODO: Use EnumToString to show image type as string
-			NazaraError("unmatching texture type: material property is of type {0} but shader sampler is of type {1}", UnderlyingCast(textureProperty.type), UnderlyingCast(textureData.imageType));
-			return;
+			std::size_t blockIndex = material.FindUniformBlockByTag("Settings");
+			if (blockIndex != Material::InvalidIndex)
+			{
+				const ShaderReflection::StructData* structData = reflection.GetStructByIndex(material.GetUniformBlockData(blockIndex).structIndex);
+				NazaraAssert(structData, "invalid struct index");
+
+				if (auto it = structData->members.find(m_samplerTag + "Index"); it != structData->members.end())
+				{
+					if (it->second.size == sizeof(UInt32))
+					{
+						m_bindlessIndexBlockIndex = blockIndex;
+						m_bindlessIndexOffset = it->second.offset;
+					}
+					else
+						NazaraError("bindless texture index {0} must be an u32", m_samplerTag + "Index");
+				}
+			}
 		}
 
+		if (m_textureIndex == Material::InvalidIndex && m_bindlessIndexBlockIndex == Material::InvalidIndex)
+			return;
+
 		m_propertyIndex = propertyIndex;
 
 		m_optionHash = 0;
@@ -62,7 +88,15 @@ namespace Nz
 		const std::shared_ptr<Texture>& texture = materialInstance.GetTextureProperty(m_propertyIndex);
 		const std::shared_ptr<TextureSampler>& sampler = Graphics::Instance()->GetSamplerCache().Get(materialInstance.GetTextureSamplerProperty(m_propertyIndex));
 
-		materialInstance.UpdateTextureBinding(m_textureIndex, texture, sampler);
+		// Shaders using the bindless table don't sample the material texture, keep the default one bound to avoid rebuilding the shader binding
+		if (m_bindlessIndexBlockIndex != Material::InvalidIndex)
+		{
+			UInt32 bindlessIndex = materialInstance.UpdateBindlessTexture(m_propertyIndex, texture, sampler);
+			materialInstance.UpdateUniformBufferData(m_bindlessIndexBlockIndex, m_bindlessIndexOffset, sizeof(UInt32), &bindlessIndex);
+		}
+		else if (m_textureIndex != Material::InvalidIndex)
+			materialInstance.UpdateTextureBinding(m_textureIndex, texture, sampler);
+
 		if (m_optionHash != 0)
 			materialInstance.UpdateOptionValue(m_optionHash, texture != nullptr);
 	}
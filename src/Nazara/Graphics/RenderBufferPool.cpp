@@ -3,16 +3,21 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/RenderBufferPool.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/UploadPool.hpp>
+#include <cstring>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
-	RenderBufferPool::RenderBufferPool(std::shared_ptr<RenderDevice> renderDevice, BufferType bufferType, std::size_t bufferSize, std::size_t bufferPerBlock) :
+	RenderBufferPool::RenderBufferPool(std::shared_ptr<RenderDevice> renderDevice, BufferType bufferType, std::size_t bufferSize, std::size_t bufferPerBlock, BufferUsageFlags bufferUsage) :
 	m_bufferPerBlock(bufferPerBlock),
 	m_bufferSize(bufferSize),
 	m_renderDevice(std::move(renderDevice)),
-	m_bufferType(bufferType)
+	m_bufferType(bufferType),
+	m_bufferUsage(bufferUsage)
 	{
 		m_bufferAlignedSize = m_bufferSize;
 
@@ -49,7 +54,7 @@ namespace Nz
 
 		// Allocate a new block
 		std::size_t blockIndex = m_bufferBlocks.size();
-		m_bufferBlocks.emplace_back(m_renderDevice->InstantiateBuffer(m_bufferType, m_bufferAlignedSize * m_bufferPerBlock, BufferUsage::DeviceLocal));
+		m_bufferBlocks.emplace_back(m_renderDevice->InstantiateBuffer(m_bufferType, m_bufferAlignedSize * m_bufferPerBlock, m_bufferUsage));
 		m_availableEntries.Resize(m_availableEntries.GetSize() + m_bufferPerBlock, true);
 
 		index = blockIndex * m_bufferPerBlock;
@@ -65,5 +70,75 @@ namespace Nz
 		NazaraAssert(!m_availableEntries.Test(index), "index is not a currently active buffer");
 
 		m_availableEntries.Set(index, true);
+		m_pendingUploads.UnboundedReset(index);
+	}
+
+	/*!
+	* \brief Returns a pointer to the data of a buffer which will be uploaded on next Transfer call
+	*
+	* The pointed memory (of GetBufferSize() bytes) keeps its content between calls, only the data that changed has to be written.
+	* It stays valid until the next QueueUpload call.
+	*/
+	void* RenderBufferPool::QueueUpload(std::size_t index)
+	{
+		NazaraAssert(!m_availableEntries.Test(index), "index is not a currently active buffer");
+
+		// Host data is only allocated for pools using batched uploads
+		std::size_t requiredSize = m_bufferBlocks.size() * m_bufferPerBlock * m_bufferAlignedSize;
+		if (m_uploadData.size() < requiredSize)
+			m_uploadData.resize(requiredSize);
+
+		m_pendingUploads.UnboundedSet(index);
+
+		return &m_uploadData[index * m_bufferAlignedSize];
+	}
+
+	/*!
+	* \brief Uploads every queued buffer using a single upload allocation
+	*
+	* Consecutive buffers of a same block are copied using a single copy command.
+	*/
+	void RenderBufferPool::Transfer(RenderFrame& renderFrame, CommandBufferBuilder& builder)
+	{
+		std::size_t pendingCount = m_pendingUploads.Count();
+		if (pendingCount == 0)
+			return;
+
+		auto& allocation = renderFrame.GetUploadPool().Allocate(pendingCount * m_bufferAlignedSize);
+		UInt8* uploadPtr = static_cast<UInt8*>(allocation.mappedPtr);
+
+		UInt64 allocationOffset = 0;
+		std::size_t firstIndex = m_pendingUploads.FindFirst();
+		while (firstIndex != m_pendingUploads.npos)
+		{
+			std::size_t blockIndex = firstIndex / m_bufferPerBlock;
+			std::size_t blockEnd = (blockIndex + 1) * m_bufferPerBlock;
+
+			// Extend the range as long as the next buffer is also queued (and from the same block)
+			std::size_t lastIndex = firstIndex;
+			std::size_t nextIndex = m_pendingUploads.FindNext(firstIndex);
+			while (nextIndex == lastIndex + 1 && nextIndex < blockEnd)
+			{
+				lastIndex = nextIndex;
+				nextIndex = m_pendingUploads.FindNext(nextIndex);
+			}
+
+			UInt64 rangeSize = (lastIndex - firstIndex + 1) * m_bufferAlignedSize;
+			std::memcpy(uploadPtr + allocationOffset, &m_uploadData[firstIndex * m_bufferAlignedSize], rangeSize);
+
+			std::size_t localIndex = firstIndex - blockIndex * m_bufferPerBlock;
+			builder.CopyBuffer(allocation, RenderBufferView(m_bufferBlocks[blockIndex].get()), rangeSize, allocationOffset, localIndex * m_bufferAlignedSize);
+
+			allocationOffset += rangeSize;
+			m_transferStats.copyCount++;
+
+			firstIndex = nextIndex;
+		}
+
+		m_transferStats.transferCount++;
+		m_transferStats.uploadedBufferCount += pendingCount;
+		m_transferStats.uploadedSize += allocationOffset;
+
+		m_pendingUploads.Clear();
 	}
 }
@@ -3,28 +3,37 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/SpotLightShadowData.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/BakedFrameGraph.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Graphics/SpotLight.hpp>
+#include <Nazara/Graphics/ViewerInstance.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	SpotLightShadowData::SpotLightShadowData(FramePipeline& pipeline, ElementRendererRegistry& elementRegistry, const SpotLight& light) :
 	m_pipeline(pipeline),
-	m_light(light)
+	m_light(light),
+	m_shadowMapResolution(light.GetShadowMapSize())
 	{
-		UInt32 shadowMapSize = light.GetShadowMapSize();
 		m_viewer.UpdateRenderMask(0xFFFFFFFF);
-		m_viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(shadowMapSize), SafeCast<int>(shadowMapSize)));
+		m_viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(m_shadowMapResolution), SafeCast<int>(m_shadowMapResolution)));
 
 		ViewerInstance& viewerInstance = m_viewer.GetViewerInstance();
 		viewerInstance.UpdateProjectionMatrix(Matrix4f::Perspective(m_light.GetOuterAngle() * 2.f, 1.f, 0.01f, m_light.GetRadius()));
 
 		m_onLightShadowMapSettingChange.Connect(m_light.OnLightShadowMapSettingChange, [this](Light* /*light*/, PixelFormat /*newPixelFormat*/, UInt32 newSize)
 		{
+			// The frame graph is rebuilt, the resolution will be lowered again next frame if needed
+			m_shadowMapResolution = newSize;
 			m_viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(newSize), SafeCast<int>(newSize)));
 		});
 
@@ -37,6 +46,8 @@ namespace Nz
 			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(m_light.GetPosition(), m_light.GetRotation()));
 
 			m_pipeline.QueueTransfer(&viewerInstance);
+
+			m_shadowmapCache.isValid = false;
 		});
 		viewerInstance.UpdateEyePosition(m_light.GetPosition());
 		viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(m_light.GetPosition(), m_light.GetRotation()));
@@ -51,16 +62,33 @@ namespace Nz
 		});
 	}
 
-	void SpotLightShadowData::PrepareRendering(RenderFrame& renderFrame)
-{
-		const Matrix4f& viewProjMatrix = m_viewer.GetViewerInstance().GetViewProjMatrix();
+	/*!
+	* \brief Remaps the light shadowmap coordinates to the part of the shadowmap shadows are rendered to
+	*/
+	void SpotLightShadowData::FillLightData(void* data, const AbstractViewer* /*viewer*/) const
+	{
+		float resolutionRatio = float(m_shadowMapResolution) / float(m_light.GetShadowMapSize());
+
+		auto lightOffset = PredefinedLightData::GetOffsets();
+		AccessByOffset<Matrix4f&>(data, lightOffset.lightMemberOffsets.viewProjMatrix) = m_light.GetViewProjMatrix() * Matrix4f::Scale(Vector3f(resolutionRatio, resolutionRatio, 1.f));
+	}
 
-		Frustumf frustum = Frustumf::Extract(viewProjMatrix);
+	void SpotLightShadowData::InvalidateShadowmaps()
+	{
+		m_shadowmapCache.isValid = false;
+	}
 
-		std::size_t visibilityHash = 5U;
-		const auto& visibleRenderables = m_pipeline.FrustumCull(frustum, 0xFFFFFFFF, visibilityHash);
+	void SpotLightShadowData::PrepareRendering(RenderFrame& renderFrame, const AbstractViewer* /*viewer*/)
+	{
+		// Shadows are rendered at a resolution depending on how big the light looks from the viewers
+		UInt32 resolution = m_shadowMapResolution;
+		if (!m_viewers.empty())
+			resolution = ComputeShadowMapResolution(m_shadowMapResolution, m_light.GetShadowMapSize(), ComputeProjectedSize());
 
-		m_depthPass->Prepare(renderFrame, frustum, visibleRenderables, visibilityHash);
+		if (resolution != m_shadowMapResolution)
+			UpdateShadowMapResolution(resolution);
+
+		PrepareCachedShadowmap(renderFrame, m_pipeline, *m_depthPass, m_viewer, m_shadowmapCache);
 	}
 
 	void SpotLightShadowData::RegisterMaterialInstance(const MaterialInstance& matInstance)
@@ -68,12 +96,12 @@ namespace Nz
 		m_depthPass->RegisterMaterialInstance(matInstance);
 	}
 
-	void SpotLightShadowData::RegisterPassInputs(FramePass& pass)
+	void SpotLightShadowData::RegisterPassInputs(FramePass& pass, const AbstractViewer* /*viewer*/)
 	{
 		pass.AddInput(m_attachmentIndex);
 	}
 
-	void SpotLightShadowData::RegisterToFrameGraph(FrameGraph& frameGraph)
+	void SpotLightShadowData::RegisterToFrameGraph(FrameGraph& frameGraph, const AbstractViewer* /*viewer*/)
 	{
 		UInt32 shadowMapSize = m_light.GetShadowMapSize();
 
@@ -84,10 +112,20 @@ namespace Nz
 			shadowMapSize, shadowMapSize,
 		});
 
+		// Shadowmap is kept between frames
+		frameGraph.MarkAttachmentAsPersistent(m_attachmentIndex);
+
 		m_depthPass->RegisterToFrameGraph(frameGraph, m_attachmentIndex);
+		m_shadowmapCache.isValid = false;
 	}
 
-	const Nz::Texture* SpotLightShadowData::RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph) const
+	void SpotLightShadowData::RegisterViewer(const AbstractViewer* viewer)
+	{
+		assert(std::find(m_viewers.begin(), m_viewers.end(), viewer) == m_viewers.end());
+		m_viewers.push_back(viewer);
+	}
+
+	const Nz::Texture* SpotLightShadowData::RetrieveLightShadowmap(const BakedFrameGraph& bakedGraph, const AbstractViewer* /*viewer*/) const
 	{
 		return bakedGraph.GetAttachmentTexture(m_attachmentIndex).get();
 	}
@@ -96,4 +134,82 @@ namespace Nz
 	{
 		m_depthPass->UnregisterMaterialInstance(matInstance);
 	}
+
+	void SpotLightShadowData::UnregisterViewer(const AbstractViewer* viewer)
+	{
+		auto it = std::find(m_viewers.begin(), m_viewers.end(), viewer);
+		assert(it != m_viewers.end());
+		m_viewers.erase(it);
+	}
+
+	/*!
+	* \brief Computes the resolution shadows should be rendered at, as a power of two
+	* \return Resolution to render shadows at, between MinShadowMapResolution and maxResolution
+	*
+	* The resolution is only lowered when the light got noticeably smaller, to prevent rendering it again and again when its size is around a threshold.
+	*
+	* \param currentResolution Resolution shadows are currently rendered at
+	* \param maxResolution Light shadowmap size
+	* \param projectedSize Diameter of the light volume on screen, in pixels
+	*/
+	UInt32 SpotLightShadowData::ComputeShadowMapResolution(UInt32 currentResolution, UInt32 maxResolution, float projectedSize)
+	{
+		constexpr float DownscaleThreshold = 1.25f;
+
+		auto RoundToResolution = [&](float size) -> UInt32
+		{
+			if (!(size < float(maxResolution)))
+				return maxResolution;
+
+			return RoundToPow2(static_cast<UInt32>(std::max(std::ceil(size), 1.f)));
+		};
+
+		UInt32 resolution = RoundToResolution(projectedSize);
+		if (resolution < currentResolution)
+			resolution = RoundToResolution(projectedSize * DownscaleThreshold);
+
+		return std::clamp(resolution, std::min(MinShadowMapResolution, maxResolution), maxResolution);
+	}
+
+	float SpotLightShadowData::ComputeProjectedSize() const
+	{
+		const Boxf& aabb = m_light.GetBoundingVolume().aabb;
+		Vector3f center = aabb.GetCenter();
+		float radius = aabb.GetRadius();
+
+		// Same metric as the one used to select renderables level of detail, scaled by the viewport height
+		float projectedSize = 0.f;
+		for (const AbstractViewer* viewer : m_viewers)
+		{
+			const ViewerInstance& viewerInstance = viewer->GetViewerInstance();
+			const Matrix4f& projectionMatrix = viewerInstance.GetProjectionMatrix();
+
+			float screenSize = radius * std::abs(projectionMatrix.m22);
+			if (projectionMatrix.m44 == 0.f) //< perspective
+			{
+				float distance = center.Distance(viewerInstance.GetEyePosition());
+				if (distance <= radius)
+					return std::numeric_limits<float>::infinity(); //< viewer is inside the light volume
+
+				screenSize /= distance;
+			}
+
+			projectedSize = std::max(projectedSize, screenSize * float(viewer->GetViewport().height));
+		}
+
+		return projectedSize;
+	}
+
+	void SpotLightShadowData::UpdateShadowMapResolution(UInt32 resolution)
+	{
+		m_shadowMapResolution = resolution;
+		m_viewer.UpdateViewport(Recti(0, 0, SafeCast<int>(resolution), SafeCast<int>(resolution)));
+
+		// Viewport is part of the depth pass command buffer
+		m_depthPass->InvalidateCommandBuffers();
+		m_shadowmapCache.isValid = false;
+
+		// Shadowmap coordinates sent to shaders changed
+		OnShadowDataInvalidated(this, nullptr);
+	}
 }
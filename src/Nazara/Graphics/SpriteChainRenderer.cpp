@@ -4,6 +4,7 @@
 
 #include <Nazara/Graphics/SpriteChainRenderer.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/RenderSpriteChain.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
@@ -99,9 +100,13 @@ namespace Nz
 
 			if (const WorldInstance* worldInstance = &spriteChain.GetWorldInstance(); m_pendingData.currentWorldInstance != worldInstance)
 			{
-				// TODO: Flushing draw calls on instance binding means we can have e.g. 1000 sprites rendered using a draw call for each one
-				// which is far from being efficient, using some bindless could help (or at least instancing?)
-				FlushDrawData();
+				// Materials reading instance data by instance index only need a new shader binding when the instance buffer changes
+				const Material& material = *m_pendingData.currentMaterialInstance->GetParentMaterial();
+				if (material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) == Material::InvalidBindingIndex || !m_pendingData.currentWorldInstance || m_pendingData.currentWorldInstance->GetInstanceBuffer().GetBuffer() != worldInstance->GetInstanceBuffer().GetBuffer())
+					FlushDrawData();
+				else
+					FlushDrawCall();
+
 				m_pendingData.currentWorldInstance = worldInstance;
 			}
 
@@ -161,15 +166,30 @@ namespace Nz
 					// Engine shader bindings
 					const Material& material = *materialInstance.GetParentMaterial();
 
+					if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer); bindingIndex != Material::InvalidBindingIndex)
+					{
+						RenderBuffer* instanceBuffer = m_pendingData.currentWorldInstance->GetInstanceBuffer().GetBuffer();
+
+						auto& bindingEntry = m_bindingCache.emplace_back();
+						bindingEntry.bindingIndex = bindingIndex;
+						bindingEntry.content = ShaderBinding::StorageBufferBinding{
+							instanceBuffer,
+							0, instanceBuffer->GetSize()
+						};
+					}
+
 					if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataUbo); bindingIndex != Material::InvalidBindingIndex)
 					{
 						const auto& instanceBuffer = m_pendingData.currentWorldInstance->GetInstanceBuffer();
 
+						// The binding is shared by world instances of the same buffer when instance data is indexed, bind the first instance
+						UInt64 instanceOffset = (material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) != Material::InvalidBindingIndex) ? 0 : instanceBuffer.GetOffset();
+
 						auto& bindingEntry = m_bindingCache.emplace_back();
 						bindingEntry.bindingIndex = bindingIndex;
 						bindingEntry.content = ShaderBinding::UniformBufferBinding{
-							instanceBuffer.get(),
-							0, instanceBuffer->GetSize()
+							instanceBuffer.GetBuffer(),
+							instanceOffset, instanceBuffer.GetSize()
 						};
 					}
 
@@ -214,17 +234,27 @@ namespace Nz
 
 				if (!m_pendingData.currentDrawCall)
 				{
+					// Indexed instance data allows the draw to be culled on the GPU, its command is added once the draw call is complete
+					bool indexedInstanceData = (m_pendingData.currentMaterialInstance->GetParentMaterial()->GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) != Material::InvalidBindingIndex);
+
 					data.drawCalls.push_back(SpriteChainRendererData::DrawCall{
 						m_pendingData.currentVertexBuffer,
 						m_pendingData.currentPipeline,
 						m_pendingData.currentShaderBinding,
 						6 * m_pendingData.firstQuadIndex,
 						0,
-						m_pendingData.currentScissorBox
+						m_pendingData.currentScissorBox,
+						renderState.aabb,
+						(indexedInstanceData) ? renderState.indirectDrawTable : nullptr,
+						m_pendingData.currentWorldInstance,
+						0,
+						(indexedInstanceData) ? m_pendingData.currentWorldInstance->GetInstanceIndex() : 0
 					});
 
 					m_pendingData.currentDrawCall = &data.drawCalls.back();
 				}
+				else
+					m_pendingData.currentDrawCall->aabb.ExtendTo(renderState.aabb);
 
 				std::size_t remainingSpace = m_maxVertexBufferSize - (m_pendingData.currentAllocationMemPtr - static_cast<UInt8*>(m_pendingData.currentAllocation->mappedPtr));
 				std::size_t maxQuads = remainingSpace / (4 * stride);
@@ -253,6 +283,13 @@ namespace Nz
 
 		FlushDrawCall();
 
+		for (std::size_t i = oldDrawCallCount; i < data.drawCalls.size(); ++i)
+		{
+			auto& drawCall = data.drawCalls[i];
+			if (drawCall.indirectDrawTable)
+				drawCall.indirectDrawIndex = drawCall.indirectDrawTable->AddIndexedDraw(*drawCall.worldInstance, drawCall.aabb, SafeCast<UInt32>(drawCall.quadCount * 6), SafeCast<UInt32>(drawCall.firstIndex));
+		}
+
 		const RenderSpriteChain* firstSpriteChain = static_cast<const RenderSpriteChain*>(elements[0]);
 		std::size_t drawCallCount = data.drawCalls.size() - oldDrawCallCount;
 		data.drawCallPerElement[firstSpriteChain] = SpriteChainRendererData::DrawCallIndices{ oldDrawCallCount, drawCallCount };
@@ -292,6 +329,20 @@ namespace Nz
 		const ShaderBinding* currentShaderBinding = nullptr;
 		Recti currentScissorBox(-1, -1, -1, -1);
 
+		// Consecutive commands of the same indirect draw table are drawn at once
+		const IndirectDrawTable* pendingIndirectDrawTable = nullptr;
+		std::size_t pendingIndirectDrawCount = 0;
+		std::size_t pendingIndirectDrawIndex = 0;
+
+		auto FlushIndirectDraws = [&]()
+		{
+			if (pendingIndirectDrawCount == 0)
+				return;
+
+			commandBuffer.DrawIndexedIndirect(pendingIndirectDrawTable->GetIndirectBuffer(), pendingIndirectDrawTable->GetCommandOffset(pendingIndirectDrawIndex), SafeCast<UInt32>(pendingIndirectDrawCount), pendingIndirectDrawTable->GetCommandStride());
+			pendingIndirectDrawCount = 0;
+		};
+
 		const RenderSpriteChain* firstSpriteChain = static_cast<const RenderSpriteChain*>(elements[0]);
 		auto it = data.drawCallPerElement.find(firstSpriteChain);
 		assert(it != data.drawCallPerElement.end());
@@ -304,18 +355,24 @@ namespace Nz
 
 			if (currentVertexBuffer != drawData.vertexBuffer)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindVertexBuffer(0, *drawData.vertexBuffer);
 				currentVertexBuffer = drawData.vertexBuffer;
 			}
 
 			if (currentPipeline != drawData.renderPipeline)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindRenderPipeline(*drawData.renderPipeline);
 				currentPipeline = drawData.renderPipeline;
 			}
 
 			if (currentShaderBinding != drawData.shaderBinding)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindRenderShaderBinding(0, *drawData.shaderBinding);
 				currentShaderBinding = drawData.shaderBinding;
 			}
@@ -323,12 +380,34 @@ namespace Nz
 			const Recti& targetScissorBox = (drawData.scissorBox.width >= 0) ? drawData.scissorBox : fullscreenScissorBox;
 			if (currentScissorBox != targetScissorBox)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.SetScissor(targetScissorBox);
 				currentScissorBox = targetScissorBox;
 			}
 
-			commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.quadCount * 6), 1U, SafeCast<UInt32>(drawData.firstIndex));
+			if (drawData.indirectDrawTable)
+			{
+				if (pendingIndirectDrawTable != drawData.indirectDrawTable || pendingIndirectDrawIndex + pendingIndirectDrawCount != drawData.indirectDrawIndex)
+					FlushIndirectDraws();
+
+				if (pendingIndirectDrawCount == 0)
+				{
+					pendingIndirectDrawTable = drawData.indirectDrawTable;
+					pendingIndirectDrawIndex = drawData.indirectDrawIndex;
+				}
+
+				pendingIndirectDrawCount++;
+			}
+			else
+			{
+				FlushIndirectDraws();
+
+				commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.quadCount * 6), 1U, SafeCast<UInt32>(drawData.firstIndex), drawData.firstInstance);
+			}
 		}
+
+		FlushIndirectDraws();
 	}
 
 	void SpriteChainRenderer::Reset(ElementRendererData& rendererData, RenderFrame& currentFrame)
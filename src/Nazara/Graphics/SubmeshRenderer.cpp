@@ -4,6 +4,7 @@
 
 #include <Nazara/Graphics/SubmeshRenderer.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/RenderSubmesh.hpp>
 #include <Nazara/Graphics/SkeletonInstance.hpp>
@@ -56,6 +57,7 @@ namespace Nz
 
 		const auto& depthTexture2D = Graphics::Instance()->GetDefaultTextures().depthTextures[ImageType::E2D];
 		const auto& depthTextureCube = Graphics::Instance()->GetDefaultTextures().depthTextures[ImageType::Cubemap];
+		const auto& depthTexture2DArray = Graphics::Instance()->GetDefaultTextures().depthTextures[ImageType::E2D_Array];
 		const auto& whiteTexture2D = Graphics::Instance()->GetDefaultTextures().whiteTextures[ImageType::E2D];
 		const auto& defaultSampler = graphics->GetSamplerCache().Get({});
 
@@ -103,9 +105,11 @@ namespace Nz
 
 			if (const WorldInstance* worldInstance = &submesh.GetWorldInstance(); currentWorldInstance != worldInstance)
 			{
-				// TODO: Flushing draw calls on instance binding means we can have e.g. 1000 sprites rendered using a draw call for each one
-				// which is far from being efficient, using some bindless could help (or at least instancing?)
-				FlushDrawData();
+				// Materials reading instance data by instance index only need a new shader binding when the instance buffer changes
+				const Material& material = *currentMaterialInstance->GetParentMaterial();
+				if (material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) == Material::InvalidBindingIndex || !currentWorldInstance || currentWorldInstance->GetInstanceBuffer().GetBuffer() != worldInstance->GetInstanceBuffer().GetBuffer())
+					FlushDrawData();
+
 				currentWorldInstance = worldInstance;
 			}
 
@@ -129,22 +133,38 @@ namespace Nz
 
 				m_bindingCache.clear();
 				m_textureBindingCache.clear();
-				m_textureBindingCache.reserve(renderState.shadowMaps2D.size() + renderState.shadowMapsCube.size());
+				m_textureBindingCache.reserve(renderState.shadowMaps2D.size() + renderState.shadowMapsCube.size() + renderState.shadowMapsDirectional.size());
 				currentMaterialInstance->FillShaderBinding(m_bindingCache);
 
 				const Material& material = *currentMaterialInstance->GetParentMaterial();
 
 				// Predefined shader bindings
+				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer); bindingIndex != Material::InvalidBindingIndex)
+				{
+					assert(currentWorldInstance);
+					RenderBuffer* instanceBuffer = currentWorldInstance->GetInstanceBuffer().GetBuffer();
+
+					auto& bindingEntry = m_bindingCache.emplace_back();
+					bindingEntry.bindingIndex = bindingIndex;
+					bindingEntry.content = ShaderBinding::StorageBufferBinding{
+						instanceBuffer,
+						0, instanceBuffer->GetSize()
+					};
+				}
+
 				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataUbo); bindingIndex != Material::InvalidBindingIndex)
 				{
 					assert(currentWorldInstance);
 					const auto& instanceBuffer = currentWorldInstance->GetInstanceBuffer();
 
+					// The binding is shared by world instances of the same buffer when instance data is indexed, bind the first instance
+					UInt64 instanceOffset = (material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) != Material::InvalidBindingIndex) ? 0 : instanceBuffer.GetOffset();
+
 					auto& bindingEntry = m_bindingCache.emplace_back();
 					bindingEntry.bindingIndex = bindingIndex;
 					bindingEntry.content = ShaderBinding::UniformBufferBinding{
-						instanceBuffer.get(),
-						0, instanceBuffer->GetSize()
+						instanceBuffer.GetBuffer(),
+						instanceOffset, instanceBuffer.GetSize()
 					};
 				}
 
@@ -202,6 +222,28 @@ namespace Nz
 					};
 				}
 
+				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::ShadowmapDirectional); bindingIndex != Material::InvalidBindingIndex)
+				{
+					std::size_t textureBindingBaseIndex = m_textureBindingCache.size();
+
+					for (std::size_t j = 0; j < renderState.shadowMapsDirectional.size(); ++j)
+					{
+						const Texture* texture = renderState.shadowMapsDirectional[j];
+						if (!texture)
+							texture = depthTexture2DArray.get();
+
+						auto& textureEntry = m_textureBindingCache.emplace_back();
+						textureEntry.texture = texture;
+						textureEntry.sampler = shadowSampler.get();
+					}
+
+					auto& bindingEntry = m_bindingCache.emplace_back();
+					bindingEntry.bindingIndex = bindingIndex;
+					bindingEntry.content = ShaderBinding::SampledTextureBindings {
+						SafeCast<UInt32>(renderState.shadowMapsDirectional.size()), &m_textureBindingCache[textureBindingBaseIndex]
+					};
+				}
+
 				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::SkeletalDataUbo); bindingIndex != Material::InvalidBindingIndex && currentSkeletonInstance)
 				{
 					const auto& skeletalBuffer = currentSkeletonInstance->GetSkeletalBuffer();
@@ -244,15 +286,28 @@ namespace Nz
 				data.shaderBindings.emplace_back(std::move(drawDataBinding));
 			}
 
+			const Material& material = *currentMaterialInstance->GetParentMaterial();
+			bool indexedInstanceData = (material.GetEngineBindingIndex(EngineShaderBinding::InstanceDataBuffer) != Material::InvalidBindingIndex);
+
 			auto& drawCall = data.drawCalls.emplace_back();
 			drawCall.firstIndex = 0;
+			drawCall.firstInstance = (indexedInstanceData) ? currentWorldInstance->GetInstanceIndex() : 0;
 			drawCall.indexBuffer = currentIndexBuffer;
 			drawCall.indexCount = submesh.GetIndexCount();
 			drawCall.indexType = submesh.GetIndexType();
+			drawCall.indirectDrawIndex = 0;
+			drawCall.indirectDrawTable = nullptr;
 			drawCall.renderPipeline = currentPipeline;
 			drawCall.scissorBox = currentScissorBox;
 			drawCall.shaderBinding = currentShaderBinding;
 			drawCall.vertexBuffer = currentVertexBuffer;
+			drawCall.bindlessTextureSet = material.GetBindlessTextureSet();
+
+			if (indexedInstanceData && renderState.indirectDrawTable && currentIndexBuffer)
+			{
+				drawCall.indirectDrawIndex = renderState.indirectDrawTable->AddIndexedDraw(*currentWorldInstance, renderState.aabb, SafeCast<UInt32>(drawCall.indexCount), SafeCast<UInt32>(drawCall.firstIndex));
+				drawCall.indirectDrawTable = renderState.indirectDrawTable;
+			}
 		}
 
 		const RenderSubmesh* firstSubmesh = static_cast<const RenderSubmesh*>(elements[0]);
@@ -273,6 +328,20 @@ namespace Nz
 		const ShaderBinding* currentShaderBinding = nullptr;
 		Recti currentScissorBox(-1, -1, -1, -1);
 
+		// Consecutive commands of the same indirect draw table are drawn at once
+		const IndirectDrawTable* pendingIndirectDrawTable = nullptr;
+		std::size_t pendingIndirectDrawCount = 0;
+		std::size_t pendingIndirectDrawIndex = 0;
+
+		auto FlushIndirectDraws = [&]()
+		{
+			if (pendingIndirectDrawCount == 0)
+				return;
+
+			commandBuffer.DrawIndexedIndirect(pendingIndirectDrawTable->GetIndirectBuffer(), pendingIndirectDrawTable->GetCommandOffset(pendingIndirectDrawIndex), SafeCast<UInt32>(pendingIndirectDrawCount), pendingIndirectDrawTable->GetCommandStride());
+			pendingIndirectDrawCount = 0;
+		};
+
 		const RenderSubmesh* firstSubmesh = static_cast<const RenderSubmesh*>(elements[0]);
 		auto it = data.drawCallPerElement.find(firstSubmesh);
 		assert(it != data.drawCallPerElement.end());
@@ -285,18 +354,33 @@ namespace Nz
 
 			if (currentPipeline != drawData.renderPipeline)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindRenderPipeline(*drawData.renderPipeline);
 				currentPipeline = drawData.renderPipeline;
+
+				// The bindless texture table is shared by all materials and only has to be bound once per pipeline
+				if (drawData.bindlessTextureSet != Material::InvalidBindingIndex)
+				{
+					const BindlessTextureTable* bindlessTextureTable = Graphics::Instance()->GetBindlessTextureTable();
+					assert(bindlessTextureTable);
+
+					commandBuffer.BindRenderShaderBinding(*currentPipeline->GetPipelineInfo().pipelineLayout, drawData.bindlessTextureSet, bindlessTextureTable->GetShaderBinding());
+				}
 			}
 
 			if (currentShaderBinding != drawData.shaderBinding)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindRenderShaderBinding(0, *drawData.shaderBinding);
 				currentShaderBinding = drawData.shaderBinding;
 			}
 
 			if (currentIndexBuffer != drawData.indexBuffer)
 			{
+				FlushIndirectDraws();
+
 				if (drawData.indexBuffer)
 					commandBuffer.BindIndexBuffer(*drawData.indexBuffer, drawData.indexType);
 
@@ -305,6 +389,8 @@ namespace Nz
 
 			if (currentVertexBuffer != drawData.vertexBuffer)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.BindVertexBuffer(0, *drawData.vertexBuffer);
 				currentVertexBuffer = drawData.vertexBuffer;
 			}
@@ -312,15 +398,37 @@ namespace Nz
 			const Recti& targetScissorBox = (drawData.scissorBox.width >= 0) ? drawData.scissorBox : fullscreenScissorBox;
 			if (currentScissorBox != targetScissorBox)
 			{
+				FlushIndirectDraws();
+
 				commandBuffer.SetScissor(targetScissorBox);
 				currentScissorBox = targetScissorBox;
 			}
 
-			if (currentIndexBuffer)
-				commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex));
+			if (drawData.indirectDrawTable)
+			{
+				if (pendingIndirectDrawTable != drawData.indirectDrawTable || pendingIndirectDrawIndex + pendingIndirectDrawCount != drawData.indirectDrawIndex)
+					FlushIndirectDraws();
+
+				if (pendingIndirectDrawCount == 0)
+				{
+					pendingIndirectDrawTable = drawData.indirectDrawTable;
+					pendingIndirectDrawIndex = drawData.indirectDrawIndex;
+				}
+
+				pendingIndirectDrawCount++;
+			}
 			else
-				commandBuffer.Draw(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex));
+			{
+				FlushIndirectDraws();
+
+				if (currentIndexBuffer)
+					commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex), drawData.firstInstance);
+				else
+					commandBuffer.Draw(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex), drawData.firstInstance);
+			}
 		}
+
+		FlushIndirectDraws();
 	}
 
 	void SubmeshRenderer::Reset(ElementRendererData& rendererData, RenderFrame& currentFrame)
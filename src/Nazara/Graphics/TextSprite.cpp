@@ -4,18 +4,23 @@
 
 #include <Nazara/Graphics/TextSprite.hpp>
 #include <Nazara/Graphics/ElementRendererRegistry.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/RenderSpriteChain.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
 #include <Nazara/Utility/AbstractTextDrawer.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	TextSprite::TextSprite(std::shared_ptr<MaterialInstance> material) :
 	InstancedRenderable(),
-	m_material(std::move(material))
+	m_material(std::move(material)),
+	m_drawerRevision(AbstractTextDrawer::UntrackedLayoutRevision),
+	m_scale(1.f),
+	m_textHeight(0.f)
 	{
 		if (!m_material)
 			m_material = MaterialInstance::GetDefault(MaterialType::Basic, MaterialInstancePreset::Transparent);
@@ -37,27 +42,29 @@ namespace Nz
 		};
 		const auto& renderPipeline = materialPipeline->GetRenderPipeline(&vertexBufferData, 1);
 
-		for (auto& pair : m_renderInfos)
+		for (auto&& [key, renderData] : m_renderData)
 		{
-			const RenderKey& key = pair.first;
-			RenderIndices& indices = pair.second;
-
-			if (indices.count > 0)
-				elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer() + key.renderOrder, m_material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, key.texture->shared_from_this(), indices.count, &m_vertices[indices.first * 4], *elementData.scissorBox));
+			if (!renderData.vertices.empty())
+			{
+				// Edge materials only differ by their uniform values and share the pipeline of the text material
+				const auto& material = GetEdgeMaterial(key.distanceFieldEdge);
+				elements.emplace_back(registry.AllocateElement<RenderSpriteChain>(GetRenderLayer() + key.renderOrder, material, passFlags, renderPipeline, *elementData.worldInstance, vertexDeclaration, key.texture->shared_from_this(), renderData.vertices.size() / 4, renderData.vertices.data(), *elementData.scissorBox));
+			}
 		}
 	}
 
 	const std::shared_ptr<MaterialInstance>& TextSprite::GetMaterial(std::size_t i) const
 	{
-		assert(i == 0);
-		NazaraUnused(i);
+		if (i == 0)
+			return m_material;
 
-		return m_material;
+		assert(i - 1 < m_edgeMaterials.size());
+		return m_edgeMaterials[i - 1].material;
 	}
 
 	std::size_t TextSprite::GetMaterialCount() const
 	{
-		return 1;
+		return 1 + m_edgeMaterials.size();
 	}
 
 	void TextSprite::Update(const AbstractTextDrawer& drawer, float scale)
@@ -93,6 +100,24 @@ namespace Nz
 			it->second.used = true;
 		}
 
+		// Default text material has to match the glyphes kind (distance fields or coverage)
+		const auto& defaultMaterials = Graphics::Instance()->GetDefaultMaterials();
+		const auto& coverageMaterial = defaultMaterials.materials[MaterialType::Basic].presets[MaterialInstancePreset::Transparent];
+		if (m_material == coverageMaterial || m_material == defaultMaterials.distanceFieldText)
+		{
+			bool distanceField = (fontCount > 0);
+			for (std::size_t i = 0; i < fontCount; ++i)
+			{
+				if (!drawer.GetFont(i)->IsDistanceFieldEnabled())
+				{
+					distanceField = false;
+					break;
+				}
+			}
+
+			SetMaterial((distanceField) ? defaultMaterials.distanceFieldText : coverageMaterial);
+		}
+
 		// Remove unused atlas slots
 		auto atlasIt = m_atlases.begin();
 		while (atlasIt != m_atlases.end())
@@ -104,77 +129,61 @@ namespace Nz
 		}
 
 		std::size_t glyphCount = drawer.GetGlyphCount();
+		Rectf bounds = drawer.GetBounds();
 
-		// Reset glyph count for every texture to zero
-		for (auto& pair : m_renderInfos)
-			pair.second.count = 0;
+		// Only regenerate vertices of glyphs which changed since last update (when the drawer tracks it)
+		std::size_t firstGlyph = 0;
+		if (m_drawerRevision != AbstractTextDrawer::UntrackedLayoutRevision && scale == m_scale)
+			firstGlyph = std::min(drawer.GetUnchangedGlyphCount(m_drawerRevision), m_glyphVertices.size());
 
-		// Count glyph count for each texture
-		RenderKey lastRenderKey{ nullptr, 0 };
-		unsigned int* count = nullptr;
+		RemoveGlyphVertices(firstGlyph);
 
-		// Iterate over visible (non-space) glyphs
-		std::size_t visibleGlyphCount = 0;
-		for (std::size_t i = 0; i < glyphCount; ++i)
+		// Vertices are flipped using text height, move unchanged glyphs if it changed
+		if (firstGlyph > 0 && bounds.height != m_textHeight)
 		{
-			const AbstractTextDrawer::Glyph& glyph = drawer.GetGlyph(i);
-			if (!glyph.atlas)
-				continue;
-
-			Texture* texture = static_cast<Texture*>(glyph.atlas);
-			RenderKey renderKey{ texture, glyph.renderOrder };
-			if (lastRenderKey != renderKey)
+			float offset = (bounds.height - m_textHeight) * scale;
+			for (auto&& [key, renderData] : m_renderData)
 			{
-				auto it = m_renderInfos.find(renderKey);
-				if (it == m_renderInfos.end())
-					it = m_renderInfos.insert(std::make_pair(renderKey, RenderIndices{ 0U, 0U })).first;
-
-				count = &it->second.count;
-				lastRenderKey = renderKey;
+				for (auto& vertex : renderData.vertices)
+					vertex.position.y += offset;
 			}
-
-			(*count)++;
-			visibleGlyphCount++;
 		}
 
-		m_vertices.resize(visibleGlyphCount * 4);
+		GenerateGlyphVertices(drawer, firstGlyph, glyphCount, bounds.height, scale);
+		UpdateEdgeMaterials();
 
-		// Attributes indices and reinitialize glyph count to zero to use it as a counter in the next loop
-		// This is because the 1st glyph can use texture A, the 2nd glyph can use texture B and the 3th glyph C can use texture A again
-		// so we need a counter to know where to write informations
-		// also remove unused render infos
-		unsigned int index = 0;
-		auto infoIt = m_renderInfos.begin();
-		while (infoIt != m_renderInfos.end())
-		{
-			RenderIndices& indices = infoIt->second;
-			if (indices.count == 0)
-				infoIt = m_renderInfos.erase(infoIt); //< No glyph uses this texture, remove from indices
-			else
-			{
-				indices.first = index;
+		m_drawerRevision = drawer.GetLayoutRevision();
+		m_scale = scale;
+		m_textHeight = bounds.height;
 
-				index += indices.count;
-				indices.count = 0;
-				++infoIt;
-			}
-		}
+		bounds.Scale(scale);
 
-		Rectf bounds = drawer.GetBounds();
+		UpdateAABB(bounds);
+		OnElementInvalidated(this);
+
+		clearOnFail.Reset();
+	}
+
+	void TextSprite::GenerateGlyphVertices(const AbstractTextDrawer& drawer, std::size_t firstGlyph, std::size_t glyphCount, float textHeight, float scale)
+	{
+		m_glyphVertices.resize(glyphCount);
 
-		lastRenderKey = { nullptr, 0 };
-		RenderIndices* indices = nullptr;
-		for (unsigned int i = 0; i < glyphCount; ++i)
+		RenderKey lastRenderKey{ nullptr, 0, 0.5f };
+		RenderData* renderData = nullptr;
+		for (std::size_t i = firstGlyph; i < glyphCount; ++i)
 		{
 			const AbstractTextDrawer::Glyph& glyph = drawer.GetGlyph(i);
 			if (!glyph.atlas)
+			{
+				m_glyphVertices[i].renderData = nullptr;
 				continue;
+			}
 
 			Texture* texture = static_cast<Texture*>(glyph.atlas);
-			RenderKey renderKey{ texture, glyph.renderOrder };
+			RenderKey renderKey{ texture, glyph.renderOrder, glyph.distanceFieldEdge };
 			if (lastRenderKey != renderKey)
 			{
-				indices = &m_renderInfos[renderKey]; //< We changed texture, adjust the pointer
+				renderData = &m_renderData[renderKey]; //< We changed texture, adjust the pointer
 				lastRenderKey = renderKey;
 			}
 
@@ -193,32 +202,114 @@ namespace Nz
 			constexpr RectCorner normalCorners[4] = { RectCorner::LeftTop, RectCorner::RightTop, RectCorner::LeftBottom, RectCorner::RightBottom };
 			constexpr RectCorner flippedCorners[4] = { RectCorner::LeftBottom, RectCorner::LeftTop, RectCorner::RightBottom, RectCorner::RightTop };
 
-			// Glyph are in clockwise order, but the sprite expects them as CCW
-			std::size_t offset = indices->first + indices->count;
-			offset *= 4;
+			m_glyphVertices[i].renderData = renderData;
+			m_glyphVertices[i].firstVertex = renderData->vertices.size();
 
+			// Glyph are in clockwise order, but the sprite expects them as CCW
 			for (std::size_t cornerIndex : { 0, 2, 1, 3 })
 			{
-				// Set the position, color and UV of our vertices
-				// Remember that indices->count is a counter here, not a count value
-				m_vertices[offset].color = glyph.color;
-				m_vertices[offset].position = glyph.corners[cornerIndex];
-				m_vertices[offset].position.y = bounds.height - m_vertices[offset].position.y;
-				m_vertices[offset].position *= scale;
-				m_vertices[offset].uv = uvRect.GetCorner((glyph.flipped) ? flippedCorners[cornerIndex] : normalCorners[cornerIndex]);
-				offset++;
+				auto& vertex = renderData->vertices.emplace_back();
+				vertex.color = glyph.color;
+				vertex.position = glyph.corners[cornerIndex];
+				vertex.position.y = textHeight - vertex.position.y;
+				vertex.position *= scale;
+				vertex.uv = uvRect.GetCorner((glyph.flipped) ? flippedCorners[cornerIndex] : normalCorners[cornerIndex]);
 			}
+		}
 
-			// Increment the counter, go to next glyph
-			indices->count++;
+		// Remove unused render data
+		for (auto it = m_renderData.begin(); it != m_renderData.end();)
+		{
+			if (it->second.vertices.empty())
+				it = m_renderData.erase(it);
+			else
+				++it;
 		}
+	}
 
-		bounds.Scale(scale);
+	void TextSprite::ClearEdgeMaterials()
+	{
+		for (std::size_t i = m_edgeMaterials.size(); i > 0; --i)
+		{
+			OnMaterialInvalidated(this, i, nullptr);
+			m_edgeMaterials.pop_back();
+		}
+	}
 
-		UpdateAABB(bounds);
-		OnElementInvalidated(this);
+	const std::shared_ptr<MaterialInstance>& TextSprite::GetEdgeMaterial(float distanceFieldEdge) const
+	{
+		for (const EdgeMaterial& edgeMaterial : m_edgeMaterials)
+		{
+			if (edgeMaterial.distanceFieldEdge == distanceFieldEdge)
+				return edgeMaterial.material;
+		}
 
-		clearOnFail.Reset();
+		return m_material;
+	}
+
+	void TextSprite::RemoveGlyphVertices(std::size_t firstGlyph)
+	{
+		if (firstGlyph == 0)
+		{
+			m_glyphVertices.clear();
+			m_renderData.clear();
+			return;
+		}
+
+		// Vertices of each render key are stored in glyph order, going backward leaves each of them with the vertices of unchanged glyphs only
+		for (std::size_t i = m_glyphVertices.size(); i > firstGlyph; --i)
+		{
+			const GlyphVertices& glyphVertices = m_glyphVertices[i - 1];
+			if (glyphVertices.renderData)
+				glyphVertices.renderData->vertices.resize(glyphVertices.firstVertex);
+		}
+
+		m_glyphVertices.resize(firstGlyph);
+	}
+
+	void TextSprite::UpdateEdgeMaterials()
+	{
+		// Distance field outlines reuse the glyph distance field with a lower edge value, which is a material value
+		// they are rendered using clones of the text material (made when the outline first appears or when the material changes)
+		bool distanceField = false;
+		if (std::size_t propertyIndex = m_material->FindValueProperty("DistanceField"); propertyIndex != MaterialInstance::InvalidPropertyIndex)
+		{
+			const bool* distanceFieldValue = std::get_if<bool>(&m_material->GetValueProperty(propertyIndex));
+			distanceField = distanceFieldValue && *distanceFieldValue && m_material->FindValueProperty("DistanceFieldEdge") != MaterialInstance::InvalidPropertyIndex;
+		}
+
+		auto IsEdgeUsed = [&](float distanceFieldEdge)
+		{
+			return std::any_of(m_renderData.begin(), m_renderData.end(), [&](const auto& renderDataPair) { return renderDataPair.first.distanceFieldEdge == distanceFieldEdge; });
+		};
+
+		for (std::size_t i = m_edgeMaterials.size(); i > 0; --i)
+		{
+			if (distanceField && IsEdgeUsed(m_edgeMaterials[i - 1].distanceFieldEdge))
+				continue;
+
+			OnMaterialInvalidated(this, i, nullptr);
+			m_edgeMaterials.erase(m_edgeMaterials.begin() + (i - 1));
+		}
+
+		if (!distanceField)
+			return;
+
+		for (auto&& [key, renderData] : m_renderData)
+		{
+			if (key.distanceFieldEdge == 0.5f || GetEdgeMaterial(key.distanceFieldEdge) != m_material)
+				continue;
+
+			std::shared_ptr<MaterialInstance> edgeMaterial = m_material->Clone();
+			edgeMaterial->SetValueProperty("DistanceFieldEdge", key.distanceFieldEdge);
+
+			// Slot has to exist (without material) when signaling it
+			std::size_t materialIndex = 1 + m_edgeMaterials.size();
+			m_edgeMaterials.push_back({ key.distanceFieldEdge, nullptr });
+
+			OnMaterialInvalidated(this, materialIndex, edgeMaterial);
+			m_edgeMaterials.back().material = std::move(edgeMaterial);
+		}
 	}
 
 	/*!
@@ -259,30 +350,26 @@ namespace Nz
 		Vector2ui newSize(newTexture->GetSize());
 		Vector2f scale = Vector2f(oldSize) / Vector2f(newSize);
 
-		// Rebuild new render infos with adjusted texture
-		decltype(m_renderInfos) newRenderInfos;
-
-		for (auto&& [renderKey, indices] : m_renderInfos)
+		// Move render data to the new texture, node extraction keeps the pointers held by glyphs valid
+		std::vector<decltype(m_renderData)::node_type> renderNodes;
+		for (auto it = m_renderData.begin(); it != m_renderData.end();)
 		{
-			if (renderKey.texture != oldTexture)
-			{
-				newRenderInfos.emplace(renderKey, indices);
-				continue;
-			}
+			if (it->first.texture == oldTexture)
+				renderNodes.push_back(m_renderData.extract(it++));
+			else
+				++it;
+		}
 
+		for (auto& renderNode : renderNodes)
+		{
 			// Adjust texture coordinates by size ratio
-			SparsePtr<Vector2f> texCoordPtr(&m_vertices[indices.first].uv, sizeof(VertexStruct_XY_Color_UV));
-			for (unsigned int i = 0; i < indices.count; ++i)
-			{
-				for (unsigned int j = 0; j < 4; ++j)
-					m_vertices[i * 4 + j].uv *= scale;
-			}
+			for (auto& vertex : renderNode.mapped().vertices)
+				vertex.uv *= scale;
 
-			newRenderInfos.emplace(RenderKey{ newTexture, renderKey.renderOrder }, indices);
+			renderNode.key().texture = newTexture;
+			m_renderData.insert(std::move(renderNode));
 		}
 
-		m_renderInfos = std::move(newRenderInfos);
-
 		OnElementInvalidated(this);
 	}
 }
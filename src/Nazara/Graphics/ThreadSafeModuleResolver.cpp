@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/ThreadSafeModuleResolver.hpp>
+#include <mutex>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::ThreadSafeModuleResolver
+	* \brief Filesystem module resolver which can be used by shader compilations running concurrently
+	*
+	* Modules are resolved under a shared lock while registrations take an exclusive one.
+	*/
+
+	void ThreadSafeModuleResolver::RegisterModule(const std::filesystem::path& realPath)
+	{
+		std::unique_lock lock(m_moduleMutex);
+		FilesystemModuleResolver::RegisterModule(realPath);
+	}
+
+	void ThreadSafeModuleResolver::RegisterModule(std::string_view moduleSource)
+	{
+		std::unique_lock lock(m_moduleMutex);
+		FilesystemModuleResolver::RegisterModule(moduleSource);
+	}
+
+	void ThreadSafeModuleResolver::RegisterModule(nzsl::Ast::ModulePtr module)
+	{
+		std::unique_lock lock(m_moduleMutex);
+		FilesystemModuleResolver::RegisterModule(std::move(module));
+	}
+
+	void ThreadSafeModuleResolver::RegisterModuleDirectory(const std::filesystem::path& realPath, bool watchDirectory)
+	{
+		std::unique_lock lock(m_moduleMutex);
+		FilesystemModuleResolver::RegisterModuleDirectory(realPath, watchDirectory);
+	}
+
+	nzsl::Ast::ModulePtr ThreadSafeModuleResolver::Resolve(const std::string& moduleName)
+	{
+		std::shared_lock lock(m_moduleMutex);
+		return FilesystemModuleResolver::Resolve(moduleName);
+	}
+}
@@ -4,16 +4,53 @@
 
 #include <Nazara/Graphics/UberShader.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <NZSL/Ast/ReflectVisitor.hpp>
 #include <NZSL/Ast/SanitizeVisitor.hpp>
+#include <algorithm>
+#include <chrono>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		enum class ManifestValueType : UInt8
+		{
+			Bool = 0,
+			Float = 1,
+			Int32 = 2,
+			UInt32 = 3
+		};
+
+		// Only scalar option values can be saved in manifests
+		template<typename T>
+		constexpr bool IsManifestValue = std::is_same_v<T, bool> || std::is_same_v<T, float> || std::is_same_v<T, Int32> || std::is_same_v<T, UInt32>;
+
+		template<typename T>
+		constexpr ManifestValueType GetManifestValueType()
+		{
+			if constexpr (std::is_same_v<T, bool>)
+				return ManifestValueType::Bool;
+			else if constexpr (std::is_same_v<T, float>)
+				return ManifestValueType::Float;
+			else if constexpr (std::is_same_v<T, Int32>)
+				return ManifestValueType::Int32;
+			else
+			{
+				static_assert(std::is_same_v<T, UInt32>);
+				return ManifestValueType::UInt32;
+			}
+		}
+	}
+
 	UberShader::UberShader(nzsl::ShaderStageTypeFlags shaderStages, std::string moduleName) :
 	UberShader(shaderStages, *Graphics::Instance()->GetShaderModuleResolver(), std::move(moduleName))
 	{
@@ -39,9 +76,10 @@ namespace Nz
 				return;
 			}
 
+			nzsl::Ast::ModulePtr validatedModule;
 			try
 			{
-				m_shaderModule = Validate(*newShaderModule, &m_optionIndexByName);
+				validatedModule = Validate(*newShaderModule, &m_optionIndexByName);
 			}
 			catch (const std::exception& e)
 			{
@@ -49,8 +87,14 @@ namespace Nz
 				return;
 			}
 
-			// Clear cache
-			m_combinations.clear();
+			{
+				std::lock_guard lock(m_mutex);
+				m_shaderModule = std::move(validatedModule);
+
+				// Clear cache (results of pending compilations are discarded)
+				m_combinations.clear();
+				m_pendingCombinations.clear();
+			}
 
 			OnShaderUpdated(this);
 		});
@@ -67,28 +111,376 @@ namespace Nz
 
 	const std::shared_ptr<ShaderModule>& UberShader::Get(const Config& config)
 	{
+		std::unique_lock lock(m_mutex);
+
 		auto it = m_combinations.find(config);
-		if (it == m_combinations.end())
+		if (it != m_combinations.end())
+			return it->second;
+
+		// Wait for an already started compilation instead of compiling the permutation twice
+		std::future<std::shared_ptr<ShaderModule>> pendingCompilation;
+		if (auto pendingIt = m_pendingCombinations.find(config); pendingIt != m_pendingCombinations.end())
+		{
+			pendingCompilation = std::move(pendingIt->second);
+			m_pendingCombinations.erase(pendingIt);
+		}
+
+		lock.unlock();
+
+		std::shared_ptr<ShaderModule> shaderModule;
+		if (pendingCompilation.valid())
+		{
+			try
+			{
+				shaderModule = pendingCompilation.get();
+			}
+			catch (const std::exception& e)
+			{
+				NazaraError("failed to compile shader permutation: {0}", e.what());
+			}
+		}
+
+		// Compile again synchronously on failure, to report errors as usual
+		if (!shaderModule)
+			shaderModule = Compile(config);
+
+		lock.lock();
+
+		// Another thread may have compiled the same permutation in the meantime, keep the first one
+		return m_combinations.emplace(config, std::move(shaderModule)).first->second;
+	}
+
+	/*!
+	* \brief Retrieves a permutation without blocking on its compilation
+	*
+	* Missing permutations are compiled by the task scheduler workers if the render device supports it, a null shader module is returned until the compilation is over.
+	* If the render device doesn't support concurrent shader module creation, this behaves like Get.
+	*/
+	const std::shared_ptr<ShaderModule>& UberShader::GetAsync(const Config& config)
+	{
+		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+
+		{
+			std::lock_guard lock(m_mutex);
+
+			if (auto it = m_combinations.find(config); it != m_combinations.end())
+				return it->second;
+
+			if (renderDevice->GetDeviceInfo().threadSafeShaderCreation)
+			{
+				auto pendingIt = m_pendingCombinations.find(config);
+				if (pendingIt == m_pendingCombinations.end())
+				{
+					auto compilationPromise = std::make_shared<std::promise<std::shared_ptr<ShaderModule>>>();
+					pendingIt = m_pendingCombinations.emplace(config, compilationPromise->get_future()).first;
+
+					// Capture the module by value, a hot-reload may replace it during compilation
+					m_compilationTasks.AddTask([compilationPromise, renderDevice, shaderModule = m_shaderModule, shaderStages = m_shaderStages, states = BuildStates(config)]
+					{
+						try
+						{
+							compilationPromise->set_value(renderDevice->InstantiateShaderModule(shaderStages, *shaderModule, states));
+						}
+						catch (...)
+						{
+							compilationPromise->set_exception(std::current_exception());
+						}
+					});
+				}
+
+				if (pendingIt->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				{
+					static std::shared_ptr<ShaderModule> s_pendingModule;
+					return s_pendingModule;
+				}
+			}
+		}
+
+		return Get(config);
+	}
+
+	/*!
+	* \brief Returns the configs of every compiled permutation
+	*
+	* This can be saved to a manifest (see SaveManifest) to prewarm the same permutations on the next run.
+	*/
+	auto UberShader::GetCompiledConfigs() const -> std::vector<Config>
+	{
+		std::lock_guard lock(m_mutex);
+
+		std::vector<Config> configs;
+		configs.reserve(m_combinations.size());
+		for (auto&& [config, shaderModule] : m_combinations)
+		{
+			if (shaderModule)
+				configs.push_back(config);
+		}
+
+		return configs;
+	}
+
+	/*!
+	* \brief Compiles every missing permutation of a list of configs
+	*
+	* This is meant to be called at loading time with the permutations known to be used (for example from a manifest saved by a previous run, see LoadManifest),
+	* to avoid compiling them on first use. Permutations are compiled on the task scheduler workers if the render device supports it.
+	* This can be called from any thread.
+	*
+	* \remark This only compiles shader modules, use MaterialPipeline::Prewarm to also create the render pipelines using them
+	*/
+	void UberShader::Prewarm(const std::vector<Config>& configs)
+	{
+		std::vector<const Config*> missingConfigs;
+		{
+			std::lock_guard lock(m_mutex);
+			for (const Config& config : configs)
+			{
+				// Pending permutations are already being compiled by GetAsync
+				if (m_combinations.find(config) == m_combinations.end() && m_pendingCombinations.find(config) == m_pendingCombinations.end())
+					missingConfigs.push_back(&config);
+			}
+		}
+
+		if (missingConfigs.empty())
+			return;
+
+		std::vector<std::shared_ptr<ShaderModule>> shaderModules(missingConfigs.size());
+		if (missingConfigs.size() > 1 && Graphics::Instance()->GetRenderDevice()->GetDeviceInfo().threadSafeShaderCreation)
+		{
+			// Prewarm may be called from a loading thread while frames are recorded, use a dedicated task group
+			TaskGroup compilationTasks;
+			for (std::size_t i = 0; i < missingConfigs.size(); ++i)
+			{
+				compilationTasks.AddTask([this, &missingConfigs, &shaderModules, i]
+				{
+					try
+					{
+						shaderModules[i] = Compile(*missingConfigs[i]);
+					}
+					catch (const std::exception& e)
+					{
+						NazaraError("failed to compile shader permutation: {0}", e.what());
+					}
+				});
+			}
+
+			compilationTasks.Wait();
+		}
+		else
+		{
+			for (std::size_t i = 0; i < missingConfigs.size(); ++i)
+				shaderModules[i] = Compile(*missingConfigs[i]);
+		}
+
+		std::lock_guard lock(m_mutex);
+		for (std::size_t i = 0; i < missingConfigs.size(); ++i)
 		{
-			nzsl::ShaderWriter::States states;
-			// TODO: Remove this when arrays are accepted as config values
-			for (const auto& [optionHash, optionValue] : config.optionValues)
+			// Failed permutations will be compiled again on use, reporting the error
+			if (shaderModules[i])
+				m_combinations.emplace(*missingConfigs[i], std::move(shaderModules[i]));
+		}
+	}
+
+	/*!
+	* \brief Reads a list of configs from a manifest written by SaveManifest
+	* \return true if the manifest was successfully read
+	*
+	* \param stream Stream to read the manifest from
+	* \param configs Output configs, appended to the vector
+	*/
+	bool UberShader::LoadManifest(Stream& stream, std::vector<Config>* configs)
+	{
+		NazaraAssert(configs, "invalid configs");
+
+		SerializationContext context;
+		context.stream = &stream;
+
+		UInt32 magic;
+		UInt32 version;
+		if (!Unserialize(context, &magic) || !Unserialize(context, &version))
+		{
+			NazaraError("failed to read manifest header");
+			return false;
+		}
+
+		if (magic != ManifestMagic)
+		{
+			NazaraError("invalid manifest");
+			return false;
+		}
+
+		if (version != ManifestVersion)
+		{
+			NazaraError("unsupported manifest version {0}", version);
+			return false;
+		}
+
+		UInt32 configCount;
+		if (!Unserialize(context, &configCount))
+		{
+			NazaraError("failed to read manifest config count");
+			return false;
+		}
+
+		std::vector<Config> manifestConfigs;
+		for (UInt32 configIndex = 0; configIndex < configCount; ++configIndex)
+		{
+			Config& config = manifestConfigs.emplace_back();
+
+			UInt32 optionCount;
+			if (!Unserialize(context, &optionCount))
+			{
+				NazaraError("failed to read manifest option count");
+				return false;
+			}
+
+			for (UInt32 i = 0; i < optionCount; ++i)
 			{
-				std::uint32_t hash = optionHash;
-				
-				std::visit([&](auto&& arg)
+				UInt32 optionHash;
+				UInt8 valueType;
+				if (!Unserialize(context, &optionHash) || !Unserialize(context, &valueType))
+				{
+					NazaraError("failed to read manifest option");
+					return false;
+				}
+
+				auto ReadValue = [&](auto dummy) -> bool
+				{
+					using T = decltype(dummy);
+
+					T value;
+					if (!Unserialize(context, &value))
+						return false;
+
+					config.optionValues[optionHash] = value;
+					return true;
+				};
+
+				bool succeeded;
+				switch (ManifestValueType(valueType))
+				{
+					case ManifestValueType::Bool:   succeeded = ReadValue(bool{}); break;
+					case ManifestValueType::Float:  succeeded = ReadValue(float{}); break;
+					case ManifestValueType::Int32:  succeeded = ReadValue(Int32{}); break;
+					case ManifestValueType::UInt32: succeeded = ReadValue(UInt32{}); break;
+
+					default:
+						NazaraError("unexpected manifest option value type {0}", valueType);
+						return false;
+				}
+
+				if (!succeeded)
 				{
-					states.optionValues[hash] = arg;
+					NazaraError("failed to read manifest option value");
+					return false;
+				}
+			}
+		}
+
+		configs->insert(configs->end(), std::make_move_iterator(manifestConfigs.begin()), std::make_move_iterator(manifestConfigs.end()));
+		return true;
+	}
+
+	/*!
+	* \brief Writes a list of configs to a manifest, to be read back by LoadManifest
+	* \return true if the manifest was successfully written
+	*
+	* Only scalar option values (bool, f32, i32 and u32) can be saved, configs using other value types are skipped with a warning.
+	*
+	* \param stream Stream to write the manifest to
+	* \param configs Configs to save (usually from GetCompiledConfigs)
+	*/
+	bool UberShader::SaveManifest(Stream& stream, const std::vector<Config>& configs)
+	{
+		auto IsSupported = [](const nzsl::Ast::ConstantSingleValue& value)
+		{
+			return std::visit([](auto&& arg)
+			{
+				return IsManifestValue<std::decay_t<decltype(arg)>>;
+			}, value);
+		};
+
+		std::vector<const Config*> savedConfigs;
+		savedConfigs.reserve(configs.size());
+		for (const Config& config : configs)
+		{
+			if (std::all_of(config.optionValues.begin(), config.optionValues.end(), [&](const auto& pair) { return IsSupported(pair.second); }))
+				savedConfigs.push_back(&config);
+			else
+				NazaraWarning("config has non-scalar option values and will not be saved to the manifest");
+		}
+
+		SerializationContext context;
+		context.stream = &stream;
+
+		if (!Serialize(context, ManifestMagic) || !Serialize(context, ManifestVersion) || !Serialize(context, SafeCast<UInt32>(savedConfigs.size())))
+		{
+			NazaraError("failed to write manifest header");
+			return false;
+		}
+
+		for (const Config* config : savedConfigs)
+		{
+			if (!Serialize(context, SafeCast<UInt32>(config->optionValues.size())))
+			{
+				NazaraError("failed to write manifest option count");
+				return false;
+			}
+
+			for (auto&& [optionHash, optionValue] : config->optionValues)
+			{
+				bool succeeded = std::visit([&, optionHash = optionHash](auto&& arg)
+				{
+					using T = std::decay_t<decltype(arg)>;
+
+					if constexpr (IsManifestValue<T>)
+						return Serialize(context, optionHash) && Serialize(context, UInt8(GetManifestValueType<T>())) && Serialize(context, arg);
+					else
+						return false; //< filtered out above
 				}, optionValue);
+
+				if (!succeeded)
+				{
+					NazaraError("failed to write manifest option");
+					return false;
+				}
 			}
-			states.shaderModuleResolver = Graphics::Instance()->GetShaderModuleResolver();
+		}
 
-			std::shared_ptr<ShaderModule> stage = Graphics::Instance()->GetRenderDevice()->InstantiateShaderModule(m_shaderStages, *m_shaderModule, std::move(states));
+		// Boolean values are written as bits
+		context.FlushBits();
 
-			it = m_combinations.emplace(config, std::move(stage)).first;
+		return true;
+	}
+
+	nzsl::ShaderWriter::States UberShader::BuildStates(const Config& config) const
+	{
+		nzsl::ShaderWriter::States states;
+		// TODO: Remove this when arrays are accepted as config values
+		for (const auto& [optionHash, optionValue] : config.optionValues)
+		{
+			std::uint32_t hash = optionHash;
+
+			std::visit([&](auto&& arg)
+			{
+				states.optionValues[hash] = arg;
+			}, optionValue);
+		}
+		states.shaderModuleResolver = Graphics::Instance()->GetShaderModuleResolver();
+
+		return states;
+	}
+
+	std::shared_ptr<ShaderModule> UberShader::Compile(const Config& config) const
+	{
+		// Keep a reference on the module, a hot-reload may replace it during compilation
+		nzsl::Ast::ModulePtr shaderModule;
+		{
+			std::lock_guard lock(m_mutex);
+			shaderModule = m_shaderModule;
 		}
 
-		return it->second;
+		return Graphics::Instance()->GetRenderDevice()->InstantiateShaderModule(m_shaderStages, *shaderModule, BuildStates(config));
 	}
 
 	nzsl::Ast::ModulePtr UberShader::Validate(const nzsl::Ast::Module& module, std::unordered_map<std::string, Option>* options)
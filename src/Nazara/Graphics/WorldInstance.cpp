@@ -6,10 +6,9 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/MaterialSettings.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
-#include <Nazara/Renderer/CommandBufferBuilder.hpp>
-#include <Nazara/Renderer/RenderFrame.hpp>
-#include <Nazara/Renderer/UploadPool.hpp>
+#include <Nazara/Graphics/RenderBufferPool.hpp>
 #include <NazaraUtils/StackVector.hpp>
+#include <cassert>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -19,23 +18,31 @@ namespace Nz
 	m_worldMatrix(Matrix4f::Identity()),
 	m_dataInvalided(true)
 	{
-		PredefinedInstanceData instanceUboOffsets = PredefinedInstanceData::GetOffsets();
+		m_instanceDataPool = Graphics::Instance()->GetWorldInstanceBufferPool();
+		m_instanceDataBuffer = m_instanceDataPool->Allocate(m_instanceDataIndex);
 
-		m_instanceDataBuffer = Graphics::Instance()->GetRenderDevice()->InstantiateBuffer(BufferType::Uniform, instanceUboOffsets.totalSize, BufferUsage::DeviceLocal | BufferUsage::Dynamic | BufferUsage::Write);
+		// Pool entries are aligned to a multiple of the instance data size, which is also the array stride of the instance data buffer
+		std::size_t instanceDataSize = PredefinedInstanceData::GetOffsets().totalSize;
+		assert(m_instanceDataBuffer.GetOffset() % instanceDataSize == 0);
+		m_instanceIndex = SafeCast<UInt32>(m_instanceDataBuffer.GetOffset() / instanceDataSize);
 	}
 
-	void WorldInstance::OnTransfer(RenderFrame& renderFrame, CommandBufferBuilder& builder)
+	WorldInstance::~WorldInstance()
+	{
+		m_instanceDataPool->Free(m_instanceDataIndex);
+	}
+
+	void WorldInstance::OnTransfer(RenderFrame& /*renderFrame*/, CommandBufferBuilder& /*builder*/)
 	{
 		if (!m_dataInvalided)
 			return;
 
 		PredefinedInstanceData instanceUboOffsets = PredefinedInstanceData::GetOffsets();
 
-		auto& allocation = renderFrame.GetUploadPool().Allocate(m_instanceDataBuffer->GetSize());
-		AccessByOffset<Matrix4f&>(allocation.mappedPtr, instanceUboOffsets.worldMatrixOffset) = m_worldMatrix;
-		AccessByOffset<Matrix4f&>(allocation.mappedPtr, instanceUboOffsets.invWorldMatrixOffset) = m_invWorldMatrix;
-
-		builder.CopyBuffer(allocation, m_instanceDataBuffer.get());
+		// Data is copied to the GPU by the pool, along with other world instances data (see ForwardFramePipeline::Render)
+		void* instanceData = m_instanceDataPool->QueueUpload(m_instanceDataIndex);
+		AccessByOffset<Matrix4f&>(instanceData, instanceUboOffsets.worldMatrixOffset) = m_worldMatrix;
+		AccessByOffset<Matrix4f&>(instanceData, instanceUboOffsets.invWorldMatrixOffset) = m_invWorldMatrix;
 
 		m_dataInvalided = false;
 	}
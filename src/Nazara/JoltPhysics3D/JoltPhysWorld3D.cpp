@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/JoltPhysics3D/JoltPhysWorld3D.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/JoltPhysics3D/JoltCharacter.hpp>
 #include <Nazara/JoltPhysics3D/JoltHelper.hpp>
 #include <Nazara/JoltPhysics3D/JoltPhysics3D.hpp>
@@ -14,6 +15,7 @@
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsStepListener.h>
 #include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/StateRecorder.h>
 #include <Jolt/Physics/Body/BodyActivationListener.h>
 #include <Jolt/Physics/Collision/CastResult.h>
 #include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
@@ -214,6 +216,34 @@ namespace Nz
 				Vector3f m_to;
 				bool m_didHit;
 		};
+
+		void WriteVarUInt(ByteArray& output, UInt64 value)
+		{
+			while (value >= 0x80)
+			{
+				output.PushBack(static_cast<UInt8>(value | 0x80));
+				value >>= 7;
+			}
+
+			output.PushBack(static_cast<UInt8>(value));
+		}
+
+		bool ReadVarUInt(const ByteArray& input, std::size_t& offset, UInt64& value)
+		{
+			value = 0;
+			for (unsigned int shift = 0; shift < 64; shift += 7)
+			{
+				if (offset >= input.GetSize())
+					return false;
+
+				UInt8 byte = input[offset++];
+				value |= UInt64(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					return true;
+			}
+
+			return false;
+		}
 	}
 
 	class JoltPhysWorld3D::BodyActivationListener : public JPH::BodyActivationListener
@@ -265,6 +295,65 @@ namespace Nz
 			JoltPhysWorld3D& m_physWorld;
 	};
 
+	class JoltPhysWorld3D::StateRecorder : public JPH::StateRecorder
+	{
+		public:
+			StateRecorder(ByteArray& output) :
+			m_input(nullptr),
+			m_output(&output),
+			m_offset(0),
+			m_failed(false)
+			{
+			}
+
+			StateRecorder(const ByteArray& input) :
+			m_input(&input),
+			m_output(nullptr),
+			m_offset(0),
+			m_failed(false)
+			{
+			}
+
+			bool IsEOF() const override
+			{
+				return !m_input || m_offset >= m_input->GetSize();
+			}
+
+			bool IsFailed() const override
+			{
+				return m_failed;
+			}
+
+			void ReadBytes(void* outData, std::size_t inNumBytes) override
+			{
+				if (!m_input || m_input->GetSize() - m_offset < inNumBytes)
+				{
+					m_failed = true;
+					return;
+				}
+
+				std::memcpy(outData, m_input->GetConstBuffer() + m_offset, inNumBytes);
+				m_offset += inNumBytes;
+			}
+
+			void WriteBytes(const void* inData, std::size_t inNumBytes) override
+			{
+				if (!m_output)
+				{
+					m_failed = true;
+					return;
+				}
+
+				m_output->Append(inData, inNumBytes);
+			}
+
+		private:
+			const ByteArray* m_input;
+			ByteArray* m_output;
+			std::size_t m_offset;
+			bool m_failed;
+	};
+
 	struct JoltPhysWorld3D::JoltWorld
 	{
 		using BodySet = tsl::ordered_set<JPH::BodyID, std::hash<JPH::BodyID>, std::equal_to<JPH::BodyID>, std::allocator<JPH::BodyID>, std::vector<JPH::BodyID>>;
@@ -441,6 +530,48 @@ namespace Nz
 		}
 	}
 
+	bool JoltPhysWorld3D::RestoreState(const ByteArray& state)
+	{
+		// Make sure pending bodies are part of the physics system, as the state is recorded for registered bodies only
+		RefreshBodies();
+
+		StateRecorder recorder(state);
+
+		Int64 timestepAccumulator;
+		recorder.Read(timestepAccumulator);
+		if (recorder.IsFailed())
+		{
+			NazaraError("failed to restore physics state: state is too short");
+			return false;
+		}
+
+		if (!m_world->physicsSystem.RestoreState(recorder))
+		{
+			NazaraError("failed to restore physics state (was the world modified since the state was saved?)");
+			return false;
+		}
+
+		m_timestepAccumulator = Time::Nanoseconds(timestepAccumulator);
+
+		// Jolt doesn't trigger activation listeners when restoring state
+		RefreshActiveBodies();
+
+		return true;
+	}
+
+	void JoltPhysWorld3D::SaveState(ByteArray& state)
+	{
+		RefreshBodies();
+
+		// Keep the buffer memory to allow saving each tick without reallocating
+		state.Clear(true);
+
+		StateRecorder recorder(state);
+		recorder.Write(m_timestepAccumulator.AsNanoseconds());
+
+		m_world->physicsSystem.SaveState(recorder);
+	}
+
 	void JoltPhysWorld3D::SetGravity(const Vector3f& gravity)
 	{
 		m_world->physicsSystem.SetGravity(ToJolt(gravity));
@@ -478,6 +609,141 @@ namespace Nz
 		}
 	}
 
+	bool JoltPhysWorld3D::ApplyStateDelta(const ByteArray& referenceState, const ByteArray& delta, ByteArray& state)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		// State is written while reference and delta are still read, decode in a temporary buffer when updating a state in place
+		if (&state == &referenceState || &state == &delta)
+		{
+			ByteArray decodedState;
+			if (!ApplyStateDelta(referenceState, delta, decodedState))
+				return false;
+
+			state.Swap(decodedState);
+			return true;
+		}
+
+		std::size_t offset = 0;
+
+		UInt64 stateSize;
+		if (!ReadVarUInt(delta, offset, stateSize))
+		{
+			NazaraError("corrupt state delta: failed to read state size");
+			return false;
+		}
+
+		state.Resize(stateSize);
+
+		std::size_t referenceSize = std::min<std::size_t>(referenceState.GetSize(), stateSize);
+		std::memcpy(state.GetBuffer(), referenceState.GetConstBuffer(), referenceSize);
+		std::memset(state.GetBuffer() + referenceSize, 0, stateSize - referenceSize);
+
+		std::size_t stateOffset = 0;
+		while (offset < delta.GetSize())
+		{
+			UInt64 identicalCount;
+			UInt64 changedCount;
+			if (!ReadVarUInt(delta, offset, identicalCount) || !ReadVarUInt(delta, offset, changedCount))
+			{
+				NazaraError("corrupt state delta: failed to read run");
+				return false;
+			}
+
+			stateOffset += identicalCount;
+			if (stateOffset > stateSize || stateSize - stateOffset < changedCount || delta.GetSize() - offset < changedCount)
+			{
+				NazaraError("corrupt state delta: run is out of bounds");
+				return false;
+			}
+
+			for (std::size_t i = 0; i < changedCount; ++i)
+				state[stateOffset++] ^= delta[offset++];
+		}
+
+		return true;
+	}
+
+	void JoltPhysWorld3D::ComputeStateDelta(const ByteArray& referenceState, const ByteArray& state, ByteArray& delta)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (&delta == &referenceState || &delta == &state)
+		{
+			ByteArray encodedDelta;
+			ComputeStateDelta(referenceState, state, encodedDelta);
+
+			delta.Swap(encodedDelta);
+			return;
+		}
+
+		// The delta is stored as a list of (identical byte count, changed byte count, xored bytes) runs,
+		// consecutive snapshots of a simulation mostly differ by a few bytes per body
+		delta.Clear(true);
+		WriteVarUInt(delta, state.GetSize());
+
+		auto GetReferenceByte = [&](std::size_t i) -> UInt8
+		{
+			return (i < referenceState.GetSize()) ? referenceState[i] : 0;
+		};
+
+		// Short identical runs are cheaper to encode as part of a changed run
+		constexpr std::size_t MinIdenticalRun = 4;
+
+		std::size_t stateSize = state.GetSize();
+		std::size_t i = 0;
+		while (i < stateSize)
+		{
+			std::size_t identicalStart = i;
+			while (i < stateSize && state[i] == GetReferenceByte(i))
+				i++;
+
+			if (i == stateSize)
+				break;
+
+			std::size_t changedStart = i;
+			std::size_t changedEnd = i;
+			while (i < stateSize)
+			{
+				if (state[i] != GetReferenceByte(i))
+					changedEnd = ++i;
+				else if (i - changedEnd < MinIdenticalRun)
+					i++;
+				else
+					break;
+			}
+			i = changedEnd;
+
+			WriteVarUInt(delta, changedStart - identicalStart);
+			WriteVarUInt(delta, changedEnd - changedStart);
+			for (std::size_t j = changedStart; j < changedEnd; ++j)
+				delta.PushBack(state[j] ^ GetReferenceByte(j));
+		}
+	}
+
+	void JoltPhysWorld3D::RefreshActiveBodies()
+	{
+		std::size_t blockCount = (m_world->physicsSystem.GetMaxBodies() - 1) / 64 + 1;
+		for (std::size_t i = 0; i < blockCount; ++i)
+			m_activeBodies[i] = 0;
+
+		JPH::BodyInterface& bodyInterface = m_world->physicsSystem.GetBodyInterfaceNoLock();
+
+		JPH::BodyIDVector bodies;
+		m_world->physicsSystem.GetBodies(bodies);
+		for (const JPH::BodyID& bodyId : bodies)
+		{
+			if (!bodyInterface.IsActive(bodyId))
+				continue;
+
+			UInt32 bodyIndex = bodyId.GetIndex();
+			UInt32 blockIndex = bodyIndex / 64;
+			UInt32 localIndex = bodyIndex % 64;
+
+			m_activeBodies[blockIndex] |= UInt64(1u) << localIndex;
+		}
+	}
+
 	void JoltPhysWorld3D::RegisterBody(const JPH::BodyID& bodyID, bool activate, bool removeFromDeactivationList)
 	{
 		assert(removeFromDeactivationList || !m_world->pendingDeactivations.contains(bodyID));
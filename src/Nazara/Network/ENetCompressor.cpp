@@ -3,9 +3,32 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Network/ENetCompressor.hpp>
+#include <algorithm>
+#include <cstring>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
 	ENetCompressor::~ENetCompressor() = default;
+
+	/*!
+	* \brief Returns a pointer to the input as a single contiguous block, copying buffers to storage only if there's more than one
+	*/
+	const UInt8* ENetCompressor::GatherBuffers(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, std::vector<UInt8>& storage)
+	{
+		if (bufferCount == 1)
+			return static_cast<const UInt8*>(buffers[0].data);
+
+		storage.resize(totalInputSize);
+
+		std::size_t offset = 0;
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::size_t size = std::min(buffers[i].dataLength, totalInputSize - offset);
+			std::memcpy(&storage[offset], buffers[i].data, size);
+			offset += size;
+		}
+
+		return storage.data();
+	}
 }
@@ -13,6 +13,7 @@
 */
 
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
@@ -532,10 +533,20 @@ namespace Nz
 			if (!m_compressor)
 				return false;
 
+			Time startTime = HighPrecisionClock::Now();
 			std::size_t newSize = m_compressor->Decompress(peer, m_receivedData + headerSize, m_receivedDataLength - headerSize, m_packetData[1].data() + headerSize, m_packetData[1].size() - headerSize);
 			if (newSize == 0 || newSize > m_packetData[1].size() - headerSize)
 				return false;
 
+			if (peer)
+			{
+				ENetCompressionStatistics& stats = peer->m_compressionStatistics;
+				stats.decompressionTime += HighPrecisionClock::Now() - startTime;
+				stats.decompressedInputSize += m_receivedDataLength - headerSize;
+				stats.decompressedOutputSize += newSize;
+				stats.decompressedPacketCount++;
+			}
+
 			std::memcpy(m_packetData[1].data(), header, headerSize);
 			m_receivedData = m_packetData[1].data();
 			m_receivedDataLength = headerSize + newSize;
@@ -1055,9 +1066,28 @@ namespace Nz
 				std::size_t compressedSize = 0;
 				if (m_compressor)
 				{
-					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, m_packetSize - sizeof(ENetProtocolHeader), m_packetData[1].data(), m_packetData[1].size());
-					if (compressedSize > 0)
+					std::size_t originalSize = m_packetSize - sizeof(ENetProtocolHeader);
+
+					Time startTime = HighPrecisionClock::Now();
+					compressedSize = m_compressor->Compress(currentPeer, &m_buffers[1], m_bufferCount - 1, originalSize, m_packetData[1].data(), m_packetData[1].size());
+
+					ENetCompressionStatistics& stats = currentPeer->m_compressionStatistics;
+					stats.compressionTime += HighPrecisionClock::Now() - startTime;
+					stats.compressedInputSize += originalSize;
+
+					// Don't bother sending compressed data if it's not smaller
+					if (compressedSize > 0 && compressedSize < originalSize)
+					{
 						m_headerFlags |= ENetProtocolHeaderFlag_Compressed;
+						stats.compressedOutputSize += compressedSize;
+						stats.compressedPacketCount++;
+					}
+					else
+					{
+						compressedSize = 0;
+						stats.compressedOutputSize += originalSize;
+						stats.incompressiblePacketCount++;
+					}
 				}
 
 				if (currentPeer->m_outgoingPeerID < ENetConstants::ENetProtocol_MaximumPeerId)
@@ -0,0 +1,49 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <lz4.h>
+#include <algorithm>
+#include <limits>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetLZ4Compressor
+	* \brief Network class compressing ENet packets using LZ4
+	*
+	* LZ4 is a lot faster than the range coder but compresses small packets less, it's a good fit for hosts sending a lot of large packets.
+	* Both hosts have to use the same compressor.
+	*/
+
+	std::size_t ENetLZ4Compressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (bufferCount == 0 || totalInputSize == 0 || totalInputSize > std::numeric_limits<int>::max())
+			return 0;
+
+		const UInt8* input = GatherBuffers(buffers, bufferCount, totalInputSize, m_inputBuffer);
+
+		int outputCapacity = static_cast<int>(std::min<std::size_t>(maxOutputSize, std::numeric_limits<int>::max()));
+		int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output), static_cast<int>(totalInputSize), outputCapacity, m_acceleration);
+		if (compressedSize <= 0)
+			return 0;
+
+		return static_cast<std::size_t>(compressedSize);
+	}
+
+	std::size_t ENetLZ4Compressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (inputSize == 0 || inputSize > std::numeric_limits<int>::max())
+			return 0;
+
+		int outputCapacity = static_cast<int>(std::min<std::size_t>(maxOutputSize, std::numeric_limits<int>::max()));
+		int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output), static_cast<int>(inputSize), outputCapacity);
+		if (decompressedSize <= 0)
+			return 0;
+
+		return static_cast<std::size_t>(decompressedSize);
+	}
+}
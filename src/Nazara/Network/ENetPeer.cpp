@@ -170,6 +170,7 @@ namespace Nz
 		m_totalPacketLost = 0;
 		m_totalPacketSent = 0;
 		m_totalWaitingData = 0;
+		m_compressionStatistics = ENetCompressionStatistics{};
 
 		m_unsequencedWindow.fill(0);
 
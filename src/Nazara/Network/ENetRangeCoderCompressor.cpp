@@ -0,0 +1,560 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+/*
+	Copyright(c) 2002 - 2016 Lee Salzman
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and / or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions :
+
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		// Adaptation constants tuned aggressively for small packet sizes rather than large file compression
+		constexpr UInt32 RangeCoderTop = 1 << 24;
+		constexpr UInt32 RangeCoderBottom = 1 << 16;
+
+		constexpr UInt16 ContextSymbolDelta = 3;
+		constexpr UInt16 ContextSymbolMinimum = 1;
+		constexpr UInt16 ContextEscapeMinimum = 1;
+
+		constexpr std::size_t SubcontextOrder = 2;
+		constexpr UInt16 SubcontextSymbolDelta = 2;
+		constexpr UInt16 SubcontextEscapeDelta = 5;
+	}
+
+	/*!
+	* \ingroup network
+	* \class Nz::ENetRangeCoderCompressor
+	* \brief Network class implementing the adaptive range coder shipped with ENet
+	*
+	* The output is compatible with ENet's enet_host_compress_with_range_coder, this compressor doesn't need any state shared between packets.
+	*/
+
+	std::size_t ENetRangeCoderCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (bufferCount == 0 || totalInputSize == 0)
+			return 0;
+
+		UInt8* outData = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		UInt32 encodeLow = 0;
+		UInt32 encodeRange = ~UInt32(0);
+
+		auto Encode = [&](UInt32 under, UInt32 count, UInt32 total)
+		{
+			encodeRange /= total;
+			encodeLow += under * encodeRange;
+			encodeRange *= count;
+			for (;;)
+			{
+				if ((encodeLow ^ (encodeLow + encodeRange)) >= RangeCoderTop)
+				{
+					if (encodeRange >= RangeCoderBottom)
+						break;
+
+					encodeRange = (UInt32(0) - encodeLow) & (RangeCoderBottom - 1);
+				}
+
+				if (outData >= outEnd)
+					return false;
+
+				*outData++ = static_cast<UInt8>(encodeLow >> 24);
+				encodeRange <<= 8;
+				encodeLow <<= 8;
+			}
+
+			return true;
+		};
+
+		const UInt8* inData = static_cast<const UInt8*>(buffers->data);
+		const UInt8* inEnd = inData + buffers->dataLength;
+		buffers++;
+		bufferCount--;
+
+		std::size_t nextSymbol = 0;
+		Symbol* root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+
+		for (;;)
+		{
+			if (inData >= inEnd)
+			{
+				if (bufferCount == 0)
+					break;
+
+				inData = static_cast<const UInt8*>(buffers->data);
+				inEnd = inData + buffers->dataLength;
+				buffers++;
+				bufferCount--;
+				continue; //< handle empty buffers
+			}
+
+			UInt8 value = *inData++;
+
+			Symbol* symbol;
+			UInt16 count;
+			UInt16 under;
+			UInt16* parent = &predicted;
+
+			bool encoded = false;
+			for (Symbol* subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				EncodeSymbol(nextSymbol, subcontext, symbol, value, under, count, SubcontextSymbolDelta, 0);
+				*parent = GetSymbolIndex(symbol);
+				parent = &symbol->parent;
+
+				UInt16 total = subcontext->total;
+				if (count > 0)
+				{
+					if (!Encode(subcontext->escapes + under, count, total))
+						return 0;
+				}
+				else
+				{
+					if (subcontext->escapes > 0 && subcontext->escapes < total)
+					{
+						if (!Encode(0, subcontext->escapes, total))
+							return 0;
+					}
+
+					subcontext->escapes += SubcontextEscapeDelta;
+					subcontext->total += SubcontextEscapeDelta;
+				}
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				if (count > 0)
+				{
+					encoded = true;
+					break;
+				}
+			}
+
+			if (!encoded)
+			{
+				EncodeSymbol(nextSymbol, root, symbol, value, under, count, ContextSymbolDelta, ContextSymbolMinimum);
+				*parent = GetSymbolIndex(symbol);
+
+				if (!Encode(root->escapes + under, count, root->total))
+					return 0;
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			if (nextSymbol >= m_symbols.size() - SubcontextOrder)
+			{
+				nextSymbol = 0;
+				root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		// Flush
+		while (encodeLow)
+		{
+			if (outData >= outEnd)
+				return 0;
+
+			*outData++ = static_cast<UInt8>(encodeLow >> 24);
+			encodeLow <<= 8;
+		}
+
+		return static_cast<std::size_t>(outData - output);
+	}
+
+	std::size_t ENetRangeCoderCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (inputSize == 0)
+			return 0;
+
+		const UInt8* inData = input;
+		const UInt8* inEnd = input + inputSize;
+		UInt8* outData = output;
+		UInt8* outEnd = output + maxOutputSize;
+
+		UInt32 decodeLow = 0;
+		UInt32 decodeCode = 0;
+		UInt32 decodeRange = ~UInt32(0);
+
+		auto Read = [&](UInt32 total) -> UInt16
+		{
+			decodeRange /= total;
+			return static_cast<UInt16>((decodeCode - decodeLow) / decodeRange);
+		};
+
+		auto Decode = [&](UInt32 under, UInt32 count)
+		{
+			decodeLow += under * decodeRange;
+			decodeRange *= count;
+			for (;;)
+			{
+				if ((decodeLow ^ (decodeLow + decodeRange)) >= RangeCoderTop)
+				{
+					if (decodeRange >= RangeCoderBottom)
+						break;
+
+					decodeRange = (UInt32(0) - decodeLow) & (RangeCoderBottom - 1);
+				}
+
+				decodeCode <<= 8;
+				if (inData < inEnd)
+					decodeCode |= *inData++;
+
+				decodeRange <<= 8;
+				decodeLow <<= 8;
+			}
+		};
+
+		std::size_t nextSymbol = 0;
+		Symbol* root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+		UInt16 predicted = 0;
+		std::size_t order = 0;
+
+		// Seed
+		for (unsigned int shift = 24; inData < inEnd; shift -= 8)
+		{
+			decodeCode |= UInt32(*inData++) << shift;
+			if (shift == 0)
+				break;
+		}
+
+		for (;;)
+		{
+			Symbol* symbol;
+			UInt8 value = 0;
+			UInt16 bottom;
+			UInt16 count;
+			UInt16 under;
+			UInt16* parent = &predicted;
+
+			Symbol* subcontext;
+			bool decoded = false;
+			for (subcontext = &m_symbols[predicted]; subcontext != root; subcontext = &m_symbols[subcontext->parent])
+			{
+				if (subcontext->escapes <= 0)
+					continue;
+
+				UInt16 total = subcontext->total;
+				if (subcontext->escapes >= total)
+					continue;
+
+				UInt16 code = Read(total);
+				if (code < subcontext->escapes)
+				{
+					Decode(0, subcontext->escapes);
+					continue;
+				}
+
+				code -= subcontext->escapes;
+				if (!TryDecodeSymbol(subcontext, symbol, code, value, under, count, SubcontextSymbolDelta, 0))
+					return 0;
+
+				bottom = GetSymbolIndex(symbol);
+				Decode(subcontext->escapes + under, count);
+
+				subcontext->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || subcontext->total > RangeCoderBottom - 0x100)
+					RescaleContext(subcontext, 0);
+
+				decoded = true;
+				break;
+			}
+
+			if (!decoded)
+			{
+				UInt16 code = Read(root->total);
+				if (code < root->escapes)
+				{
+					// End of stream
+					Decode(0, root->escapes);
+					break;
+				}
+
+				code -= root->escapes;
+				DecodeRootSymbol(nextSymbol, root, symbol, code, value, under, count, ContextSymbolDelta, ContextSymbolMinimum);
+
+				bottom = GetSymbolIndex(symbol);
+				Decode(root->escapes + under, count);
+
+				root->total += ContextSymbolDelta;
+				if (count > 0xFF - 2 * ContextSymbolDelta + ContextSymbolMinimum || root->total > RangeCoderBottom - 0x100)
+					RescaleContext(root, ContextSymbolMinimum);
+			}
+
+			// Update contexts which escaped so they know about the symbol next time
+			for (Symbol* patch = &m_symbols[predicted]; patch != subcontext; patch = &m_symbols[patch->parent])
+			{
+				EncodeSymbol(nextSymbol, patch, symbol, value, under, count, SubcontextSymbolDelta, 0);
+				*parent = GetSymbolIndex(symbol);
+				parent = &symbol->parent;
+
+				if (count <= 0)
+				{
+					patch->escapes += SubcontextEscapeDelta;
+					patch->total += SubcontextEscapeDelta;
+				}
+
+				patch->total += SubcontextSymbolDelta;
+				if (count > 0xFF - 2 * SubcontextSymbolDelta || patch->total > RangeCoderBottom - 0x100)
+					RescaleContext(patch, 0);
+			}
+			*parent = bottom;
+
+			if (outData >= outEnd)
+				return 0;
+
+			*outData++ = value;
+
+			if (order >= SubcontextOrder)
+				predicted = m_symbols[predicted].parent;
+			else
+				order++;
+
+			if (nextSymbol >= m_symbols.size() - SubcontextOrder)
+			{
+				nextSymbol = 0;
+				root = CreateContext(nextSymbol, ContextEscapeMinimum, ContextSymbolMinimum);
+				predicted = 0;
+				order = 0;
+			}
+		}
+
+		return static_cast<std::size_t>(outData - output);
+	}
+
+	auto ENetRangeCoderCompressor::CreateContext(std::size_t& nextSymbol, UInt16 escapes, UInt16 minimum) -> Symbol*
+	{
+		Symbol* context = CreateSymbol(nextSymbol, 0, 0);
+		context->escapes = escapes;
+		context->total = escapes + 256 * minimum;
+		context->symbols = 0;
+
+		return context;
+	}
+
+	auto ENetRangeCoderCompressor::CreateSymbol(std::size_t& nextSymbol, UInt8 value, UInt16 count) -> Symbol*
+	{
+		Symbol& symbol = m_symbols[nextSymbol++];
+		symbol.value = value;
+		symbol.count = static_cast<UInt8>(count);
+		symbol.under = count;
+		symbol.left = 0;
+		symbol.right = 0;
+		symbol.symbols = 0;
+		symbol.escapes = 0;
+		symbol.total = 0;
+		symbol.parent = 0;
+
+		return &symbol;
+	}
+
+	void ENetRangeCoderCompressor::DecodeRootSymbol(std::size_t& nextSymbol, Symbol* context, Symbol*& symbol, UInt16 code, UInt8& value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum)
+	{
+		under = 0;
+		count = minimum;
+
+		if (!context->symbols)
+		{
+			value = static_cast<UInt8>(code / minimum);
+			under = code - code % minimum;
+			symbol = CreateSymbol(nextSymbol, value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+			return;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = under + node->under + (node->value + 1) * minimum;
+			UInt16 before = node->count + minimum;
+			if (code >= after)
+			{
+				under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				value = static_cast<UInt8>(node->value + 1 + (code - after) / minimum);
+				under = code - (code - after) % minimum;
+				symbol = CreateSymbol(nextSymbol, value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				value = static_cast<UInt8>(node->value - 1 - (after - before - code - 1) / minimum);
+				under = code - (after - before - code - 1) % minimum;
+				symbol = CreateSymbol(nextSymbol, value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+			}
+			else
+			{
+				value = node->value;
+				count += node->count;
+				under = after - before;
+				node->under += update;
+				node->count += update;
+				symbol = node;
+			}
+
+			break;
+		}
+	}
+
+	void ENetRangeCoderCompressor::EncodeSymbol(std::size_t& nextSymbol, Symbol* context, Symbol*& symbol, UInt8 value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum)
+	{
+		under = value * minimum;
+		count = minimum;
+
+		if (!context->symbols)
+		{
+			symbol = CreateSymbol(nextSymbol, value, update);
+			context->symbols = static_cast<UInt16>(symbol - context);
+			return;
+		}
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			if (value < node->value)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				symbol = CreateSymbol(nextSymbol, value, update);
+				node->left = static_cast<UInt16>(symbol - node);
+			}
+			else if (value > node->value)
+			{
+				under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				symbol = CreateSymbol(nextSymbol, value, update);
+				node->right = static_cast<UInt16>(symbol - node);
+			}
+			else
+			{
+				count += node->count;
+				under += node->under - node->count;
+				node->under += update;
+				node->count += update;
+				symbol = node;
+			}
+
+			break;
+		}
+	}
+
+	void ENetRangeCoderCompressor::RescaleContext(Symbol* context, UInt16 minimum)
+	{
+		context->total = (context->symbols) ? RescaleSymbol(context + context->symbols) : 0;
+		context->escapes -= context->escapes >> 1;
+		context->total += context->escapes + 256 * minimum;
+	}
+
+	UInt16 ENetRangeCoderCompressor::RescaleSymbol(Symbol* symbol)
+	{
+		UInt16 total = 0;
+		for (;;)
+		{
+			symbol->count -= symbol->count >> 1;
+			symbol->under = symbol->count;
+			if (symbol->left)
+				symbol->under += RescaleSymbol(symbol + symbol->left);
+
+			total += symbol->under;
+			if (!symbol->right)
+				break;
+
+			symbol += symbol->right;
+		}
+
+		return total;
+	}
+
+	bool ENetRangeCoderCompressor::TryDecodeSymbol(Symbol* context, Symbol*& symbol, UInt16 code, UInt8& value, UInt16& under, UInt16& count, UInt16 update, UInt16 minimum)
+	{
+		under = 0;
+		count = minimum;
+
+		if (!context->symbols)
+			return false;
+
+		Symbol* node = context + context->symbols;
+		for (;;)
+		{
+			UInt16 after = under + node->under + (node->value + 1) * minimum;
+			UInt16 before = node->count + minimum;
+			if (code >= after)
+			{
+				under += node->under;
+				if (node->right)
+				{
+					node += node->right;
+					continue;
+				}
+
+				return false;
+			}
+			else if (code < after - before)
+			{
+				node->under += update;
+				if (node->left)
+				{
+					node += node->left;
+					continue;
+				}
+
+				return false;
+			}
+			else
+			{
+				value = node->value;
+				count += node->count;
+				under = after - before;
+				node->under += update;
+				node->count += update;
+				symbol = node;
+				return true;
+			}
+		}
+	}
+}
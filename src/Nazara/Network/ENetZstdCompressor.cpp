@@ -0,0 +1,170 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetZstdCompressor.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <zdict.h>
+#include <zstd.h>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ENetZstdCompressor
+	* \brief Network class compressing ENet packets using zstd, optionally with a pre-trained dictionary
+	*
+	* Game packets are usually too small for a generic compressor to find redundancy, a dictionary trained on captured traffic
+	* (see TrainDictionary) greatly improves the compression ratio. Both hosts have to use the same dictionary.
+	*
+	* Frame headers are kept as small as possible (no content size, no checksum nor dictionary id) as ENet already handles this.
+	*/
+
+	/*!
+	* \brief Constructs a zstd compressor without dictionary
+	*
+	* \param compressionLevel zstd compression level
+	*/
+	ENetZstdCompressor::ENetZstdCompressor(int compressionLevel) :
+	m_compressionDictionary(nullptr),
+	m_decompressionDictionary(nullptr),
+	m_compressionLevel(compressionLevel)
+	{
+		m_compressionContext = ZSTD_createCCtx();
+		m_decompressionContext = ZSTD_createDCtx();
+
+		ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_compressionLevel, m_compressionLevel);
+		ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_contentSizeFlag, 0);
+		ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_checksumFlag, 0);
+		ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_dictIDFlag, 0);
+	}
+
+	/*!
+	* \brief Constructs a zstd compressor using a dictionary
+	*
+	* \param dictionary Dictionary data, typically generated by TrainDictionary
+	* \param dictionarySize Dictionary size in bytes
+	* \param compressionLevel zstd compression level
+	*/
+	ENetZstdCompressor::ENetZstdCompressor(const void* dictionary, std::size_t dictionarySize, int compressionLevel) :
+	ENetZstdCompressor(compressionLevel)
+	{
+		LoadDictionary(dictionary, dictionarySize);
+	}
+
+	ENetZstdCompressor::~ENetZstdCompressor()
+	{
+		ReleaseDictionary();
+
+		ZSTD_freeCCtx(m_compressionContext);
+		ZSTD_freeDCtx(m_decompressionContext);
+	}
+
+	std::size_t ENetZstdCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		if (bufferCount == 0 || totalInputSize == 0)
+			return 0;
+
+		const UInt8* input = GatherBuffers(buffers, bufferCount, totalInputSize, m_inputBuffer);
+
+		std::size_t compressedSize = ZSTD_compress2(m_compressionContext, output, maxOutputSize, input, totalInputSize);
+		if (ZSTD_isError(compressedSize))
+			return 0;
+
+		return compressedSize;
+	}
+
+	std::size_t ENetZstdCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		std::size_t decompressedSize = ZSTD_decompressDCtx(m_decompressionContext, output, maxOutputSize, input, inputSize);
+		if (ZSTD_isError(decompressedSize))
+			return 0;
+
+		return decompressedSize;
+	}
+
+	/*!
+	* \brief Sets the dictionary used for compression and decompression
+	* \return True if the dictionary was successfully loaded
+	*
+	* \param dictionary Dictionary data or nullptr to stop using a dictionary
+	* \param dictionarySize Dictionary size in bytes
+	*
+	* \remark Both hosts must switch dictionaries at the same time, packets compressed with another dictionary can't be decompressed
+	*/
+	bool ENetZstdCompressor::LoadDictionary(const void* dictionary, std::size_t dictionarySize)
+	{
+		ReleaseDictionary();
+
+		if (!dictionary || dictionarySize == 0)
+			return true;
+
+		m_compressionDictionary = ZSTD_createCDict(dictionary, dictionarySize, m_compressionLevel);
+		m_decompressionDictionary = ZSTD_createDDict(dictionary, dictionarySize);
+		if (!m_compressionDictionary || !m_decompressionDictionary)
+		{
+			NazaraError("failed to load zstd dictionary");
+			ReleaseDictionary();
+			return false;
+		}
+
+		ZSTD_CCtx_refCDict(m_compressionContext, m_compressionDictionary);
+		ZSTD_DCtx_refDDict(m_decompressionContext, m_decompressionDictionary);
+
+		return true;
+	}
+
+	void ENetZstdCompressor::ReleaseDictionary()
+	{
+		// Referencing a null dictionary makes contexts go back to no dictionary
+		ZSTD_CCtx_refCDict(m_compressionContext, nullptr);
+		ZSTD_DCtx_refDDict(m_decompressionContext, nullptr);
+
+		if (m_compressionDictionary)
+		{
+			ZSTD_freeCDict(m_compressionDictionary);
+			m_compressionDictionary = nullptr;
+		}
+
+		if (m_decompressionDictionary)
+		{
+			ZSTD_freeDDict(m_decompressionDictionary);
+			m_decompressionDictionary = nullptr;
+		}
+	}
+
+	/*!
+	* \brief Trains a dictionary from a corpus of packets
+	* \return Dictionary data, or an empty vector if training failed
+	*
+	* Samples should be representative of the traffic (for example packets captured from a play session),
+	* a few thousands of them are usually needed to train a useful dictionary.
+	*
+	* \param samples Packet samples to train the dictionary on
+	* \param maxDictionarySize Maximum size of the dictionary in bytes
+	*/
+	std::vector<UInt8> ENetZstdCompressor::TrainDictionary(const std::vector<std::vector<UInt8>>& samples, std::size_t maxDictionarySize)
+	{
+		std::vector<UInt8> sampleBuffer;
+		std::vector<std::size_t> sampleSizes;
+		sampleSizes.reserve(samples.size());
+
+		for (const std::vector<UInt8>& sample : samples)
+		{
+			sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+			sampleSizes.push_back(sample.size());
+		}
+
+		std::vector<UInt8> dictionary(maxDictionarySize);
+		std::size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), sampleBuffer.data(), sampleSizes.data(), static_cast<unsigned int>(sampleSizes.size()));
+		if (ZDICT_isError(dictionarySize))
+		{
+			NazaraError("failed to train zstd dictionary: {0}", ZDICT_getErrorName(dictionarySize));
+			return {};
+		}
+
+		dictionary.resize(dictionarySize);
+		return dictionary;
+	}
+}
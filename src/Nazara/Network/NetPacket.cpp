@@ -4,14 +4,81 @@
 
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Buffers are recycled by size classes (powers of two from 64B to 64KiB), larger buffers are not kept around
+		constexpr std::size_t MinSizeClassLog2 = 6;
+		constexpr std::size_t SizeClassCount = 11;
+		constexpr std::size_t MaxPooledBufferPerClass = 64;
+
+		// Each thread has its own free lists so building and releasing packets never contends with other threads
+		struct BufferPool
+		{
+			std::array<std::vector<std::shared_ptr<ByteArray>>, SizeClassCount> freeBuffers;
+		};
+
+		thread_local BufferPool s_bufferPool;
+
+		std::shared_ptr<ByteArray> AcquireBuffer(std::size_t minCapacity)
+		{
+			std::size_t capacityLog2 = std::max<std::size_t>(IntegralLog2(RoundToPow2(std::max<std::size_t>(minCapacity, 1))), MinSizeClassLog2);
+			std::size_t sizeClass = capacityLog2 - MinSizeClassLog2;
+
+			// Also accept a buffer from the next class up rather than allocating
+			for (std::size_t i = sizeClass; i < std::min(sizeClass + 2, SizeClassCount); ++i)
+			{
+				auto& freeBuffers = s_bufferPool.freeBuffers[i];
+				if (!freeBuffers.empty())
+				{
+					std::shared_ptr<ByteArray> buffer = std::move(freeBuffers.back());
+					freeBuffers.pop_back();
+
+					return buffer;
+				}
+			}
+
+			std::shared_ptr<ByteArray> buffer = std::make_shared<ByteArray>();
+			buffer->Reserve(std::size_t(1) << capacityLog2);
+
+			return buffer;
+		}
+
+		void ReleaseBuffer(std::shared_ptr<ByteArray> buffer)
+		{
+			// Buffer is still referenced by a shared packet, the last one will recycle it
+			if (buffer.use_count() != 1)
+				return;
+
+			std::size_t capacity = buffer->GetCapacity();
+			if (capacity < (std::size_t(1) << MinSizeClassLog2))
+				return;
+
+			std::size_t sizeClass = IntegralLog2(capacity) - MinSizeClassLog2;
+			if (sizeClass >= SizeClassCount)
+				return;
+
+			auto& freeBuffers = s_bufferPool.freeBuffers[sizeClass];
+			if (freeBuffers.size() >= MaxPooledBufferPerClass)
+				return;
+
+			freeBuffers.push_back(std::move(buffer));
+		}
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
 	* \brief Network class that represents a packet
+	*
+	* Packet buffers are recycled through thread-local free lists, and can be shared between packets (see Share).
 	*/
 
 	/*!
@@ -44,16 +111,56 @@ namespace Nz
 		NazaraAssert(m_netCode != 0, "Invalid NetCode");
 
 		std::size_t size = m_buffer->GetSize();
-		if (!EncodeHeader(m_buffer->GetBuffer(), static_cast<UInt32>(size), m_netCode))
+
+		// Shared packets header was already encoded by Share and mustn't be written concurrently
+		if (m_buffer.use_count() == 1)
 		{
-			NazaraError("Failed to encode packet header");
-			return nullptr;
+			if (!EncodeHeader(m_buffer->GetBuffer(), static_cast<UInt32>(size), m_netCode))
+			{
+				NazaraError("Failed to encode packet header");
+				return nullptr;
+			}
 		}
+		else
+			NazaraAssert(IsHeaderUpToDate(), "Shared packet was modified after being shared");
 
 		*newSize = size;
 		return m_buffer->GetBuffer();
 	}
 
+	/*!
+	* \brief Makes a read-only packet referencing the same buffer
+	* \return Packet sharing this packet buffer
+	*
+	* This allows sending the same data to multiple sockets or threads without copying it.
+	* The header is encoded when the first share is made, further shares only add a reference to the buffer.
+	*
+	* \remark The buffer must not be modified while it's shared
+	* \remark Produces a NazaraAssert if internal buffer is invalid
+	* \remark Produces a NazaraAssert if net code is invalid
+	* \remark Produces a NazaraAssert if the packet was modified since it was first shared
+	*/
+	NetPacket NetPacket::Share() const
+	{
+		NazaraAssert(m_buffer, "Invalid buffer");
+		NazaraAssert(m_netCode != 0, "Invalid NetCode");
+
+		// Other shares may be reading the header from other threads, only write it while we're the sole owner
+		if (m_buffer.use_count() == 1)
+			EncodeHeader(m_buffer->GetBuffer(), static_cast<UInt32>(m_buffer->GetSize()), m_netCode);
+		else
+			NazaraAssert(IsHeaderUpToDate(), "Shared packet was modified after being shared");
+
+		NetPacket packet;
+		packet.m_buffer = m_buffer;
+		packet.m_netCode = m_netCode;
+		packet.m_memoryStream.SetBuffer(packet.m_buffer.get(), OpenMode::ReadOnly);
+		packet.m_memoryStream.SetCursorPos(HeaderSize);
+		packet.SetStream(&packet.m_memoryStream);
+
+		return packet;
+	}
+
 	/*!
 	* \brief Decodes the header of the packet
 	* \return true If successful
@@ -110,10 +217,7 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		std::lock_guard<std::recursive_mutex> lock(s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		ReleaseBuffer(std::move(m_buffer));
 	}
 
 	/*!
@@ -130,21 +234,9 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			std::lock_guard<std::recursive_mutex> lock(s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
-
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+		FreeStream(); //< In case it wasn't released yet
 
+		m_buffer = AcquireBuffer(minCapacity);
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -152,6 +244,21 @@ namespace Nz
 		SetStream(&m_memoryStream);
 	}
 
+	/*!
+	* \brief Checks the encoded header matches the packet size and net code
+	* \return true If the header is up to date
+	*/
+
+	bool NetPacket::IsHeaderUpToDate() const
+	{
+		UInt32 packetSize;
+		UInt16 netCode;
+		if (!DecodeHeader(m_buffer->GetConstBuffer(), &packetSize, &netCode))
+			return false;
+
+		return packetSize == m_buffer->GetSize() && netCode == m_netCode;
+	}
+
 	/*!
 	* \brief Initializes the NetPacket class
 	* \return true If initialization is successful
@@ -168,9 +275,8 @@ namespace Nz
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
+		// Only the calling thread free lists can be released, other threads release theirs when exiting
+		for (auto& freeBuffers : s_bufferPool.freeBuffers)
+			freeBuffers.clear();
 	}
-
-	std::recursive_mutex NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
 }
@@ -0,0 +1,225 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ReplicationClient.hpp>
+#include <Nazara/Core/BitWriter.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ReplicationClient
+	* \brief Network class that applies entity snapshots sent by a ReplicationServer
+	*
+	* Snapshots are rebuilt from the baseline they were delta-compressed against, then compared to the previously applied one
+	* so component deserializers are only called for entities and components that actually changed.
+	*
+	* \see ReplicationServer
+	*/
+
+	/*!
+	* \brief Handles a packet received from the server on the replication channel, and acknowledges it
+	* \return false if packet was invalid or could not be decoded
+	*
+	* \param peer Server peer, used to send the acknowledgement
+	* \param packet Received packet
+	*/
+	bool ReplicationClient::HandlePacket(ENetPeer* peer, const NetPacket& packet)
+	{
+		BitReader reader(packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize());
+		if (!DecodeSnapshot(reader, &m_decodedSnapshot))
+			return false;
+
+		UInt32 sequence = m_decodedSnapshot.sequence;
+
+		ApplySnapshot(m_decodedSnapshot);
+
+		ReplicationSnapshot& snapshot = m_history[sequence % ReplicationSnapshot::HistorySize];
+		std::swap(snapshot, m_decodedSnapshot); //< keep the old snapshot memory for the next decoding
+		m_currentSnapshot = &snapshot;
+
+		if (peer)
+		{
+			BitWriter ackWriter;
+			ackWriter.Write(sequence, 32);
+
+			NetPacket ackPacket(1, ackWriter.GetSize());
+			ackPacket.Write(ackWriter.GetData(), ackWriter.GetSize());
+
+			peer->Send(m_channelId, ENetPacketFlag_Unreliable, std::move(ackPacket));
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Registers a replicated component
+	* \return Index of the component, components must be registered in the same order as on the server
+	*
+	* \param deserializer Function reading the component of an entity, it must read exactly the bits written by the server serializer
+	*/
+	std::size_t ReplicationClient::RegisterComponent(Deserializer deserializer)
+	{
+		NazaraAssert(deserializer, "invalid deserializer");
+		NazaraAssert(m_deserializers.size() < ReplicationSnapshot::MaxComponentCount, "too many components");
+
+		m_deserializers.push_back(std::move(deserializer));
+		return m_deserializers.size() - 1;
+	}
+
+	/*!
+	* \brief Destroys every replicated entity and forgets snapshots, for example after reconnecting
+	*/
+	void ReplicationClient::Reset()
+	{
+		if (m_currentSnapshot)
+		{
+			for (auto&& [entityId, state] : m_currentSnapshot->entities)
+				OnEntityDestroyed(this, entityId);
+		}
+
+		for (ReplicationSnapshot& snapshot : m_history)
+		{
+			snapshot.entities.clear();
+			snapshot.sequence = 0;
+		}
+
+		m_currentSnapshot = nullptr;
+	}
+
+	void ReplicationClient::ApplySnapshot(const ReplicationSnapshot& snapshot)
+	{
+		if (m_currentSnapshot)
+		{
+			for (auto&& [entityId, state] : m_currentSnapshot->entities)
+			{
+				if (snapshot.entities.find(entityId) == snapshot.entities.end())
+					OnEntityDestroyed(this, entityId);
+			}
+		}
+
+		for (auto&& [entityId, state] : snapshot.entities)
+		{
+			const ReplicatedEntityState* previousState = nullptr;
+			if (m_currentSnapshot)
+			{
+				if (auto it = m_currentSnapshot->entities.find(entityId); it != m_currentSnapshot->entities.end())
+					previousState = it->second.get();
+			}
+
+			if (previousState == state.get())
+				continue;
+
+			if (!previousState)
+				OnEntityCreated(this, entityId);
+
+			for (std::size_t componentIndex = 0; componentIndex < m_deserializers.size(); ++componentIndex)
+			{
+				const std::shared_ptr<const ReplicatedComponentData>& componentData = state->components[componentIndex];
+				if (previousState && ReplicationSnapshot::IsComponentEqual(previousState->components[componentIndex], componentData))
+					continue;
+
+				if (componentData)
+					DeserializeComponent(entityId, componentIndex, *componentData);
+				else if (previousState && previousState->components[componentIndex])
+					OnComponentRemoved(this, entityId, componentIndex);
+			}
+		}
+	}
+
+	bool ReplicationClient::DecodeSnapshot(BitReader& reader, ReplicationSnapshot* snapshot) const
+	{
+		UInt32 sequence = static_cast<UInt32>(reader.Read(32));
+		UInt64 baselineDistance = reader.ReadVarUInt();
+		if (reader.HasOverflowed())
+			return false;
+
+		// Unreliable sequenced packets shouldn't arrive out of order, but don't go back in time if they do
+		if (m_currentSnapshot && !ReplicationSnapshot::IsSequenceMoreRecent(sequence, m_currentSnapshot->sequence))
+			return false;
+
+		snapshot->sequence = sequence;
+		snapshot->entities.clear();
+
+		if (baselineDistance > 0)
+		{
+			if (baselineDistance >= ReplicationSnapshot::HistorySize)
+				return false;
+
+			UInt32 baselineSequence = sequence - static_cast<UInt32>(baselineDistance);
+			const ReplicationSnapshot& baseline = m_history[baselineSequence % ReplicationSnapshot::HistorySize];
+			if (baseline.sequence != baselineSequence || !m_currentSnapshot)
+			{
+				NazaraWarning("received a snapshot based on an unknown snapshot");
+				return false;
+			}
+
+			snapshot->entities = baseline.entities;
+		}
+
+		UInt64 removedCount = reader.ReadVarUInt();
+		for (UInt64 i = 0; i < removedCount && !reader.HasOverflowed(); ++i)
+			snapshot->entities.erase(static_cast<ReplicatedEntityId>(reader.ReadVarUInt()));
+
+		while (reader.ReadBool())
+		{
+			ReplicatedEntityId entityId = static_cast<ReplicatedEntityId>(reader.ReadVarUInt());
+
+			std::shared_ptr<const ReplicatedEntityState>& entityState = snapshot->entities[entityId];
+
+			std::shared_ptr<ReplicatedEntityState> newState = std::make_shared<ReplicatedEntityState>();
+			if (!ReadEntity(reader, entityState.get(), newState.get()))
+				return false;
+
+			entityState = std::move(newState);
+		}
+
+		return !reader.HasOverflowed();
+	}
+
+	void ReplicationClient::DeserializeComponent(ReplicatedEntityId entityId, std::size_t componentIndex, const ReplicatedComponentData& componentData)
+	{
+		BitReader componentReader(componentData.data.data(), componentData.data.size());
+		m_deserializers[componentIndex](entityId, componentReader);
+
+		if (componentReader.HasOverflowed())
+			NazaraWarning("component #{0} of entity #{1} read more bits than written", componentIndex, entityId);
+	}
+
+	bool ReplicationClient::ReadEntity(BitReader& reader, const ReplicatedEntityState* baselineState, ReplicatedEntityState* state) const
+	{
+		unsigned int maskBitCount = static_cast<unsigned int>(m_deserializers.size());
+
+		if (baselineState && !reader.ReadBool())
+			state->componentMask = baselineState->componentMask;
+		else
+			state->componentMask = static_cast<UInt32>(reader.Read(maskBitCount));
+
+		state->components.resize(m_deserializers.size());
+		for (std::size_t componentIndex = 0; componentIndex < m_deserializers.size(); ++componentIndex)
+		{
+			if ((state->componentMask & (1u << componentIndex)) == 0)
+				continue;
+
+			if (baselineState && baselineState->components[componentIndex] && !reader.ReadBool())
+			{
+				// Unchanged since baseline
+				state->components[componentIndex] = baselineState->components[componentIndex];
+				continue;
+			}
+
+			std::shared_ptr<ReplicatedComponentData> componentData = std::make_shared<ReplicatedComponentData>();
+			if (!ReplicationSnapshot::ReadComponentData(reader, componentData.get()))
+				return false;
+
+			state->components[componentIndex] = std::move(componentData);
+		}
+
+		return !reader.HasOverflowed();
+	}
+}
@@ -0,0 +1,440 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ReplicationServer.hpp>
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup network
+	* \class Nz::ReplicationServer
+	* \brief Network class that replicates entity states to clients using delta-compressed snapshots
+	*
+	* Each tick, every replicated entity is serialized once (using the registered component serializers) and a snapshot is sent to each client over an unreliable sequenced channel.
+	* Snapshots only contain entities that changed since the last snapshot acknowledged by the client (its baseline), and only the components that changed.
+	* Entities are filtered by relevancy (distance to the client viewer) and, when the bandwidth budget of a client is exceeded, are prioritized according to how long they have been waiting.
+	*
+	* Entity identifiers are up to the user (an entt entity or a game-specific identifier for example), they just have to be the same on both sides.
+	*
+	* \see ReplicationClient
+	*/
+
+	void ReplicationServer::AddClient(ENetPeer* peer)
+	{
+		NazaraAssert(peer, "invalid peer");
+		NazaraAssert(m_clients.find(peer) == m_clients.end(), "client was already added");
+
+		std::unique_ptr<ClientData> client = std::make_unique<ClientData>();
+		client->peer = peer;
+
+		m_clients.emplace(peer, std::move(client));
+	}
+
+	/*!
+	* \brief Starts replicating an entity
+	*
+	* \param entityId Identifier of the entity, it must be unique
+	* \param componentMask Replicated components of the entity (bit N being the component index N)
+	* \param position Position used for relevancy
+	* \param priority Replication priority of the entity, an entity with a priority of 2 gets updated twice as often as one with a priority of 1 when bandwidth is limited
+	*/
+	void ReplicationServer::CreateEntity(ReplicatedEntityId entityId, UInt32 componentMask, const Vector3f& position, float priority)
+	{
+		NazaraAssert(m_entities.find(entityId) == m_entities.end(), "entity already exists");
+		NazaraAssert(priority > 0.f, "priority must be positive");
+
+		EntityData& entity = m_entities[entityId];
+		entity.componentMask = componentMask;
+		entity.position = position;
+		entity.priority = priority;
+	}
+
+	void ReplicationServer::DestroyEntity(ReplicatedEntityId entityId)
+	{
+		auto it = m_entities.find(entityId);
+		NazaraAssert(it != m_entities.end(), "entity doesn't exist");
+
+		m_entities.erase(it);
+
+		for (auto&& [peer, client] : m_clients)
+			client->priorityAccumulators.erase(entityId);
+	}
+
+	/*!
+	* \brief Handles a packet received from a client on the replication channel
+	* \return false if packet was invalid
+	*/
+	bool ReplicationServer::HandlePacket(ENetPeer* peer, const NetPacket& packet)
+	{
+		auto it = m_clients.find(peer);
+		if (it == m_clients.end())
+			return false;
+
+		ClientData& client = *it->second;
+
+		BitReader reader(packet.GetConstData() + NetPacket::HeaderSize, packet.GetDataSize());
+		UInt32 ackedSequence = static_cast<UInt32>(reader.Read(32));
+		if (reader.HasOverflowed())
+			return false;
+
+		// Acknowledgements of snapshots not sent yet are invalid
+		if (ReplicationSnapshot::IsSequenceMoreRecent(ackedSequence, m_sequence))
+			return false;
+
+		if (!client.hasAck || ReplicationSnapshot::IsSequenceMoreRecent(ackedSequence, client.lastAckedSequence))
+		{
+			client.lastAckedSequence = ackedSequence;
+			client.hasAck = true;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Registers a replicated component
+	* \return Index of the component, to use in component masks
+	*
+	* \param serializer Function writing the component of an entity, the client must read exactly the same bits
+	*/
+	std::size_t ReplicationServer::RegisterComponent(Serializer serializer)
+	{
+		NazaraAssert(serializer, "invalid serializer");
+		NazaraAssert(m_serializers.size() < ReplicationSnapshot::MaxComponentCount, "too many components");
+		NazaraAssert(m_entities.empty(), "components must be registered before creating entities");
+
+		m_serializers.push_back(std::move(serializer));
+		return m_serializers.size() - 1;
+	}
+
+	void ReplicationServer::RemoveClient(ENetPeer* peer)
+	{
+		NazaraAssert(m_clients.find(peer) != m_clients.end(), "unknown client");
+
+		m_clients.erase(peer);
+	}
+
+	/*!
+	* \brief Sets how many bytes a snapshot sent to a client can use at most
+	*
+	* Entities which don't fit are sent in the next snapshots
+	*/
+	void ReplicationServer::SetClientBandwidthBudget(ENetPeer* peer, std::size_t byteCount)
+	{
+		GetClientData(peer).bandwidthBudget = byteCount;
+	}
+
+	/*!
+	* \brief Sets the point of view of a client, only entities within the radius (or always relevant) are replicated to it
+	*/
+	void ReplicationServer::SetClientViewer(ENetPeer* peer, const Vector3f& position, float radius)
+	{
+		ClientData& client = GetClientData(peer);
+		client.viewerPosition = position;
+		client.viewerRadius = radius;
+	}
+
+	void ReplicationServer::SetEntityAlwaysRelevant(ReplicatedEntityId entityId, bool alwaysRelevant)
+	{
+		GetEntityData(entityId).alwaysRelevant = alwaysRelevant;
+	}
+
+	void ReplicationServer::SetEntityComponents(ReplicatedEntityId entityId, UInt32 componentMask)
+	{
+		GetEntityData(entityId).componentMask = componentMask;
+	}
+
+	void ReplicationServer::SetEntityPosition(ReplicatedEntityId entityId, const Vector3f& position)
+	{
+		GetEntityData(entityId).position = position;
+	}
+
+	void ReplicationServer::SetEntityPriority(ReplicatedEntityId entityId, float priority)
+	{
+		NazaraAssert(priority > 0.f, "priority must be positive");
+		GetEntityData(entityId).priority = priority;
+	}
+
+	/*!
+	* \brief Serializes entities and sends a snapshot to every client
+	*
+	* This should be called at the network tick rate, after entities have been updated
+	*/
+	void ReplicationServer::Tick()
+	{
+		UpdateEntityStates();
+
+		m_sequence++;
+		for (auto&& [peer, client] : m_clients)
+			SendSnapshot(*client);
+	}
+
+	auto ReplicationServer::GetClientData(ENetPeer* peer) -> ClientData&
+	{
+		auto it = m_clients.find(peer);
+		NazaraAssert(it != m_clients.end(), "unknown client");
+
+		return *it->second;
+	}
+
+	auto ReplicationServer::GetEntityData(ReplicatedEntityId entityId) -> EntityData&
+	{
+		auto it = m_entities.find(entityId);
+		NazaraAssert(it != m_entities.end(), "entity doesn't exist");
+
+		return it->second;
+	}
+
+	bool ReplicationServer::IsRelevant(const ClientData& client, const EntityData& entity, float* priorityFactor) const
+	{
+		if (entity.alwaysRelevant || client.viewerRadius == std::numeric_limits<float>::infinity())
+		{
+			*priorityFactor = 1.f;
+			return true;
+		}
+
+		float squaredDistance = client.viewerPosition.SquaredDistance(entity.position);
+		float squaredRadius = client.viewerRadius * client.viewerRadius;
+		if (squaredDistance > squaredRadius)
+			return false;
+
+		// Closer entities get updated up to twice as often
+		*priorityFactor = 2.f - squaredDistance / squaredRadius;
+		return true;
+	}
+
+	void ReplicationServer::SendSnapshot(ClientData& client)
+	{
+		// Snapshots older than the history can no longer be used as a baseline as the client doesn't keep them either
+		const ReplicationSnapshot* baseline = nullptr;
+		if (client.hasAck)
+		{
+			UInt32 distance = m_sequence - client.lastAckedSequence;
+			const ReplicationSnapshot& ackedSnapshot = client.history[client.lastAckedSequence % ReplicationSnapshot::HistorySize];
+			if (distance < ReplicationSnapshot::HistorySize && ackedSnapshot.sequence == client.lastAckedSequence)
+				baseline = &ackedSnapshot;
+		}
+
+		// Snapshot describes what the client will know once it receives it
+		ReplicationSnapshot& snapshot = client.history[m_sequence % ReplicationSnapshot::HistorySize];
+		snapshot.sequence = m_sequence;
+		if (baseline)
+			snapshot.entities = baseline->entities;
+		else
+			snapshot.entities.clear();
+
+		m_snapshotWriter.Clear();
+		m_snapshotWriter.Write(m_sequence, 32);
+		m_snapshotWriter.WriteVarUInt((baseline) ? m_sequence - baseline->sequence : 0);
+
+		// Remove destroyed or no longer relevant entities, as many as the budget allows (keeping one bit for the end marker)
+		// the others stay known by the client in this snapshot and will be removed by the next ones
+		std::size_t bitBudget = client.bandwidthBudget * 8;
+		auto GetVarUIntBitCount = [&](UInt64 value)
+		{
+			m_entityWriter.Clear();
+			m_entityWriter.WriteVarUInt(value);
+			return m_entityWriter.GetBitCount();
+		};
+
+		m_removedEntities.clear();
+		std::size_t removedBitCount = 0;
+		for (auto it = snapshot.entities.begin(); it != snapshot.entities.end();)
+		{
+			float priorityFactor;
+			auto entityIt = m_entities.find(it->first);
+			if (entityIt == m_entities.end() || !IsRelevant(client, entityIt->second, &priorityFactor))
+			{
+				std::size_t entityBitCount = GetVarUIntBitCount(it->first);
+				std::size_t countBitCount = GetVarUIntBitCount(m_removedEntities.size() + 1);
+				if (m_snapshotWriter.GetBitCount() + countBitCount + removedBitCount + entityBitCount + 1 <= bitBudget)
+				{
+					m_removedEntities.push_back(it->first);
+					removedBitCount += entityBitCount;
+
+					it = snapshot.entities.erase(it);
+					continue;
+				}
+			}
+
+			++it;
+		}
+
+		m_snapshotWriter.WriteVarUInt(m_removedEntities.size());
+		for (ReplicatedEntityId entityId : m_removedEntities)
+			m_snapshotWriter.WriteVarUInt(entityId);
+
+		// Gather entities whose state differs from what the client knows
+		m_pendingEntities.clear();
+		for (auto&& [entityId, entity] : m_entities)
+		{
+			float priorityFactor;
+			if (!IsRelevant(client, entity, &priorityFactor))
+			{
+				client.priorityAccumulators.erase(entityId);
+				continue;
+			}
+
+			auto it = snapshot.entities.find(entityId);
+			if (it != snapshot.entities.end() && it->second == entity.state)
+			{
+				client.priorityAccumulators.erase(entityId);
+				continue;
+			}
+
+			float& accumulator = client.priorityAccumulators[entityId];
+			accumulator += entity.priority * priorityFactor;
+
+			m_pendingEntities.push_back({ entityId, accumulator });
+		}
+
+		std::sort(m_pendingEntities.begin(), m_pendingEntities.end(), [](const PendingEntity& lhs, const PendingEntity& rhs)
+		{
+			return lhs.priority > rhs.priority;
+		});
+
+		// Write as many entities as the remaining budget allows
+		for (const PendingEntity& pendingEntity : m_pendingEntities)
+		{
+			const EntityData& entity = m_entities.find(pendingEntity.entityId)->second;
+
+			const ReplicatedEntityState* baselineState = nullptr;
+			if (auto it = snapshot.entities.find(pendingEntity.entityId); it != snapshot.entities.end())
+				baselineState = it->second.get();
+
+			m_entityWriter.Clear();
+			m_entityWriter.WriteBool(true);
+			m_entityWriter.WriteVarUInt(pendingEntity.entityId);
+			WriteEntity(m_entityWriter, baselineState, *entity.state);
+
+			if (m_snapshotWriter.GetBitCount() + m_entityWriter.GetBitCount() + 1 > bitBudget)
+				continue; //< a smaller entity may still fit
+
+			AppendBits(m_snapshotWriter, m_entityWriter);
+
+			snapshot.entities[pendingEntity.entityId] = entity.state;
+			client.priorityAccumulators.erase(pendingEntity.entityId);
+		}
+		m_snapshotWriter.WriteBool(false);
+
+		NetPacket packet(1, m_snapshotWriter.GetSize());
+		packet.Write(m_snapshotWriter.GetData(), m_snapshotWriter.GetSize());
+
+		client.peer->Send(m_channelId, ENetPacketFlag_UnreliableFragment, std::move(packet));
+	}
+
+	void ReplicationServer::UpdateEntityStates()
+	{
+		for (auto&& [entityId, entity] : m_entities)
+		{
+			const ReplicatedEntityState* previousState = entity.state.get();
+
+			std::shared_ptr<ReplicatedEntityState> newState;
+			auto GetNewState = [&]() -> ReplicatedEntityState&
+			{
+				if (!newState)
+				{
+					newState = std::make_shared<ReplicatedEntityState>();
+					newState->componentMask = entity.componentMask;
+					if (previousState)
+						newState->components = previousState->components;
+
+					newState->components.resize(m_serializers.size());
+				}
+
+				return *newState;
+			};
+
+			if (!previousState || previousState->componentMask != entity.componentMask)
+				GetNewState();
+
+			for (std::size_t componentIndex = 0; componentIndex < m_serializers.size(); ++componentIndex)
+			{
+				if ((entity.componentMask & (1u << componentIndex)) == 0)
+				{
+					if (newState)
+						newState->components[componentIndex].reset();
+
+					continue;
+				}
+
+				m_componentWriter.Clear();
+				m_serializers[componentIndex](entityId, m_componentWriter);
+
+				NazaraAssert(m_componentWriter.GetBitCount() <= ReplicationSnapshot::MaxComponentBitCount, "component data is too big");
+
+				// Keep sharing previous data when unchanged, which makes most comparisons a pointer comparison
+				const std::shared_ptr<const ReplicatedComponentData>* previousData = nullptr;
+				if (previousState && componentIndex < previousState->components.size() && previousState->components[componentIndex])
+					previousData = &previousState->components[componentIndex];
+
+				if (previousData)
+				{
+					const ReplicatedComponentData& data = **previousData;
+					if (data.bitCount == m_componentWriter.GetBitCount() && std::equal(data.data.begin(), data.data.end(), m_componentWriter.GetData()))
+						continue;
+				}
+
+				std::shared_ptr<ReplicatedComponentData> componentData = std::make_shared<ReplicatedComponentData>();
+				componentData->bitCount = m_componentWriter.GetBitCount();
+				componentData->data.assign(m_componentWriter.GetData(), m_componentWriter.GetData() + m_componentWriter.GetSize());
+
+				GetNewState().components[componentIndex] = std::move(componentData);
+			}
+
+			if (newState)
+				entity.state = std::move(newState);
+		}
+	}
+
+	void ReplicationServer::WriteEntity(BitWriter& writer, const ReplicatedEntityState* baselineState, const ReplicatedEntityState& state) const
+	{
+		unsigned int maskBitCount = static_cast<unsigned int>(m_serializers.size());
+
+		if (baselineState)
+		{
+			bool maskChanged = (baselineState->componentMask != state.componentMask);
+			writer.WriteBool(maskChanged);
+			if (maskChanged)
+				writer.Write(state.componentMask, maskBitCount);
+		}
+		else
+			writer.Write(state.componentMask, maskBitCount);
+
+		for (std::size_t componentIndex = 0; componentIndex < m_serializers.size(); ++componentIndex)
+		{
+			if ((state.componentMask & (1u << componentIndex)) == 0)
+				continue;
+
+			const std::shared_ptr<const ReplicatedComponentData>& componentData = state.components[componentIndex];
+			if (baselineState && baselineState->components[componentIndex])
+			{
+				bool changed = !ReplicationSnapshot::IsComponentEqual(baselineState->components[componentIndex], componentData);
+				writer.WriteBool(changed);
+				if (!changed)
+					continue;
+			}
+
+			ReplicationSnapshot::WriteComponentData(writer, *componentData);
+		}
+	}
+
+	void ReplicationServer::AppendBits(BitWriter& writer, const BitWriter& source)
+	{
+		std::size_t bitCount = source.GetBitCount();
+		const UInt8* data = source.GetData();
+
+		std::size_t byteCount = bitCount / 8;
+		for (std::size_t i = 0; i < byteCount; ++i)
+			writer.Write(data[i], 8);
+
+		if (unsigned int remainingBits = static_cast<unsigned int>(bitCount % 8); remainingBits > 0)
+			writer.Write(data[byteCount], remainingBits);
+	}
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ReplicationSnapshot.hpp>
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Core/BitWriter.hpp>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Reads component bits written by WriteComponentData
+	* \return false if data is corrupted
+	*/
+	bool ReplicationSnapshot::ReadComponentData(BitReader& reader, ReplicatedComponentData* componentData)
+	{
+		UInt64 bitCount = reader.ReadVarUInt();
+		if (bitCount > MaxComponentBitCount || bitCount > reader.GetRemainingBitCount())
+			return false;
+
+		componentData->bitCount = bitCount;
+		componentData->data.resize((bitCount + 7) / 8);
+
+		std::size_t byteCount = bitCount / 8;
+		for (std::size_t i = 0; i < byteCount; ++i)
+			componentData->data[i] = static_cast<UInt8>(reader.Read(8));
+
+		if (unsigned int remainingBits = static_cast<unsigned int>(bitCount % 8); remainingBits > 0)
+			componentData->data[byteCount] = static_cast<UInt8>(reader.Read(remainingBits));
+
+		return !reader.HasOverflowed();
+	}
+
+	void ReplicationSnapshot::WriteComponentData(BitWriter& writer, const ReplicatedComponentData& componentData)
+	{
+		writer.WriteVarUInt(componentData.bitCount);
+
+		std::size_t byteCount = componentData.bitCount / 8;
+		for (std::size_t i = 0; i < byteCount; ++i)
+			writer.Write(componentData.data[i], 8);
+
+		if (unsigned int remainingBits = static_cast<unsigned int>(componentData.bitCount % 8); remainingBits > 0)
+			writer.Write(componentData.data[byteCount], remainingBits);
+	}
+}
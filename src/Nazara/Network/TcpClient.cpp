@@ -7,6 +7,7 @@
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
+#include <cstring>
 #include <limits>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -250,10 +251,8 @@ namespace Nz
 
 		if (!m_pendingPacket.headerReceived)
 		{
-			m_pendingPacket.data.Resize(NetPacket::HeaderSize);
-
 			std::size_t received;
-			if (!Receive(&m_pendingPacket.data[m_pendingPacket.received], NetPacket::HeaderSize - m_pendingPacket.received, &received))
+			if (!Receive(&m_pendingPacket.header[m_pendingPacket.received], NetPacket::HeaderSize - m_pendingPacket.received, &received))
 				return false;
 
 			m_pendingPacket.received += received;
@@ -263,14 +262,18 @@ namespace Nz
 			if (m_pendingPacket.received >= NetPacket::HeaderSize)
 			{
 				UInt32 size;
-				if (!NetPacket::DecodeHeader(m_pendingPacket.data.GetConstBuffer(), &size, &m_pendingPacket.netcode))
+				UInt16 netCode;
+				if (!NetPacket::DecodeHeader(m_pendingPacket.header.data(), &size, &netCode) || size < NetPacket::HeaderSize)
 				{
 					m_lastError = SocketError::Packet;
 					NazaraWarning("Invalid header data");
 					return false;
 				}
 
-				m_pendingPacket.data.Resize(size - NetPacket::HeaderSize);
+				// Data is received directly in the packet buffer, which is then handed to the caller
+				m_pendingPacket.packet.Reset(netCode, nullptr, size - NetPacket::HeaderSize);
+				std::memcpy(m_pendingPacket.packet.GetData(), m_pendingPacket.header.data(), NetPacket::HeaderSize);
+
 				m_pendingPacket.headerReceived = true;
 				m_pendingPacket.received = 0;
 			}
@@ -279,38 +282,28 @@ namespace Nz
 		// We may have just received the header now
 		if (m_pendingPacket.headerReceived)
 		{
-			UInt32 packetSize = static_cast<UInt32>(m_pendingPacket.data.GetSize()); //< Total packet size
-			if (packetSize == 0)
+			std::size_t packetSize = m_pendingPacket.packet.GetDataSize();
+			if (packetSize > 0)
 			{
-				// Special case: our packet carry no data
-				packet->Reset(m_pendingPacket.netcode);
-
-				// And reset every state
-				m_pendingPacket.data.Clear();
-				m_pendingPacket.headerReceived = false;
-				m_pendingPacket.received = 0;
-				return true;
-			}
+				std::size_t received;
+				if (!Receive(m_pendingPacket.packet.GetData() + NetPacket::HeaderSize + m_pendingPacket.received, packetSize - m_pendingPacket.received, &received))
+					return false;
 
-			std::size_t received;
-			if (!Receive(&m_pendingPacket.data[m_pendingPacket.received], packetSize - m_pendingPacket.received, &received))
-				return false;
+				m_pendingPacket.received += received;
 
-			m_pendingPacket.received += received;
+				//TODO: Should never happen in production !
+				NazaraAssert(m_pendingPacket.received <= packetSize, "Received more data than packet size");
+				if (m_pendingPacket.received < packetSize)
+					return false;
+			}
 
-			//TODO: Should never happen in production !
-			NazaraAssert(m_pendingPacket.received <= packetSize, "Received more data than packet size");
-			if (m_pendingPacket.received >= packetSize)
-			{
-				// Okay we received the whole packet, copy it
-				packet->Reset(m_pendingPacket.netcode, m_pendingPacket.data.GetConstBuffer(), m_pendingPacket.data.GetSize());
+			// Okay we received the whole packet
+			*packet = std::move(m_pendingPacket.packet);
 
-				// And reset every state
-				m_pendingPacket.data.Clear();
-				m_pendingPacket.headerReceived = false;
-				m_pendingPacket.received = 0;
-				return true;
-			}
+			// And reset every state
+			m_pendingPacket.headerReceived = false;
+			m_pendingPacket.received = 0;
+			return true;
 		}
 
 		return false;
@@ -59,7 +59,7 @@ namespace Nz
 		}
 	}
 
-	void OpenGLCommandBuffer::Execute()
+	void OpenGLCommandBuffer::Execute() const
 	{
 		const GL::Context* context = GL::Context::GetCurrentContext();
 
@@ -83,7 +83,7 @@ namespace Nz
 		// No OpenGL object to name
 	}
 
-	void OpenGLCommandBuffer::ApplyBindings(const GL::Context& context, const ShaderBindings& states)
+	void OpenGLCommandBuffer::ApplyBindings(const GL::Context& context, const ShaderBindings& states) const
 	{
 		unsigned int setIndex = 0;
 		for (const auto& [pipelineLayout, shaderBinding] : states.shaderBindings)
@@ -97,7 +97,7 @@ namespace Nz
 		}
 	}
 
-	void OpenGLCommandBuffer::ApplyStates(const GL::Context& context, const DrawStates& states)
+	void OpenGLCommandBuffer::ApplyStates(const GL::Context& context, const DrawStates& states) const
 	{
 		states.pipeline->Apply(context, states.shouldFlipY);
 
@@ -135,41 +135,41 @@ namespace Nz
 		context.BindVertexArray(vao.GetObjectId());
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BeginDebugRegionCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BeginDebugRegionCommand& command) const
 	{
 		if (context->glPushDebugGroup)
 			context->glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, GLsizei(command.regionName.size()), command.regionName.data());
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BlitTextureCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BlitTextureCommand& command) const
 	{
 		context->BlitTexture(*command.source, *command.target, command.sourceBox, command.targetBox, command.filter);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, const BuildTextureMipmapsCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, const BuildTextureMipmapsCommand& command) const
 	{
 		command.texture->GenerateMipmaps(command.baseLevel, command.levelCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferCommand& command) const
 	{
 		context->BindBuffer(GL::BufferTarget::CopyRead, command.source);
 		context->BindBuffer(GL::BufferTarget::CopyWrite, command.target);
 		context->glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, command.sourceOffset, command.targetOffset, command.size);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command) const
 	{
 		context->BindBuffer(GL::BufferTarget::CopyWrite, command.target);
 		context->glBufferSubData(GL_COPY_WRITE_BUFFER, command.targetOffset, command.size, command.memory);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyTextureCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyTextureCommand& command) const
 	{
 		context->CopyTexture(*command.source, *command.target, command.sourceBox, command.targetPoint);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DispatchCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DispatchCommand& command) const
 	{
 		if (!context->glDispatchCompute)
 			throw std::runtime_error("compute shaders are not supported on this device");
@@ -179,14 +179,14 @@ namespace Nz
 		context->glDispatchCompute(command.numGroupsX, command.numGroupsY, command.numGroupsZ);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawCommand& command) const
 	{
 		ApplyStates(*context, command.states);
 		ApplyBindings(*context, command.bindings);
 		context->glDrawArraysInstanced(ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode), command.firstVertex, command.vertexCount, command.instanceCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawIndexedCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawIndexedCommand& command) const
 	{
 		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
 		origin += command.states.indexBufferOffset;
@@ -203,19 +203,100 @@ namespace Nz
 		context->glDrawElementsInstanced(ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode), command.indexCount, ToOpenGL(command.states.indexBufferType), origin, command.instanceCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const EndDebugRegionCommand& /*command*/)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawIndexedIndirectCommand& command) const
+	{
+		if (!context->glDrawElementsIndirect)
+			throw std::runtime_error("indirect draws are not supported on this device");
+
+		// Indirect commands offsets are relative to the start of the index buffer
+		if (command.states.indexBufferOffset != 0)
+			throw std::runtime_error("indirect indexed draws don't support index buffer offsets with OpenGL");
+
+		ApplyStates(*context, command.states);
+		ApplyBindings(*context, command.bindings);
+
+		GLenum primitiveMode = ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode);
+		GLenum indexType = ToOpenGL(command.states.indexBufferType);
+
+		context->BindBuffer(GL::BufferTarget::DrawIndirect, command.indirectBuffer);
+
+		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
+		origin += command.offset;
+
+		if (command.countBuffer != 0)
+		{
+			if (!context->glMultiDrawElementsIndirectCount)
+				throw std::runtime_error("indirect draw count is not supported on this device");
+
+			context->BindBuffer(GL::BufferTarget::Parameter, command.countBuffer);
+			context->glMultiDrawElementsIndirectCount(primitiveMode, indexType, origin, static_cast<GLintptr>(command.countOffset), command.drawCount, command.stride);
+		}
+		else if (context->glMultiDrawElementsIndirect)
+			context->glMultiDrawElementsIndirect(primitiveMode, indexType, origin, command.drawCount, command.stride);
+		else
+		{
+			for (UInt32 i = 0; i < command.drawCount; ++i)
+			{
+				context->glDrawElementsIndirect(primitiveMode, indexType, origin);
+				origin += command.stride;
+			}
+		}
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawIndirectCommand& command) const
+	{
+		if (!context->glDrawArraysIndirect)
+			throw std::runtime_error("indirect draws are not supported on this device");
+
+		ApplyStates(*context, command.states);
+		ApplyBindings(*context, command.bindings);
+
+		GLenum primitiveMode = ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode);
+
+		context->BindBuffer(GL::BufferTarget::DrawIndirect, command.indirectBuffer);
+
+		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
+		origin += command.offset;
+
+		if (command.countBuffer != 0)
+		{
+			if (!context->glMultiDrawArraysIndirectCount)
+				throw std::runtime_error("indirect draw count is not supported on this device");
+
+			context->BindBuffer(GL::BufferTarget::Parameter, command.countBuffer);
+			context->glMultiDrawArraysIndirectCount(primitiveMode, origin, static_cast<GLintptr>(command.countOffset), command.drawCount, command.stride);
+		}
+		else if (context->glMultiDrawArraysIndirect)
+			context->glMultiDrawArraysIndirect(primitiveMode, origin, command.drawCount, command.stride);
+		else
+		{
+			for (UInt32 i = 0; i < command.drawCount; ++i)
+			{
+				context->glDrawArraysIndirect(primitiveMode, origin);
+				origin += command.stride;
+			}
+		}
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const EndDebugRegionCommand& /*command*/) const
 	{
 		if (context->glPopDebugGroup)
 			context->glPopDebugGroup();
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const MemoryBarrier& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, const ExecuteSecondaryCommand& command) const
+	{
+		// Deferred replay of the secondary command buffer, using the framebuffer bound by the primary
+		command.commandBuffer->Execute();
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const MemoryBarrier& command) const
 	{
 		if (context->glMemoryBarrier)
 			context->glMemoryBarrier(command.barriers);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context*& context, const SetFrameBufferCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context*& context, const SetFrameBufferCommand& command) const
 	{
 		command.framebuffer->Activate();
 
@@ -22,7 +22,7 @@ namespace Nz
 		m_commandBuffer.BeginDebugRegion(regionName, color);
 	}
 
-	void OpenGLCommandBufferBuilder::BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& /*renderRect*/, const ClearValues* clearValues, std::size_t clearValueCount)
+	void OpenGLCommandBufferBuilder::BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& /*renderRect*/, const ClearValues* clearValues, std::size_t clearValueCount, SubpassContents /*contents*/)
 	{
 		m_commandBuffer.SetFramebuffer(static_cast<const OpenGLFramebuffer&>(framebuffer), static_cast<const OpenGLRenderPass&>(renderPass), clearValues, clearValueCount);
 	}
@@ -138,6 +138,36 @@ namespace Nz
 		m_commandBuffer.DrawIndexed(indexCount, instanceCount, firstIndex, firstInstance);
 	}
 
+	void OpenGLCommandBufferBuilder::DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = static_cast<const OpenGLBuffer&>(indirectBuffer);
+
+		m_commandBuffer.DrawIndexedIndirect(glBuffer.GetBuffer().GetObjectId(), offset, drawCount, stride);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = static_cast<const OpenGLBuffer&>(indirectBuffer);
+		const OpenGLBuffer& glCountBuffer = static_cast<const OpenGLBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndexedIndirect(glBuffer.GetBuffer().GetObjectId(), offset, maxDrawCount, stride, glCountBuffer.GetBuffer().GetObjectId(), countOffset);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = static_cast<const OpenGLBuffer&>(indirectBuffer);
+
+		m_commandBuffer.DrawIndirect(glBuffer.GetBuffer().GetObjectId(), offset, drawCount, stride);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = static_cast<const OpenGLBuffer&>(indirectBuffer);
+		const OpenGLBuffer& glCountBuffer = static_cast<const OpenGLBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndirect(glBuffer.GetBuffer().GetObjectId(), offset, maxDrawCount, stride, glCountBuffer.GetBuffer().GetObjectId(), countOffset);
+	}
+
 	void OpenGLCommandBufferBuilder::EndDebugRegion()
 	{
 		m_commandBuffer.EndDebugRegion();
@@ -148,7 +178,48 @@ namespace Nz
 		/* nothing to do */
 	}
 
-	void OpenGLCommandBufferBuilder::NextSubpass()
+	void OpenGLCommandBufferBuilder::ExecuteSecondaryCommandBuffer(const CommandBuffer& commandBuffer)
+	{
+		m_commandBuffer.ExecuteSecondaryCommandBuffer(static_cast<const OpenGLCommandBuffer&>(commandBuffer));
+	}
+
+	void OpenGLCommandBufferBuilder::MemoryBarrier(PipelineStageFlags /*srcStageMask*/, PipelineStageFlags /*dstStageMask*/, MemoryAccessFlags srcAccessMask, MemoryAccessFlags dstAccessMask)
+	{
+		// glMemoryBarrier is only required to synchronize with incoherent shader writes (storage buffers/images)
+		if (!srcAccessMask.Test(MemoryAccess::ShaderWrite))
+			return;
+
+		GLbitfield barriers = 0;
+
+		if (dstAccessMask.Test(MemoryAccess::IndexBufferRead))
+			barriers |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::IndirectCommandRead))
+			barriers |= GL_COMMAND_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::HostRead))
+			barriers |= GL_BUFFER_UPDATE_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::ShaderRead) || dstAccessMask.Test(MemoryAccess::ShaderWrite))
+			barriers |= GL_SHADER_STORAGE_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::TransferRead) || dstAccessMask.Test(MemoryAccess::TransferWrite))
+			barriers |= GL_BUFFER_UPDATE_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::UniformBufferRead))
+			barriers |= GL_UNIFORM_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::VertexBufferRead))
+			barriers |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+
+		if (dstAccessMask.Test(MemoryAccess::MemoryRead) || dstAccessMask.Test(MemoryAccess::MemoryWrite))
+			barriers |= GL_ALL_BARRIER_BITS;
+
+		if (barriers != 0)
+			m_commandBuffer.InsertMemoryBarrier(barriers);
+	}
+
+	void OpenGLCommandBufferBuilder::NextSubpass(SubpassContents /*contents*/)
 	{
 		/* nothing to do */
 	}
@@ -5,6 +5,7 @@
 #include <Nazara/OpenGLRenderer/OpenGLCommandPool.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLCommandBuffer.hpp>
 #include <Nazara/OpenGLRenderer/OpenGLCommandBufferBuilder.hpp>
+#include <Nazara/OpenGLRenderer/OpenGLFramebuffer.hpp>
 #include <NazaraUtils/MemoryHelper.hpp>
 #include <Nazara/OpenGLRenderer/Debug.hpp>
 
@@ -12,25 +13,23 @@ namespace Nz
 {
 	CommandBufferPtr OpenGLCommandPool::BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback)
 	{
-		CommandBufferPtr commandBuffer;
-		for (std::size_t i = 0; i < m_commandPools.size(); ++i)
-		{
-			commandBuffer = AllocateFromPool(i);
-			if (commandBuffer)
-				break;
-		}
+		CommandBufferPtr commandBuffer = AllocateCommandBuffer();
 
-		if (!commandBuffer)
-		{
-			// No allocation could be made, time to allocate a new pool
-			std::size_t newPoolIndex = m_commandPools.size();
-			AllocatePool();
+		OpenGLCommandBufferBuilder builder(static_cast<OpenGLCommandBuffer&>(*commandBuffer.get()));
+		callback(builder);
 
-			commandBuffer = AllocateFromPool(newPoolIndex);
-			assert(commandBuffer);
-		}
+		return commandBuffer;
+	}
 
-		OpenGLCommandBufferBuilder builder(static_cast<OpenGLCommandBuffer&>(*commandBuffer.get()));
+	CommandBufferPtr OpenGLCommandPool::BuildSecondaryCommandBuffer(const Framebuffer& framebuffer, const RenderPass& /*renderPass*/, UInt32 /*subpassIndex*/, const std::function<void(CommandBufferBuilder& builder)>& callback)
+	{
+		// OpenGL has no secondary command buffers, commands are replayed by the primary command buffer when it executes
+		CommandBufferPtr commandBuffer = AllocateCommandBuffer();
+
+		OpenGLCommandBuffer& glCommandBuffer = static_cast<OpenGLCommandBuffer&>(*commandBuffer.get());
+		glCommandBuffer.InheritFramebuffer(static_cast<const OpenGLFramebuffer&>(framebuffer));
+
+		OpenGLCommandBufferBuilder builder(glCommandBuffer);
 		callback(builder);
 
 		return commandBuffer;
@@ -52,6 +51,24 @@ namespace Nz
 		return m_commandPools.emplace_back(std::move(pool));
 	}
 
+	CommandBufferPtr OpenGLCommandPool::AllocateCommandBuffer()
+	{
+		for (std::size_t i = 0; i < m_commandPools.size(); ++i)
+		{
+			if (CommandBufferPtr commandBuffer = AllocateFromPool(i))
+				return commandBuffer;
+		}
+
+		// No allocation could be made, time to allocate a new pool
+		std::size_t newPoolIndex = m_commandPools.size();
+		AllocatePool();
+
+		CommandBufferPtr commandBuffer = AllocateFromPool(newPoolIndex);
+		assert(commandBuffer);
+
+		return commandBuffer;
+	}
+
 	CommandBufferPtr OpenGLCommandPool::AllocateFromPool(std::size_t poolIndex)
 	{
 		auto& pool = m_commandPools[poolIndex];
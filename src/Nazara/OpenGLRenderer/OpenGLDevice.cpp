@@ -72,6 +72,15 @@ namespace Nz
 		if (m_referenceContext->IsExtensionSupported(GL::Extension::DepthClamp))
 			m_deviceInfo.features.depthClamping = true;
 
+		if (m_referenceContext->IsExtensionSupported(GL::Extension::DrawIndirect))
+			m_deviceInfo.features.drawIndirect = true;
+
+		if (m_referenceContext->IsExtensionSupported(GL::Extension::IndirectParameters))
+			m_deviceInfo.features.drawIndirectCount = true;
+
+		if (m_referenceContext->IsExtensionSupported(GL::Extension::MultiDrawIndirect))
+			m_deviceInfo.features.multiDrawIndirect = true;
+
 		if (m_referenceContext->glPolygonMode) //< not supported in core OpenGL ES, but supported in OpenGL or with GL_NV_polygon_mode extension
 			m_deviceInfo.features.nonSolidFaceFilling = true;
 
@@ -91,6 +100,7 @@ namespace Nz
 			m_deviceInfo.features.unrestrictedTextureViews = true;
 
 		// Limits
+		m_deviceInfo.limits.maxPerStageSampledTextures = m_referenceContext->GetInteger<UInt32>(GL_MAX_TEXTURE_IMAGE_UNITS);
 		m_deviceInfo.limits.maxUniformBufferSize = m_referenceContext->GetInteger<UInt64>(GL_MAX_UNIFORM_BLOCK_SIZE);
 		m_deviceInfo.limits.minUniformBufferOffsetAlignment = RoundToPow2(m_referenceContext->GetInteger<UInt64>(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT));
 
@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/OpenGLRenderer/OpenGLUploadPool.hpp>
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <stdexcept>
 #include <Nazara/OpenGLRenderer/Debug.hpp>
 
@@ -16,42 +18,95 @@ namespace Nz
 
 	auto OpenGLUploadPool::Allocate(UInt64 size, UInt64 /*alignment*/) -> Allocation&
 	{
-		// Try to minimize lost space
-		struct
+		// Big allocations would waste most of a block, they get their own memory
+		if (size > m_blockSize / 2)
+			return AllocateDedicated(size);
+
+		// Linear allocation in the current block, blocks are filled in the same order every frame
+		if (m_currentBlockIndex < m_blocks.size() && m_blocks[m_currentBlockIndex].freeOffset + size > m_blocks[m_currentBlockIndex].size)
+			m_currentBlockIndex++; //< Not enough space, the end of the block stays unused until next reset
+
+		if (m_currentBlockIndex >= m_blocks.size())
 		{
-			Block* block = nullptr;
-			UInt64 offset = 0;
-		} bestBlock;
+			assert(m_currentBlockIndex == m_blocks.size());
+			m_blocks.push_back(CreateBlock(m_blockSize));
+		}
+
+		Block& block = m_blocks[m_currentBlockIndex];
+		UInt64 offset = block.freeOffset;
+		block.freeOffset += size;
+
+		m_stats.usedMemory += size;
 
-		for (Block& block : m_blocks)
+		return PushAllocation(block, offset, size);
+	}
+
+	/*!
+	* \brief Makes the memory of every allocation available again
+	*
+	* This must only be called once the frame using this pool has been executed.
+	*/
+	void OpenGLUploadPool::Reset()
+	{
+		// Dedicated blocks which weren't reused during the last frame are released, others are kept for the next one
+		for (Block& block : m_freeDedicatedBlocks)
+			m_stats.allocatedMemory -= block.size;
+
+		m_freeDedicatedBlocks.clear();
+		std::move(m_dedicatedBlocks.begin(), m_dedicatedBlocks.end(), std::back_inserter(m_freeDedicatedBlocks));
+		m_dedicatedBlocks.clear();
+
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size() && blockIndex <= m_currentBlockIndex; ++blockIndex)
+			m_blocks[blockIndex].freeOffset = 0;
+
+		m_currentBlockIndex = 0;
+		m_nextAllocationIndex = 0;
+
+		m_stats.allocationCount = 0;
+		m_stats.dedicatedAllocationCount = 0;
+		m_stats.usedMemory = 0;
+	}
+
+	auto OpenGLUploadPool::AllocateDedicated(UInt64 size) -> Allocation&
+	{
+		// Reuse the smallest dedicated block from the previous frame big enough, if any
+		auto bestIt = m_freeDedicatedBlocks.end();
+		for (auto it = m_freeDedicatedBlocks.begin(); it != m_freeDedicatedBlocks.end(); ++it)
 		{
-			if (block.freeOffset + size > block.size)
-				continue; //< Not enough space
-
-			if (!bestBlock.block)
-			{
-				bestBlock.block = &block;
-				bestBlock.offset = block.freeOffset;
-				break; //< Since we have no alignment constraint, the first block is good
-			}
+			if (it->size >= size && (bestIt == m_freeDedicatedBlocks.end() || it->size < bestIt->size))
+				bestIt = it;
 		}
 
-		// No block found, allocate a new one
-		if (!bestBlock.block)
+		Block* block;
+		if (bestIt != m_freeDedicatedBlocks.end())
 		{
-			// Handle really big allocations (TODO: Handle them separately as they shouldn't be common and can consume a lot of memory)
-			UInt64 blockSize = std::max(m_blockSize, size);
+			block = &m_dedicatedBlocks.emplace_back(std::move(*bestIt));
+			m_freeDedicatedBlocks.erase(bestIt);
+		}
+		else
+			block = &m_dedicatedBlocks.emplace_back(CreateBlock(size));
 
-			Block newBlock;
-			newBlock.size = blockSize;
+		block->freeOffset = size;
 
-			newBlock.memory.resize(blockSize);
+		m_stats.dedicatedAllocationCount++;
+		m_stats.usedMemory += size;
 
-			bestBlock.block = &m_blocks.emplace_back(std::move(newBlock));
-			bestBlock.offset = 0;
-		}
+		return PushAllocation(*block, 0, size);
+	}
+
+	auto OpenGLUploadPool::CreateBlock(UInt64 size) -> Block
+	{
+		Block newBlock;
+		newBlock.size = size;
+		newBlock.memory.resize(size);
+
+		m_stats.allocatedMemory += size;
+
+		return newBlock;
+	}
 
-		// Now find the proper allocation buffer
+	auto OpenGLUploadPool::PushAllocation(Block& block, UInt64 offset, UInt64 size) -> Allocation&
+	{
 		std::size_t allocationBlockIndex = m_nextAllocationIndex / AllocationPerBlock;
 		std::size_t allocationIndex = m_nextAllocationIndex % AllocationPerBlock;
 
@@ -64,20 +119,14 @@ namespace Nz
 		auto& allocationBlock = *m_allocationBlocks[allocationBlockIndex];
 
 		Allocation& allocationData = allocationBlock[allocationIndex];
-		allocationData.mappedPtr = static_cast<UInt8*>(bestBlock.block->memory.data()) + bestBlock.offset;
+		allocationData.mappedPtr = static_cast<UInt8*>(block.memory.data()) + offset;
 		allocationData.size = size;
 
-		bestBlock.block->freeOffset += size;
 		m_nextAllocationIndex++;
 
-		return allocationData;
-	}
-
-	void OpenGLUploadPool::Reset()
-	{
-		for (Block& block : m_blocks)
-			block.freeOffset = 0;
+		m_stats.allocationCount++;
+		m_stats.peakUsedMemory = std::max(m_stats.peakUsedMemory, m_stats.usedMemory);
 
-		m_nextAllocationIndex = 0;
+		return allocationData;
 	}
 }
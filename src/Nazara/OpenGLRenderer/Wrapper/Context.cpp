@@ -487,6 +487,26 @@ namespace Nz::GL
 		else if (m_supportedExtensions.count("GL_NV_depth_clamp"))
 			m_extensionStatus[Extension::DepthClamp] = ExtensionStatus::Vendor;
 
+		// Draw indirect
+		if ((m_params.type == ContextType::OpenGL && glVersion >= 400) || (m_params.type == ContextType::OpenGL_ES && glVersion >= 310))
+			m_extensionStatus[Extension::DrawIndirect] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_draw_indirect"))
+			m_extensionStatus[Extension::DrawIndirect] = ExtensionStatus::ARB;
+
+		// Indirect parameters (draw count read from a buffer)
+		if (m_params.type == ContextType::OpenGL && glVersion >= 460)
+			m_extensionStatus[Extension::IndirectParameters] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_indirect_parameters"))
+			m_extensionStatus[Extension::IndirectParameters] = ExtensionStatus::ARB;
+
+		// Multi draw indirect
+		if (m_params.type == ContextType::OpenGL && glVersion >= 430)
+			m_extensionStatus[Extension::MultiDrawIndirect] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_multi_draw_indirect"))
+			m_extensionStatus[Extension::MultiDrawIndirect] = ExtensionStatus::ARB;
+		else if (m_supportedExtensions.count("GL_EXT_multi_draw_indirect"))
+			m_extensionStatus[Extension::MultiDrawIndirect] = ExtensionStatus::EXT;
+
 		// Polygon mode
 		if (m_params.type == ContextType::OpenGL)
 			m_extensionStatus[Extension::PolygonMode] = ExtensionStatus::Core;
@@ -1045,6 +1065,30 @@ namespace Nz::GL
 			return loader.Load<PFNGLDEBUGMESSAGECALLBACKKHRPROC, functionIndex>(glDebugMessageCallback, "glDebugMessageCallbackKHR", false) || //< from GL_KHR_debug
 			       loader.Load<PFNGLDEBUGMESSAGECALLBACKPROC, functionIndex>(glDebugMessageCallback, "glDebugMessageCallbackARB", false);      //< from GL_ARB_debug_output
 		}
+		else if (function == "glMultiDrawArraysIndirect")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawArraysIndirect);
+
+			return loader.Load<PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC, functionIndex>(glMultiDrawArraysIndirect, "glMultiDrawArraysIndirectEXT", false); //< from GL_EXT_multi_draw_indirect
+		}
+		else if (function == "glMultiDrawArraysIndirectCount")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawArraysIndirectCount);
+
+			return loader.Load<PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, functionIndex>(glMultiDrawArraysIndirectCount, "glMultiDrawArraysIndirectCountARB", false); //< from GL_ARB_indirect_parameters
+		}
+		else if (function == "glMultiDrawElementsIndirect")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawElementsIndirect);
+
+			return loader.Load<PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC, functionIndex>(glMultiDrawElementsIndirect, "glMultiDrawElementsIndirectEXT", false); //< from GL_EXT_multi_draw_indirect
+		}
+		else if (function == "glMultiDrawElementsIndirectCount")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawElementsIndirectCount);
+
+			return loader.Load<PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, functionIndex>(glMultiDrawElementsIndirectCount, "glMultiDrawElementsIndirectCountARB", false); //< from GL_ARB_indirect_parameters
+		}
 		else if (function == "glPolygonMode")
 		{
 			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glPolygonMode);
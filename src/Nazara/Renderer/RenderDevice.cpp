@@ -5,12 +5,53 @@
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <stdexcept>
 #include <Nazara/Renderer/Debug.hpp>
 
 namespace Nz
 {
 	RenderDevice::~RenderDevice() = default;
 
+	/*!
+	* \brief Retrieves the content of the device pipeline cache, to be saved and reloaded later using LoadPipelineCacheData
+	*
+	* \return Pipeline cache data, empty if the device doesn't support pipeline caching
+	*/
+	std::vector<UInt8> RenderDevice::GetPipelineCacheData() const
+	{
+		return {};
+	}
+
+	/*!
+	* \brief Retrieves the memory a texture would require if it were placed in a texture heap
+	*
+	* The default implementation estimates it from the texture dimensions and format, backends supporting texture heaps override it with exact values.
+	*/
+	TextureMemoryRequirements RenderDevice::GetTextureMemoryRequirements(const TextureInfo& textureInfo)
+	{
+		UInt64 size = 0;
+		unsigned int width = textureInfo.width;
+		unsigned int height = textureInfo.height;
+		unsigned int depth = textureInfo.depth;
+		for (UInt8 level = 0; level < textureInfo.levelCount; ++level)
+		{
+			size += PixelFormatInfo::ComputeSize(textureInfo.pixelFormat, width, height, depth);
+			if (width == 1 && height == 1 && depth == 1)
+				break;
+
+			width = std::max(width / 2, 1U);
+			height = std::max(height / 2, 1U);
+			depth = std::max(depth / 2, 1U);
+		}
+
+		TextureMemoryRequirements requirements;
+		requirements.size = size * textureInfo.layerCount;
+
+		return requirements;
+	}
+
 	std::shared_ptr<ShaderModule> RenderDevice::InstantiateShaderModule(nzsl::ShaderStageTypeFlags shaderStages, ShaderLanguage lang, const std::filesystem::path& sourcePath, const nzsl::ShaderWriter::States& states)
 	{
 		File file(sourcePath);
@@ -32,6 +73,30 @@ namespace Nz
 		return InstantiateShaderModule(shaderStages, lang, source.data(), source.size(), states);
 	}
 
+	/*!
+	* \brief Allocates a memory heap in which multiple textures can be placed, possibly overlapping
+	*
+	* Only available if the textureMemoryAliasing feature is enabled.
+	*
+	* \param heapRequirements Size and alignment of the heap, the memory type bits must intersect with the ones of every texture placed in it
+	*/
+	std::shared_ptr<TextureHeap> RenderDevice::InstantiateTextureHeap(const TextureMemoryRequirements& /*heapRequirements*/)
+	{
+		throw std::runtime_error("texture heaps are not supported by this device");
+	}
+
+	/*!
+	* \brief Merges previously saved pipeline cache data into the device pipeline cache
+	*
+	* Pipeline cache data can only be used with devices sharing the same pipelineCacheUUID, implementations may silently ignore incompatible data.
+	*
+	* \return True if the data was loaded
+	*/
+	bool RenderDevice::LoadPipelineCacheData(const void* /*data*/, std::size_t /*size*/)
+	{
+		return false;
+	}
+
 	void RenderDevice::ValidateFeatures(const RenderDeviceFeatures& supportedFeatures, RenderDeviceFeatures& enabledFeatures)
 	{
 #define NzValidateFeature(field, name) \
@@ -42,11 +107,16 @@ namespace Nz
 		}
 
 		NzValidateFeature(anisotropicFiltering, "anistropic filtering feature")
+		NzValidateFeature(bindlessTextures, "bindless textures feature")
 		NzValidateFeature(computeShaders, "compute shaders feature")
 		NzValidateFeature(depthClamping, "depth clamping feature")
+		NzValidateFeature(drawIndirect, "indirect draw feature")
+		NzValidateFeature(drawIndirectCount, "indirect draw count feature")
+		NzValidateFeature(multiDrawIndirect, "multi-draw indirect feature")
 		NzValidateFeature(nonSolidFaceFilling, "non-solid face filling feature")
 		NzValidateFeature(storageBuffers, "storage buffers support")
 		NzValidateFeature(textureReadWithoutFormat, "texture read without format")
+		NzValidateFeature(textureMemoryAliasing, "texture memory aliasing")
 		NzValidateFeature(textureReadWrite, "texture read/write")
 		NzValidateFeature(textureWriteWithoutFormat, "texture write without format")
 		NzValidateFeature(unrestrictedTextureViews, "unrestricted texture view support")
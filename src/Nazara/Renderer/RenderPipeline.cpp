@@ -10,6 +10,17 @@ namespace Nz
 {
 	RenderPipeline::~RenderPipeline() = default;
 
+	/*!
+	* \brief Creates the backend pipeline object used with a render pass ahead of its first use
+	*
+	* Backends creating pipeline objects lazily per render pass (Vulkan) create it here, going through the device pipeline cache.
+	* Any render pass compatible with the one used to render (same attachment formats and sample counts) can be used.
+	* Other backends do nothing.
+	*/
+	void RenderPipeline::Prewarm(const RenderPass& /*renderPass*/, std::size_t /*subpassIndex*/) const
+	{
+	}
+
 	void RenderPipeline::ValidatePipelineInfo(const RenderDevice& device, RenderPipelineInfo& pipelineInfo)
 	{
 		const RenderDeviceFeatures& deviceFeatures = device.GetEnabledFeatures();
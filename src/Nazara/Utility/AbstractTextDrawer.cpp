@@ -3,9 +3,38 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/AbstractTextDrawer.hpp>
+#include <atomic>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
 	AbstractTextDrawer::~AbstractTextDrawer() = default;
+
+	/*!
+	* \brief Returns an identifier of the current glyphs layout
+	*
+	* Revisions are unique among all drawers, a drawer not tracking its layout changes returns UntrackedLayoutRevision.
+	* This allows users (like text sprites) to only process glyphs which changed since the last time they saw the drawer, see GetUnchangedGlyphCount.
+	*/
+	UInt64 AbstractTextDrawer::GetLayoutRevision() const
+	{
+		return UntrackedLayoutRevision;
+	}
+
+	/*!
+	* \brief Returns the number of leading glyphs which didn't change since the layout revision
+	* \return Glyph count, zero if the revision is unknown to the drawer (every glyph has to be considered changed)
+	*
+	* \param layoutRevision Revision previously returned by GetLayoutRevision
+	*/
+	std::size_t AbstractTextDrawer::GetUnchangedGlyphCount(UInt64 /*layoutRevision*/) const
+	{
+		return 0;
+	}
+
+	UInt64 AbstractTextDrawer::GenerateLayoutRevision()
+	{
+		static std::atomic<UInt64> s_nextRevision = UntrackedLayoutRevision + 1;
+		return s_nextRevision++;
+	}
 }
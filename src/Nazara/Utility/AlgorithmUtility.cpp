@@ -32,6 +32,9 @@
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -629,6 +632,184 @@ namespace Nz
 				float m_valenceBoostScale;
 				float m_valenceBoostPower;
 		};
+
+		struct Quadric
+		{
+			// Sum of weighted squared plane equations (a, b, c, d), stored as the upper triangle of a symmetric 4x4 matrix
+			float a2 = 0.f, ab = 0.f, ac = 0.f, ad = 0.f;
+			float b2 = 0.f, bc = 0.f, bd = 0.f;
+			float c2 = 0.f, cd = 0.f;
+			float d2 = 0.f;
+			float weight = 0.f;
+
+			void AddPlane(const Vector3f& normal, float distance, float planeWeight)
+			{
+				a2 += planeWeight * normal.x * normal.x;
+				ab += planeWeight * normal.x * normal.y;
+				ac += planeWeight * normal.x * normal.z;
+				ad += planeWeight * normal.x * distance;
+				b2 += planeWeight * normal.y * normal.y;
+				bc += planeWeight * normal.y * normal.z;
+				bd += planeWeight * normal.y * distance;
+				c2 += planeWeight * normal.z * normal.z;
+				cd += planeWeight * normal.z * distance;
+				d2 += planeWeight * distance * distance;
+				weight += planeWeight;
+			}
+
+			// Returns the weighted mean of the squared distances between a point and the planes
+			float Evaluate(const Vector3f& p) const
+			{
+				if (weight <= 0.f)
+					return 0.f;
+
+				float error = p.x * (a2 * p.x + 2.f * (ab * p.y + ac * p.z + ad))
+				            + p.y * (b2 * p.y + 2.f * (bc * p.z + bd))
+				            + p.z * (c2 * p.z + 2.f * cd)
+				            + d2;
+
+				return std::abs(error) / weight;
+			}
+
+			Quadric& operator+=(const Quadric& quadric)
+			{
+				a2 += quadric.a2; ab += quadric.ab; ac += quadric.ac; ad += quadric.ad;
+				b2 += quadric.b2; bc += quadric.bc; bd += quadric.bd;
+				c2 += quadric.c2; cd += quadric.cd;
+				d2 += quadric.d2;
+				weight += quadric.weight;
+
+				return *this;
+			}
+		};
+
+		// Simple FIFO vertex cache, close to what post-transform caches of most GPUs do
+		class FifoVertexCache
+		{
+			public:
+				FifoVertexCache(UInt32 vertexCount) :
+				m_timestamps(vertexCount, 0),
+				m_time(CacheSize + 1)
+				{
+				}
+
+				unsigned int Process(UInt32 a, UInt32 b, UInt32 c)
+				{
+					unsigned int missCount = 0;
+					for (UInt32 vertex : { a, b, c })
+					{
+						if (m_time - m_timestamps[vertex] > CacheSize)
+						{
+							m_timestamps[vertex] = m_time++;
+							missCount++;
+						}
+					}
+
+					return missCount;
+				}
+
+				void Reset()
+				{
+					m_time += CacheSize + 1;
+				}
+
+			private:
+				static constexpr UInt32 CacheSize = 16;
+
+				std::vector<UInt32> m_timestamps;
+				UInt32 m_time;
+		};
+
+		enum class SimplifyVertexKind : UInt8
+		{
+			Manifold, //< can be collapsed to any neighbor
+			Border,   //< can only be collapsed along a border edge
+			Seam,     //< attribute seam shared by two vertices, collapsed along the seam along with its sibling
+			Locked    //< complex attribute seam or seam on a border, never collapsed
+		};
+
+		constexpr UInt64 EncodeEdge(UInt32 a, UInt32 b)
+		{
+			return (UInt64(a) << 32) | b;
+		}
+	}
+
+	/***********************************Build***********************************/
+
+	MeshletData BuildMeshlets(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, UInt32 maxVertexCount, UInt32 maxTriangleCount)
+	{
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+		NazaraAssert(maxVertexCount >= 3 && maxVertexCount <= 256, "meshlet vertex count must be between 3 and 256");
+		NazaraAssert(maxTriangleCount >= 1, "meshlet triangle count must be at least 1");
+
+		constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+
+		MeshletData meshletData;
+		meshletData.meshlets.reserve(indexCount / 3 / maxTriangleCount + 1);
+		meshletData.triangles.reserve(indexCount);
+
+		// Local index of each vertex in the current meshlet
+		std::unordered_map<UInt32, UInt32> localIndices;
+
+		Meshlet currentMeshlet = { Boxf::Zero(), 0, 0, 0, 0 };
+
+		auto FinishMeshlet = [&]
+		{
+			if (currentMeshlet.triangleCount == 0)
+				return;
+
+			if (positionPtr)
+			{
+				const UInt32* vertices = &meshletData.vertices[currentMeshlet.vertexOffset];
+				currentMeshlet.aabb = Boxf(positionPtr[vertices[0]], Vector3f::Zero());
+				for (UInt32 i = 1; i < currentMeshlet.vertexCount; ++i)
+					currentMeshlet.aabb.ExtendTo(positionPtr[vertices[i]]);
+			}
+
+			meshletData.meshlets.push_back(currentMeshlet);
+
+			currentMeshlet.aabb = Boxf::Zero();
+			currentMeshlet.triangleCount = 0;
+			currentMeshlet.triangleOffset = static_cast<UInt32>(meshletData.triangles.size());
+			currentMeshlet.vertexCount = 0;
+			currentMeshlet.vertexOffset = static_cast<UInt32>(meshletData.vertices.size());
+
+			localIndices.clear();
+		};
+
+		// Triangles are grouped in submission order, which should have been optimized for vertex cache locality beforehand
+		for (UInt32 i = 0; i < indexCount; i += 3)
+		{
+			std::array<UInt32, 3> triangle = { indices[i + 0], indices[i + 1], indices[i + 2] };
+
+			UInt32 newVertexCount = 0;
+			for (std::size_t j = 0; j < 3; ++j)
+			{
+				if (localIndices.find(triangle[j]) == localIndices.end() && std::find(triangle.begin(), triangle.begin() + j, triangle[j]) == triangle.begin() + j)
+					newVertexCount++;
+			}
+
+			if (currentMeshlet.vertexCount + newVertexCount > maxVertexCount || currentMeshlet.triangleCount + 1 > maxTriangleCount)
+				FinishMeshlet();
+
+			for (UInt32 vertex : triangle)
+			{
+				UInt32& localIndex = localIndices.emplace(vertex, InvalidIndex).first->second;
+				if (localIndex == InvalidIndex)
+				{
+					localIndex = currentMeshlet.vertexCount++;
+					meshletData.vertices.push_back(vertex);
+				}
+
+				meshletData.triangles.push_back(SafeCast<UInt8>(localIndex));
+			}
+
+			currentMeshlet.triangleCount++;
+		}
+
+		FinishMeshlet();
+
+		return meshletData;
 	}
 
 	/**********************************Compute**********************************/
@@ -1063,6 +1244,516 @@ namespace Nz
 			NazaraWarning("Indices optimizer failed");
 	}
 
+	void OptimizeOverdraw(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, float threshold)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+		NazaraAssert(positionPtr, "invalid positions");
+
+		// Based on "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" (Sander, Nehab, Barczak)
+		// Triangles are split in clusters along vertex cache boundaries, clusters are then sorted so that those facing
+		// away from the mesh center are drawn first as they are more likely to occlude the others
+		UInt32 triangleCount = indexCount / 3;
+		if (triangleCount == 0)
+			return;
+
+		std::vector<UInt32> sourceIndices(indexCount);
+		UInt32 vertexCount = 0;
+		for (UInt32 i = 0; i < indexCount; ++i)
+		{
+			sourceIndices[i] = indices[i];
+			vertexCount = std::max(vertexCount, sourceIndices[i] + 1);
+		}
+
+		FifoVertexCache cache(vertexCount);
+
+		// Hard boundaries: triangles where the cache has to be fully reloaded, splitting there doesn't cost anything
+		std::vector<UInt32> hardBoundaries;
+		std::vector<UInt8> triangleMisses(triangleCount);
+		for (UInt32 i = 0; i < triangleCount; ++i)
+		{
+			triangleMisses[i] = UInt8(cache.Process(sourceIndices[i * 3 + 0], sourceIndices[i * 3 + 1], sourceIndices[i * 3 + 2]));
+			if (i == 0 || triangleMisses[i] == 3)
+				hardBoundaries.push_back(i);
+		}
+		hardBoundaries.push_back(triangleCount);
+
+		// Soft boundaries: split clusters further as long as the cache efficiency doesn't drop below the threshold
+		std::vector<UInt32> clusters;
+		for (std::size_t i = 0; i + 1 < hardBoundaries.size(); ++i)
+		{
+			UInt32 start = hardBoundaries[i];
+			UInt32 end = hardBoundaries[i + 1];
+
+			UInt32 clusterMisses = 0;
+			for (UInt32 j = start; j < end; ++j)
+				clusterMisses += triangleMisses[j];
+
+			float maxAcmr = float(clusterMisses) / float(end - start) * threshold;
+
+			cache.Reset();
+
+			UInt32 clusterStart = start;
+			UInt32 misses = 0;
+			clusters.push_back(start);
+			for (UInt32 j = start; j < end; ++j)
+			{
+				misses += cache.Process(sourceIndices[j * 3 + 0], sourceIndices[j * 3 + 1], sourceIndices[j * 3 + 2]);
+
+				if (j + 1 < end && float(misses) / float(j - clusterStart + 1) <= maxAcmr)
+				{
+					clusterStart = j + 1;
+					clusters.push_back(clusterStart);
+
+					cache.Reset();
+					misses = 0;
+				}
+			}
+		}
+		clusters.push_back(triangleCount);
+
+		std::size_t clusterCount = clusters.size() - 1;
+
+		struct ClusterInfo
+		{
+			Vector3f centroid = Vector3f::Zero();
+			Vector3f normal = Vector3f::Zero();
+			float area = 0.f;
+			float sortKey;
+		};
+
+		std::vector<ClusterInfo> clusterInfos(clusterCount);
+
+		Vector3f meshCentroid = Vector3f::Zero();
+		float meshArea = 0.f;
+		for (std::size_t i = 0; i < clusterCount; ++i)
+		{
+			ClusterInfo& clusterInfo = clusterInfos[i];
+			for (UInt32 j = clusters[i]; j < clusters[i + 1]; ++j)
+			{
+				const Vector3f& p0 = positionPtr[sourceIndices[j * 3 + 0]];
+				const Vector3f& p1 = positionPtr[sourceIndices[j * 3 + 1]];
+				const Vector3f& p2 = positionPtr[sourceIndices[j * 3 + 2]];
+
+				Vector3f normal = Vector3f::CrossProduct(p1 - p0, p2 - p0);
+				float area = normal.GetLength();
+
+				clusterInfo.centroid += (p0 + p1 + p2) * (area / 3.f);
+				clusterInfo.normal += normal;
+				clusterInfo.area += area;
+			}
+
+			meshCentroid += clusterInfo.centroid;
+			meshArea += clusterInfo.area;
+
+			if (clusterInfo.area > 0.f)
+				clusterInfo.centroid /= clusterInfo.area;
+
+			clusterInfo.normal.Normalize();
+		}
+
+		if (meshArea > 0.f)
+			meshCentroid /= meshArea;
+
+		for (ClusterInfo& clusterInfo : clusterInfos)
+			clusterInfo.sortKey = clusterInfo.normal.DotProduct(clusterInfo.centroid - meshCentroid);
+
+		std::vector<std::size_t> clusterOrder(clusterCount);
+		for (std::size_t i = 0; i < clusterCount; ++i)
+			clusterOrder[i] = i;
+
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&](std::size_t lhs, std::size_t rhs)
+		{
+			return clusterInfos[lhs].sortKey > clusterInfos[rhs].sortKey;
+		});
+
+		UInt32 outputIndex = 0;
+		for (std::size_t clusterIndex : clusterOrder)
+		{
+			for (UInt32 i = clusters[clusterIndex] * 3; i < clusters[clusterIndex + 1] * 3; ++i)
+				indices[outputIndex++] = sourceIndices[i];
+		}
+	}
+
+	UInt32 OptimizeVertexFetch(IndexIterator indices, UInt32 indexCount, UInt32 vertexCount, UInt32* vertexRemap)
+	{
+		NazaraAssert(vertexRemap, "invalid vertex remap");
+
+		// Number vertices in the order they're first referenced, so they're fetched sequentially
+		std::fill(vertexRemap, vertexRemap + vertexCount, std::numeric_limits<UInt32>::max());
+
+		UInt32 newVertexCount = 0;
+		for (UInt32 i = 0; i < indexCount; ++i)
+		{
+			IndexIterator::Reference index = indices[i];
+
+			UInt32 vertex = index;
+			NazaraAssert(vertex < vertexCount, "index out of range");
+
+			if (vertexRemap[vertex] == std::numeric_limits<UInt32>::max())
+				vertexRemap[vertex] = newVertexCount++;
+
+			index = vertexRemap[vertex];
+		}
+
+		return newVertexCount;
+	}
+
+	/**********************************Simplify*********************************/
+
+	UInt32 SimplifyIndices(IndexIterator indices, UInt32 indexCount, SparsePtr<const Vector3f> positionPtr, UInt32 vertexCount, UInt32 targetIndexCount, float targetError, UInt32* outputIndices, float* resultError)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(indexCount % 3 == 0, "index count must be a multiple of 3");
+		NazaraAssert(positionPtr, "invalid positions");
+		NazaraAssert(outputIndices, "invalid output indices");
+
+		// Iterative edge collapse driven by quadric error metrics ("Surface Simplification Using Quadric Error Metrics", Garland & Heckbert)
+		// Vertices are only collapsed onto other existing vertices, which means simplified indices can share the original vertex buffer
+		for (UInt32 i = 0; i < indexCount; ++i)
+			outputIndices[i] = indices[i];
+
+		if (resultError)
+			*resultError = 0.f;
+
+		if (indexCount == 0 || targetIndexCount >= indexCount)
+			return indexCount;
+
+		// Work in a normalized space so errors are relative to the mesh size
+		Boxf aabb = ComputeAABB(positionPtr, vertexCount);
+		float scale = std::max({ aabb.width, aabb.height, aabb.depth });
+		scale = (scale > 0.f) ? 1.f / scale : 1.f;
+
+		std::vector<Vector3f> positions(vertexCount);
+		for (UInt32 i = 0; i < vertexCount; ++i)
+			positions[i] = (positionPtr[i] - aabb.GetPosition()) * scale;
+
+		// Vertices sharing the same position (attribute seams) are welded to find the real topology of the mesh
+		// A position shared by two vertices is a simple seam, whose vertices are collapsed in lockstep, more than two are locked
+		std::vector<UInt32> weldRemap(vertexCount);
+		std::vector<UInt32> seamSiblings(vertexCount);
+		std::vector<SimplifyVertexKind> vertexKinds(vertexCount, SimplifyVertexKind::Manifold);
+		{
+			std::unordered_map<Vector3f, UInt32> firstVertexByPosition;
+			firstVertexByPosition.reserve(vertexCount);
+
+			for (UInt32 i = 0; i < vertexCount; ++i)
+			{
+				auto it = firstVertexByPosition.emplace(positions[i], i).first;
+				UInt32 firstVertex = it->second;
+
+				weldRemap[i] = firstVertex;
+				seamSiblings[i] = i;
+
+				if (firstVertex == i)
+					continue;
+
+				if (vertexKinds[firstVertex] == SimplifyVertexKind::Manifold)
+				{
+					vertexKinds[i] = SimplifyVertexKind::Seam;
+					vertexKinds[firstVertex] = SimplifyVertexKind::Seam;
+					seamSiblings[i] = firstVertex;
+					seamSiblings[firstVertex] = i;
+				}
+				else
+				{
+					// Third vertex at this position
+					vertexKinds[i] = SimplifyVertexKind::Locked;
+					vertexKinds[firstVertex] = SimplifyVertexKind::Locked;
+					vertexKinds[seamSiblings[firstVertex]] = SimplifyVertexKind::Locked;
+				}
+			}
+		}
+
+		std::vector<UInt64> edges; //< welded edges
+		std::vector<UInt64> vertexEdges;
+		auto BuildEdges = [&]
+		{
+			edges.clear();
+			vertexEdges.clear();
+			for (UInt32 i = 0; i < indexCount; i += 3)
+			{
+				for (UInt32 j = 0; j < 3; ++j)
+				{
+					UInt32 a = outputIndices[i + j];
+					UInt32 b = outputIndices[i + (j + 1) % 3];
+
+					edges.push_back(EncodeEdge(weldRemap[a], weldRemap[b]));
+					vertexEdges.push_back(EncodeEdge(a, b));
+				}
+			}
+
+			std::sort(edges.begin(), edges.end());
+			std::sort(vertexEdges.begin(), vertexEdges.end());
+		};
+
+		auto IsBorderEdge = [&](UInt32 a, UInt32 b)
+		{
+			return !std::binary_search(edges.begin(), edges.end(), EncodeEdge(weldRemap[b], weldRemap[a]));
+		};
+
+		// Seam edges have no opposite edge between the same vertices, but one between their siblings
+		auto IsSeamEdge = [&](UInt32 a, UInt32 b)
+		{
+			return !std::binary_search(vertexEdges.begin(), vertexEdges.end(), EncodeEdge(b, a)) &&
+			       std::binary_search(vertexEdges.begin(), vertexEdges.end(), EncodeEdge(seamSiblings[b], seamSiblings[a]));
+		};
+
+		// Compute initial quadrics from triangle planes, and constrain borders with planes perpendicular to them
+		constexpr float BorderWeight = 10.f;
+
+		BuildEdges();
+
+		std::vector<Quadric> quadrics(vertexCount);
+		for (UInt32 i = 0; i < indexCount; i += 3)
+		{
+			const Vector3f& p0 = positions[outputIndices[i + 0]];
+			const Vector3f& p1 = positions[outputIndices[i + 1]];
+			const Vector3f& p2 = positions[outputIndices[i + 2]];
+
+			Vector3f normal = Vector3f::CrossProduct(p1 - p0, p2 - p0);
+			float area = normal.GetLength();
+			if (area > 0.f)
+				normal /= area;
+
+			for (UInt32 j = 0; j < 3; ++j)
+			{
+				UInt32 vertex = outputIndices[i + j];
+				UInt32 nextVertex = outputIndices[i + (j + 1) % 3];
+
+				if (area > 0.f)
+					quadrics[vertex].AddPlane(normal, -normal.DotProduct(p0), area * 0.5f);
+
+				if (!IsBorderEdge(vertex, nextVertex))
+					continue;
+
+				for (UInt32 borderVertex : { vertex, nextVertex })
+				{
+					if (vertexKinds[borderVertex] == SimplifyVertexKind::Manifold)
+						vertexKinds[borderVertex] = SimplifyVertexKind::Border;
+					else if (vertexKinds[borderVertex] == SimplifyVertexKind::Seam)
+					{
+						vertexKinds[borderVertex] = SimplifyVertexKind::Locked;
+						vertexKinds[seamSiblings[borderVertex]] = SimplifyVertexKind::Locked;
+					}
+				}
+
+				Vector3f edge = positions[nextVertex] - positions[vertex];
+				float edgeLength = edge.GetLength();
+				if (area <= 0.f || edgeLength <= 0.f)
+					continue;
+
+				Vector3f borderNormal = Vector3f::CrossProduct(edge, normal) / edgeLength;
+				float borderDistance = -borderNormal.DotProduct(positions[vertex]);
+
+				quadrics[vertex].AddPlane(borderNormal, borderDistance, edgeLength * edgeLength * BorderWeight);
+				quadrics[nextVertex].AddPlane(borderNormal, borderDistance, edgeLength * edgeLength * BorderWeight);
+			}
+		}
+
+		struct Collapse
+		{
+			UInt32 source;
+			UInt32 target;
+			float error;
+			bool isBorder;
+		};
+
+		auto CanCollapse = [&](UInt32 source, UInt32 target, bool isBorderEdge)
+		{
+			switch (vertexKinds[source])
+			{
+				case SimplifyVertexKind::Manifold: return true;
+				case SimplifyVertexKind::Border:   return isBorderEdge && vertexKinds[target] != SimplifyVertexKind::Manifold;
+				case SimplifyVertexKind::Seam:     return vertexKinds[target] == SimplifyVertexKind::Seam && IsSeamEdge(source, target);
+				case SimplifyVertexKind::Locked:   return false;
+			}
+
+			return false;
+		};
+
+		// Seam vertices are collapsed along with their sibling, so their error accounts for both sides of the seam
+		auto ComputeCollapseError = [&](UInt32 source, UInt32 target)
+		{
+			if (vertexKinds[source] != SimplifyVertexKind::Seam)
+				return quadrics[source].Evaluate(positions[target]);
+
+			Quadric quadric = quadrics[source];
+			quadric += quadrics[seamSiblings[source]];
+
+			return quadric.Evaluate(positions[target]);
+		};
+
+		std::vector<Collapse> collapses;
+		std::vector<UInt32> vertexTriangleOffsets(vertexCount + 1);
+		std::vector<UInt32> vertexTriangles;
+		std::vector<UInt32> vertexRemap(vertexCount);
+		std::vector<bool> collapseLocked(vertexCount);
+
+		float maxError = targetError * targetError; //< quadrics store squared distances
+		float currentError = 0.f;
+
+		while (indexCount > targetIndexCount)
+		{
+			// Triangles adjacent to each vertex, used to prevent collapses from flipping them
+			std::fill(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end(), 0);
+			for (UInt32 i = 0; i < indexCount; ++i)
+				vertexTriangleOffsets[outputIndices[i] + 1]++;
+
+			for (UInt32 i = 0; i < vertexCount; ++i)
+				vertexTriangleOffsets[i + 1] += vertexTriangleOffsets[i];
+
+			vertexTriangles.resize(indexCount);
+			{
+				std::vector<UInt32> fillOffsets(vertexTriangleOffsets.begin(), vertexTriangleOffsets.end() - 1);
+				for (UInt32 i = 0; i < indexCount; ++i)
+					vertexTriangles[fillOffsets[outputIndices[i]]++] = i / 3;
+			}
+
+			// Pick the cheapest allowed direction for every edge
+			collapses.clear();
+			for (UInt32 i = 0; i < indexCount; i += 3)
+			{
+				for (UInt32 j = 0; j < 3; ++j)
+				{
+					UInt32 a = outputIndices[i + j];
+					UInt32 b = outputIndices[i + (j + 1) % 3];
+
+					bool isBorderEdge = IsBorderEdge(a, b);
+					if (a > b && !isBorderEdge)
+						continue; //< interior edges are seen twice
+
+					bool canCollapseA = CanCollapse(a, b, isBorderEdge);
+					bool canCollapseB = CanCollapse(b, a, isBorderEdge);
+					if (!canCollapseA && !canCollapseB)
+						continue;
+
+					float errorA = (canCollapseA) ? ComputeCollapseError(a, b) : std::numeric_limits<float>::infinity();
+					float errorB = (canCollapseB) ? ComputeCollapseError(b, a) : std::numeric_limits<float>::infinity();
+
+					if (errorA <= errorB)
+						collapses.push_back({ a, b, errorA, isBorderEdge });
+					else
+						collapses.push_back({ b, a, errorB, isBorderEdge });
+				}
+			}
+
+			std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.error < rhs.error; });
+
+			// Apply as many independent collapses as possible in this pass
+			for (UInt32 i = 0; i < vertexCount; ++i)
+				vertexRemap[i] = i;
+
+			std::fill(collapseLocked.begin(), collapseLocked.end(), false);
+
+			UInt32 trianglesToRemove = (indexCount - targetIndexCount + 2) / 3;
+			UInt32 removedTriangles = 0;
+			UInt32 collapseCount = 0;
+
+			auto WouldFlip = [&](UInt32 source, UInt32 target)
+			{
+				const Vector3f& newPosition = positions[target];
+				for (UInt32 j = vertexTriangleOffsets[source]; j < vertexTriangleOffsets[source + 1]; ++j)
+				{
+					const UInt32* triangle = &outputIndices[vertexTriangles[j] * 3];
+					if (triangle[0] == target || triangle[1] == target || triangle[2] == target)
+						continue; //< will be removed by the collapse
+
+					Vector3f p[3] = { positions[triangle[0]], positions[triangle[1]], positions[triangle[2]] };
+					Vector3f oldNormal = Vector3f::CrossProduct(p[1] - p[0], p[2] - p[0]);
+					if (oldNormal.GetSquaredLength() <= 0.f)
+						continue;
+
+					p[std::find(triangle, triangle + 3, source) - triangle] = newPosition;
+
+					Vector3f newNormal = Vector3f::CrossProduct(p[1] - p[0], p[2] - p[0]);
+
+					// Reject flipped triangles as well as triangles getting too thin
+					if (oldNormal.DotProduct(newNormal) <= 0.25f * oldNormal.GetLength() * newNormal.GetLength())
+						return true;
+				}
+
+				return false;
+			};
+
+			auto ApplyCollapse = [&](UInt32 source, UInt32 target)
+			{
+				vertexRemap[source] = target;
+				quadrics[target] += quadrics[source];
+
+				// Lock the neighborhood of the collapse, as its triangles are no longer up to date
+				for (UInt32 j = vertexTriangleOffsets[source]; j < vertexTriangleOffsets[source + 1]; ++j)
+				{
+					const UInt32* triangle = &outputIndices[vertexTriangles[j] * 3];
+					collapseLocked[triangle[0]] = true;
+					collapseLocked[triangle[1]] = true;
+					collapseLocked[triangle[2]] = true;
+				}
+			};
+
+			for (const Collapse& collapse : collapses)
+			{
+				if (collapse.error > maxError || removedTriangles >= trianglesToRemove)
+					break;
+
+				if (collapseLocked[collapse.source] || collapseLocked[collapse.target])
+					continue;
+
+				if (WouldFlip(collapse.source, collapse.target))
+					continue;
+
+				if (vertexKinds[collapse.source] == SimplifyVertexKind::Seam)
+				{
+					// Collapse the other side of the seam the same way, or the seam would crack open
+					UInt32 siblingSource = seamSiblings[collapse.source];
+					UInt32 siblingTarget = seamSiblings[collapse.target];
+					if (collapseLocked[siblingSource] || collapseLocked[siblingTarget])
+						continue;
+
+					if (WouldFlip(siblingSource, siblingTarget))
+						continue;
+
+					ApplyCollapse(siblingSource, siblingTarget);
+				}
+
+				ApplyCollapse(collapse.source, collapse.target);
+
+				currentError = std::max(currentError, collapse.error);
+				removedTriangles += (collapse.isBorder) ? 1 : 2;
+				collapseCount++;
+			}
+
+			if (collapseCount == 0)
+				break;
+
+			// Remap indices and remove degenerate triangles
+			UInt32 newIndexCount = 0;
+			for (UInt32 i = 0; i < indexCount; i += 3)
+			{
+				UInt32 a = vertexRemap[outputIndices[i + 0]];
+				UInt32 b = vertexRemap[outputIndices[i + 1]];
+				UInt32 c = vertexRemap[outputIndices[i + 2]];
+				if (a == b || b == c || c == a)
+					continue;
+
+				outputIndices[newIndexCount++] = a;
+				outputIndices[newIndexCount++] = b;
+				outputIndices[newIndexCount++] = c;
+			}
+
+			indexCount = newIndexCount;
+
+			BuildEdges();
+		}
+
+		if (resultError)
+			*resultError = std::sqrt(currentError);
+
+		return indexCount;
+	}
+
 	/************************************Skin***********************************/
 
 	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
@@ -4,11 +4,18 @@
 
 #include <Nazara/Utility/Font.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/FontData.hpp>
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <Nazara/Utility/GuillotineImageAtlas.hpp>
 #include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_set>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -18,6 +25,85 @@ namespace Nz
 		const UInt8 r_sansationRegular[] = {
 			#include <Nazara/Utility/Resources/Fonts/OpenSans-Regular.ttf.h>
 		};
+
+		struct PendingLayerChange
+		{
+			const Font* font;
+			AbstractImage* oldLayer;
+			AbstractImage* newLayer;
+		};
+
+		thread_local std::vector<PendingLayerChange> s_pendingLayerChanges;
+		thread_local unsigned int s_layerChangeDeferralCount = 0;
+
+		// Atlas layer changes happen while holding the glyph and atlas locks, notifying text drawers at this point could deadlock
+		// if they use the font, so notifications are delayed until the guard (created before locking) is destroyed
+		struct LayerChangeDeferralGuard
+		{
+			LayerChangeDeferralGuard()
+			{
+				s_layerChangeDeferralCount++;
+			}
+
+			~LayerChangeDeferralGuard()
+			{
+				if (--s_layerChangeDeferralCount > 0)
+					return;
+
+				std::vector<PendingLayerChange> pendingLayerChanges;
+				std::swap(pendingLayerChanges, s_pendingLayerChanges);
+
+				for (const PendingLayerChange& layerChange : pendingLayerChanges)
+					layerChange.font->OnFontAtlasLayerChanged(layerChange.font, layerChange.oldLayer, layerChange.newLayer);
+			}
+		};
+
+		constexpr float DistanceFieldInfinity = 1e20f;
+
+		// One dimensional squared distance transform of sampled functions (Felzenszwalb & Huttenlocher), in place
+		// Each output value is min over q of (p - q)^2 + f(q), computed in linear time using the lower envelope of parabolas
+		void TransformSquaredDistances(float* values, std::size_t count, std::size_t stride, float* f, std::size_t* v, float* z)
+		{
+			for (std::size_t q = 0; q < count; ++q)
+				f[q] = values[q * stride];
+
+			std::size_t k = 0;
+			v[0] = 0;
+			z[0] = -std::numeric_limits<float>::infinity();
+			z[1] = std::numeric_limits<float>::infinity();
+
+			for (std::size_t q = 1; q < count; ++q)
+			{
+				// z[0] is -infinity so this always stops at the first parabola
+				float s;
+				for (;;)
+				{
+					// Subtract values first to stay exact between two parabolas at infinity
+					std::size_t r = v[k];
+					s = ((f[q] - f[r]) + static_cast<float>(q * q - r * r)) / (2.f * static_cast<float>(q - r));
+					if (s > z[k])
+						break;
+
+					k--;
+				}
+
+				k++;
+				v[k] = q;
+				z[k] = s;
+				z[k + 1] = std::numeric_limits<float>::infinity();
+			}
+
+			k = 0;
+			for (std::size_t q = 0; q < count; ++q)
+			{
+				while (z[k + 1] < static_cast<float>(q))
+					k++;
+
+				std::size_t r = v[k];
+				float offset = static_cast<float>(q) - static_cast<float>(r);
+				values[q * stride] = f[r] + offset * offset;
+			}
+		}
 	}
 
 	bool FontParams::IsValid() const
@@ -26,8 +112,11 @@ namespace Nz
 	}
 
 	Font::Font() :
+	m_distanceFieldReferenceSize(64),
+	m_distanceFieldSpread(8),
 	m_glyphBorder(s_defaultGlyphBorder),
-	m_minimumStepSize(s_defaultMinimumStepSize)
+	m_minimumStepSize(s_defaultMinimumStepSize),
+	m_distanceFieldEnabled(false)
 	{
 		SetAtlas(s_defaultAtlas);
 	}
@@ -49,17 +138,25 @@ namespace Nz
 			else
 			{
 				// Au moins une autre police utilise cet atlas, on vire nos glyphes un par un
-				for (auto mapIt = m_glyphes.begin(); mapIt != m_glyphes.end(); ++mapIt)
+				// (in distance field mode, glyphes only reference the atlas rects of the glyphes rendered at reference size)
+				for (auto& glyphes : { &m_distanceFieldGlyphes, &m_glyphes })
 				{
-					GlyphMap& glyphMap = mapIt->second;
-					for (auto glyphIt = glyphMap.begin(); glyphIt != glyphMap.end(); ++glyphIt)
+					if (glyphes == &m_glyphes && m_distanceFieldEnabled)
+						continue;
+
+					for (auto mapIt = glyphes->begin(); mapIt != glyphes->end(); ++mapIt)
 					{
-						Glyph& glyph = glyphIt->second;
-						m_atlas->Free(&glyph.atlasRect, &glyph.layerIndex, 1);
+						GlyphMap& glyphMap = mapIt->second;
+						for (auto glyphIt = glyphMap.begin(); glyphIt != glyphMap.end(); ++glyphIt)
+						{
+							Glyph& glyph = glyphIt->second;
+							m_atlas->Free(&glyph.atlasRect, &glyph.layerIndex, 1);
+						}
 					}
 				}
 
 				// Destruction des glyphes mémorisés et notification
+				m_distanceFieldGlyphes.clear();
 				m_glyphes.clear();
 
 				OnFontGlyphCacheCleared(this);
@@ -104,6 +201,22 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Enables or disables distance field glyphes
+	*
+	* In distance field mode, glyphes are rendered once at the reference size as signed distance fields (see SetDistanceFieldReferenceSize)
+	* and every other character size or outline thickness reuses them, only their metrics are scaled.
+	* Such glyphes have to be rendered with a distance field shader (ex: the DistanceField option of the basic material).
+	*/
+	void Font::EnableDistanceField(bool enable)
+	{
+		if (m_distanceFieldEnabled != enable)
+		{
+			ClearGlyphCache();
+			m_distanceFieldEnabled = enable;
+		}
+	}
+
 	bool Font::ExtractGlyph(unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* glyph) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -114,6 +227,7 @@ namespace Nz
 		}
 		#endif
 
+		auto dataLock = LockData();
 		return m_data->ExtractGlyph(characterSize, character, style, outlineThickness, glyph);
 	}
 
@@ -122,9 +236,22 @@ namespace Nz
 		return m_atlas;
 	}
 
+	/*!
+	* \brief Gets an atlas layer (as referenced by glyphs), this is safe to call while another thread renders glyphs
+	*/
+	AbstractImage* Font::GetAtlasLayer(unsigned int layerIndex) const
+	{
+		NazaraAssert(m_atlas, "font has no atlas");
+
+		std::lock_guard lock(s_atlasMutex);
+		return m_atlas->GetLayer(layerIndex);
+	}
+
 	std::size_t Font::GetCachedGlyphCount(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const
 	{
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
+
+		std::shared_lock lock(m_glyphMutex);
 		auto it = m_glyphes.find(key);
 		if (it == m_glyphes.end())
 			return 0;
@@ -134,6 +261,8 @@ namespace Nz
 
 	std::size_t Font::GetCachedGlyphCount() const
 	{
+		std::shared_lock lock(m_glyphMutex);
+
 		std::size_t count = 0;
 		for (auto& pair : m_glyphes)
 			count += pair.second.size();
@@ -141,6 +270,16 @@ namespace Nz
 		return count;
 	}
 
+	unsigned int Font::GetDistanceFieldReferenceSize() const
+	{
+		return m_distanceFieldReferenceSize;
+	}
+
+	unsigned int Font::GetDistanceFieldSpread() const
+	{
+		return m_distanceFieldSpread;
+	}
+
 	std::string Font::GetFamilyName() const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -165,25 +304,52 @@ namespace Nz
 		#endif
 
 		// Use a cache as QueryKerning may be costly (may induce an internal size change)
-		auto& map = m_kerningCache[characterSize];
-
 		UInt64 key = (static_cast<UInt64>(first) << 32) | second;
 
-		auto it = map.find(key);
-		if (it == map.end())
 		{
-			int kerning = m_data->QueryKerning(characterSize, first, second);
-			map.insert(std::make_pair(key, kerning));
+			std::shared_lock lock(m_kerningMutex);
+			if (auto mapIt = m_kerningCache.find(characterSize); mapIt != m_kerningCache.end())
+			{
+				if (auto it = mapIt->second.find(key); it != mapIt->second.end())
+					return it->second;
+			}
+		}
 
-			return kerning;
+		int kerning;
+		{
+			auto dataLock = LockData();
+			kerning = m_data->QueryKerning(characterSize, first, second);
 		}
-		else
-			return it->second;
+
+		std::unique_lock lock(m_kerningMutex);
+		m_kerningCache[characterSize].emplace(key, kerning);
+
+		return kerning;
 	}
 
+	/*!
+	* \brief Gets a glyph, rendering it if it's not in the glyph cache
+	*
+	* Glyph queries (GetGlyph, GetKerning, GetSizeInfo, Precache) can be made from multiple threads at once,
+	* but they should not happen at the same time as cache clearing or font settings changes.
+	* Atlas notifications may be triggered by the thread which renders the glyph.
+	*/
 	const Font::Glyph& Font::GetGlyph(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
+
+		{
+			std::shared_lock lock(m_glyphMutex);
+			if (auto mapIt = m_glyphes.find(key); mapIt != m_glyphes.end())
+			{
+				if (auto it = mapIt->second.find(character); it != mapIt->second.end())
+					return it->second;
+			}
+		}
+
+		LayerChangeDeferralGuard layerChangeGuard;
+
+		std::unique_lock lock(m_glyphMutex);
 		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character);
 	}
 
@@ -209,10 +375,15 @@ namespace Nz
 		}
 		#endif
 
-		auto it = m_sizeInfoCache.find(characterSize);
-		if (it == m_sizeInfoCache.end())
 		{
-			SizeInfo sizeInfo;
+			std::shared_lock lock(m_sizeInfoMutex);
+			if (auto it = m_sizeInfoCache.find(characterSize); it != m_sizeInfoCache.end())
+				return it->second;
+		}
+
+		SizeInfo sizeInfo;
+		{
+			auto dataLock = LockData();
 			sizeInfo.lineHeight = m_data->QueryLineHeight(characterSize);
 			sizeInfo.underlinePosition = m_data->QueryUnderlinePosition(characterSize);
 			sizeInfo.underlineThickness = m_data->QueryUnderlineThickness(characterSize);
@@ -225,11 +396,10 @@ namespace Nz
 				NazaraWarning("Failed to extract space character from font, using half the character size");
 				sizeInfo.spaceAdvance = characterSize / 2;
 			}
-
-			it = m_sizeInfoCache.insert(std::make_pair(characterSize, sizeInfo)).first;
 		}
 
-		return it->second;
+		std::unique_lock lock(m_sizeInfoMutex);
+		return m_sizeInfoCache.emplace(characterSize, sizeInfo).first->second;
 	}
 
 	std::string Font::GetStyleName() const
@@ -245,6 +415,11 @@ namespace Nz
 		return m_data->GetStyleName();
 	}
 
+	bool Font::IsDistanceFieldEnabled() const
+	{
+		return m_distanceFieldEnabled;
+	}
+
 	bool Font::IsValid() const
 	{
 		return m_data != nullptr;
@@ -252,24 +427,133 @@ namespace Nz
 
 	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
 	{
-		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		return PrecacheGlyph(m_glyphes[key], characterSize, style, outlineThickness, character).valid;
+		return GetGlyph(characterSize, style, outlineThickness, character).valid;
 	}
 
 	bool Font::Precache(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const
 	{
 		NazaraAssert(!characterSet.empty(), "empty character set");
 
+		LayerChangeDeferralGuard layerChangeGuard;
+
+		if (m_distanceFieldEnabled)
+		{
+			PrecacheDistanceFieldGlyphs(characterSize, style, outlineThickness, characterSet);
+			return true;
+		}
+
+		#if NAZARA_UTILITY_SAFE
+		if (!m_atlas)
+		{
+			NazaraError("Font has no atlas");
+			return false;
+		}
+		#endif
+
 		UInt64 key = ComputeKey(characterSize, style, outlineThickness);
-		auto& glyphMap = m_glyphes[key];
 
-		IterateOnCodepoints(characterSet, [&](const char32_t* characters, std::size_t characterCount)
+		// Simulated styles reuse glyphs of the supported style, let PrecacheGlyph handle them one by one
+		bool requireFauxStyle = (style & TextStyle::Bold && !m_data->SupportsStyle(TextStyle::Bold)) ||
+		                        (style & TextStyle::Italic && !m_data->SupportsStyle(TextStyle::Italic)) ||
+		                        (outlineThickness > 0.f && !m_data->SupportsOutline(outlineThickness));
+
+		if (requireFauxStyle)
 		{
-			for (std::size_t i = 0; i < characterCount; ++i)
-				PrecacheGlyph(glyphMap, characterSize, style, outlineThickness, characters[i]);
+			std::unique_lock lock(m_glyphMutex);
+			GlyphMap& glyphMap = m_glyphes[key];
+
+			IterateOnCodepoints(characterSet, [&](const char32_t* characters, std::size_t characterCount)
+			{
+				for (std::size_t i = 0; i < characterCount; ++i)
+					PrecacheGlyph(glyphMap, characterSize, style, outlineThickness, characters[i]);
+
+				return true;
+			});
 
 			return true;
-		});
+		}
+
+		// List missing glyphs
+		std::vector<char32_t> missingCharacters;
+		{
+			std::shared_lock lock(m_glyphMutex);
+
+			const GlyphMap* glyphMap = nullptr;
+			if (auto it = m_glyphes.find(key); it != m_glyphes.end())
+				glyphMap = &it->second;
+
+			std::unordered_set<char32_t> pendingCharacters;
+			IterateOnCodepoints(characterSet, [&](const char32_t* characters, std::size_t characterCount)
+			{
+				for (std::size_t i = 0; i < characterCount; ++i)
+				{
+					char32_t character = characters[i];
+					if (glyphMap && glyphMap->find(character) != glyphMap->end())
+						continue;
+
+					if (pendingCharacters.insert(character).second)
+						missingCharacters.push_back(character);
+				}
+
+				return true;
+			});
+		}
+
+		if (missingCharacters.empty())
+			return true;
+
+		// Render glyphs without holding the cache lock, across the task scheduler if font data allows it
+		std::vector<FontGlyph> fontGlyphs(missingCharacters.size());
+		std::unique_ptr<bool[]> extracted = std::make_unique<bool[]>(missingCharacters.size());
+
+		auto ExtractGlyphs = [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+				extracted[i] = ExtractGlyph(characterSize, missingCharacters[i], style, outlineThickness, &fontGlyphs[i]);
+		};
+
+		std::size_t workerCount = TaskScheduler::GetWorkerCount();
+		if (m_data->SupportsConcurrentExtraction() && workerCount > 1 && missingCharacters.size() > 1)
+		{
+			// Fonts may be precached from several threads at once, or from a task
+			TaskGroup extractionTasks;
+
+			std::size_t taskCount = std::min<std::size_t>(workerCount, missingCharacters.size());
+			std::size_t glyphPerTask = (missingCharacters.size() + taskCount - 1) / taskCount;
+			for (std::size_t first = 0; first < missingCharacters.size(); first += glyphPerTask)
+			{
+				std::size_t last = std::min(first + glyphPerTask, missingCharacters.size());
+				extractionTasks.AddTask([&ExtractGlyphs, first, last] { ExtractGlyphs(first, last); });
+			}
+
+			extractionTasks.Wait();
+		}
+		else
+			ExtractGlyphs(0, missingCharacters.size());
+
+		// Insert every glyph at once, atlas uploads will be processed together when its layers are retrieved
+		std::unique_lock lock(m_glyphMutex);
+		GlyphMap& glyphMap = m_glyphes[key];
+
+		std::lock_guard atlasLock(s_atlasMutex);
+		for (std::size_t i = 0; i < missingCharacters.size(); ++i)
+		{
+			char32_t character = missingCharacters[i];
+			if (glyphMap.find(character) != glyphMap.end())
+				continue; //< another thread was faster
+
+			Glyph& glyph = glyphMap[character];
+			glyph.distanceFieldEdge = 0.5f;
+			glyph.fauxOutlineThickness = 0.f;
+			glyph.requireFauxBold = false;
+			glyph.requireFauxItalic = false;
+			glyph.valid = false;
+
+			if (extracted[i])
+				StoreGlyph(glyph, fontGlyphs[i]);
+			else
+				NazaraWarning("Failed to extract glyph \"" + FromUtf32String(std::u32string_view(&character, 1)) + "\"");
+		}
 
 		return true;
 	}
@@ -296,6 +580,40 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Sets the character size at which distance field glyphes are rendered
+	*
+	* Bigger sizes keep sharper corners when scaling glyphes up, at the expense of atlas memory.
+	*/
+	void Font::SetDistanceFieldReferenceSize(unsigned int characterSize)
+	{
+		if (m_distanceFieldReferenceSize != characterSize)
+		{
+			NazaraAssert(characterSize != 0, "reference size cannot be zero");
+
+			m_distanceFieldReferenceSize = characterSize;
+			if (m_distanceFieldEnabled)
+				ClearGlyphCache();
+		}
+	}
+
+	/*!
+	* \brief Sets the maximum distance (in pixels, at reference size) stored around distance field glyphes
+	*
+	* It also limits the outline thickness (at reference size) which can be rendered from distance fields.
+	*/
+	void Font::SetDistanceFieldSpread(unsigned int spread)
+	{
+		if (m_distanceFieldSpread != spread)
+		{
+			NazaraAssert(spread >= 2, "spread must be at least two pixels");
+
+			m_distanceFieldSpread = spread;
+			if (m_distanceFieldEnabled)
+				ClearGlyphCache();
+		}
+	}
+
 	void Font::SetGlyphBorder(unsigned int borderSize)
 	{
 		if (m_glyphBorder != borderSize)
@@ -316,6 +634,87 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Converts a glyph coverage bitmap to a signed distance field extended by spread pixels on each side
+	*
+	* The field value is 0.5 on the glyph edge, greater inside and lower outside, distances being normalized by twice the spread.
+	* Antialiased pixels place the edge at a subpixel distance from their center (0.5 - coverage), which is then propagated using
+	* an exact euclidean distance transform running in linear time.
+	*
+	* \param coverage Glyph coverage (A8 format)
+	* \param spread Maximum distance (in pixels) stored around the glyph edge
+	*/
+	Image Font::ComputeDistanceField(const Image& coverage, unsigned int spread)
+	{
+		NazaraAssert(coverage.GetFormat() == PixelFormat::A8, "glyph coverage must be A8");
+		NazaraAssert(spread > 0, "spread must be positive");
+
+		std::size_t width = coverage.GetWidth();
+		std::size_t height = coverage.GetHeight();
+		std::size_t fieldWidth = width + spread * 2;
+		std::size_t fieldHeight = height + spread * 2;
+		std::size_t pixelCount = fieldWidth * fieldHeight;
+
+		// Squared distances to the edge from outside and inside pixels, seeded on the glyph pixels
+		std::vector<float> outsideDistances(pixelCount, DistanceFieldInfinity);
+		std::vector<float> insideDistances(pixelCount, 0.f);
+
+		const UInt8* pixels = coverage.GetConstPixels();
+		for (std::size_t y = 0; y < height; ++y)
+		{
+			for (std::size_t x = 0; x < width; ++x)
+			{
+				UInt8 pixelCoverage = pixels[y * width + x];
+				if (pixelCoverage == 0)
+					continue;
+
+				std::size_t fieldIndex = (y + spread) * fieldWidth + x + spread;
+				if (pixelCoverage == 255)
+				{
+					outsideDistances[fieldIndex] = 0.f;
+					insideDistances[fieldIndex] = DistanceFieldInfinity;
+				}
+				else
+				{
+					// Approximate the edge as crossing the pixel, partially covered pixels are on both sides of it
+					float edgeDistance = 0.5f - pixelCoverage / 255.f;
+					outsideDistances[fieldIndex] = (edgeDistance > 0.f) ? edgeDistance * edgeDistance : 0.f;
+					insideDistances[fieldIndex] = (edgeDistance < 0.f) ? edgeDistance * edgeDistance : 0.f;
+				}
+			}
+		}
+
+		std::size_t maxSize = std::max(fieldWidth, fieldHeight);
+		std::vector<float> f(maxSize);
+		std::vector<std::size_t> v(maxSize);
+		std::vector<float> z(maxSize + 1);
+
+		// The 2D transform is separable: columns then rows
+		for (float* distances : { outsideDistances.data(), insideDistances.data() })
+		{
+			for (std::size_t x = 0; x < fieldWidth; ++x)
+				TransformSquaredDistances(&distances[x], fieldHeight, fieldWidth, f.data(), v.data(), z.data());
+
+			for (std::size_t y = 0; y < fieldHeight; ++y)
+				TransformSquaredDistances(&distances[y * fieldWidth], fieldWidth, 1, f.data(), v.data(), z.data());
+		}
+
+		Image distanceField;
+		distanceField.Create(ImageType::E2D, PixelFormat::A8, SafeCast<unsigned int>(fieldWidth), SafeCast<unsigned int>(fieldHeight));
+		UInt8* fieldPixels = distanceField.GetPixels();
+
+		float invRange = 1.f / (2.f * spread);
+		for (std::size_t i = 0; i < pixelCount; ++i)
+		{
+			float distance = std::sqrt(insideDistances[i]) - std::sqrt(outsideDistances[i]);
+
+			float value = 0.5f + distance * invRange;
+			fieldPixels[i] = static_cast<UInt8>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+		}
+
+		return distanceField;
+	}
+
 	std::shared_ptr<AbstractAtlas> Font::GetDefaultAtlas()
 	{
 		return s_defaultAtlas;
@@ -388,6 +787,21 @@ namespace Nz
 		s_defaultMinimumStepSize = minimumStepSize;
 	}
 
+	float Font::ComputeDistanceFieldEdge(unsigned int characterSize, float outlineThickness) const
+	{
+		if (outlineThickness <= 0.f)
+			return 0.5f;
+
+		// Quantize reference outline thickness to limit the number of edge values (each one requires a material variant to render)
+		float referenceOutline = outlineThickness * m_distanceFieldReferenceSize / characterSize;
+		referenceOutline = std::round(referenceOutline * 4.f) / 4.f;
+
+		// Distance fields don't store distances past the spread
+		referenceOutline = std::min(referenceOutline, static_cast<float>(m_distanceFieldSpread - 1));
+
+		return 0.5f - referenceOutline / (2.f * m_distanceFieldSpread);
+	}
+
 	UInt64 Font::ComputeKey(unsigned int characterSize, TextStyleFlags style, float outlineThickness) const
 	{
 		// Adjust size to step size
@@ -405,6 +819,85 @@ namespace Nz
 		return (sizeStylePart << 32) | reinterpret_cast<Nz::UInt32&>(outlineThickness);
 	}
 
+	bool Font::ExtractDistanceFieldSource(TextStyleFlags style, char32_t character, Glyph& glyph, FontGlyph& fontGlyph) const
+	{
+		glyph.distanceFieldEdge = 0.5f;
+		glyph.fauxOutlineThickness = 0.f; //< outlines are rendered from the distance field
+		glyph.requireFauxBold = false;
+		glyph.requireFauxItalic = false;
+		glyph.valid = false;
+
+		TextStyleFlags supportedStyle = style;
+		if (style & TextStyle::Bold && !m_data->SupportsStyle(TextStyle::Bold))
+		{
+			glyph.requireFauxBold = true;
+			supportedStyle &= ~TextStyle::Bold;
+		}
+
+		if (style & TextStyle::Italic && !m_data->SupportsStyle(TextStyle::Italic))
+		{
+			glyph.requireFauxItalic = true;
+			supportedStyle &= ~TextStyle::Italic;
+		}
+
+		if (!ExtractGlyph(m_distanceFieldReferenceSize, character, supportedStyle, 0.f, &fontGlyph))
+		{
+			NazaraWarning("Failed to extract glyph \"" + FromUtf32String(std::u32string_view(&character, 1)) + "\"");
+			return false;
+		}
+
+		return true;
+	}
+
+	const Font::Glyph& Font::InsertDistanceFieldGlyph(GlyphMap& referenceMap, char32_t character, const Glyph& sourceGlyph, const FontGlyph& fontGlyph, const Image& distanceField) const
+	{
+		Glyph& glyph = referenceMap[character];
+		glyph = sourceGlyph;
+		glyph.aabb = fontGlyph.aabb;
+		glyph.advance = fontGlyph.advance;
+		glyph.atlasRect = Rectui(0, 0, 0, 0);
+
+		if (distanceField.IsValid())
+		{
+			// Add a small border to prevent GPU to sample another glyph pixel
+			glyph.atlasRect.width = distanceField.GetWidth() + m_glyphBorder*2;
+			glyph.atlasRect.height = distanceField.GetHeight() + m_glyphBorder*2;
+
+			std::lock_guard atlasLock(s_atlasMutex);
+			if (!m_atlas->Insert(distanceField, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
+			{
+				NazaraError("Failed to insert glyph into atlas");
+				return glyph;
+			}
+
+			// Recenter and remove glyph border
+			glyph.atlasRect.x += m_glyphBorder;
+			glyph.atlasRect.y += m_glyphBorder;
+			glyph.atlasRect.width -= m_glyphBorder*2;
+			glyph.atlasRect.height -= m_glyphBorder*2;
+
+			// The distance field extends the glyph by the spread on each side
+			int spread = SafeCast<int>(m_distanceFieldSpread);
+
+			glyph.aabb.x -= spread;
+			glyph.aabb.y -= spread;
+			glyph.aabb.width = SafeCast<int>(distanceField.GetWidth());
+			glyph.aabb.height = SafeCast<int>(distanceField.GetHeight());
+		}
+
+		glyph.valid = true;
+
+		return glyph;
+	}
+
+	std::unique_lock<std::mutex> Font::LockData() const
+	{
+		if (m_data && m_data->SupportsConcurrentExtraction())
+			return std::unique_lock<std::mutex>(m_dataMutex, std::defer_lock);
+
+		return std::unique_lock<std::mutex>(m_dataMutex);
+	}
+
 	void Font::OnAtlasCleared(const AbstractAtlas* atlas)
 	{
 		NazaraUnused(atlas);
@@ -419,6 +912,7 @@ namespace Nz
 		#endif
 
 		// Notre atlas vient d'être vidé, détruisons le cache de glyphe
+		m_distanceFieldGlyphes.clear();
 		m_glyphes.clear();
 
 		OnFontGlyphCacheCleared(this);
@@ -440,7 +934,151 @@ namespace Nz
 		#endif
 
 		// Pour faciliter le travail des ressources qui nous écoutent
-		OnFontAtlasLayerChanged(this, oldLayer, newLayer);
+		if (s_layerChangeDeferralCount > 0)
+			s_pendingLayerChanges.push_back({ this, oldLayer, newLayer });
+		else
+			OnFontAtlasLayerChanged(this, oldLayer, newLayer);
+	}
+
+	const Font::Glyph& Font::PrecacheDistanceFieldGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
+	{
+		// Glyphes are only rendered once at reference size, other sizes scale their metrics and outlines move their edge value
+		GlyphMap& referenceMap = m_distanceFieldGlyphes[ComputeKey(m_distanceFieldReferenceSize, style, 0.f)];
+
+		const Glyph* referenceGlyph;
+		if (auto it = referenceMap.find(character); it != referenceMap.end())
+			referenceGlyph = &it->second;
+		else
+		{
+			#if NAZARA_UTILITY_SAFE
+			if (!m_atlas)
+			{
+				NazaraError("Font has no atlas");
+				Glyph& invalidGlyph = glyphMap[character];
+				invalidGlyph.valid = false;
+				return invalidGlyph;
+			}
+			#endif
+
+			Glyph sourceGlyph;
+			FontGlyph fontGlyph;
+			if (ExtractDistanceFieldSource(style, character, sourceGlyph, fontGlyph))
+			{
+				Image distanceField;
+				if (fontGlyph.image.IsValid())
+					distanceField = ComputeDistanceField(fontGlyph.image, m_distanceFieldSpread);
+
+				referenceGlyph = &InsertDistanceFieldGlyph(referenceMap, character, sourceGlyph, fontGlyph, distanceField);
+			}
+			else
+				referenceGlyph = &(referenceMap[character] = sourceGlyph);
+		}
+
+		Glyph& glyph = glyphMap[character];
+		glyph = *referenceGlyph;
+
+		if (glyph.valid)
+		{
+			float scale = static_cast<float>(characterSize) / m_distanceFieldReferenceSize;
+
+			glyph.aabb.x = static_cast<int>(std::floor(referenceGlyph->aabb.x * scale));
+			glyph.aabb.y = static_cast<int>(std::floor(referenceGlyph->aabb.y * scale));
+			glyph.aabb.width = static_cast<int>(std::ceil(referenceGlyph->aabb.width * scale));
+			glyph.aabb.height = static_cast<int>(std::ceil(referenceGlyph->aabb.height * scale));
+			glyph.advance = static_cast<int>(std::round(referenceGlyph->advance * scale));
+
+			if (outlineThickness > 0.f)
+			{
+				// Outlines use the same distance field with a lower edge value, text drawers offset outlined glyphes by -outlineThickness
+				int outlineOffset = static_cast<int>(std::round(outlineThickness));
+
+				glyph.aabb.x += outlineOffset;
+				glyph.aabb.y += outlineOffset;
+				glyph.distanceFieldEdge = ComputeDistanceFieldEdge(characterSize, outlineThickness);
+			}
+		}
+
+		return glyph;
+	}
+
+	void Font::PrecacheDistanceFieldGlyphs(unsigned int characterSize, TextStyleFlags style, float outlineThickness, std::string_view characterSet) const
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (!m_atlas)
+		{
+			NazaraError("Font has no atlas");
+			return;
+		}
+		#endif
+
+		std::unique_lock lock(m_glyphMutex);
+
+		GlyphMap& referenceMap = m_distanceFieldGlyphes[ComputeKey(m_distanceFieldReferenceSize, style, 0.f)];
+
+		struct PendingGlyph
+		{
+			char32_t character;
+			FontGlyph fontGlyph;
+			Glyph glyph;
+			Image distanceField;
+		};
+
+		// Font data (FreeType) isn't thread-safe, glyphes are extracted sequentially and their distance fields are computed in parallel
+		std::vector<PendingGlyph> pendingGlyphs;
+		IterateOnCodepoints(characterSet, [&](const char32_t* characters, std::size_t characterCount)
+		{
+			for (std::size_t i = 0; i < characterCount; ++i)
+			{
+				char32_t character = characters[i];
+				if (referenceMap.find(character) != referenceMap.end())
+					continue;
+
+				if (std::find_if(pendingGlyphs.begin(), pendingGlyphs.end(), [&](const PendingGlyph& pendingGlyph) { return pendingGlyph.character == character; }) != pendingGlyphs.end())
+					continue;
+
+				PendingGlyph pendingGlyph;
+				pendingGlyph.character = character;
+				if (!ExtractDistanceFieldSource(style, character, pendingGlyph.glyph, pendingGlyph.fontGlyph))
+				{
+					referenceMap[character] = pendingGlyph.glyph; //< don't try again
+					continue;
+				}
+
+				pendingGlyphs.push_back(std::move(pendingGlyph));
+			}
+
+			return true;
+		});
+
+		TaskGroup distanceFieldTasks;
+		for (PendingGlyph& pendingGlyph : pendingGlyphs)
+		{
+			if (!pendingGlyph.fontGlyph.image.IsValid())
+				continue;
+
+			distanceFieldTasks.AddTask([&pendingGlyph, spread = m_distanceFieldSpread]
+			{
+				pendingGlyph.distanceField = ComputeDistanceField(pendingGlyph.fontGlyph.image, spread);
+			});
+		}
+
+		distanceFieldTasks.Wait();
+
+		// Atlas insertion has to be sequential as well
+		for (const PendingGlyph& pendingGlyph : pendingGlyphs)
+			InsertDistanceFieldGlyph(referenceMap, pendingGlyph.character, pendingGlyph.glyph, pendingGlyph.fontGlyph, pendingGlyph.distanceField);
+
+		GlyphMap& glyphMap = m_glyphes[ComputeKey(characterSize, style, outlineThickness)];
+		IterateOnCodepoints(characterSet, [&](const char32_t* characters, std::size_t characterCount)
+		{
+			for (std::size_t i = 0; i < characterCount; ++i)
+			{
+				if (glyphMap.find(characters[i]) == glyphMap.end())
+					PrecacheDistanceFieldGlyph(glyphMap, characterSize, style, outlineThickness, characters[i]);
+			}
+
+			return true;
+		});
 	}
 
 	const Font::Glyph& Font::PrecacheGlyph(GlyphMap& glyphMap, unsigned int characterSize, TextStyleFlags style, float outlineThickness, char32_t character) const
@@ -449,6 +1087,9 @@ namespace Nz
 		if (it != glyphMap.end())
 			return it->second;
 
+		if (m_distanceFieldEnabled)
+			return PrecacheDistanceFieldGlyph(glyphMap, characterSize, style, outlineThickness, character);
+
 		Glyph& glyph = glyphMap[character]; //< Insert a new glyph
 		glyph.valid = false;
 
@@ -461,6 +1102,7 @@ namespace Nz
 		#endif
 
 		// Check if requested style is supported by our font (otherwise it will need to be simulated)
+		glyph.distanceFieldEdge = 0.5f;
 		glyph.fauxOutlineThickness = 0.f;
 		glyph.requireFauxBold = false;
 		glyph.requireFauxItalic = false;
@@ -491,40 +1133,8 @@ namespace Nz
 			FontGlyph fontGlyph;
 			if (ExtractGlyph(characterSize, character, style, outlineThickness, &fontGlyph))
 			{
-				if (fontGlyph.image.IsValid())
-				{
-					glyph.atlasRect.width = fontGlyph.image.GetWidth();
-					glyph.atlasRect.height = fontGlyph.image.GetHeight();
-				}
-				else
-				{
-					glyph.atlasRect.width = 0;
-					glyph.atlasRect.height = 0;
-				}
-
-				// Insert rectangle (if not empty) into our atlas
-				if (glyph.atlasRect.width > 0 && glyph.atlasRect.height > 0)
-				{
-					// Add a small border to prevent GPU to sample another glyph pixel
-					glyph.atlasRect.width += m_glyphBorder*2;
-					glyph.atlasRect.height += m_glyphBorder*2;
-
-					if (!m_atlas->Insert(fontGlyph.image, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
-					{
-						NazaraError("Failed to insert glyph into atlas");
-						return glyph;
-					}
-
-					// Recenter and remove glyph border
-					glyph.atlasRect.x += m_glyphBorder;
-					glyph.atlasRect.y += m_glyphBorder;
-					glyph.atlasRect.width -= m_glyphBorder*2;
-					glyph.atlasRect.height -= m_glyphBorder*2;
-				}
-
-				glyph.aabb = fontGlyph.aabb;
-				glyph.advance = fontGlyph.advance;
-				glyph.valid = true;
+				std::lock_guard atlasLock(s_atlasMutex);
+				StoreGlyph(glyph, fontGlyph);
 			}
 			else
 				NazaraWarning("Failed to extract glyph \"" + FromUtf32String(std::u32string_view(&character, 1)) + "\"");
@@ -548,6 +1158,46 @@ namespace Nz
 		return glyph;
 	}
 
+	bool Font::StoreGlyph(Glyph& glyph, const FontGlyph& fontGlyph) const
+	{
+		if (fontGlyph.image.IsValid())
+		{
+			glyph.atlasRect.width = fontGlyph.image.GetWidth();
+			glyph.atlasRect.height = fontGlyph.image.GetHeight();
+		}
+		else
+		{
+			glyph.atlasRect.width = 0;
+			glyph.atlasRect.height = 0;
+		}
+
+		// Insert rectangle (if not empty) into our atlas
+		if (glyph.atlasRect.width > 0 && glyph.atlasRect.height > 0)
+		{
+			// Add a small border to prevent GPU to sample another glyph pixel
+			glyph.atlasRect.width += m_glyphBorder*2;
+			glyph.atlasRect.height += m_glyphBorder*2;
+
+			if (!m_atlas->Insert(fontGlyph.image, &glyph.atlasRect, &glyph.flipped, &glyph.layerIndex))
+			{
+				NazaraError("Failed to insert glyph into atlas");
+				return false;
+			}
+
+			// Recenter and remove glyph border
+			glyph.atlasRect.x += m_glyphBorder;
+			glyph.atlasRect.y += m_glyphBorder;
+			glyph.atlasRect.width -= m_glyphBorder*2;
+			glyph.atlasRect.height -= m_glyphBorder*2;
+		}
+
+		glyph.aabb = fontGlyph.aabb;
+		glyph.advance = fontGlyph.advance;
+		glyph.valid = true;
+
+		return true;
+	}
+
 	bool Font::Initialize()
 	{
 		s_defaultAtlas = std::make_shared<GuillotineImageAtlas>();
@@ -563,6 +1213,7 @@ namespace Nz
 		s_defaultFont.reset();
 	}
 
+	std::mutex Font::s_atlasMutex;
 	std::shared_ptr<AbstractAtlas> Font::s_defaultAtlas;
 	std::shared_ptr<Font> Font::s_defaultFont;
 	unsigned int Font::s_defaultGlyphBorder;
@@ -8,4 +8,14 @@
 namespace Nz
 {
 	FontData::~FontData() = default;
+
+	/*!
+	* \brief Returns whether glyph extraction and queries can be called from multiple threads at once
+	*
+	* Fonts serialize every call to their data when it doesn't support it.
+	*/
+	bool FontData::SupportsConcurrentExtraction() const
+	{
+		return false;
+	}
 }
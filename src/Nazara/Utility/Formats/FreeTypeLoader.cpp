@@ -17,8 +17,14 @@
 #include <Nazara/Utility/FontGlyph.hpp>
 #include <frozen/string.h>
 #include <frozen/unordered_set.h>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -28,7 +34,7 @@ namespace Nz
 		class FreeTypeLibrary;
 
 		FT_Library s_freetypeLibrary = nullptr;
-		FT_Stroker s_freetypeStroker = nullptr;
+		std::mutex s_freetypeLibraryMutex; //< FreeType faces creation/destruction are not thread-safe
 		std::shared_ptr<FreeTypeLibrary> s_freetypeLibraryOwner;
 		constexpr float s_freetypeScaleFactor = 1 << 6;
 		constexpr float s_freetypeInvScaleFactor = 1.f / s_freetypeScaleFactor;
@@ -71,42 +77,71 @@ namespace Nz
 			// pour ne libérer FreeType que lorsque plus personne ne l'utilise
 
 			public:
-				FreeTypeLibrary()
-				{
-					if (FT_Stroker_New(s_freetypeLibrary, &s_freetypeStroker) != 0)
-					{
-						NazaraWarning("Failed to load FreeType stroker, outline will not be possible");
-						s_freetypeStroker = nullptr; //< Just in case
-					}
-				}
+				FreeTypeLibrary() = default;
 
 				~FreeTypeLibrary()
 				{
-					if (s_freetypeStroker)
-					{
-						FT_Stroker_Done(s_freetypeStroker);
-						s_freetypeStroker = nullptr;
-					}
-
 					FT_Done_FreeType(s_freetypeLibrary);
 					s_freetypeLibrary = nullptr;
 				}
 		};
 
+		// FreeType faces can only be used by one thread at once, a font keeps a pool of faces (one per thread using it at most)
+		// as long as its source can be opened multiple times (files and memory)
 		class FreeTypeStream : public FontData
 		{
+			private:
+				struct Face;
+
+				class FaceLock
+				{
+					public:
+						FaceLock(const FreeTypeStream& stream) :
+						m_face(stream.AcquireFace()),
+						m_stream(stream)
+						{
+						}
+
+						FaceLock(const FaceLock&) = delete;
+						FaceLock(FaceLock&&) = delete;
+
+						~FaceLock()
+						{
+							m_stream.ReleaseFace(m_face);
+						}
+
+						Face* operator->() const
+						{
+							return m_face;
+						}
+
+						FaceLock& operator=(const FaceLock&) = delete;
+						FaceLock& operator=(FaceLock&&) = delete;
+
+					private:
+						Face* m_face;
+						const FreeTypeStream& m_stream;
+				};
+
 			public:
 				FreeTypeStream() :
 				m_face(nullptr),
 				m_library(s_freetypeLibraryOwner),
-				m_characterSize(0)
+				m_sourceStream(nullptr)
 				{
 				}
 
 				~FreeTypeStream()
 				{
-					if (m_face)
-						FT_Done_Face(m_face);
+					std::lock_guard lock(s_freetypeLibraryMutex);
+					for (auto& face : m_faces)
+					{
+						if (face->stroker)
+							FT_Stroker_Done(face->stroker);
+
+						if (face->face)
+							FT_Done_Face(face->face);
+					}
 				}
 
 				bool ExtractGlyph(unsigned int characterSize, char32_t character, TextStyleFlags style, float outlineThickness, FontGlyph* dst) override
@@ -119,15 +154,16 @@ namespace Nz
 					}
 					#endif
 
-					SetCharacterSize(characterSize);
+					FaceLock face(*this);
+					face->SetCharacterSize(characterSize);
 
-					if (FT_Load_Char(m_face, character, FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_NORMAL) != 0)
+					if (FT_Load_Char(face->face, character, FT_LOAD_FORCE_AUTOHINT | FT_LOAD_TARGET_NORMAL) != 0)
 					{
 						NazaraError("Failed to load character");
 						return false;
 					}
 
-					FT_GlyphSlot glyphSlot = m_face->glyph;
+					FT_GlyphSlot glyphSlot = face->face->glyph;
 
 					FT_Glyph glyph;
 					if (FT_Get_Glyph(glyphSlot, &glyph) != 0)
@@ -159,8 +195,8 @@ namespace Nz
 
 						if (outlineThickness > 0.f)
 						{
-							FT_Stroker_Set(s_freetypeStroker, static_cast<FT_Fixed>(s_freetypeScaleFactor * outlineThickness), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-							if (FT_Glyph_Stroke(&glyph, s_freetypeStroker, 1) != 0)
+							FT_Stroker_Set(face->stroker, static_cast<FT_Fixed>(s_freetypeScaleFactor * outlineThickness), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+							if (FT_Glyph_Stroke(&glyph, face->stroker, 1) != 0)
 							{
 								NazaraError("Failed to outline glyph");
 								return false;
@@ -260,17 +296,30 @@ namespace Nz
 
 				bool Open()
 				{
-					return FT_Open_Face(s_freetypeLibrary, &m_args, 0, &m_face) == 0;
+					m_faces.push_back(std::make_unique<Face>());
+					Face& face = *m_faces.back();
+					face.SetStream(*m_sourceStream);
+
+					if (!face.Open())
+					{
+						m_faces.clear();
+						return false;
+					}
+
+					m_face = face.face;
+					m_availableFaces.push_back(&face);
+					return true;
 				}
 
 				int QueryKerning(unsigned int characterSize, char32_t first, char32_t second) const override
 				{
 					if (FT_HAS_KERNING(m_face))
 					{
-						SetCharacterSize(characterSize);
+						FaceLock face(*this);
+						face->SetCharacterSize(characterSize);
 
 						FT_Vector kerning;
-						FT_Get_Kerning(m_face, FT_Get_Char_Index(m_face, first), FT_Get_Char_Index(m_face, second), FT_KERNING_DEFAULT, &kerning);
+						FT_Get_Kerning(face->face, FT_Get_Char_Index(face->face, first), FT_Get_Char_Index(face->face, second), FT_KERNING_DEFAULT, &kerning);
 
 						if (!FT_IS_SCALABLE(m_face))
 							return kerning.x; // Taille déjà précisée en pixels dans ce cas
@@ -283,20 +332,22 @@ namespace Nz
 
 				unsigned int QueryLineHeight(unsigned int characterSize) const override
 				{
-					SetCharacterSize(characterSize);
+					FaceLock face(*this);
+					face->SetCharacterSize(characterSize);
 
 					// http://www.freetype.org/freetype2/docs/reference/ft2-base_interface.html#FT_Size_Metrics
-					return m_face->size->metrics.height >> 6;
+					return face->face->size->metrics.height >> 6;
 				}
 
 				float QueryUnderlinePosition(unsigned int characterSize) const override
 				{
 					if (FT_IS_SCALABLE(m_face))
 					{
-						SetCharacterSize(characterSize);
+						FaceLock face(*this);
+						face->SetCharacterSize(characterSize);
 
 						// http://www.freetype.org/freetype2/docs/reference/ft2-base_interface.html#FT_FaceRec
-						return static_cast<float>(FT_MulFix(m_face->underline_position, m_face->size->metrics.y_scale)) * s_freetypeInvScaleFactor;
+						return static_cast<float>(FT_MulFix(face->face->underline_position, face->face->size->metrics.y_scale)) * s_freetypeInvScaleFactor;
 					}
 					else
 						return characterSize / 10.f; // Joker ?
@@ -306,10 +357,11 @@ namespace Nz
 				{
 					if (FT_IS_SCALABLE(m_face))
 					{
-						SetCharacterSize(characterSize);
+						FaceLock face(*this);
+						face->SetCharacterSize(characterSize);
 
 						// http://www.freetype.org/freetype2/docs/reference/ft2-base_interface.html#FT_FaceRec
-						return static_cast<float>(FT_MulFix(m_face->underline_thickness, m_face->size->metrics.y_scale)) * s_freetypeInvScaleFactor;
+						return static_cast<float>(FT_MulFix(face->face->underline_thickness, face->face->size->metrics.y_scale)) * s_freetypeInvScaleFactor;
 					}
 					else
 						return characterSize/15.f; // Joker ?
@@ -324,34 +376,47 @@ namespace Nz
 						return false;
 					}
 					m_ownedStream = std::move(file);
+					m_sourceStream = m_ownedStream.get();
+
+					// Additional faces open the file again to get their own cursor
+					m_streamFactory = [filePath]() -> std::unique_ptr<Stream>
+					{
+						std::unique_ptr<File> file = std::make_unique<File>();
+						if (!file->Open(filePath, OpenMode::ReadOnly))
+							return nullptr;
+
+						return file;
+					};
 
-					SetStream(*m_ownedStream);
 					return true;
 				}
 
 				void SetMemory(const void* data, std::size_t size)
 				{
 					m_ownedStream = std::make_unique<MemoryView>(data, size);
-					SetStream(*m_ownedStream);
+					m_sourceStream = m_ownedStream.get();
+
+					m_streamFactory = [data, size]() -> std::unique_ptr<Stream>
+					{
+						return std::make_unique<MemoryView>(data, size);
+					};
 				}
 
 				void SetStream(Stream& stream)
 				{
-					m_stream.base = nullptr;
-					m_stream.close = FT_StreamClose;
-					m_stream.descriptor.pointer = &stream;
-					m_stream.read = FT_StreamRead;
-					m_stream.pos = 0;
-					m_stream.size = static_cast<unsigned long>(stream.GetSize());
-
-					m_args.driver = nullptr;
-					m_args.flags = FT_OPEN_STREAM;
-					m_args.stream = &m_stream;
+					// We don't know how to open user streams again, faces will be shared
+					m_sourceStream = &stream;
+					m_streamFactory = nullptr;
+				}
+
+				bool SupportsConcurrentExtraction() const override
+				{
+					return true;
 				}
 
 				bool SupportsOutline(float /*outlineThickness*/) const override
 				{
-					return s_freetypeStroker != nullptr;
+					return !m_faces.empty() && m_faces.front()->stroker != nullptr;
 				}
 
 				bool SupportsStyle(TextStyleFlags style) const override
@@ -361,21 +426,111 @@ namespace Nz
 				}
 
 			private:
-				void SetCharacterSize(unsigned int characterSize) const
+				struct Face
 				{
-					if (m_characterSize != characterSize)
+					bool Open()
 					{
-						FT_Set_Pixel_Sizes(m_face, 0, characterSize);
-						m_characterSize = characterSize;
+						std::lock_guard lock(s_freetypeLibraryMutex);
+						if (FT_Open_Face(s_freetypeLibrary, &args, 0, &face) != 0)
+							return false;
+
+						if (FT_Stroker_New(s_freetypeLibrary, &stroker) != 0)
+						{
+							NazaraWarning("Failed to load FreeType stroker, outline will not be possible");
+							stroker = nullptr; //< Just in case
+						}
+
+						return true;
 					}
+
+					void SetCharacterSize(unsigned int size)
+					{
+						if (characterSize != size)
+						{
+							FT_Set_Pixel_Sizes(face, 0, size);
+							characterSize = size;
+						}
+					}
+
+					void SetStream(Stream& stream)
+					{
+						streamRec.base = nullptr;
+						streamRec.close = FT_StreamClose;
+						streamRec.descriptor.pointer = &stream;
+						streamRec.read = FT_StreamRead;
+						streamRec.pos = 0;
+						streamRec.size = static_cast<unsigned long>(stream.GetSize());
+
+						args.driver = nullptr;
+						args.flags = FT_OPEN_STREAM;
+						args.stream = &streamRec;
+					}
+
+					FT_Face face = nullptr;
+					FT_Open_Args args;
+					FT_Stroker stroker = nullptr;
+					FT_StreamRec streamRec;
+					std::unique_ptr<Stream> ownedStream;
+					unsigned int characterSize = 0;
+				};
+
+				Face* AcquireFace() const
+				{
+					std::unique_lock lock(m_faceMutex);
+					for (;;)
+					{
+						if (!m_availableFaces.empty())
+						{
+							Face* face = m_availableFaces.back();
+							m_availableFaces.pop_back();
+							return face;
+						}
+
+						// Open another face if possible, up to one face per hardware thread
+						std::size_t maxFaceCount = std::max(std::thread::hardware_concurrency(), 1U);
+						if (m_streamFactory && m_faces.size() < maxFaceCount)
+						{
+							if (std::unique_ptr<Stream> stream = m_streamFactory())
+							{
+								std::unique_ptr<Face> face = std::make_unique<Face>();
+								face->ownedStream = std::move(stream);
+								face->SetStream(*face->ownedStream);
+								if (face->Open())
+								{
+									m_faces.push_back(std::move(face));
+									return m_faces.back().get();
+								}
+							}
+
+							// Don't try again
+							NazaraWarning("failed to open an additional font face, glyph extraction will not run in parallel");
+							m_streamFactory = nullptr;
+							continue;
+						}
+
+						m_faceCondition.wait(lock);
+					}
+				}
+
+				void ReleaseFace(Face* face) const
+				{
+					{
+						std::lock_guard lock(m_faceMutex);
+						m_availableFaces.push_back(face);
+					}
+
+					m_faceCondition.notify_one();
 				}
 
-				FT_Open_Args m_args;
-				FT_Face m_face;
-				FT_StreamRec m_stream;
+				mutable std::condition_variable m_faceCondition;
+				mutable std::function<std::unique_ptr<Stream>()> m_streamFactory;
+				mutable std::mutex m_faceMutex;
+				mutable std::vector<std::unique_ptr<Face>> m_faces;
+				mutable std::vector<Face*> m_availableFaces;
+				FT_Face m_face; //< main face, only used to query face informations
 				std::shared_ptr<FreeTypeLibrary> m_library;
 				std::unique_ptr<Stream> m_ownedStream;
-				mutable unsigned int m_characterSize;
+				Stream* m_sourceStream;
 		};
 
 		bool IsFreetypeSupported(std::string_view extension)
@@ -330,6 +330,8 @@ namespace Nz
 				else if (normalPtr)
 					subMesh->GenerateNormals();
 
+				subMesh->Optimize(parameters);
+
 				mesh->AddSubMesh(meshes[i].name + '_' + materials[meshes[i].material], subMesh);
 			}
 			mesh->SetMaterialCount(parser.GetMaterialCount());
@@ -222,45 +222,43 @@ namespace Nz
 				paddingY = (glyph.rect.height - glyphHeight)/2;
 			}
 
-			if (paddingX > 0 || paddingY > 0)
+			const UInt8* src = glyph.image.GetConstPixels();
+			if (paddingX == 0 && paddingY == 0 && !glyph.flipped)
 			{
-				// On remplit les contours
-				pixelBuffer.resize(glyph.rect.width * glyph.rect.height);
-				std::memset(pixelBuffer.data(), 0, glyph.rect.width*glyph.rect.height*sizeof(UInt8));
-
-				layer.image->Update(pixelBuffer.data(), glyph.rect);
+				// Pas de contour ni de rotation, on envoie directement le glyphe
+				layer.image->Update(src, glyph.rect, 0, glyphWidth, glyphHeight);
 			}
-
-			const UInt8* pixels;
-			// On copie le glyphe dans l'atlas
-			if (glyph.flipped)
+			else
 			{
-				pixelBuffer.resize(glyphHeight * glyphWidth);
+				// On compose le contour et le glyphe dans un seul tampon afin de n'effectuer qu'un seul envoi par glyphe
+				unsigned int rectWidth = glyph.rect.width;
+				unsigned int rectHeight = glyph.rect.height;
 
-				// On tourne le glyphe pour qu'il rentre dans le rectangle
-				const UInt8* src = glyph.image.GetConstPixels();
-				UInt8* ptr = pixelBuffer.data();
+				pixelBuffer.resize(rectWidth * rectHeight);
+				if (paddingX > 0 || paddingY > 0)
+					std::memset(pixelBuffer.data(), 0, rectWidth*rectHeight*sizeof(UInt8));
 
-				unsigned int lineStride = glyphWidth*sizeof(UInt8); // BPP = 1
-				src += lineStride-1; // Départ en haut à droite
-				for (unsigned int x = 0; x < glyphWidth; ++x)
+				if (glyph.flipped)
 				{
-					for (unsigned int y = 0; y < glyphHeight; ++y)
+					// On tourne le glyphe pour qu'il rentre dans le rectangle
+					unsigned int lineStride = glyphWidth*sizeof(UInt8); // BPP = 1
+					for (unsigned int x = 0; x < glyphWidth; ++x)
 					{
-						*ptr++ = *src;
-						src += lineStride;
+						UInt8* dst = &pixelBuffer[(paddingY + x) * rectWidth + paddingX];
+						const UInt8* column = src + lineStride - 1 - x; // Départ en haut à droite
+						for (unsigned int y = 0; y < glyphHeight; ++y)
+							*dst++ = column[y * lineStride];
 					}
-
-					src -= glyphHeight*lineStride + 1;
+				}
+				else
+				{
+					for (unsigned int y = 0; y < glyphHeight; ++y)
+						std::memcpy(&pixelBuffer[(paddingY + y) * rectWidth + paddingX], &src[y * glyphWidth], glyphWidth*sizeof(UInt8));
 				}
 
-				pixels = pixelBuffer.data();
-				std::swap(glyphWidth, glyphHeight);
+				layer.image->Update(pixelBuffer.data(), glyph.rect);
 			}
-			else
-				pixels = glyph.image.GetConstPixels();
 
-			layer.image->Update(pixels, Rectui(glyph.rect.x + paddingX, glyph.rect.y + paddingY, glyphWidth, glyphHeight), 0, glyphWidth, glyphHeight);
 			glyph.image.Destroy(); // On libère l'image dès que possible (pour réduire la consommation)
 		}
 
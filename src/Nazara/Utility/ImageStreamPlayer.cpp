@@ -0,0 +1,271 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/ImageStreamPlayer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ThreadExt.hpp>
+#include <Nazara/Utility/ImageStream.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utility
+	* \class Nz::ImageStreamPlayer
+	* \brief Utility class that decodes an image stream ahead of time on a separate thread
+	*
+	* Frames are decoded in a ring of reusable buffers, the caller only has to advance the playing offset with Update and to upload the presented frame when it changes.
+	*/
+
+	ImageStreamPlayer::ImageStreamPlayer() :
+	m_currentFrame(InvalidFrame),
+	m_firstQueuedFrame(0),
+	m_queuedFrameCount(0),
+	m_playingOffset(Time::Zero()),
+	m_seekFrameIndex(0),
+	m_endOfStream(false),
+	m_looping(false),
+	m_resyncPlayingOffset(false),
+	m_running(false),
+	m_seekRequested(false)
+	{
+	}
+
+	ImageStreamPlayer::ImageStreamPlayer(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount) :
+	ImageStreamPlayer()
+	{
+		ErrorFlags flags(ErrorMode::ThrowException);
+		Create(std::move(imageStream), bufferedFrameCount);
+	}
+
+	ImageStreamPlayer::~ImageStreamPlayer()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Starts decoding an image stream
+	* \return true if decoding thread was started
+	*
+	* \param imageStream Image stream to decode, it must not be used by something else until the player is destroyed
+	* \param bufferedFrameCount Number of frames decoded ahead of the presented one
+	*/
+	bool ImageStreamPlayer::Create(std::shared_ptr<ImageStream> imageStream, std::size_t bufferedFrameCount)
+	{
+		NazaraAssert(imageStream, "invalid image stream");
+		NazaraAssert(bufferedFrameCount > 0, "at least one frame must be buffered");
+
+		Destroy();
+
+		Vector2ui size = imageStream->GetSize();
+		std::size_t frameSize = PixelFormatInfo::ComputeSize(imageStream->GetPixelFormat(), size.x, size.y, 1);
+		if (frameSize == 0)
+		{
+			NazaraError("image stream has an invalid size or pixel format");
+			return false;
+		}
+
+		// One more frame than buffered frames, for the presented one
+		m_frames.resize(bufferedFrameCount + 1);
+		for (Frame& frame : m_frames)
+		{
+			frame.pixels.resize(frameSize);
+			frame.time = Time::Zero();
+		}
+
+		m_currentFrame = InvalidFrame;
+		m_endOfStream = false;
+		m_firstQueuedFrame = 0;
+		m_playingOffset = Time::Zero();
+		m_queuedFrameCount = 0;
+		m_resyncPlayingOffset = true;
+		m_running = true;
+		m_seekRequested = false;
+		m_stream = std::move(imageStream);
+
+		m_thread = std::thread(&ImageStreamPlayer::DecodingThread, this);
+
+		return true;
+	}
+
+	void ImageStreamPlayer::Destroy()
+	{
+		if (m_thread.joinable())
+		{
+			{
+				std::lock_guard lock(m_mutex);
+				m_running = false;
+			}
+			m_decoderCondition.notify_one();
+
+			m_thread.join();
+		}
+
+		m_currentFrame = InvalidFrame;
+		m_frames.clear();
+		m_stream.reset();
+	}
+
+	void ImageStreamPlayer::EnableLooping(bool loop)
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_looping = loop;
+		}
+		m_decoderCondition.notify_one();
+	}
+
+	/*!
+	* \brief Checks whether every frame of the stream was presented
+	*
+	* \remark A looping player never finishes
+	*/
+	bool ImageStreamPlayer::IsFinished() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_endOfStream && m_queuedFrameCount == 0 && !m_seekRequested;
+	}
+
+	/*!
+	* \brief Drops every buffered frame and restarts decoding from a frame
+	*
+	* The playing offset is resynchronized on the time of the first frame decoded after seeking
+	*
+	* \param frameIndex Index of the frame to restart decoding from
+	*/
+	void ImageStreamPlayer::Seek(UInt64 frameIndex)
+	{
+		NazaraAssert(IsValid(), "invalid player");
+
+		{
+			std::lock_guard lock(m_mutex);
+
+			// Keep presenting the current frame until a new one is ready, the queue restarts right after it
+			m_firstQueuedFrame = (m_currentFrame != InvalidFrame) ? (m_currentFrame + 1) % m_frames.size() : 0;
+			m_queuedFrameCount = 0;
+			m_endOfStream = false;
+			m_resyncPlayingOffset = true;
+			m_seekFrameIndex = frameIndex;
+			m_seekRequested = true;
+		}
+		m_decoderCondition.notify_one();
+	}
+
+	/*!
+	* \brief Advances the playing offset and presents the most recent decoded frame which should be visible
+	* \return true if the presented frame changed
+	*
+	* \param elapsedTime Time elapsed since the last update
+	*
+	* \remark This never waits for the decoding thread, if the next frame is not ready yet the current one is kept
+	*/
+	bool ImageStreamPlayer::Update(Time elapsedTime)
+	{
+		NazaraAssert(IsValid(), "invalid player");
+
+		bool frameChanged = false;
+		{
+			std::lock_guard lock(m_mutex);
+
+			if (m_resyncPlayingOffset)
+			{
+				if (m_queuedFrameCount == 0)
+					return false; //< wait for the first frame before starting the clock
+
+				m_playingOffset = m_frames[m_firstQueuedFrame].time;
+				m_resyncPlayingOffset = false;
+			}
+			else if (!m_endOfStream || m_queuedFrameCount > 0)
+				m_playingOffset += elapsedTime;
+
+			// Skip late frames, presenting a frame frees the previously presented one
+			while (m_queuedFrameCount > 0 && m_frames[m_firstQueuedFrame].time <= m_playingOffset)
+			{
+				m_currentFrame = m_firstQueuedFrame;
+				m_firstQueuedFrame = (m_firstQueuedFrame + 1) % m_frames.size();
+				m_queuedFrameCount--;
+
+				frameChanged = true;
+			}
+		}
+
+		if (frameChanged)
+			m_decoderCondition.notify_one();
+
+		return frameChanged;
+	}
+
+	void ImageStreamPlayer::DecodingThread()
+	{
+		SetCurrentThreadName("ImageStreamPlayer");
+
+		// Frame times of looping streams keep increasing after each loop
+		Time loopOffset = Time::Zero();
+		bool hasDecodedFrame = false;
+
+		std::unique_lock lock(m_mutex);
+		for (;;)
+		{
+			m_decoderCondition.wait(lock, [&]
+			{
+				// The slot right before the first queued one holds the presented frame
+				return !m_running || m_seekRequested || (!m_endOfStream && m_queuedFrameCount < m_frames.size() - 1);
+			});
+
+			if (!m_running)
+				break;
+
+			if (m_seekRequested)
+			{
+				m_seekRequested = false;
+				UInt64 frameIndex = m_seekFrameIndex;
+
+				lock.unlock();
+				m_stream->Seek(frameIndex);
+				lock.lock();
+
+				loopOffset = Time::Zero();
+				hasDecodedFrame = false;
+				continue;
+			}
+
+			std::size_t frameIndex = (m_firstQueuedFrame + m_queuedFrameCount) % m_frames.size();
+			Frame& frame = m_frames[frameIndex];
+
+			// Decode without holding the lock, this slot cannot be presented before it is queued
+			lock.unlock();
+
+			Time frameTime = Time::Zero();
+			bool decoded = m_stream->DecodeNextFrame(frame.pixels.data(), &frameTime);
+
+			lock.lock();
+
+			if (!m_running)
+				break;
+
+			if (m_seekRequested)
+				continue; //< frame is no longer relevant
+
+			if (decoded)
+			{
+				frame.time = loopOffset + frameTime;
+				m_queuedFrameCount++;
+				hasDecodedFrame = true;
+			}
+			else if (m_looping && hasDecodedFrame)
+			{
+				// At the end of the stream, frameTime holds its end time (zero if decoding failed)
+				loopOffset += frameTime;
+				hasDecodedFrame = false;
+
+				lock.unlock();
+				m_stream->Seek(0);
+				lock.lock();
+			}
+			else
+				m_endOfStream = true;
+		}
+	}
+}
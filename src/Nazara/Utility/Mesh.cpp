@@ -37,6 +37,18 @@ namespace Nz
 			return false;
 		}
 
+		if (generateMeshlets && (meshletMaxVertexCount < 3 || meshletMaxVertexCount > 256 || meshletMaxTriangleCount == 0))
+		{
+			NazaraError("Meshlets must have between 3 and 256 vertices and at least one triangle");
+			return false;
+		}
+
+		if (lodCount > 0 && (lodReductionFactor <= 0.f || lodReductionFactor >= 1.f))
+		{
+			NazaraError("LOD reduction factor must be between 0 and 1");
+			return false;
+		}
+
 		return true;
 	}
 
@@ -244,6 +256,7 @@ namespace Nz
 
 		std::shared_ptr<StaticMesh> subMesh = std::make_shared<StaticMesh>(vertexBuffer, indexBuffer);
 		subMesh->SetAABB(aabb);
+		subMesh->Optimize(params);
 
 		AddSubMesh(subMesh);
 		return subMesh;
@@ -297,6 +310,34 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Generates levels of detail for every static submesh, for example when cooking assets
+	*
+	* Levels of detail can also be generated at loading time using MeshParams::lodCount.
+	*
+	* \param lodCount Maximum number of levels to generate, in addition to the submeshes themselves
+	* \param reductionFactor Triangle count ratio between two successive levels
+	* \param maxError Maximum error of a level, relative to the submesh size
+	*
+	* \see StaticMesh::GenerateLods
+	*/
+	void Mesh::GenerateLods(std::size_t lodCount, float reductionFactor, float maxError)
+	{
+		NazaraAssert(m_isValid, "Mesh should be created first");
+		NazaraAssert(m_animationType == AnimationType::Static, "Mesh is not static");
+
+		for (SubMeshData& data : m_subMeshes)
+		{
+			StaticMesh& staticMesh = static_cast<StaticMesh&>(*data.subMesh);
+
+			const std::shared_ptr<IndexBuffer>& indexBuffer = staticMesh.GetIndexBuffer();
+			if (!indexBuffer)
+				continue;
+
+			staticMesh.GenerateLods(lodCount, reductionFactor, maxError, indexBuffer->GetBuffer()->GetUsageFlags(), &SoftwareBufferFactory);
+		}
+	}
+
 	void Mesh::GenerateNormals()
 	{
 		NazaraAssert(m_isValid, "Mesh should be created first");
@@ -13,12 +13,18 @@ namespace Nz
 	m_currentColor(Color::White()),
 	m_currentOutlineColor(Color::Black()),
 	m_currentStyle(TextStyle_Regular),
+	m_appendedTextOffset(InvalidTextOffset),
+	m_firstChangedGlyph(0),
+	m_firstInvalidBlock(0),
+	m_layoutRevision(UntrackedLayoutRevision),
+	m_previousLayoutRevision(UntrackedLayoutRevision),
 	m_glyphUpdated(false),
 	m_currentCharacterSpacingOffset(0.f),
 	m_currentLineSpacingOffset(0.f),
 	m_currentOutlineThickness(0.f),
 	m_maxLineWidth(std::numeric_limits<float>::infinity()),
-	m_currentCharacterSize(24)
+	m_currentCharacterSize(24),
+	m_lastCharacter(0)
 	{
 		SetTextFont(Font::GetDefault());
 	}
@@ -27,14 +33,20 @@ namespace Nz
 	m_currentColor(drawer.m_currentColor),
 	m_currentOutlineColor(drawer.m_currentOutlineColor),
 	m_currentStyle(drawer.m_currentStyle),
+	m_appendedTextOffset(InvalidTextOffset),
+	m_firstChangedGlyph(0),
+	m_firstInvalidBlock(0),
 	m_fontIndexes(drawer.m_fontIndexes),
 	m_blocks(drawer.m_blocks),
+	m_layoutRevision(UntrackedLayoutRevision),
+	m_previousLayoutRevision(UntrackedLayoutRevision),
 	m_glyphUpdated(false),
 	m_currentCharacterSpacingOffset(drawer.m_currentCharacterSpacingOffset),
 	m_currentLineSpacingOffset(drawer.m_currentLineSpacingOffset),
 	m_currentOutlineThickness(drawer.m_currentOutlineThickness),
 	m_maxLineWidth(drawer.m_maxLineWidth),
-	m_currentCharacterSize(drawer.m_currentCharacterSize)
+	m_currentCharacterSize(drawer.m_currentCharacterSize),
+	m_lastCharacter(0)
 	{
 		m_fonts.resize(drawer.m_fonts.size());
 		for (std::size_t i = 0; i < m_fonts.size(); ++i)
@@ -100,11 +112,22 @@ namespace Nz
 
 			assert(newBlock.fontIndex < m_fonts.size());
 			m_fonts[newBlock.fontIndex].useCount++;
+
+			InvalidateGlyphs(m_blocks.size() - 1);
 		}
 		else
-			m_blocks.back().text += str;
+		{
+			// If layout is up to date, glyphs generation can resume where it stopped
+			bool resumeLayout = m_glyphUpdated;
 
-		InvalidateGlyphs();
+			Block& lastBlock = m_blocks.back();
+			std::size_t previousLength = lastBlock.text.size();
+			lastBlock.text += str;
+
+			InvalidateGlyphs(m_blocks.size() - 1);
+			if (resumeLayout)
+				m_appendedTextOffset = previousLength;
+		}
 
 		return BlockRef(*this, m_blocks.size() - 1);
 	}
@@ -114,8 +137,7 @@ namespace Nz
 		m_fontIndexes.clear();
 		m_blocks.clear();
 		m_fonts.clear();
-		m_glyphs.clear();
-		ClearGlyphs();
+		InvalidateGlyphs();
 	}
 
 	const Rectf& RichTextDrawer::GetBounds() const
@@ -154,6 +176,14 @@ namespace Nz
 		return m_glyphs.size();
 	}
 
+	UInt64 RichTextDrawer::GetLayoutRevision() const
+	{
+		if (!m_glyphUpdated)
+			UpdateGlyphs();
+
+		return m_layoutRevision;
+	}
+
 	const AbstractTextDrawer::Line& RichTextDrawer::GetLine(std::size_t index) const
 	{
 		if (!m_glyphUpdated)
@@ -176,6 +206,21 @@ namespace Nz
 		return m_maxLineWidth;
 	}
 
+	std::size_t RichTextDrawer::GetUnchangedGlyphCount(UInt64 layoutRevision) const
+	{
+		if (!m_glyphUpdated)
+			UpdateGlyphs();
+
+		if (layoutRevision == UntrackedLayoutRevision)
+			return 0;
+		else if (layoutRevision == m_layoutRevision)
+			return m_glyphs.size();
+		else if (layoutRevision == m_previousLayoutRevision)
+			return m_firstChangedGlyph;
+		else
+			return 0;
+	}
+
 	void RichTextDrawer::MergeBlocks()
 	{
 		auto TestBlockProperties = [](const Block& lhs, const Block& rhs)
@@ -196,6 +241,7 @@ namespace Nz
 			if (TestBlockProperties(m_blocks[previousBlockIndex], m_blocks[i]))
 			{
 				m_blocks[previousBlockIndex].text += m_blocks[i].text;
+				InvalidateGlyphs(previousBlockIndex);
 
 				RemoveBlock(i);
 				--i;
@@ -220,7 +266,8 @@ namespace Nz
 			m_blocks[i].glyphIndex -= textLength;
 		}
 
-		InvalidateGlyphs();
+		// Layout of the removed block start is still valid for the next block
+		InvalidateGlyphs(index);
 	}
 
 	void RichTextDrawer::SetMaxLineWidth(float lineWidth)
@@ -244,6 +291,7 @@ namespace Nz
 		m_currentOutlineThickness = drawer.m_currentOutlineThickness;
 		m_currentStyle = drawer.m_currentStyle;
 		m_fontIndexes = drawer.m_fontIndexes;
+		m_maxLineWidth = drawer.m_maxLineWidth;
 
 		m_fonts.resize(drawer.m_fonts.size());
 		for (std::size_t i = 0; i < m_fonts.size(); ++i)
@@ -262,6 +310,8 @@ namespace Nz
 	{
 		DisconnectFontSlots();
 
+		m_appendedTextOffset = drawer.m_appendedTextOffset;
+		m_blockLayouts = std::move(drawer.m_blockLayouts);
 		m_blocks = std::move(drawer.m_blocks);
 		m_bounds = std::move(drawer.m_bounds);
 		m_currentCharacterSize = std::move(drawer.m_currentCharacterSize);
@@ -273,11 +323,19 @@ namespace Nz
 		m_currentOutlineThickness = std::move(drawer.m_currentOutlineThickness);
 		m_currentStyle = std::move(drawer.m_currentStyle);
 		m_drawPos = std::move(drawer.m_drawPos);
+		m_firstChangedGlyph = drawer.m_firstChangedGlyph;
+		m_firstInvalidBlock = drawer.m_firstInvalidBlock;
 		m_fontIndexes = std::move(drawer.m_fontIndexes);
 		m_fonts = std::move(drawer.m_fonts);
 		m_glyphs = std::move(drawer.m_glyphs);
+		m_lastCharacter = drawer.m_lastCharacter;
+		m_lastSeparatorGlyph = drawer.m_lastSeparatorGlyph;
+		m_lastSeparatorPosition = drawer.m_lastSeparatorPosition;
+		m_layoutRevision = drawer.m_layoutRevision;
 		m_lines = std::move(drawer.m_lines);
+		m_maxLineWidth = drawer.m_maxLineWidth;
 		m_glyphUpdated = std::move(drawer.m_glyphUpdated);
+		m_previousLayoutRevision = drawer.m_previousLayoutRevision;
 
 		drawer.DisconnectFontSlots();
 		ConnectFontSlots();
@@ -341,9 +399,10 @@ namespace Nz
 		const Font::Glyph& fontGlyph = font.GetGlyph(characterSize, style, outlineThickness, character);
 		if (fontGlyph.valid && fontGlyph.fauxOutlineThickness <= 0.f)
 		{
-			glyph.atlas = font.GetAtlas()->GetLayer(fontGlyph.layerIndex);
+			glyph.atlas = font.GetAtlasLayer(fontGlyph.layerIndex);
 			glyph.atlasRect = fontGlyph.atlasRect;
 			glyph.color = color;
+			glyph.distanceFieldEdge = fontGlyph.distanceFieldEdge;
 			glyph.flipped = fontGlyph.flipped;
 			glyph.renderOrder = renderOrder;
 
@@ -376,13 +435,11 @@ namespace Nz
 			return false;
 	};
 
-	void RichTextDrawer::GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, const std::string& text) const
+	void RichTextDrawer::GenerateGlyphs(const Font& font, const Color& color, TextStyleFlags style, unsigned int characterSize, const Color& outlineColor, float characterSpacingOffset, float lineSpacingOffset, float outlineThickness, std::string_view text, char32_t previousCharacter) const
 	{
 		if (text.empty())
 			return;
 
-		char32_t previousCharacter = 0;
-
 		const Font::SizeInfo& sizeInfo = font.GetSizeInfo(characterSize);
 		float lineHeight = GetLineHeight(lineSpacingOffset, sizeInfo);
 
@@ -489,8 +546,7 @@ namespace Nz
 		});
 
 		m_bounds.ExtendTo(m_lines.back().bounds);
-
-		m_glyphUpdated = true;
+		m_lastCharacter = previousCharacter;
 	}
 
 	void RichTextDrawer::OnFontAtlasLayerChanged(const Font* font, AbstractImage* oldLayer, AbstractImage* newLayer)
@@ -513,6 +569,15 @@ namespace Nz
 			if (glyph.atlas == oldLayer)
 				glyph.atlas = newLayer;
 		}
+
+		for (BlockLayout& blockLayout : m_blockLayouts)
+		{
+			for (Glyph& glyph : blockLayout.lineGlyphs)
+			{
+				if (glyph.atlas == oldLayer)
+					glyph.atlas = newLayer;
+			}
+		}
 	}
 
 	void RichTextDrawer::OnFontInvalidated(const Font* font)
@@ -528,7 +593,7 @@ namespace Nz
 		}
 #endif
 
-		m_glyphUpdated = false;
+		InvalidateGlyphs();
 	}
 
 	void RichTextDrawer::OnFontRelease(const Font* font)
@@ -548,9 +613,104 @@ namespace Nz
 		//SetTextFont(nullptr);
 	}
 
+	void RichTextDrawer::RestoreBlockLayout(std::size_t blockIndex) const
+	{
+		assert(blockIndex < m_blockLayouts.size());
+		const BlockLayout& blockLayout = m_blockLayouts[blockIndex];
+
+		assert(blockLayout.glyphCount <= m_glyphs.size());
+		std::size_t lineFirstGlyph = blockLayout.glyphCount - blockLayout.lineGlyphs.size();
+
+		m_glyphs.resize(blockLayout.glyphCount);
+		std::copy(blockLayout.lineGlyphs.begin(), blockLayout.lineGlyphs.end(), m_glyphs.begin() + lineFirstGlyph);
+
+		assert(blockLayout.lineCount <= m_lines.size());
+		m_lines.resize(blockLayout.lineCount);
+		m_lines.back() = blockLayout.line;
+
+		m_bounds = blockLayout.bounds;
+		m_drawPos = blockLayout.drawPos;
+		m_lastSeparatorGlyph = blockLayout.lastSeparatorGlyph;
+		m_lastSeparatorPosition = blockLayout.lastSeparatorPosition;
+
+		m_firstChangedGlyph = lineFirstGlyph;
+	}
+
+	void RichTextDrawer::SaveBlockLayout(std::size_t blockIndex) const
+	{
+		if (blockIndex >= m_blockLayouts.size())
+			m_blockLayouts.resize(blockIndex + 1);
+
+		const Line& currentLine = m_lines.back();
+		std::size_t lineFirstGlyph = std::min(currentLine.glyphIndex, m_glyphs.size());
+
+		BlockLayout& blockLayout = m_blockLayouts[blockIndex];
+		blockLayout.bounds = m_bounds;
+		blockLayout.drawPos = m_drawPos;
+		blockLayout.glyphCount = m_glyphs.size();
+		blockLayout.lastSeparatorGlyph = m_lastSeparatorGlyph;
+		blockLayout.lastSeparatorPosition = m_lastSeparatorPosition;
+		blockLayout.line = currentLine;
+		blockLayout.lineCount = m_lines.size();
+		blockLayout.lineGlyphs.assign(m_glyphs.begin() + lineFirstGlyph, m_glyphs.end());
+	}
+
 	void RichTextDrawer::UpdateGlyphs() const
 	{
+		std::size_t firstBlockIndex = m_firstInvalidBlock;
+		std::size_t appendedTextOffset = m_appendedTextOffset;
+
+		m_appendedTextOffset = InvalidTextOffset;
+		m_firstInvalidBlock = InvalidBlockIndex;
+
+		m_previousLayoutRevision = m_layoutRevision;
+		m_layoutRevision = GenerateLayoutRevision();
+
+		// First block properties define the initial line and draw position, it can only be resumed when text was appended to it
+		bool canResume = (firstBlockIndex > 0 || appendedTextOffset != InvalidTextOffset);
+		if (!m_blocks.empty() && canResume && firstBlockIndex <= m_blocks.size() && firstBlockIndex <= m_blockLayouts.size())
+		{
+			// Only re-flow text from the first changed block
+			if (appendedTextOffset != InvalidTextOffset)
+			{
+				// Text was appended to the last block, resume generation from where it stopped
+				assert(firstBlockIndex == m_blocks.size() - 1);
+				m_firstChangedGlyph = std::min(m_lines.back().glyphIndex, m_glyphs.size());
+
+				const Block& block = m_blocks[firstBlockIndex];
+				assert(block.fontIndex < m_fonts.size());
+				const auto& fontData = m_fonts[block.fontIndex];
+
+				std::string_view appendedText = std::string_view(block.text).substr(appendedTextOffset);
+				GenerateGlyphs(*fontData.font, block.color, block.style, block.characterSize, block.outlineColor, block.characterSpacingOffset, block.lineSpacingOffset, block.outlineThickness, appendedText, (appendedTextOffset > 0) ? m_lastCharacter : 0);
+			}
+			else
+			{
+				if (firstBlockIndex < m_blockLayouts.size())
+					RestoreBlockLayout(firstBlockIndex);
+				else
+					m_firstChangedGlyph = std::min(m_lines.back().glyphIndex, m_glyphs.size()); //< new block, layout continues from the previous one
+
+				for (std::size_t i = firstBlockIndex; i < m_blocks.size(); ++i)
+				{
+					const Block& block = m_blocks[i];
+					assert(block.fontIndex < m_fonts.size());
+					const auto& fontData = m_fonts[block.fontIndex];
+
+					SaveBlockLayout(i);
+					GenerateGlyphs(*fontData.font, block.color, block.style, block.characterSize, block.outlineColor, block.characterSpacingOffset, block.lineSpacingOffset, block.outlineThickness, block.text);
+				}
+
+				m_blockLayouts.resize(m_blocks.size());
+			}
+
+			m_glyphUpdated = true;
+			return;
+		}
+
 		ClearGlyphs();
+		m_blockLayouts.clear();
+		m_firstChangedGlyph = 0;
 
 		if (!m_blocks.empty())
 		{
@@ -566,12 +726,14 @@ namespace Nz
 
 			m_drawPos = Vector2f(0.f, SafeCast<float>(firstBlock.characterSize));
 
-			for (const Block& block : m_blocks)
+			for (std::size_t i = 0; i < m_blocks.size(); ++i)
 			{
+				const Block& block = m_blocks[i];
 				assert(block.fontIndex < m_fonts.size());
 				const auto& fontData = m_fonts[block.fontIndex];
 
-				GenerateGlyphs(*fontData.font, block.color, block.style, block.characterSize, block.outlineColor, block.outlineThickness, block.characterSpacingOffset, block.lineSpacingOffset, block.text);
+				SaveBlockLayout(i);
+				GenerateGlyphs(*fontData.font, block.color, block.style, block.characterSize, block.outlineColor, block.characterSpacingOffset, block.lineSpacingOffset, block.outlineThickness, block.text);
 			}
 		}
 		else
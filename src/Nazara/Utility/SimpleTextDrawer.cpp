@@ -145,9 +145,10 @@ namespace Nz
 		const Font::Glyph& fontGlyph = m_font->GetGlyph(m_characterSize, m_style, outlineThickness, character);
 		if (fontGlyph.valid && fontGlyph.fauxOutlineThickness <= 0.f)
 		{
-			glyph.atlas = m_font->GetAtlas()->GetLayer(fontGlyph.layerIndex);
+			glyph.atlas = m_font->GetAtlasLayer(fontGlyph.layerIndex);
 			glyph.atlasRect = fontGlyph.atlasRect;
 			glyph.color = color;
+			glyph.distanceFieldEdge = fontGlyph.distanceFieldEdge;
 			glyph.flipped = fontGlyph.flipped;
 			glyph.renderOrder = renderOrder;
 
@@ -5,7 +5,11 @@
 #include <Nazara/Utility/StaticMesh.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/VertexMapper.hpp>
+#include <cstring>
+#include <limits>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -18,6 +22,24 @@ namespace Nz
 		NazaraAssert(m_vertexBuffer, "Invalid vertex buffer");
 	}
 
+	/*!
+	* \brief Splits the mesh into small clusters of triangles (meshlets), which can be culled individually
+	*
+	* \param maxVertexCount Maximum vertex count of a meshlet (up to 256)
+	* \param maxTriangleCount Maximum triangle count of a meshlet
+	*
+	* \remark Triangles are grouped in index buffer order, which should have been optimized for vertex cache before
+	*/
+	void StaticMesh::BuildMeshlets(UInt32 maxVertexCount, UInt32 maxTriangleCount)
+	{
+		NazaraAssert(m_indexBuffer, "meshlets requires an index buffer");
+
+		VertexMapper vertexMapper(*m_vertexBuffer);
+		IndexMapper indexMapper(*m_indexBuffer);
+
+		m_meshlets = Nz::BuildMeshlets(indexMapper.begin(), indexMapper.GetIndexCount(), vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent::Position), maxVertexCount, maxTriangleCount);
+	}
+
 	void StaticMesh::Center()
 	{
 		Vector3f offset(m_aabb.x + m_aabb.width/2.f, m_aabb.y + m_aabb.height/2.f, m_aabb.z + m_aabb.depth/2.f);
@@ -43,6 +65,65 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Generates simplified versions of the mesh, each one having reductionFactor times the triangles of the previous one
+	*
+	* \param lodCount Maximum number of levels to generate, in addition to the mesh itself
+	* \param reductionFactor Triangle count ratio between two successive levels
+	* \param maxError Maximum geometric error allowed (relative to the mesh size), generation stops once a level cannot be simplified further
+	* \param usage Usage flags of the generated index buffers
+	* \param bufferFactory Factory used to create the generated index buffers
+	*/
+	void StaticMesh::GenerateLods(std::size_t lodCount, float reductionFactor, float maxError, BufferUsageFlags usage, const BufferFactory& bufferFactory)
+	{
+		NazaraAssert(m_indexBuffer, "level of details requires an index buffer");
+		NazaraAssert(reductionFactor > 0.f && reductionFactor < 1.f, "reduction factor must be between 0 and 1");
+
+		m_lods.clear();
+
+		VertexMapper vertexMapper(*m_vertexBuffer);
+		IndexMapper indexMapper(*m_indexBuffer);
+
+		SparsePtr<const Vector3f> positionPtr = vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
+		if (!positionPtr)
+		{
+			NazaraError("level of details requires vertex positions");
+			return;
+		}
+
+		UInt32 indexCount = indexMapper.GetIndexCount();
+		UInt32 vertexCount = m_vertexBuffer->GetVertexCount();
+
+		std::vector<UInt32> lodIndices(indexCount);
+
+		UInt32 previousIndexCount = indexCount;
+		float targetTriangleCount = float(indexCount / 3);
+		for (std::size_t i = 0; i < lodCount; ++i)
+		{
+			targetTriangleCount *= reductionFactor;
+
+			// Always simplify from the full mesh to prevent errors from accumulating
+			float lodError;
+			UInt32 lodIndexCount = SimplifyIndices(indexMapper.begin(), indexCount, positionPtr, vertexCount, UInt32(targetTriangleCount) * 3, maxError, lodIndices.data(), &lodError);
+			if (lodIndexCount == 0 || lodIndexCount >= previousIndexCount)
+				break;
+
+			std::shared_ptr<IndexBuffer> lodIndexBuffer = std::make_shared<IndexBuffer>(m_indexBuffer->GetIndexType(), lodIndexCount, usage, bufferFactory);
+
+			IndexMapper lodMapper(*lodIndexBuffer);
+			for (UInt32 j = 0; j < lodIndexCount; ++j)
+				lodMapper.Set(j, lodIndices[j]);
+
+			lodMapper.Unmap();
+
+			auto& lod = m_lods.emplace_back();
+			lod.error = lodError;
+			lod.indexBuffer = std::move(lodIndexBuffer);
+
+			previousIndexCount = lodIndexCount;
+		}
+	}
+
 	const Boxf& StaticMesh::GetAABB() const
 	{
 		return m_aabb;
@@ -78,6 +159,98 @@ namespace Nz
 		return m_vertexBuffer != nullptr;
 	}
 
+	/*!
+	* \brief Applies the optimizations enabled in mesh parameters
+	*
+	* Overdraw is optimized first since it reorders triangles, then vertices are reordered according to the final triangle order.
+	* Level of details and meshlets are built last, so they benefit from the previous optimizations.
+	*
+	* \param params Mesh parameters the mesh was loaded with
+	*/
+	void StaticMesh::Optimize(const MeshParams& params)
+	{
+		if (!m_indexBuffer)
+			return;
+
+		if (params.optimizeOverdraw)
+			OptimizeOverdraw(params.overdrawThreshold);
+
+		if (params.optimizeVertexFetch)
+			OptimizeVertexFetch();
+
+		if (params.lodCount > 0)
+			GenerateLods(params.lodCount, params.lodReductionFactor, params.lodMaxError, params.indexBufferFlags, params.bufferFactory);
+
+		if (params.generateMeshlets)
+			BuildMeshlets(params.meshletMaxVertexCount, params.meshletMaxTriangleCount);
+	}
+
+	/*!
+	* \brief Reorders triangles to reduce overdraw, trading some vertex cache efficiency
+	*
+	* \param threshold How much vertex cache efficiency may be lost (1.05 allows 5% more cache misses)
+	*/
+	void StaticMesh::OptimizeOverdraw(float threshold)
+	{
+		NazaraAssert(m_indexBuffer, "overdraw optimization requires an index buffer");
+
+		VertexMapper vertexMapper(*m_vertexBuffer);
+		SparsePtr<const Vector3f> positionPtr = vertexMapper.GetComponentPtr<const Vector3f>(VertexComponent::Position);
+		if (!positionPtr)
+		{
+			NazaraError("overdraw optimization requires vertex positions");
+			return;
+		}
+
+		IndexMapper indexMapper(*m_indexBuffer);
+		Nz::OptimizeOverdraw(indexMapper.begin(), indexMapper.GetIndexCount(), positionPtr, threshold);
+	}
+
+	/*!
+	* \brief Reorders vertices in the order they are referenced by the index buffer, and removes unused vertices
+	*
+	* Level of details and meshlets are remapped as well.
+	*/
+	void StaticMesh::OptimizeVertexFetch()
+	{
+		NazaraAssert(m_indexBuffer, "vertex fetch optimization requires an index buffer");
+
+		UInt32 vertexCount = m_vertexBuffer->GetVertexCount();
+
+		std::vector<UInt32> vertexRemap(vertexCount);
+		UInt32 newVertexCount;
+		{
+			IndexMapper indexMapper(*m_indexBuffer);
+			newVertexCount = Nz::OptimizeVertexFetch(indexMapper.begin(), indexMapper.GetIndexCount(), vertexCount, vertexRemap.data());
+		}
+
+		for (StaticMeshLod& lod : m_lods)
+		{
+			IndexMapper lodMapper(*lod.indexBuffer);
+			for (UInt32 i = 0; i < lodMapper.GetIndexCount(); ++i)
+				lodMapper.Set(i, vertexRemap[lodMapper.Get(i)]);
+		}
+
+		for (UInt32& vertex : m_meshlets.vertices)
+			vertex = vertexRemap[vertex];
+
+		// Permute vertices in place, unused ones end up past the new vertex count
+		std::size_t stride = static_cast<std::size_t>(m_vertexBuffer->GetStride());
+		UInt8* vertexData = static_cast<UInt8*>(m_vertexBuffer->Map(0, vertexCount));
+
+		std::vector<UInt8> sourceData(vertexData, vertexData + stride * vertexCount);
+		for (UInt32 i = 0; i < vertexCount; ++i)
+		{
+			if (vertexRemap[i] != std::numeric_limits<UInt32>::max())
+				std::memcpy(&vertexData[vertexRemap[i] * stride], &sourceData[i * stride], stride);
+		}
+
+		m_vertexBuffer->Unmap();
+
+		if (newVertexCount != vertexCount)
+			m_vertexBuffer = std::make_shared<VertexBuffer>(m_vertexBuffer->GetVertexDeclaration(), m_vertexBuffer->GetBuffer(), m_vertexBuffer->GetStartOffset(), newVertexCount * stride);
+	}
+
 	void StaticMesh::SetAABB(const Boxf& aabb)
 	{
 		m_aabb = aabb;
@@ -88,5 +261,9 @@ namespace Nz
 	void StaticMesh::SetIndexBuffer(std::shared_ptr<IndexBuffer> indexBuffer)
 	{
 		m_indexBuffer = std::move(indexBuffer);
+
+		// Derived data no longer match the geometry
+		m_lods.clear();
+		m_meshlets = MeshletData{};
 	}
 }
@@ -0,0 +1,301 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	TransformHierarchy::TransformHierarchy() :
+	m_parallelThreshold(4096),
+	m_orderInvalidated(false)
+	{
+	}
+
+	std::size_t TransformHierarchy::AddNode(std::size_t parentIndex, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale)
+	{
+		assert(parentIndex == InvalidNodeIndex || IsValid(parentIndex));
+
+		// Don't reuse indices of nodes removed since last update, their children still reference them until the order is rebuilt
+		std::size_t nodeIndex = (!m_orderInvalidated) ? m_freeNodeIndices.FindFirst() : m_freeNodeIndices.npos;
+		if (nodeIndex == m_freeNodeIndices.npos)
+		{
+			nodeIndex = m_nodeSlots.size();
+			m_nodeParents.push_back(InvalidNodeIndex);
+			m_nodeSlots.push_back(InvalidSlot);
+			m_freeNodeIndices.Resize(nodeIndex + 1, false);
+		}
+		else
+			m_freeNodeIndices.Set(nodeIndex, false);
+
+		// New nodes are appended, the depth order will be restored by the next update
+		UInt32 slot = SafeCast<UInt32>(m_slotNodes.size());
+		m_nodeParents[nodeIndex] = parentIndex;
+		m_nodeSlots[nodeIndex] = slot;
+
+		m_dirtySlots.push_back(1);
+		m_globalPositions.push_back(position);
+		m_globalRotations.push_back(rotation);
+		m_globalScales.push_back(scale);
+		m_parentSlots.push_back((parentIndex != InvalidNodeIndex) ? m_nodeSlots[parentIndex] : InvalidSlot);
+		m_positions.push_back(position);
+		m_rotations.push_back(rotation);
+		m_scales.push_back(scale);
+		m_slotNodes.push_back(SafeCast<UInt32>(nodeIndex));
+		m_transformMatrices.push_back(Matrix4f::Identity());
+
+		m_orderInvalidated = true;
+
+		return nodeIndex;
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		m_changedNodes.clear();
+		m_dirtySlots.clear();
+		m_freeNodeIndices.Clear();
+		m_globalPositions.clear();
+		m_globalRotations.clear();
+		m_globalScales.clear();
+		m_levelOffsets.clear();
+		m_nodeParents.clear();
+		m_nodeSlots.clear();
+		m_parentSlots.clear();
+		m_positions.clear();
+		m_rotations.clear();
+		m_scales.clear();
+		m_slotNodes.clear();
+		m_transformMatrices.clear();
+		m_orderInvalidated = false;
+	}
+
+	/*!
+	* \brief Removes a node from the hierarchy
+	*
+	* Children of the removed node become root nodes (keeping their local transform) on next update
+	*/
+	void TransformHierarchy::RemoveNode(std::size_t nodeIndex)
+	{
+		assert(IsValid(nodeIndex));
+
+		m_freeNodeIndices.Set(nodeIndex, true);
+		m_orderInvalidated = true;
+	}
+
+	void TransformHierarchy::SetParent(std::size_t nodeIndex, std::size_t parentIndex)
+	{
+		assert(IsValid(nodeIndex));
+		assert(parentIndex == InvalidNodeIndex || IsValid(parentIndex));
+
+		#if NAZARA_UTILITY_SAFE
+		for (std::size_t ancestorIndex = parentIndex; ancestorIndex != InvalidNodeIndex; ancestorIndex = m_nodeParents[ancestorIndex])
+		{
+			if (ancestorIndex == nodeIndex)
+			{
+				NazaraError("a node cannot be its own parent");
+				return;
+			}
+		}
+		#endif
+
+		if (m_nodeParents[nodeIndex] == parentIndex)
+			return;
+
+		UInt32 slot = m_nodeSlots[nodeIndex];
+		m_nodeParents[nodeIndex] = parentIndex;
+		m_parentSlots[slot] = (parentIndex != InvalidNodeIndex) ? m_nodeSlots[parentIndex] : InvalidSlot;
+		m_dirtySlots[slot] = 1;
+
+		m_orderInvalidated = true;
+	}
+
+	/*!
+	* \brief Updates global transforms of every node whose transform (or one of its parent transform) changed
+	*
+	* Nodes are processed level by level, levels with more nodes than the parallel threshold are split across the task scheduler workers.
+	* Updated nodes can be retrieved afterwards using GetChangedNodes.
+	*/
+	void TransformHierarchy::Update()
+	{
+		if (m_orderInvalidated)
+			RebuildOrder();
+
+		for (std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+		{
+			std::size_t firstSlot = m_levelOffsets[level];
+			std::size_t lastSlot = m_levelOffsets[level + 1];
+			std::size_t slotCount = lastSlot - firstSlot;
+
+			if (slotCount >= m_parallelThreshold)
+			{
+				std::size_t workerCount = TaskScheduler::GetWorkerCount();
+				std::size_t chunkSize = (slotCount + workerCount - 1) / workerCount;
+
+				// Use a dedicated task group so hierarchies can be updated from several threads, or from a task
+				TaskGroup levelTasks;
+				for (std::size_t chunkStart = firstSlot; chunkStart < lastSlot; chunkStart += chunkSize)
+				{
+					std::size_t chunkEnd = std::min(chunkStart + chunkSize, lastSlot);
+					levelTasks.AddTask([this, chunkStart, chunkEnd]
+					{
+						UpdateSlots(chunkStart, chunkEnd);
+					});
+				}
+
+				levelTasks.Wait();
+			}
+			else
+				UpdateSlots(firstSlot, lastSlot);
+		}
+
+		m_changedNodes.clear();
+		for (std::size_t slot = 0; slot < m_dirtySlots.size(); ++slot)
+		{
+			if (!m_dirtySlots[slot])
+				continue;
+
+			m_changedNodes.push_back(m_slotNodes[slot]);
+			m_dirtySlots[slot] = 0;
+		}
+	}
+
+	void TransformHierarchy::RebuildOrder()
+	{
+		std::size_t nodeCount = m_nodeParents.size();
+
+		// Detach children of removed nodes
+		for (std::size_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+		{
+			std::size_t parentIndex = m_nodeParents[nodeIndex];
+			if (m_freeNodeIndices.Test(nodeIndex) || parentIndex == InvalidNodeIndex || !m_freeNodeIndices.Test(parentIndex))
+				continue;
+
+			m_nodeParents[nodeIndex] = InvalidNodeIndex;
+			m_dirtySlots[m_nodeSlots[nodeIndex]] = 1;
+		}
+
+		// Compute node depths, walking up the hierarchy until a node of known depth is found
+		std::vector<UInt32> nodeDepths(nodeCount, InvalidSlot);
+		std::vector<std::size_t> nodeChain;
+		std::vector<std::size_t> levelCounts;
+		for (std::size_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+		{
+			if (m_freeNodeIndices.Test(nodeIndex) || nodeDepths[nodeIndex] != InvalidSlot)
+				continue;
+
+			std::size_t currentIndex = nodeIndex;
+			while (currentIndex != InvalidNodeIndex && nodeDepths[currentIndex] == InvalidSlot)
+			{
+				nodeChain.push_back(currentIndex);
+				currentIndex = m_nodeParents[currentIndex];
+			}
+
+			UInt32 depth = (currentIndex != InvalidNodeIndex) ? nodeDepths[currentIndex] + 1 : 0;
+			for (auto it = nodeChain.rbegin(); it != nodeChain.rend(); ++it)
+			{
+				nodeDepths[*it] = depth;
+				if (depth >= levelCounts.size())
+					levelCounts.resize(depth + 1, 0);
+
+				levelCounts[depth]++;
+				depth++;
+			}
+
+			nodeChain.clear();
+		}
+
+		// Counting sort by depth
+		m_levelOffsets.resize(levelCounts.size() + 1);
+		m_levelOffsets[0] = 0;
+		for (std::size_t level = 0; level < levelCounts.size(); ++level)
+			m_levelOffsets[level + 1] = m_levelOffsets[level] + levelCounts[level];
+
+		std::size_t slotCount = m_levelOffsets.back();
+		std::vector<std::size_t> levelCursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+
+		std::vector<UInt32> newNodeSlots(nodeCount, InvalidSlot);
+		std::vector<UInt32> newSlotNodes(slotCount);
+		for (std::size_t nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+		{
+			if (m_freeNodeIndices.Test(nodeIndex))
+				continue;
+
+			std::size_t slot = levelCursors[nodeDepths[nodeIndex]]++;
+			newNodeSlots[nodeIndex] = SafeCast<UInt32>(slot);
+			newSlotNodes[slot] = SafeCast<UInt32>(nodeIndex);
+		}
+
+		auto Reorder = [&](auto& slotData)
+		{
+			std::remove_reference_t<decltype(slotData)> newData(slotCount);
+			for (std::size_t slot = 0; slot < slotCount; ++slot)
+				newData[slot] = slotData[m_nodeSlots[newSlotNodes[slot]]];
+
+			slotData = std::move(newData);
+		};
+
+		Reorder(m_dirtySlots);
+		Reorder(m_globalPositions);
+		Reorder(m_globalRotations);
+		Reorder(m_globalScales);
+		Reorder(m_positions);
+		Reorder(m_rotations);
+		Reorder(m_scales);
+		Reorder(m_transformMatrices);
+
+		m_parentSlots.resize(slotCount);
+		for (std::size_t slot = 0; slot < slotCount; ++slot)
+		{
+			std::size_t parentIndex = m_nodeParents[newSlotNodes[slot]];
+			m_parentSlots[slot] = (parentIndex != InvalidNodeIndex) ? newNodeSlots[parentIndex] : InvalidSlot;
+		}
+
+		m_nodeSlots = std::move(newNodeSlots);
+		m_slotNodes = std::move(newSlotNodes);
+
+		m_orderInvalidated = false;
+	}
+
+	void TransformHierarchy::UpdateSlots(std::size_t firstSlot, std::size_t lastSlot)
+	{
+		for (std::size_t slot = firstSlot; slot < lastSlot; ++slot)
+		{
+			UInt32 parentSlot = m_parentSlots[slot];
+			if (parentSlot != InvalidSlot)
+			{
+				// Parents belong to a previous level and are already up to date
+				if (m_dirtySlots[parentSlot])
+					m_dirtySlots[slot] = 1;
+
+				if (!m_dirtySlots[slot])
+					continue;
+
+				const Vector3f& parentPosition = m_globalPositions[parentSlot];
+				const Quaternionf& parentRotation = m_globalRotations[parentSlot];
+				const Vector3f& parentScale = m_globalScales[parentSlot];
+
+				m_globalPositions[slot] = parentRotation * (parentScale * m_positions[slot]) + parentPosition;
+				m_globalRotations[slot] = parentRotation * Quaternionf::Mirror(m_rotations[slot], parentScale);
+				m_globalRotations[slot].Normalize();
+				m_globalScales[slot] = parentScale * m_scales[slot];
+			}
+			else
+			{
+				if (!m_dirtySlots[slot])
+					continue;
+
+				m_globalPositions[slot] = m_positions[slot];
+				m_globalRotations[slot] = m_rotations[slot];
+				m_globalScales[slot] = m_scales[slot];
+			}
+
+			m_transformMatrices[slot] = Matrix4f::Transform(m_globalPositions[slot], m_globalRotations[slot], m_globalScales[slot]);
+		}
+	}
+}
@@ -11,7 +11,9 @@
 #include <Nazara/VulkanRenderer/VulkanDevice.hpp>
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <unordered_set>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
@@ -53,12 +55,19 @@ namespace Nz
 	{
 		RenderDeviceInfo deviceInfo;
 		deviceInfo.name = physDevice.properties.deviceName;
+		deviceInfo.threadSafeShaderCreation = true;
+		std::memcpy(deviceInfo.pipelineCacheUUID.data(), physDevice.properties.pipelineCacheUUID, VK_UUID_SIZE);
 
 		deviceInfo.features.anisotropicFiltering = physDevice.features.samplerAnisotropy;
+		deviceInfo.features.bindlessTextures = physDevice.features.shaderSampledImageArrayDynamicIndexing && physDevice.descriptorIndexingFeatures.descriptorBindingPartiallyBound && physDevice.descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending;
 		deviceInfo.features.computeShaders = true;
 		deviceInfo.features.depthClamping = physDevice.features.depthClamp;
+		deviceInfo.features.drawIndirect = true;
+		deviceInfo.features.drawIndirectCount = physDevice.extensions.count(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) != 0; //< core since Vulkan 1.2 but requires an optional feature, rely on the extension
+		deviceInfo.features.multiDrawIndirect = physDevice.features.multiDrawIndirect && physDevice.features.drawIndirectFirstInstance;
 		deviceInfo.features.nonSolidFaceFilling = physDevice.features.fillModeNonSolid;
 		deviceInfo.features.storageBuffers = true;
+		deviceInfo.features.textureMemoryAliasing = true;
 		deviceInfo.features.textureReadWithoutFormat = physDevice.features.shaderStorageImageReadWithoutFormat;
 		deviceInfo.features.textureReadWrite = true;
 		deviceInfo.features.textureWriteWithoutFormat = physDevice.features.shaderStorageImageWriteWithoutFormat;
@@ -68,6 +77,7 @@ namespace Nz
 		deviceInfo.limits.maxComputeWorkGroupCount = { physDevice.properties.limits.maxComputeWorkGroupCount[0], physDevice.properties.limits.maxComputeWorkGroupCount[1], physDevice.properties.limits.maxComputeWorkGroupCount[2] };
 		deviceInfo.limits.maxComputeWorkGroupSize = { physDevice.properties.limits.maxComputeWorkGroupSize[0], physDevice.properties.limits.maxComputeWorkGroupSize[1], physDevice.properties.limits.maxComputeWorkGroupSize[2] };
 		deviceInfo.limits.maxComputeWorkGroupInvocations = physDevice.properties.limits.maxComputeWorkGroupInvocations;
+		deviceInfo.limits.maxPerStageSampledTextures = std::min(physDevice.properties.limits.maxPerStageDescriptorSampledImages, physDevice.properties.limits.maxPerStageDescriptorSamplers);
 		deviceInfo.limits.maxStorageBufferSize = physDevice.properties.limits.maxStorageBufferRange;
 		deviceInfo.limits.maxUniformBufferSize = physDevice.properties.limits.maxUniformBufferRange;
 		deviceInfo.limits.minStorageBufferOffsetAlignment = RoundToPow2(physDevice.properties.limits.minStorageBufferOffsetAlignment);
@@ -359,6 +369,19 @@ namespace Nz
 			else
 				NazaraWarning("failed to query physical device extensions for {0} ({1:#x})", deviceInfo.properties.deviceName, deviceInfo.properties.deviceID);
 
+			// Descriptor indexing is only queried when core (Vulkan 1.2), to avoid handling its extension dependencies
+			deviceInfo.descriptorIndexingFeatures = {};
+			deviceInfo.descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+			if (s_instance.GetApiVersion() >= VK_API_VERSION_1_2 && deviceInfo.properties.apiVersion >= VK_API_VERSION_1_2)
+			{
+				VkPhysicalDeviceFeatures2 features = {};
+				features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+				features.pNext = &deviceInfo.descriptorIndexingFeatures;
+
+				s_instance.vkGetPhysicalDeviceFeatures2(physDevice, &features);
+				deviceInfo.descriptorIndexingFeatures.pNext = nullptr;
+			}
+
 			s_physDevices.emplace_back(std::move(deviceInfo));
 		}
 
@@ -563,6 +586,9 @@ namespace Nz
 				EnableIfSupported(VK_KHR_BIND_MEMORY_2_EXTENSION_NAME);
 				EnableIfSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
 			}
+
+			if (enabledFeatures.drawIndirectCount)
+				EnableIfSupported(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
 		}
 
 		std::vector<std::string> additionalExtensions; // Just to keep the String alive
@@ -585,15 +611,33 @@ namespace Nz
 		if (enabledFeatures.anisotropicFiltering)
 			deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+		if (enabledFeatures.bindlessTextures)
+			deviceFeatures.shaderSampledImageArrayDynamicIndexing = VK_TRUE;
+
 		if (enabledFeatures.depthClamping)
 			deviceFeatures.depthClamp = VK_TRUE;
 
+		if (enabledFeatures.multiDrawIndirect)
+		{
+			deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+			deviceFeatures.multiDrawIndirect = VK_TRUE;
+		}
+
 		if (enabledFeatures.nonSolidFaceFilling)
 			deviceFeatures.fillModeNonSolid = VK_TRUE;
 
+		VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures = {};
+		descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+		if (enabledFeatures.bindlessTextures)
+		{
+			descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+			descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+		}
+
 		VkDeviceCreateInfo createInfo = {
 			VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-			nullptr,
+			(enabledFeatures.bindlessTextures) ? &descriptorIndexingFeatures : nullptr,
 			0,
 			UInt32(queueCreateInfos.size()),
 			queueCreateInfos.data(),
@@ -21,6 +21,12 @@ namespace Nz
 		if ((usage & BufferUsage::DirectMapping) == 0)
 			bufferUsage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 
+		if (usage & BufferUsage::Indirect)
+			bufferUsage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+		if (usage & BufferUsage::Storage)
+			bufferUsage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
 		VkBufferCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 		createInfo.size = size;
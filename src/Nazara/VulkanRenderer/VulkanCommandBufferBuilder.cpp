@@ -5,7 +5,9 @@
 #include <Nazara/VulkanRenderer/VulkanCommandBufferBuilder.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/VulkanRenderer/VulkanBuffer.hpp>
+#include <Nazara/VulkanRenderer/VulkanCommandBuffer.hpp>
 #include <Nazara/VulkanRenderer/VulkanComputePipeline.hpp>
+#include <Nazara/VulkanRenderer/VulkanDevice.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPass.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPipeline.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPipelineLayout.hpp>
@@ -29,7 +31,7 @@ namespace Nz
 		m_commandBuffer.BeginDebugRegion(regionNameEOS.data(), color);
 	}
 
-	void VulkanCommandBufferBuilder::BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount)
+	void VulkanCommandBufferBuilder::BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount, SubpassContents contents)
 	{
 		const VulkanRenderPass& vkRenderPass = static_cast<const VulkanRenderPass&>(renderPass);
 		const VulkanFramebuffer& vkFramebuffer = static_cast<const VulkanFramebuffer&>(framebuffer);
@@ -67,7 +69,7 @@ namespace Nz
 		beginInfo.clearValueCount = UInt32(vkClearValues.size());
 		beginInfo.pClearValues = vkClearValues.data();
 
-		m_commandBuffer.BeginRenderPass(beginInfo);
+		m_commandBuffer.BeginRenderPass(beginInfo, ToVulkan(contents));
 
 		m_currentRenderPass = &vkRenderPass;
 		m_currentSubpassIndex = 0;
@@ -304,6 +306,50 @@ namespace Nz
 		m_commandBuffer.DrawIndexed(indexCount, instanceCount, firstIndex, 0, firstInstance);
 	}
 
+	void VulkanCommandBufferBuilder::DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = static_cast<const VulkanBuffer&>(indirectBuffer);
+
+		// drawCount > 1 requires the multiDrawIndirect feature
+		if (drawCount > 1 && !vkBuffer.GetRenderDevice().GetEnabledFeatures().multiDrawIndirect)
+		{
+			for (UInt32 i = 0; i < drawCount; ++i)
+				m_commandBuffer.DrawIndexedIndirect(vkBuffer.GetBuffer(), offset + UInt64(i) * stride, 1, stride);
+		}
+		else
+			m_commandBuffer.DrawIndexedIndirect(vkBuffer.GetBuffer(), offset, drawCount, stride);
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = static_cast<const VulkanBuffer&>(indirectBuffer);
+		const VulkanBuffer& vkCountBuffer = static_cast<const VulkanBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndexedIndirectCount(vkBuffer.GetBuffer(), offset, vkCountBuffer.GetBuffer(), countOffset, maxDrawCount, stride);
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = static_cast<const VulkanBuffer&>(indirectBuffer);
+
+		// drawCount > 1 requires the multiDrawIndirect feature
+		if (drawCount > 1 && !vkBuffer.GetRenderDevice().GetEnabledFeatures().multiDrawIndirect)
+		{
+			for (UInt32 i = 0; i < drawCount; ++i)
+				m_commandBuffer.DrawIndirect(vkBuffer.GetBuffer(), offset + UInt64(i) * stride, 1, stride);
+		}
+		else
+			m_commandBuffer.DrawIndirect(vkBuffer.GetBuffer(), offset, drawCount, stride);
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = static_cast<const VulkanBuffer&>(indirectBuffer);
+		const VulkanBuffer& vkCountBuffer = static_cast<const VulkanBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndirectCount(vkBuffer.GetBuffer(), offset, vkCountBuffer.GetBuffer(), countOffset, maxDrawCount, stride);
+	}
+
 	void VulkanCommandBufferBuilder::EndDebugRegion()
 	{
 		m_commandBuffer.EndDebugRegion();
@@ -315,9 +361,21 @@ namespace Nz
 		m_currentRenderPass = nullptr;
 	}
 
-	void VulkanCommandBufferBuilder::NextSubpass()
+	void VulkanCommandBufferBuilder::ExecuteSecondaryCommandBuffer(const CommandBuffer& commandBuffer)
+	{
+		const VulkanCommandBuffer& vkCommandBuffer = static_cast<const VulkanCommandBuffer&>(commandBuffer);
+
+		m_commandBuffer.ExecuteCommands(vkCommandBuffer.GetCommandBuffer());
+	}
+
+	void VulkanCommandBufferBuilder::MemoryBarrier(PipelineStageFlags srcStageMask, PipelineStageFlags dstStageMask, MemoryAccessFlags srcAccessMask, MemoryAccessFlags dstAccessMask)
+	{
+		m_commandBuffer.MemoryBarrier(ToVulkan(srcStageMask), ToVulkan(dstStageMask), ToVulkan(srcAccessMask), ToVulkan(dstAccessMask));
+	}
+
+	void VulkanCommandBufferBuilder::NextSubpass(SubpassContents contents)
 	{
-		m_commandBuffer.NextSubpass();
+		m_commandBuffer.NextSubpass(ToVulkan(contents));
 		m_currentSubpassIndex++;
 	}
 
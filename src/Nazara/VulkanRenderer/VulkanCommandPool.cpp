@@ -5,6 +5,8 @@
 #include <Nazara/VulkanRenderer/VulkanCommandPool.hpp>
 #include <Nazara/VulkanRenderer/VulkanCommandBuffer.hpp>
 #include <Nazara/VulkanRenderer/VulkanCommandBufferBuilder.hpp>
+#include <Nazara/VulkanRenderer/VulkanFramebuffer.hpp>
+#include <Nazara/VulkanRenderer/VulkanRenderPass.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/CommandBuffer.hpp>
 #include <NazaraUtils/StackVector.hpp>
 #include <Nazara/VulkanRenderer/Debug.hpp>
@@ -24,19 +26,28 @@ namespace Nz
 		if (!commandBuffer->End())
 			throw std::runtime_error("failed to build command buffer: " + TranslateVulkanError(commandBuffer->GetLastErrorCode()));
 
-		for (std::size_t i = 0; i < m_commandPools.size(); ++i)
-		{
-			if (m_commandPools[i].freeCommands.TestNone())
-				continue;
+		return RegisterCommandBuffer(std::move(commandBuffer));
+	}
 
-			return AllocateFromPool(i, std::move(commandBuffer));
-		}
+	CommandBufferPtr VulkanCommandPool::BuildSecondaryCommandBuffer(const Framebuffer& framebuffer, const RenderPass& renderPass, UInt32 subpassIndex, const std::function<void(CommandBufferBuilder& builder)>& callback)
+	{
+		const VulkanFramebuffer& vkFramebuffer = static_cast<const VulkanFramebuffer&>(framebuffer);
+		const VulkanRenderPass& vkRenderPass = static_cast<const VulkanRenderPass&>(renderPass);
 
-		// No allocation could be made, time to allocate a new pool
-		std::size_t newPoolIndex = m_commandPools.size();
-		AllocatePool();
+		Vk::AutoCommandBuffer commandBuffer = m_commandPool.AllocateCommandBuffer(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
 
-		return AllocateFromPool(newPoolIndex, std::move(commandBuffer));
+		// Secondary command buffers are executed inside a render pass (they inherit its state)
+		// They're only executed by one primary command buffer at a time, simultaneous use would prevent some driver optimizations
+		if (!commandBuffer->Begin(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT, vkRenderPass.GetRenderPass(), subpassIndex, vkFramebuffer.GetFramebuffer(), false, 0, 0))
+			throw std::runtime_error("failed to begin command buffer: " + TranslateVulkanError(commandBuffer->GetLastErrorCode()));
+
+		VulkanCommandBufferBuilder builder(commandBuffer.Get(), vkRenderPass, subpassIndex);
+		callback(builder);
+
+		if (!commandBuffer->End())
+			throw std::runtime_error("failed to build command buffer: " + TranslateVulkanError(commandBuffer->GetLastErrorCode()));
+
+		return RegisterCommandBuffer(std::move(commandBuffer));
 	}
 
 	void VulkanCommandPool::UpdateDebugName(std::string_view name)
@@ -55,6 +66,23 @@ namespace Nz
 		return m_commandPools.emplace_back(std::move(pool));
 	}
 
+	CommandBufferPtr VulkanCommandPool::RegisterCommandBuffer(Vk::AutoCommandBuffer commandBuffer)
+	{
+		for (std::size_t i = 0; i < m_commandPools.size(); ++i)
+		{
+			if (m_commandPools[i].freeCommands.TestNone())
+				continue;
+
+			return AllocateFromPool(i, std::move(commandBuffer));
+		}
+
+		// No allocation could be made, time to allocate a new pool
+		std::size_t newPoolIndex = m_commandPools.size();
+		AllocatePool();
+
+		return AllocateFromPool(newPoolIndex, std::move(commandBuffer));
+	}
+
 	void VulkanCommandPool::Release(CommandBuffer& binding)
 	{
 		VulkanCommandBuffer& vulkanBinding = static_cast<VulkanCommandBuffer&>(binding);
@@ -13,14 +13,29 @@
 #include <Nazara/VulkanRenderer/VulkanSwapchain.hpp>
 #include <Nazara/VulkanRenderer/VulkanTexture.hpp>
 #include <Nazara/VulkanRenderer/VulkanTextureFramebuffer.hpp>
+#include <Nazara/VulkanRenderer/VulkanTextureHeap.hpp>
 #include <Nazara/VulkanRenderer/VulkanTextureSampler.hpp>
+#include <Nazara/VulkanRenderer/Wrapper/Image.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/QueueHandle.hpp>
+#include <stdexcept>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
 namespace Nz
 {
 	VulkanDevice::~VulkanDevice() = default;
 
+	bool VulkanDevice::Create(const Vk::PhysicalDevice& deviceInfo, const VkDeviceCreateInfo& createInfo, const VkAllocationCallbacks* allocator)
+	{
+		if (!Device::Create(deviceInfo, createInfo, allocator))
+			return false;
+
+		// Pipeline creation can work without a cache
+		if (!m_pipelineCache.Create(*this))
+			NazaraWarning("failed to create pipeline cache: {0}", TranslateVulkanError(m_pipelineCache.GetLastErrorCode()));
+
+		return true;
+	}
+
 	const RenderDeviceInfo& VulkanDevice::GetDeviceInfo() const
 	{
 		return m_renderDeviceInfo;
@@ -31,6 +46,39 @@ namespace Nz
 		return m_enabledFeatures;
 	}
 
+	std::vector<UInt8> VulkanDevice::GetPipelineCacheData() const
+	{
+		std::vector<UInt8> data;
+		if (!m_pipelineCache.IsValid() || !m_pipelineCache.GetData(&data))
+			return {};
+
+		return data;
+	}
+
+	TextureMemoryRequirements VulkanDevice::GetTextureMemoryRequirements(const TextureInfo& textureInfo)
+	{
+		TextureInfo imageInfo = textureInfo;
+		imageInfo.levelCount = std::min(imageInfo.levelCount, Image::GetMaxLevel(imageInfo.type, imageInfo.width, imageInfo.height, imageInfo.depth));
+
+		VkImageCreateInfo createInfo;
+		VkImageViewCreateInfo createInfoView;
+		VulkanTexture::BuildCreateInfo(imageInfo, createInfo, createInfoView);
+
+		// Memory requirements can only be queried on an image object
+		Vk::Image image;
+		if (!image.Create(*this, createInfo))
+			throw std::runtime_error("failed to create image: " + TranslateVulkanError(image.GetLastErrorCode()));
+
+		VkMemoryRequirements memoryRequirements = image.GetMemoryRequirements();
+
+		TextureMemoryRequirements requirements;
+		requirements.alignment = memoryRequirements.alignment;
+		requirements.memoryTypeBits = memoryRequirements.memoryTypeBits;
+		requirements.size = memoryRequirements.size;
+
+		return requirements;
+	}
+
 	std::shared_ptr<RenderBuffer> VulkanDevice::InstantiateBuffer(BufferType type, UInt64 size, BufferUsageFlags usageFlags, const void* initialData)
 	{
 		return std::make_shared<VulkanBuffer>(*this, type, size, usageFlags, initialData);
@@ -103,6 +151,11 @@ namespace Nz
 		return std::make_shared<VulkanTexture>(*this, params, initialData, buildMipmaps, srcWidth, srcHeight);
 	}
 
+	std::shared_ptr<TextureHeap> VulkanDevice::InstantiateTextureHeap(const TextureMemoryRequirements& heapRequirements)
+	{
+		return std::make_shared<VulkanTextureHeap>(*this, heapRequirements);
+	}
+
 	std::shared_ptr<TextureSampler> VulkanDevice::InstantiateTextureSampler(const TextureSamplerInfo& params)
 	{
 		return std::make_shared<VulkanTextureSampler>(*this, params);
@@ -147,6 +200,22 @@ namespace Nz
 		return formatProperties.optimalTilingFeatures & flags; //< Assume optimal tiling
 	}
 
+	bool VulkanDevice::LoadPipelineCacheData(const void* data, std::size_t size)
+	{
+		if (!m_pipelineCache.IsValid())
+			return false;
+
+		// Drivers check the data header (vendor, device and cache UUID) and ignore incompatible data
+		Vk::PipelineCache loadedCache;
+		if (!loadedCache.Create(*this, data, size))
+		{
+			NazaraError("failed to load pipeline cache data: {0}", TranslateVulkanError(loadedCache.GetLastErrorCode()));
+			return false;
+		}
+
+		return m_pipelineCache.Merge(loadedCache);
+	}
+
 	void VulkanDevice::WaitForIdle()
 	{
 		Device::WaitForIdle();
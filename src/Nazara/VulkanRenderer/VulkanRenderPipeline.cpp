@@ -9,10 +9,17 @@
 #include <Nazara/VulkanRenderer/VulkanRenderPipelineLayout.hpp>
 #include <Nazara/VulkanRenderer/VulkanShaderModule.hpp>
 #include <cassert>
+#include <mutex>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Render passes signals are shared between pipelines, which may be instantiated from multiple threads
+		std::mutex s_renderPassConnectionMutex;
+	}
+
 	VulkanRenderPipeline::VulkanRenderPipeline(VulkanDevice& device, RenderPipelineInfo pipelineInfo) :
 	m_device(&device),
 	m_pipelineInfo(std::move(pipelineInfo))
@@ -34,6 +41,16 @@ namespace Nz
 
 		std::pair<VkRenderPass, std::size_t> key = { renderPassHandle, colorAttachmentCount };
 
+		// Command buffers can be recorded from multiple threads, pipelines are looked up concurrently
+		{
+			std::shared_lock lock(m_pipelineMutex);
+			if (auto it = m_pipelines.find(key); it != m_pipelines.end())
+				return it->second.pipeline;
+		}
+
+		std::unique_lock lock(m_pipelineMutex);
+
+		// Another thread may have created the pipeline while we were waiting
 		if (auto it = m_pipelines.find(key); it != m_pipelines.end())
 			return it->second.pipeline;
 
@@ -43,12 +60,16 @@ namespace Nz
 		pipelineCreateInfo.renderPass = renderPassHandle;
 
 		PipelineData pipelineData;
-		pipelineData.onRenderPassRelease.Connect(renderPass.OnRenderPassRelease, [this, key](const VulkanRenderPass*)
 		{
-			m_pipelines.erase(key);
-		});
+			std::lock_guard connectionLock(s_renderPassConnectionMutex);
+			pipelineData.onRenderPassRelease.Connect(renderPass.OnRenderPassRelease, [this, key](const VulkanRenderPass*)
+			{
+				std::unique_lock lock(m_pipelineMutex);
+				m_pipelines.erase(key);
+			});
+		}
 
-		if (!pipelineData.pipeline.CreateGraphics(*m_device, pipelineCreateInfo))
+		if (!pipelineData.pipeline.CreateGraphics(*m_device, pipelineCreateInfo, m_device->GetPipelineCache()))
 			return VK_NULL_HANDLE;
 
 		if (!m_debugName.empty())
@@ -58,6 +79,11 @@ namespace Nz
 		return it->second.pipeline;
 	}
 
+	void VulkanRenderPipeline::Prewarm(const RenderPass& renderPass, std::size_t subpassIndex) const
+	{
+		Get(static_cast<const VulkanRenderPass&>(renderPass), subpassIndex);
+	}
+
 	void VulkanRenderPipeline::UpdateDebugName(std::string_view name)
 	{
 		m_debugName = name;
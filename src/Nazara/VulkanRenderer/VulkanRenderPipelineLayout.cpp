@@ -9,6 +9,7 @@
 #include <NazaraUtils/MemoryHelper.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <NazaraUtils/StackVector.hpp>
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include <Nazara/VulkanRenderer/Debug.hpp>
@@ -73,10 +74,21 @@ namespace Nz
 			layoutBinding.descriptorType = ToVulkan(bindingInfo.type);
 			layoutBinding.pImmutableSamplers = nullptr;
 			layoutBinding.stageFlags = ToVulkan(bindingInfo.shaderStageFlags);
+
+			VkDescriptorBindingFlags bindingFlags = 0;
+			if (bindingInfo.partiallyBound)
+				bindingFlags |= VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+			descriptorSetLayoutInfo.bindingFlags.push_back(bindingFlags);
 		}
 
 		for (UInt32 i = 0; i < setCount; ++i)
 		{
+			// Binding flags require descriptor indexing, only pass them when used
+			auto& bindingFlags = setLayoutInfo[i].bindingFlags;
+			if (std::all_of(bindingFlags.begin(), bindingFlags.end(), [](VkDescriptorBindingFlags flags) { return flags == 0; }))
+				bindingFlags.clear();
+
 			m_descriptorSetLayouts[i] = &device.GetDescriptorSetLayoutCache().Get(setLayoutInfo[i]);
 			setLayouts[i] = *m_descriptorSetLayouts[i];
 		}
@@ -97,22 +109,30 @@ namespace Nz
 		StackVector<VkDescriptorPoolSize> poolSizes = NazaraStackVector(VkDescriptorPoolSize, m_layoutInfo.bindings.size());
 
 		constexpr UInt32 MaxSet = 128;
+		constexpr UInt32 MaxDescriptorPerBinding = 4096;
+
+		// Big descriptor arrays (such as bindless texture tables) reduce the number of sets per pool to keep pools reasonably sized
+		UInt32 maxArraySize = 1;
+		for (const auto& bindingInfo : m_layoutInfo.bindings)
+			maxArraySize = std::max(maxArraySize, bindingInfo.arraySize);
+
+		UInt32 setCount = std::clamp<UInt32>(MaxDescriptorPerBinding / maxArraySize, 1, MaxSet);
 
 		for (const auto& bindingInfo : m_layoutInfo.bindings)
 		{
 			VkDescriptorPoolSize& poolSize = poolSizes.emplace_back();
-			poolSize.descriptorCount = MaxSet;
+			poolSize.descriptorCount = bindingInfo.arraySize * setCount;
 			poolSize.type = ToVulkan(bindingInfo.type);
 		}
 
 		DescriptorPool pool;
 		pool.descriptorPool = std::make_unique<Vk::DescriptorPool>();
 
-		if (!pool.descriptorPool->Create(*m_device, MaxSet, UInt32(poolSizes.size()), poolSizes.data(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT))
+		if (!pool.descriptorPool->Create(*m_device, setCount, UInt32(poolSizes.size()), poolSizes.data(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT))
 			throw std::runtime_error("failed to allocate new descriptor pool: " + TranslateVulkanError(pool.descriptorPool->GetLastErrorCode()));
 
-		pool.freeBindings.Resize(MaxSet, true);
-		pool.storage = std::make_unique<DescriptorPool::BindingStorage[]>(MaxSet);
+		pool.freeBindings.Resize(setCount, true);
+		pool.storage = std::make_unique<DescriptorPool::BindingStorage[]>(setCount);
 
 		return m_descriptorPools.emplace_back(std::move(pool));
 	}
@@ -85,6 +85,7 @@ namespace Nz
 						imageInfo.sampler = (vkSampler) ? vkSampler->GetSampler() : VK_NULL_HANDLE;
 					}
 
+					writeOp.dstArrayElement = arg.arrayOffset;
 					writeOp.descriptorCount = arg.arraySize;
 					writeOp.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 					writeOp.pImageInfo = &imageBinding[imageBinding.size() - arg.arraySize];
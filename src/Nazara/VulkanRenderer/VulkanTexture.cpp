@@ -6,6 +6,7 @@
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/VulkanRenderer/VulkanBuffer.hpp>
 #include <Nazara/VulkanRenderer/VulkanDevice.hpp>
+#include <Nazara/VulkanRenderer/VulkanTextureHeap.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/CommandBuffer.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/QueueHandle.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
@@ -24,87 +25,9 @@ namespace Nz
 		m_textureInfo.levelCount = std::min(m_textureInfo.levelCount, Image::GetMaxLevel(m_textureInfo.type, m_textureInfo.width, m_textureInfo.height, m_textureInfo.depth));
 		m_textureViewInfo = m_textureInfo;
 
-		VkImageViewCreateInfo createInfoView = {};
-		createInfoView.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-		InitViewForFormat(m_textureInfo.pixelFormat, createInfoView);
-		
-		VkImageCreateInfo createInfo = {};
-		createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-		createInfo.format = createInfoView.format;
-		createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
-		createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
-		createInfo.usage = ToVulkan(m_textureInfo.usageFlags);
-
-		switch (m_textureInfo.type)
-		{
-			case ImageType::E1D:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height == 1, "Height must be one");
-				NazaraAssert(m_textureInfo.depth == 1, "Depth must be one");
-				NazaraAssert(m_textureInfo.layerCount == 1, "Array count must be one");
-
-				createInfo.imageType = VK_IMAGE_TYPE_1D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_1D;
-				break;
-
-			case ImageType::E1D_Array:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height == 1, "Height must be one");
-				NazaraAssert(m_textureInfo.depth == 1, "Depth must be one");
-				NazaraAssert(m_textureInfo.layerCount > 0, "Array count must be over zero");
-
-				createInfo.imageType = VK_IMAGE_TYPE_1D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_1D_ARRAY;
-				break;
-
-			case ImageType::E2D:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height > 0, "Height must be over zero");
-				NazaraAssert(m_textureInfo.depth == 1, "Depth must be one");
-				NazaraAssert(m_textureInfo.layerCount == 1, "Array count must be one");
-
-				createInfo.imageType = VK_IMAGE_TYPE_2D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_2D;
-				break;
-
-			case ImageType::E2D_Array:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height > 0, "Height must be over zero");
-				NazaraAssert(m_textureInfo.depth == 1, "Depth must be one");
-				NazaraAssert(m_textureInfo.layerCount > 0, "Array count must be over zero");
-
-				createInfo.imageType = VK_IMAGE_TYPE_2D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
-				break;
-
-			case ImageType::E3D:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height > 0, "Height must be over zero");
-				NazaraAssert(m_textureInfo.depth > 0, "Depth must be over zero");
-				NazaraAssert(m_textureInfo.layerCount == 1, "Array count must be one");
-
-				createInfo.imageType = VK_IMAGE_TYPE_3D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_3D;
-				break;
-
-			case ImageType::Cubemap:
-				NazaraAssert(m_textureInfo.width > 0, "Width must be over zero");
-				NazaraAssert(m_textureInfo.height > 0, "Height must be over zero");
-				NazaraAssert(m_textureInfo.depth == 1, "Depth must be one");
-				NazaraAssert(m_textureInfo.layerCount > 0 && m_textureInfo.layerCount % 6 == 0, "Array count must be a multiple of 6");
-
-				createInfo.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
-				createInfo.imageType = VK_IMAGE_TYPE_2D;
-				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_CUBE;
-				break;
-		}
-
-		createInfo.extent.width = m_textureInfo.width;
-		createInfo.extent.height = m_textureInfo.height;
-		createInfo.extent.depth = m_textureInfo.depth;
-		createInfo.arrayLayers = m_textureInfo.layerCount;
-		createInfo.mipLevels = m_textureInfo.levelCount;
+		VkImageCreateInfo createInfo;
+		VkImageViewCreateInfo createInfoView;
+		BuildCreateInfo(m_textureInfo, createInfo, createInfoView);
 
 		VmaAllocationCreateInfo allocInfo = {};
 		allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
@@ -115,20 +38,41 @@ namespace Nz
 
 		CallOnExit releaseImage([&]{ vmaDestroyImage(m_device.GetMemoryAllocator(), m_image, m_allocation); });
 
-		// Create default view (viewing the whole texture)
-		m_subresourceRange = {
-			ToVulkan(PixelFormatInfo::GetContent(m_textureInfo.pixelFormat)),
-			0,                      //< baseMipLevel
-			createInfo.mipLevels,   //< levelCount
-			0,                      //< baseArrayLayer
-			createInfo.arrayLayers  //< layerCount
-		};
+		CreateDefaultView(createInfo, createInfoView);
 
-		createInfoView.image = m_image;
-		createInfoView.subresourceRange = m_subresourceRange;
+		releaseImage.Reset();
+	}
 
-		if (!m_imageView.Create(m_device, createInfoView))
-			throw std::runtime_error("Failed to create default image view: " + TranslateVulkanError(m_imageView.GetLastErrorCode()));
+	/*!
+	* \brief Creates a texture in an existing texture heap, whose memory may be shared with other textures
+	*
+	* The texture content is undefined when it's used for the first time after another texture overlapping its memory range was used.
+	*/
+	VulkanTexture::VulkanTexture(std::shared_ptr<VulkanTextureHeap> heap, const TextureInfo& textureInfo, UInt64 heapOffset) :
+	m_heap(std::move(heap)),
+	m_device(m_heap->GetDevice()),
+	m_image(VK_NULL_HANDLE),
+	m_allocation(nullptr),
+	m_textureInfo(textureInfo)
+	{
+		m_textureInfo.levelCount = std::min(m_textureInfo.levelCount, Image::GetMaxLevel(m_textureInfo.type, m_textureInfo.width, m_textureInfo.height, m_textureInfo.depth));
+		m_textureViewInfo = m_textureInfo;
+
+		VkImageCreateInfo createInfo;
+		VkImageViewCreateInfo createInfoView;
+		BuildCreateInfo(m_textureInfo, createInfo, createInfoView);
+
+		VkResult result = m_device.vkCreateImage(m_device, &createInfo, nullptr, &m_image);
+		if (result != VK_SUCCESS)
+			throw std::runtime_error("Failed to create image: " + TranslateVulkanError(result));
+
+		CallOnExit releaseImage([&]{ m_device.vkDestroyImage(m_device, m_image, nullptr); });
+
+		result = vmaBindImageMemory2(m_device.GetMemoryAllocator(), m_heap->GetAllocation(), heapOffset, m_image, nullptr);
+		if (result != VK_SUCCESS)
+			throw std::runtime_error("Failed to bind image memory: " + TranslateVulkanError(result));
+
+		CreateDefaultView(createInfo, createInfoView);
 
 		releaseImage.Reset();
 	}
@@ -300,6 +244,8 @@ namespace Nz
 	{
 		if (m_allocation)
 			vmaDestroyImage(m_device.GetMemoryAllocator(), m_image, m_allocation);
+		else if (m_heap)
+			m_device.vkDestroyImage(m_device, m_image, nullptr);
 	}
 
 	bool VulkanTexture::Copy(const Texture& source, const Boxui& srcBox, const Vector3ui& dstPos)
@@ -480,6 +426,109 @@ namespace Nz
 		m_device.SetDebugName(VK_OBJECT_TYPE_IMAGE_VIEW, VulkanHandleToInteger(static_cast<VkImageView>(m_imageView)), name);
 	}
 
+	void VulkanTexture::BuildCreateInfo(const TextureInfo& textureInfo, VkImageCreateInfo& createInfo, VkImageViewCreateInfo& createInfoView)
+	{
+		createInfoView = {};
+		createInfoView.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		InitViewForFormat(textureInfo.pixelFormat, createInfoView);
+
+		createInfo = {};
+		createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		createInfo.format = createInfoView.format;
+		createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+		createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		createInfo.usage = ToVulkan(textureInfo.usageFlags);
+
+		switch (textureInfo.type)
+		{
+			case ImageType::E1D:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height == 1, "Height must be one");
+				NazaraAssert(textureInfo.depth == 1, "Depth must be one");
+				NazaraAssert(textureInfo.layerCount == 1, "Array count must be one");
+
+				createInfo.imageType = VK_IMAGE_TYPE_1D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_1D;
+				break;
+
+			case ImageType::E1D_Array:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height == 1, "Height must be one");
+				NazaraAssert(textureInfo.depth == 1, "Depth must be one");
+				NazaraAssert(textureInfo.layerCount > 0, "Array count must be over zero");
+
+				createInfo.imageType = VK_IMAGE_TYPE_1D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_1D_ARRAY;
+				break;
+
+			case ImageType::E2D:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height > 0, "Height must be over zero");
+				NazaraAssert(textureInfo.depth == 1, "Depth must be one");
+				NazaraAssert(textureInfo.layerCount == 1, "Array count must be one");
+
+				createInfo.imageType = VK_IMAGE_TYPE_2D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_2D;
+				break;
+
+			case ImageType::E2D_Array:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height > 0, "Height must be over zero");
+				NazaraAssert(textureInfo.depth == 1, "Depth must be one");
+				NazaraAssert(textureInfo.layerCount > 0, "Array count must be over zero");
+
+				createInfo.imageType = VK_IMAGE_TYPE_2D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+				break;
+
+			case ImageType::E3D:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height > 0, "Height must be over zero");
+				NazaraAssert(textureInfo.depth > 0, "Depth must be over zero");
+				NazaraAssert(textureInfo.layerCount == 1, "Array count must be one");
+
+				createInfo.imageType = VK_IMAGE_TYPE_3D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_3D;
+				break;
+
+			case ImageType::Cubemap:
+				NazaraAssert(textureInfo.width > 0, "Width must be over zero");
+				NazaraAssert(textureInfo.height > 0, "Height must be over zero");
+				NazaraAssert(textureInfo.depth == 1, "Depth must be one");
+				NazaraAssert(textureInfo.layerCount > 0 && textureInfo.layerCount % 6 == 0, "Array count must be a multiple of 6");
+
+				createInfo.flags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+				createInfo.imageType = VK_IMAGE_TYPE_2D;
+				createInfoView.viewType = VK_IMAGE_VIEW_TYPE_CUBE;
+				break;
+		}
+
+		createInfo.extent.width = textureInfo.width;
+		createInfo.extent.height = textureInfo.height;
+		createInfo.extent.depth = textureInfo.depth;
+		createInfo.arrayLayers = textureInfo.layerCount;
+		createInfo.mipLevels = textureInfo.levelCount;
+	}
+
+	void VulkanTexture::CreateDefaultView(const VkImageCreateInfo& createInfo, VkImageViewCreateInfo& createInfoView)
+	{
+		// Create default view (viewing the whole texture)
+		m_subresourceRange = {
+			ToVulkan(PixelFormatInfo::GetContent(m_textureInfo.pixelFormat)),
+			0,                      //< baseMipLevel
+			createInfo.mipLevels,   //< levelCount
+			0,                      //< baseArrayLayer
+			createInfo.arrayLayers  //< layerCount
+		};
+
+		createInfoView.image = m_image;
+		createInfoView.subresourceRange = m_subresourceRange;
+
+		if (!m_imageView.Create(m_device, createInfoView))
+			throw std::runtime_error("Failed to create default image view: " + TranslateVulkanError(m_imageView.GetLastErrorCode()));
+	}
+
 	void VulkanTexture::InitViewForFormat(PixelFormat pixelFormat, VkImageViewCreateInfo& createImageView)
 	{
 		// TODO: Fill this switch
@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Vulkan renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/VulkanRenderer/VulkanTextureHeap.hpp>
+#include <Nazara/VulkanRenderer/VulkanDevice.hpp>
+#include <Nazara/VulkanRenderer/VulkanTexture.hpp>
+#include <vma/vk_mem_alloc.h>
+#include <stdexcept>
+#include <string>
+#include <Nazara/VulkanRenderer/Debug.hpp>
+
+namespace Nz
+{
+	VulkanTextureHeap::VulkanTextureHeap(VulkanDevice& device, const TextureMemoryRequirements& heapRequirements) :
+	TextureHeap(heapRequirements.size),
+	m_device(device)
+	{
+		VkMemoryRequirements memoryRequirements = {
+			heapRequirements.size,
+			heapRequirements.alignment,
+			heapRequirements.memoryTypeBits
+		};
+
+		// Heaps are big and live as long as the frame graph, give them their own memory block
+		VmaAllocationCreateInfo allocInfo = {};
+		allocInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+		allocInfo.preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+		VkResult result = vmaAllocateMemory(m_device.GetMemoryAllocator(), &memoryRequirements, &allocInfo, &m_allocation, nullptr);
+		if (result != VK_SUCCESS)
+			throw std::runtime_error("failed to allocate texture heap: " + TranslateVulkanError(result));
+	}
+
+	VulkanTextureHeap::~VulkanTextureHeap()
+	{
+		vmaFreeMemory(m_device.GetMemoryAllocator(), m_allocation);
+	}
+
+	std::shared_ptr<Texture> VulkanTextureHeap::InstantiateTexture(const TextureInfo& textureInfo, UInt64 offset)
+	{
+		return std::make_shared<VulkanTexture>(shared_from_this(), textureInfo, offset);
+	}
+
+	void VulkanTextureHeap::UpdateDebugName(std::string_view name)
+	{
+		VmaAllocationInfo allocationInfo;
+		vmaGetAllocationInfo(m_device.GetMemoryAllocator(), m_allocation, &allocationInfo);
+
+		m_device.SetDebugName(VK_OBJECT_TYPE_DEVICE_MEMORY, VulkanHandleToInteger(allocationInfo.deviceMemory), name);
+	}
+}
+
+// vma includes vulkan.h which includes system headers
+#if defined(NAZARA_PLATFORM_WINDOWS)
+#include <Nazara/Core/AntiWindows.hpp>
+#elif defined(NAZARA_PLATFORM_LINUX)
+#include <Nazara/Core/AntiX11.hpp>
+#endif
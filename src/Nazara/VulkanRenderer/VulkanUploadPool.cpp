@@ -3,7 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/VulkanRenderer/VulkanUploadPool.hpp>
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <stdexcept>
 #include <Nazara/VulkanRenderer/Debug.hpp>
 
@@ -19,59 +21,115 @@ namespace Nz
 
 	auto VulkanUploadPool::Allocate(UInt64 size, UInt64 alignment) -> VulkanAllocation&
 	{
-		// Try to minimize lost space
-		struct
-		{
-			Block* block = nullptr;
-			UInt64 alignedOffset = 0;
-			UInt64 lostSpace = 0;
-		} bestBlock;
+		// Big allocations would waste most of a block, they get their own buffer
+		if (size > m_blockSize / 2)
+			return AllocateDedicated(size);
 
-		for (Block& block : m_blocks)
+		// Linear allocation in the current block, blocks are filled in the same order every frame
+		UInt64 alignedOffset = 0;
+		if (m_currentBlockIndex < m_blocks.size())
 		{
-			UInt64 alignedOffset = AlignPow2(block.freeOffset, alignment);
-			if (alignedOffset + size > block.size)
-				continue; //< Not enough space
-
-			UInt64 lostSpace = alignedOffset - block.freeOffset;
-
-			if (!bestBlock.block || lostSpace < bestBlock.lostSpace)
+			alignedOffset = AlignPow2(m_blocks[m_currentBlockIndex].freeOffset, alignment);
+			if (alignedOffset + size > m_blocks[m_currentBlockIndex].size)
 			{
-				bestBlock.block = &block;
-				bestBlock.alignedOffset = alignedOffset;
-				bestBlock.lostSpace = lostSpace;
+				// Not enough space, the end of the block stays unused until next reset
+				m_currentBlockIndex++;
+				alignedOffset = 0;
 			}
 		}
 
-		// No block found, allocate a new one
-		if (!bestBlock.block)
+		if (m_currentBlockIndex >= m_blocks.size())
 		{
-			// Handle really big allocations (TODO: Handle them separately as they shouldn't be common and can consume a lot of memory)
-			UInt64 blockSize = std::max(m_blockSize, size);
+			assert(m_currentBlockIndex == m_blocks.size());
+			m_blocks.push_back(CreateBlock(m_blockSize));
+		}
+
+		Block& block = m_blocks[m_currentBlockIndex];
+		m_stats.usedMemory += alignedOffset + size - block.freeOffset;
+		block.freeOffset = alignedOffset + size;
 
-			Block newBlock;
-			newBlock.size = blockSize;
+		return PushAllocation(block, alignedOffset, size);
+	}
 
-			if (!newBlock.buffer.Create(m_device, 0U, blockSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
-				throw std::runtime_error("failed to create block buffer: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+	/*!
+	* \brief Makes the memory of every allocation available again
+	*
+	* This must only be called once the GPU is done with the frame using this pool (after waiting on its fence).
+	*/
+	void VulkanUploadPool::Reset()
+	{
+		// Dedicated blocks which weren't reused during the last frame are released, others are kept for the next one
+		for (Block& block : m_freeDedicatedBlocks)
+			m_stats.allocatedMemory -= block.size;
 
-			VkMemoryRequirements requirement = newBlock.buffer.GetMemoryRequirements();
+		m_freeDedicatedBlocks.clear();
+		std::move(m_dedicatedBlocks.begin(), m_dedicatedBlocks.end(), std::back_inserter(m_freeDedicatedBlocks));
+		m_dedicatedBlocks.clear();
 
-			if (!newBlock.blockMemory.Create(m_device, requirement.size, requirement.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
-				throw std::runtime_error("failed to allocate block memory: " + TranslateVulkanError(newBlock.blockMemory.GetLastErrorCode()));
+		for (std::size_t blockIndex = 0; blockIndex < m_blocks.size() && blockIndex <= m_currentBlockIndex; ++blockIndex)
+			m_blocks[blockIndex].freeOffset = 0;
 
-			if (!newBlock.buffer.BindBufferMemory(newBlock.blockMemory))
-				throw std::runtime_error("failed to bind buffer memory: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+		m_currentBlockIndex = 0;
+		m_nextAllocationIndex = 0;
 
-			if (!newBlock.blockMemory.Map())
-				throw std::runtime_error("failed to map buffer memory: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+		m_stats.allocationCount = 0;
+		m_stats.dedicatedAllocationCount = 0;
+		m_stats.usedMemory = 0;
+	}
 
-			bestBlock.block = &m_blocks.emplace_back(std::move(newBlock));
-			bestBlock.alignedOffset = 0;
-			bestBlock.lostSpace = 0;
+	auto VulkanUploadPool::AllocateDedicated(UInt64 size) -> VulkanAllocation&
+	{
+		// Reuse the smallest dedicated block from the previous frame big enough, if any
+		auto bestIt = m_freeDedicatedBlocks.end();
+		for (auto it = m_freeDedicatedBlocks.begin(); it != m_freeDedicatedBlocks.end(); ++it)
+		{
+			if (it->size >= size && (bestIt == m_freeDedicatedBlocks.end() || it->size < bestIt->size))
+				bestIt = it;
+		}
+
+		Block* block;
+		if (bestIt != m_freeDedicatedBlocks.end())
+		{
+			block = &m_dedicatedBlocks.emplace_back(std::move(*bestIt));
+			m_freeDedicatedBlocks.erase(bestIt);
 		}
+		else
+			block = &m_dedicatedBlocks.emplace_back(CreateBlock(size));
+
+		block->freeOffset = size;
+
+		m_stats.dedicatedAllocationCount++;
+		m_stats.usedMemory += size;
+
+		return PushAllocation(*block, 0, size);
+	}
 
-		// Now find the proper allocation buffer
+	auto VulkanUploadPool::CreateBlock(UInt64 size) -> Block
+	{
+		Block newBlock;
+		newBlock.size = size;
+
+		if (!newBlock.buffer.Create(m_device, 0U, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+			throw std::runtime_error("failed to create block buffer: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+
+		VkMemoryRequirements requirement = newBlock.buffer.GetMemoryRequirements();
+
+		if (!newBlock.blockMemory.Create(m_device, requirement.size, requirement.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+			throw std::runtime_error("failed to allocate block memory: " + TranslateVulkanError(newBlock.blockMemory.GetLastErrorCode()));
+
+		if (!newBlock.buffer.BindBufferMemory(newBlock.blockMemory))
+			throw std::runtime_error("failed to bind buffer memory: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+
+		if (!newBlock.blockMemory.Map())
+			throw std::runtime_error("failed to map buffer memory: " + TranslateVulkanError(newBlock.buffer.GetLastErrorCode()));
+
+		m_stats.allocatedMemory += size;
+
+		return newBlock;
+	}
+
+	auto VulkanUploadPool::PushAllocation(Block& block, UInt64 offset, UInt64 size) -> VulkanAllocation&
+	{
 		std::size_t allocationBlockIndex = m_nextAllocationIndex / AllocationPerBlock;
 		std::size_t allocationIndex = m_nextAllocationIndex % AllocationPerBlock;
 
@@ -84,22 +142,16 @@ namespace Nz
 		auto& allocationBlock = *m_allocationBlocks[allocationBlockIndex];
 
 		VulkanAllocation& allocationData = allocationBlock[allocationIndex];
-		allocationData.buffer = bestBlock.block->buffer;
-		allocationData.mappedPtr = static_cast<UInt8*>(bestBlock.block->blockMemory.GetMappedPointer()) + bestBlock.alignedOffset;
-		allocationData.offset = bestBlock.alignedOffset;
+		allocationData.buffer = block.buffer;
+		allocationData.mappedPtr = static_cast<UInt8*>(block.blockMemory.GetMappedPointer()) + offset;
+		allocationData.offset = offset;
 		allocationData.size = size;
 
-		bestBlock.block->freeOffset += size;
 		m_nextAllocationIndex++;
 
-		return allocationData;
-	}
+		m_stats.allocationCount++;
+		m_stats.peakUsedMemory = std::max(m_stats.peakUsedMemory, m_stats.usedMemory);
 
-	void VulkanUploadPool::Reset()
-	{
-		for (Block& block : m_blocks)
-			block.freeOffset = 0;
-
-		m_nextAllocationIndex = 0;
+		return allocationData;
 	}
 }
@@ -4,6 +4,9 @@
 
 #include <Nazara/Widgets/Canvas.hpp>
 #include <Nazara/Widgets/DefaultWidgetTheme.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <limits>
 #include <Nazara/Widgets/Debug.hpp>
 
@@ -43,7 +46,9 @@ namespace Nz
 	std::size_t Canvas::RegisterWidget(BaseWidget* widget)
 	{
 		WidgetEntry box;
+		box.cells = Recti(0, 0, 0, 0);
 		box.cursor = widget->GetCursor();
+		box.isLargeWidget = false;
 		box.widget = widget;
 
 		std::size_t index = m_widgetEntries.size();
@@ -55,6 +60,9 @@ namespace Nz
 
 	void Canvas::UnregisterWidget(std::size_t index)
 	{
+		UnindexWidget(index);
+		m_dirtyWidgetBoxes.UnboundedReset(index);
+
 		WidgetEntry& entry = m_widgetEntries[index];
 
 		if (m_hoveredWidget == index)
@@ -69,14 +77,21 @@ namespace Nz
 		if (m_keyboardOwner == index)
 			m_keyboardOwner = InvalidCanvasIndex;
 
-		if (m_widgetEntries.size() > 1U)
+		// Move the last entry in place of the removed one (unless the removed one is the last)
+		std::size_t lastEntryIndex = m_widgetEntries.size() - 1;
+		if (index != lastEntryIndex)
 		{
 			WidgetEntry& lastEntry = m_widgetEntries.back();
-			std::size_t lastEntryIndex = m_widgetEntries.size() - 1;
+
+			UnindexWidget(lastEntryIndex);
+			m_dirtyWidgetBoxes.UnboundedReset(lastEntryIndex);
 
 			entry = std::move(lastEntry);
 			entry.widget->UpdateCanvasIndex(index);
 
+			// Entry index changed, index it again
+			NotifyWidgetBoxUpdate(index);
+
 			if (m_hoveredWidget == lastEntryIndex)
 				m_hoveredWidget = index;
 
@@ -132,6 +147,8 @@ namespace Nz
 
 	void Canvas::OnEventMouseButtonRelease(const WindowEventHandler* /*eventHandler*/, const WindowEvent::MouseButtonEvent& event)
 	{
+		UpdateWidgetBoxes();
+
 		if (std::size_t targetWidgetIndex = GetMouseEventTarget(); targetWidgetIndex != InvalidCanvasIndex)
 		{
 			DispatchEvent(targetWidgetIndex, [&](WidgetEntry& widgetEntry)
@@ -203,6 +220,8 @@ namespace Nz
 
 	void Canvas::OnEventMouseWheelMoved(const WindowEventHandler* /*eventHandler*/, const WindowEvent::MouseWheelEvent& event)
 	{
+		UpdateWidgetBoxes();
+
 		if (std::size_t targetWidgetIndex = GetMouseEventTarget(); targetWidgetIndex != InvalidCanvasIndex)
 		{
 			DispatchEvent(targetWidgetIndex, [&](WidgetEntry& widgetEntry)
@@ -293,14 +312,94 @@ namespace Nz
 			m_widgetEntries[m_keyboardOwner].widget->OnTextEdited(event.text, event.length);
 	}
 
+	void Canvas::IndexWidget(std::size_t index)
+	{
+		WidgetEntry& entry = m_widgetEntries[index];
+		assert(entry.cells.width == 0 && !entry.isLargeWidget);
+
+		const Boxf& box = entry.box;
+		if (box.width <= 0.f || box.height <= 0.f)
+			return;
+
+		int firstCellX = static_cast<int>(std::floor(box.x / GridCellSize));
+		int firstCellY = static_cast<int>(std::floor(box.y / GridCellSize));
+		int lastCellX = static_cast<int>(std::floor((box.x + box.width) / GridCellSize));
+		int lastCellY = static_cast<int>(std::floor((box.y + box.height) / GridCellSize));
+
+		int cellCountX = lastCellX - firstCellX + 1;
+		int cellCountY = lastCellY - firstCellY + 1;
+		if (cellCountX * cellCountY > MaxWidgetCellCount)
+		{
+			// Big widgets (like the canvas itself) would fill too many cells
+			entry.isLargeWidget = true;
+			m_largeWidgets.push_back(index);
+			return;
+		}
+
+		entry.cells = Recti(firstCellX, firstCellY, cellCountX, cellCountY);
+		for (int y = firstCellY; y <= lastCellY; ++y)
+		{
+			for (int x = firstCellX; x <= lastCellX; ++x)
+				m_widgetGrid[GetCellKey(x, y)].push_back(index);
+		}
+	}
+
+	void Canvas::UnindexWidget(std::size_t index)
+	{
+		auto RemoveIndex = [&](std::vector<std::size_t>& indices)
+		{
+			auto it = std::find(indices.begin(), indices.end(), index);
+			assert(it != indices.end());
+
+			*it = indices.back();
+			indices.pop_back();
+		};
+
+		WidgetEntry& entry = m_widgetEntries[index];
+		if (entry.isLargeWidget)
+		{
+			RemoveIndex(m_largeWidgets);
+			entry.isLargeWidget = false;
+		}
+		else if (entry.cells.width > 0)
+		{
+			for (int y = entry.cells.y; y < entry.cells.y + entry.cells.height; ++y)
+			{
+				for (int x = entry.cells.x; x < entry.cells.x + entry.cells.width; ++x)
+				{
+					auto it = m_widgetGrid.find(GetCellKey(x, y));
+					assert(it != m_widgetGrid.end());
+
+					RemoveIndex(it->second);
+					if (it->second.empty())
+						m_widgetGrid.erase(it);
+				}
+			}
+
+			entry.cells = Recti(0, 0, 0, 0);
+		}
+	}
+
 	void Canvas::UpdateHoveredWidget(int x, int y)
 	{
+		UpdateWidgetBoxes();
+
 		std::size_t bestEntry = InvalidCanvasIndex;
 		float bestEntryArea = std::numeric_limits<float>::infinity();
 		int bestEntryLayer = std::numeric_limits<int>::min();
 
 		Vector3f mousePos(float(x), m_size.y - float(y), 0.f);
-		for (std::size_t i = 0; i < m_widgetEntries.size(); ++i)
+
+		// Only test widgets sharing the mouse cell, in registration order to keep the same priority between widgets
+		m_hoverCandidates.assign(m_largeWidgets.begin(), m_largeWidgets.end());
+
+		auto it = m_widgetGrid.find(GetCellKey(static_cast<int>(std::floor(mousePos.x / GridCellSize)), static_cast<int>(std::floor(mousePos.y / GridCellSize))));
+		if (it != m_widgetGrid.end())
+			m_hoverCandidates.insert(m_hoverCandidates.end(), it->second.begin(), it->second.end());
+
+		std::sort(m_hoverCandidates.begin(), m_hoverCandidates.end());
+
+		for (std::size_t i : m_hoverCandidates)
 		{
 			const Boxf& box = m_widgetEntries[i].box;
 			int layer = m_widgetEntries[i].widget->GetBaseRenderLayer();
@@ -349,4 +448,23 @@ namespace Nz
 				m_cursorController->UpdateCursor(Cursor::Get(SystemCursor::Default));
 		}
 	}
+
+	void Canvas::UpdateWidgetBoxes()
+	{
+		for (std::size_t index = m_dirtyWidgetBoxes.FindFirst(); index != m_dirtyWidgetBoxes.npos; index = m_dirtyWidgetBoxes.FindNext(index))
+		{
+			UnindexWidget(index);
+
+			WidgetEntry& entry = m_widgetEntries[index];
+
+			Vector3f pos = entry.widget->GetPosition(CoordSys::Global);
+			Vector2f size = entry.widget->GetSize();
+
+			entry.box = Boxf(pos.x, pos.y, pos.z, size.x, size.y, 1.f);
+
+			IndexWidget(index);
+		}
+
+		m_dirtyWidgetBoxes.Clear();
+	}
 }
@@ -0,0 +1,472 @@
+#include <Nazara/Core.hpp>
+#include <Nazara/Math.hpp>
+#include <Nazara/Platform.hpp>
+#include <Nazara/Renderer.hpp>
+#include <NZSL/Parser.hpp>
+#include <NZSL/Math/FieldOffsets.hpp>
+#include <Nazara/Utility.hpp>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <thread>
+
+NAZARA_REQUEST_DEDICATED_GPU()
+
+// Culls every instance against the view rect and writes one indirect draw command per instance (with a vertex count of zero when culled)
+const char computeSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+[layout(std140)]
+struct Instance
+{
+	color: vec3[f32],
+	position: vec2[f32]
+}
+
+[layout(std140)]
+struct InstanceData
+{
+	instance_count: u32,
+	instances: dyn_array[Instance]
+}
+
+[layout(std140)]
+struct DrawCommand
+{
+	vertex_count: u32,
+	instance_count: u32,
+	first_vertex: u32,
+	first_instance: u32
+}
+
+[layout(std140)]
+struct DrawCommandData
+{
+	commands: dyn_array[DrawCommand]
+}
+
+[layout(std140)]
+struct SceneData
+{
+	view_rect: vec4[f32],
+	quad_size: f32
+}
+
+external
+{
+	[binding(0)] instanceData: storage[InstanceData],
+	[binding(1)] commandData: storage[DrawCommandData],
+	[binding(2)] sceneData: uniform[SceneData]
+}
+
+struct Input
+{
+	[builtin(global_invocation_indices)] indices: vec3[u32]
+}
+
+[entry(compute)]
+[workgroup(64, 1, 1)]
+fn main(input: Input)
+{
+	let index = input.indices.x;
+	if (index >= instanceData.instance_count)
+		return;
+
+	let position = instanceData.instances[index].position;
+	let viewMin = sceneData.view_rect.xy - vec2[f32](sceneData.quad_size, sceneData.quad_size);
+	let viewMax = sceneData.view_rect.xy + sceneData.view_rect.zw;
+	let isVisible = position.x >= viewMin.x && position.y >= viewMin.y && position.x <= viewMax.x && position.y <= viewMax.y;
+
+	commandData.commands[index].vertex_count = select(isVisible, u32(4), u32(0));
+	commandData.commands[index].instance_count = u32(1);
+	commandData.commands[index].first_vertex = index * u32(4);
+	commandData.commands[index].first_instance = u32(0);
+}
+)";
+
+const char fragVertSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+[layout(std140)]
+struct Instance
+{
+	color: vec3[f32],
+	position: vec2[f32]
+}
+
+[layout(std140)]
+struct InstanceData
+{
+	instance_count: u32,
+	instances: dyn_array[Instance]
+}
+
+[layout(std140)]
+struct SceneData
+{
+	view_rect: vec4[f32],
+	quad_size: f32
+}
+
+external
+{
+	[binding(0)] sceneData: uniform[SceneData],
+	[binding(1)] instanceData: storage[InstanceData]
+}
+
+struct FragOut
+{
+	[location(0)] color: vec4[f32]
+}
+
+struct VertIn
+{
+	[builtin(vertex_index)] vert_index: i32
+}
+
+struct VertOut
+{
+	[location(0)] color: vec3[f32],
+	[builtin(position)] pos: vec4[f32]
+}
+
+[entry(frag)]
+fn main(input: VertOut) -> FragOut
+{
+	let output: FragOut;
+	output.color = vec4[f32](input.color, 1.0);
+
+	return output;
+}
+
+[entry(vert)]
+fn main(input: VertIn) -> VertOut
+{
+	// Every instance is a quad (triangle strip) starting at vertex instance_index * 4
+	let instanceIndex = input.vert_index / 4;
+	let corner = input.vert_index % 4;
+
+	let worldPos = instanceData.instances[instanceIndex].position + vec2[f32](f32(corner / 2), f32(corner % 2)) * sceneData.quad_size;
+
+	let output: VertOut;
+	output.pos = vec4[f32]((worldPos - sceneData.view_rect.xy) / sceneData.view_rect.zw * 2.0 - vec2[f32](1.0, 1.0), 0.0, 1.0);
+	output.color = instanceData.instances[instanceIndex].color;
+	return output;
+}
+)";
+
+std::shared_ptr<Nz::ShaderModule> BuildShader(Nz::RenderDevice& device, nzsl::ShaderStageTypeFlags shaderStages, std::string_view source);
+
+int main()
+{
+	Nz::Vector2ui windowSize = { 1920, 1080 };
+
+	Nz::Renderer::Config rendererConfig;
+	std::cout << "Run using Vulkan? (y/n)" << std::endl;
+	if (std::getchar() == 'y')
+		rendererConfig.preferredAPI = Nz::RenderAPI::Vulkan;
+	else
+		rendererConfig.preferredAPI = Nz::RenderAPI::OpenGL;
+
+	Nz::Modules<Nz::Renderer> nazara(rendererConfig);
+
+	Nz::RenderDeviceFeatures enabledFeatures;
+	enabledFeatures.computeShaders = true;
+	enabledFeatures.drawIndirect = true;
+	enabledFeatures.multiDrawIndirect = true;
+	enabledFeatures.storageBuffers = true;
+
+	std::shared_ptr<Nz::RenderDevice> device = Nz::Renderer::Instance()->InstanciateRenderDevice(0, enabledFeatures);
+
+	const Nz::RenderDeviceFeatures& deviceFeatures = device->GetEnabledFeatures();
+	if (!deviceFeatures.computeShaders || !deviceFeatures.drawIndirect || !deviceFeatures.storageBuffers)
+	{
+		std::cerr << "this device doesn't support indirect draws" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (!deviceFeatures.multiDrawIndirect)
+		std::cout << "multi-draw indirect is not supported, falling back to one indirect draw per instance" << std::endl;
+
+	constexpr std::size_t instanceCount = 100'000;
+	constexpr float quadSize = 8.f;
+
+	// Instances are scattered over a world much larger than the view, most of them get culled every frame
+	Nz::Vector2f worldSize = Nz::Vector2f(windowSize) * 10.f;
+
+	nzsl::FieldOffsets instanceLayout(nzsl::StructLayout::Std140);
+	std::size_t instanceColorOffset = instanceLayout.AddField(nzsl::StructFieldType::Float3);
+	std::size_t instancePosOffset = instanceLayout.AddField(nzsl::StructFieldType::Float2);
+
+	std::size_t instanceSize = instanceLayout.GetAlignedSize();
+
+	nzsl::FieldOffsets instanceBufferLayout(nzsl::StructLayout::Std140);
+	std::size_t instanceCountOffset = instanceBufferLayout.AddField(nzsl::StructFieldType::UInt1);
+	std::size_t instanceArrayOffset = instanceBufferLayout.AddStructArray(instanceLayout, instanceCount);
+
+	std::size_t instanceBufferSize = instanceBufferLayout.GetAlignedSize();
+
+	std::vector<Nz::UInt8> instanceBufferData(instanceBufferSize);
+	Nz::AccessByOffset<Nz::UInt32&>(instanceBufferData.data(), instanceCountOffset) = instanceCount;
+
+	std::mt19937 rand(std::random_device{}());
+	std::uniform_real_distribution<float> colorDis(0.2f, 1.f);
+	std::uniform_real_distribution<float> posXDis(0.f, worldSize.x);
+	std::uniform_real_distribution<float> posYDis(0.f, worldSize.y);
+
+	Nz::UInt8* instanceBasePtr = instanceBufferData.data() + instanceArrayOffset;
+	Nz::SparsePtr<Nz::Vector3f> instanceColorPtr(instanceBasePtr + instanceColorOffset, instanceSize);
+	Nz::SparsePtr<Nz::Vector2f> instancePosPtr(instanceBasePtr + instancePosOffset, instanceSize);
+	for (std::size_t i = 0; i < instanceCount; ++i)
+	{
+		instanceColorPtr[i] = Nz::Vector3f(colorDis(rand), colorDis(rand), colorDis(rand));
+		instancePosPtr[i] = Nz::Vector2f(posXDis(rand), posYDis(rand));
+	}
+
+	std::shared_ptr<Nz::RenderBuffer> instanceBuffer = device->InstantiateBuffer(Nz::BufferType::Storage, instanceBufferSize, Nz::BufferUsage::DeviceLocal, instanceBufferData.data());
+
+	// Filled by the compute shader and read by the GPU as indirect draw commands
+	constexpr std::size_t commandBufferSize = instanceCount * sizeof(Nz::CommandBufferBuilder::DrawIndirectCommand);
+	std::shared_ptr<Nz::RenderBuffer> commandBuffer = device->InstantiateBuffer(Nz::BufferType::Storage, commandBufferSize, Nz::BufferUsage::DeviceLocal | Nz::BufferUsage::Indirect);
+
+	nzsl::FieldOffsets sceneBufferLayout(nzsl::StructLayout::Std140);
+	std::size_t viewRectOffset = sceneBufferLayout.AddField(nzsl::StructFieldType::Float4);
+	std::size_t quadSizeOffset = sceneBufferLayout.AddField(nzsl::StructFieldType::Float1);
+
+	std::size_t sceneBufferSize = sceneBufferLayout.GetAlignedSize();
+
+	std::shared_ptr<Nz::RenderBuffer> sceneDataBuffer = device->InstantiateBuffer(Nz::BufferType::Uniform, sceneBufferSize, Nz::BufferUsage::DeviceLocal | Nz::BufferUsage::Dynamic);
+
+	// Culling part
+	Nz::RenderPipelineLayoutInfo computePipelineLayoutInfo;
+	computePipelineLayoutInfo.bindings.assign({
+		{
+			0, 0, 1,
+			Nz::ShaderBindingType::StorageBuffer,
+			nzsl::ShaderStageType::Compute
+		},
+		{
+			0, 1, 1,
+			Nz::ShaderBindingType::StorageBuffer,
+			nzsl::ShaderStageType::Compute
+		},
+		{
+			0, 2, 1,
+			Nz::ShaderBindingType::UniformBuffer,
+			nzsl::ShaderStageType::Compute
+		}
+	});
+
+	std::shared_ptr<Nz::RenderPipelineLayout> computePipelineLayout = device->InstantiateRenderPipelineLayout(computePipelineLayoutInfo);
+
+	Nz::ComputePipelineInfo computePipelineInfo;
+	computePipelineInfo.pipelineLayout = computePipelineLayout;
+	computePipelineInfo.shaderModule = BuildShader(*device, nzsl::ShaderStageType::Compute, std::string_view(computeSource, sizeof(computeSource)));
+
+	std::shared_ptr<Nz::ComputePipeline> computePipeline = device->InstantiateComputePipeline(computePipelineInfo);
+	if (!computePipeline)
+	{
+		std::cout << "Failed to instantiate compute pipeline" << std::endl;
+		std::abort();
+	}
+
+	std::shared_ptr<Nz::ShaderBinding> computeBinding = computePipelineLayout->AllocateShaderBinding(0);
+	computeBinding->Update({
+		{
+			0,
+			Nz::ShaderBinding::StorageBufferBinding {
+				instanceBuffer.get(), 0, instanceBufferSize
+			}
+		},
+		{
+			1,
+			Nz::ShaderBinding::StorageBufferBinding {
+				commandBuffer.get(), 0, commandBufferSize
+			}
+		},
+		{
+			2,
+			Nz::ShaderBinding::UniformBufferBinding {
+				sceneDataBuffer.get(), 0, sceneBufferSize
+			}
+		}
+	});
+
+	// Rendering part
+	Nz::RenderPipelineLayoutInfo renderPipelineLayoutInfo;
+	renderPipelineLayoutInfo.bindings.assign({
+		{
+			0, 0, 1,
+			Nz::ShaderBindingType::UniformBuffer,
+			nzsl::ShaderStageType::Vertex
+		},
+		{
+			0, 1, 1,
+			Nz::ShaderBindingType::StorageBuffer,
+			nzsl::ShaderStageType::Vertex
+		}
+	});
+
+	std::shared_ptr<Nz::RenderPipelineLayout> renderPipelineLayout = device->InstantiateRenderPipelineLayout(renderPipelineLayoutInfo);
+
+	Nz::RenderPipelineInfo renderPipelineInfo;
+	renderPipelineInfo.primitiveMode = Nz::PrimitiveMode::TriangleStrip;
+	renderPipelineInfo.pipelineLayout = renderPipelineLayout;
+	renderPipelineInfo.shaderModules.push_back(BuildShader(*device, nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex, std::string_view(fragVertSource, sizeof(fragVertSource))));
+
+	std::shared_ptr<Nz::RenderPipeline> renderPipeline = device->InstantiateRenderPipeline(std::move(renderPipelineInfo));
+
+	std::shared_ptr<Nz::ShaderBinding> renderBinding = renderPipelineLayout->AllocateShaderBinding(0);
+	renderBinding->Update({
+		{
+			0,
+			Nz::ShaderBinding::UniformBufferBinding {
+				sceneDataBuffer.get(), 0, sceneBufferSize
+			}
+		},
+		{
+			1,
+			Nz::ShaderBinding::StorageBufferBinding {
+				instanceBuffer.get(), 0, instanceBufferSize
+			}
+		}
+	});
+
+	std::string windowTitle = "Indirect draw test (" + std::to_string(instanceCount) + " instances)";
+	Nz::Window window;
+	if (!window.Create(Nz::VideoMode(windowSize.x, windowSize.y), windowTitle))
+	{
+		std::cout << "Failed to create Window" << std::endl;
+		std::abort();
+	}
+	Nz::WindowSwapchain windowSwapchain(device, window);
+
+	Nz::MillisecondClock fpsClock;
+	Nz::HighPrecisionClock elapsedClock;
+	unsigned int fps = 0;
+
+	while (window.IsOpen())
+	{
+		window.ProcessEvents();
+
+		Nz::RenderFrame frame = windowSwapchain.AcquireFrame();
+		if (!frame)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			continue;
+		}
+
+		float elapsedTime = elapsedClock.GetElapsedTime().AsSeconds();
+
+		// Pan the view over the world
+		Nz::Vector2f viewSize(windowSize);
+		Nz::Vector2f viewPos = (worldSize - viewSize) * 0.5f;
+		viewPos.x += std::cos(elapsedTime * 0.2f) * (worldSize.x - viewSize.x) * 0.5f;
+		viewPos.y += std::sin(elapsedTime * 0.3f) * (worldSize.y - viewSize.y) * 0.5f;
+
+		Nz::UploadPool& uploadPool = frame.GetUploadPool();
+
+		frame.Execute([&](Nz::CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Upload scene data", Nz::Color::Yellow());
+			{
+				auto& allocation = uploadPool.Allocate(sceneBufferSize);
+				Nz::AccessByOffset<Nz::Vector4f&>(allocation.mappedPtr, viewRectOffset) = Nz::Vector4f(viewPos.x, viewPos.y, viewSize.x, viewSize.y);
+				Nz::AccessByOffset<float&>(allocation.mappedPtr, quadSizeOffset) = quadSize;
+
+				builder.PreTransferBarrier();
+				builder.CopyBuffer(allocation, sceneDataBuffer.get());
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+
+			builder.BeginDebugRegion("Culling", Nz::Color::Blue());
+			{
+				// The previous frame may still be reading the draw commands
+				builder.MemoryBarrier(Nz::PipelineStage::DrawIndirect, Nz::PipelineStage::ComputeShader, Nz::MemoryAccess::IndirectCommandRead, Nz::MemoryAccess::ShaderWrite);
+
+				builder.BindComputePipeline(*computePipeline);
+				builder.BindComputeShaderBinding(0, *computeBinding);
+				builder.Dispatch(instanceCount / 64 + 1, 1, 1);
+
+				builder.MemoryBarrier(Nz::PipelineStage::ComputeShader, Nz::PipelineStage::DrawIndirect, Nz::MemoryAccess::ShaderWrite, Nz::MemoryAccess::IndirectCommandRead);
+			}
+			builder.EndDebugRegion();
+
+			builder.BeginDebugRegion("Main window rendering", Nz::Color::Green());
+			{
+				Nz::Recti renderRect(0, 0, window.GetSize().x, window.GetSize().y);
+
+				Nz::CommandBufferBuilder::ClearValues clearValues[2];
+				clearValues[0].color = Nz::Color::Black();
+				clearValues[1].depth = 1.f;
+				clearValues[1].stencil = 0;
+
+				builder.BeginRenderPass(windowSwapchain.GetFramebuffer(frame.GetFramebufferIndex()), windowSwapchain.GetRenderPass(), renderRect, { clearValues[0], clearValues[1] });
+				{
+					builder.SetScissor(Nz::Recti{ 0, 0, int(windowSize.x), int(windowSize.y) });
+					builder.SetViewport(Nz::Recti{ 0, 0, int(windowSize.x), int(windowSize.y) });
+
+					builder.BindRenderPipeline(*renderPipeline);
+					builder.BindRenderShaderBinding(0, *renderBinding);
+
+					if (deviceFeatures.multiDrawIndirect)
+						builder.DrawIndirect(*commandBuffer, 0, instanceCount);
+					else
+					{
+						for (std::size_t i = 0; i < instanceCount; ++i)
+							builder.DrawIndirect(*commandBuffer, i * sizeof(Nz::CommandBufferBuilder::DrawIndirectCommand));
+					}
+				}
+				builder.EndRenderPass();
+			}
+			builder.EndDebugRegion();
+
+		}, Nz::QueueType::Graphics);
+
+		frame.Present();
+
+		fps++;
+
+		if (fpsClock.RestartIfOver(Nz::Time::Second()))
+		{
+			window.SetTitle(windowTitle + " - " + Nz::NumberToString(fps) + " FPS");
+			fps = 0;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+std::shared_ptr<Nz::ShaderModule> BuildShader(Nz::RenderDevice& device, nzsl::ShaderStageTypeFlags shaderStages, std::string_view source)
+{
+	try
+	{
+		nzsl::Ast::ModulePtr shaderModule = nzsl::Parse(source);
+		if (!shaderModule)
+		{
+			std::cout << "Failed to parse shader module" << std::endl;
+			std::abort();
+		}
+
+		nzsl::ShaderWriter::States states;
+		states.optimize = true;
+
+		std::shared_ptr<Nz::ShaderModule> shader = device.InstantiateShaderModule(shaderStages, *shaderModule, states);
+		if (!shader)
+		{
+			std::cout << "Failed to instantiate shader" << std::endl;
+			std::abort();
+		}
+
+		return shader;
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		std::abort();
+	}
+}
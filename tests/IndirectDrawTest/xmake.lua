@@ -0,0 +1,7 @@
+if is_plat("wasm") then
+	return -- Compute shaders are not supported with WebGL (but are with WebGPU)
+end
+
+target("IndirectDrawTest")
+	add_deps("NazaraRenderer")
+	add_files("main.cpp")
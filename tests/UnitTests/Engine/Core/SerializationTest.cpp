@@ -1,11 +1,15 @@
 #include <Nazara/Core/SerializationContext.hpp>
 
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Core/BitWriter.hpp>
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Ray.hpp>
 #include <array>
+#include <cmath>
+#include <limits>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -264,4 +268,138 @@ SCENARIO("Serialization", "[CORE][SERIALIZATION]")
 			}
 		}
 	}
+
+	GIVEN("A bit writer")
+	{
+		Nz::BitWriter writer;
+
+		WHEN("We pack values with arbitrary bit counts")
+		{
+			writer.WriteBool(true);
+			writer.Write(0x5, 3);
+			writer.Write(0x1FF, 9);
+			writer.Write(0xDEADBEEFCAFEBABE, 64);
+			writer.WriteBool(false);
+
+			THEN("They use only the required bits and are read back")
+			{
+				CHECK(writer.GetBitCount() == 78);
+				CHECK(writer.GetSize() == 10);
+
+				Nz::BitReader reader(writer.GetData(), writer.GetSize());
+				CHECK(reader.ReadBool());
+				CHECK(reader.Read(3) == 0x5);
+				CHECK(reader.Read(9) == 0x1FF);
+				CHECK(reader.Read(64) == 0xDEADBEEFCAFEBABE);
+				CHECK_FALSE(reader.ReadBool());
+				CHECK_FALSE(reader.HasOverflowed());
+
+				// Reading past the end is reported instead of reading garbage
+				CHECK(reader.Read(8) == 0);
+				CHECK(reader.HasOverflowed());
+			}
+		}
+
+		WHEN("We write variable-length and ranged integers")
+		{
+			writer.WriteVarUInt(42);
+			writer.WriteVarUInt(300);
+			writer.WriteVarInt(-1);
+			writer.WriteVarInt(std::numeric_limits<Nz::Int64>::min());
+			writer.WriteVarUInt(std::numeric_limits<Nz::UInt64>::max());
+			writer.WriteRanged(-3, -10, 10);
+
+			THEN("Small values are compact and values are preserved")
+			{
+				CHECK(Nz::BitWriter::ZigZagEncode(-1) == 1);
+				CHECK(Nz::BitWriter::ZigZagEncode(1) == 2);
+				CHECK(Nz::BitWriter::ComputeRangeBitCount(20) == 5);
+
+				Nz::BitReader reader(writer.GetData(), writer.GetSize());
+				CHECK(reader.ReadVarUInt() == 42);
+				CHECK(reader.GetBitOffset() == 8);
+				CHECK(reader.ReadVarUInt() == 300);
+				CHECK(reader.GetBitOffset() == 24);
+				CHECK(reader.ReadVarInt() == -1);
+				CHECK(reader.ReadVarInt() == std::numeric_limits<Nz::Int64>::min());
+				CHECK(reader.ReadVarUInt() == std::numeric_limits<Nz::UInt64>::max());
+
+				std::size_t offset = reader.GetBitOffset();
+				CHECK(reader.ReadRanged(-10, 10) == -3);
+				CHECK(reader.GetBitOffset() - offset == 5);
+				CHECK_FALSE(reader.HasOverflowed());
+			}
+		}
+
+		WHEN("We write quantized values")
+		{
+			writer.WriteQuantized(3.14159f, -10.f, 10.f, 16);
+			writer.WriteQuantized(50.f, -10.f, 10.f, 8);
+			writer.WriteQuantized(Nz::Vector3f(1.f, -2.f, 3.f), -100.f, 100.f, 20);
+
+			Nz::Quaternionf rotation = Nz::Quaternionf::Normalize(Nz::Quaternionf(0.3f, -0.8f, 0.2f, 0.4f));
+			writer.WriteQuaternion(rotation, 12);
+
+			THEN("They are read back with the expected precision")
+			{
+				CHECK(writer.GetBitCount() == 16 + 8 + 3 * 20 + 2 + 3 * 12);
+
+				Nz::BitReader reader(writer.GetData(), writer.GetSize());
+				CHECK(reader.ReadQuantized(-10.f, 10.f, 16) == Catch::Approx(3.14159f).margin(0.001f));
+				CHECK(reader.ReadQuantized(-10.f, 10.f, 8) == Catch::Approx(10.f)); //< clamped
+
+				Nz::Vector3f position = reader.ReadQuantizedVector3(-100.f, 100.f, 20);
+				CHECK(position.x == Catch::Approx(1.f).margin(0.001f));
+				CHECK(position.y == Catch::Approx(-2.f).margin(0.001f));
+				CHECK(position.z == Catch::Approx(3.f).margin(0.001f));
+
+				// q and -q are the same rotation
+				Nz::Quaternionf readRotation = reader.ReadQuaternion(12);
+				float dot = readRotation.w * rotation.w + readRotation.x * rotation.x + readRotation.y * rotation.y + readRotation.z * rotation.z;
+				CHECK(std::abs(dot) == Catch::Approx(1.f).margin(0.001f));
+				CHECK_FALSE(reader.HasOverflowed());
+			}
+		}
+
+		WHEN("We serialize types")
+		{
+			REQUIRE(Serialize(writer, true));
+			REQUIRE(Serialize(writer, Nz::UInt8(200)));
+			REQUIRE(Serialize(writer, -1234));
+			REQUIRE(Serialize(writer, 2.5f));
+			REQUIRE(Serialize(writer, Nz::Vector3f(1.f, 2.f, 3.f)));
+			REQUIRE(Serialize(writer, Nz::Quaternionf::Identity()));
+
+			THEN("They are unserialized")
+			{
+				Nz::BitReader reader(writer.GetData(), writer.GetSize());
+
+				bool boolean = false;
+				REQUIRE(Unserialize(reader, &boolean));
+				CHECK(boolean);
+
+				Nz::UInt8 byte = 0;
+				REQUIRE(Unserialize(reader, &byte));
+				CHECK(byte == 200);
+
+				int integer = 0;
+				REQUIRE(Unserialize(reader, &integer));
+				CHECK(integer == -1234);
+
+				float value = 0.f;
+				REQUIRE(Unserialize(reader, &value));
+				CHECK(value == 2.5f);
+
+				Nz::Vector3f vector;
+				REQUIRE(Unserialize(reader, &vector));
+				CHECK(vector == Nz::Vector3f(1.f, 2.f, 3.f));
+
+				Nz::Quaternionf quaternion;
+				REQUIRE(Unserialize(reader, &quaternion));
+				CHECK(quaternion == Nz::Quaternionf::Identity());
+
+				CHECK_FALSE(Unserialize(reader, &integer));
+			}
+		}
+	}
 }
@@ -0,0 +1,117 @@
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskGroup.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+SCENARIO("TaskGroup", "[CORE][TASKGROUP]")
+{
+	GIVEN("Task groups used from several threads at once")
+	{
+		std::atomic_uint counter = 0;
+
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				Nz::TaskGroup group;
+				for (unsigned int j = 0; j < 8; ++j)
+				{
+					group.AddTask([&]
+					{
+						// Waiting on a group from a task must not deadlock
+						Nz::TaskGroup nestedGroup;
+						for (unsigned int k = 0; k < 4; ++k)
+							nestedGroup.AddTask([&] { counter++; });
+
+						nestedGroup.Wait();
+					});
+				}
+
+				group.Wait();
+				CHECK(group.IsFinished());
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		THEN("Every task was executed exactly once")
+		{
+			CHECK(counter == 4 * 8 * 4);
+		}
+	}
+
+	GIVEN("A group with a lot of queued tasks")
+	{
+		std::atomic_bool stop = false;
+		std::atomic_uint executedTaskCount = 0;
+
+		Nz::TaskGroup busyGroup;
+		for (unsigned int i = 0; i < 10'000; ++i)
+		{
+			busyGroup.AddTask([&]
+			{
+				if (!stop)
+				{
+					std::this_thread::yield();
+					executedTaskCount++;
+				}
+			});
+		}
+
+		WHEN("Another group is waited on")
+		{
+			std::atomic_uint counter = 0;
+
+			Nz::TaskGroup group;
+			for (unsigned int i = 0; i < 16; ++i)
+				group.AddTask([&] { counter++; });
+
+			group.Wait();
+			stop = true;
+
+			THEN("Its tasks don't have to wait for the other group")
+			{
+				CHECK(counter == 16);
+				CHECK(executedTaskCount < 10'000);
+			}
+		}
+
+		busyGroup.Wait();
+		CHECK(busyGroup.IsFinished());
+	}
+
+	GIVEN("A task throwing an exception")
+	{
+		Nz::TaskGroup group;
+		group.AddTask([] { throw std::runtime_error("task failure"); });
+
+		THEN("It is rethrown when waiting")
+		{
+			CHECK_THROWS_AS(group.Wait(), std::runtime_error);
+			CHECK_NOTHROW(group.Wait());
+		}
+	}
+
+	GIVEN("Error flags set on the calling thread")
+	{
+		Nz::ErrorModeFlags oldFlags = Nz::Error::SetFlags(Nz::ErrorMode::Silent);
+
+		Nz::ErrorModeFlags taskFlags;
+
+		Nz::TaskGroup group;
+		group.AddTask([&] { taskFlags = Nz::Error::GetFlags(); });
+		group.Wait();
+
+		Nz::Error::SetFlags(oldFlags);
+
+		THEN("Tasks are executed with the same flags")
+		{
+			CHECK(taskFlags == Nz::ErrorMode::Silent);
+		}
+	}
+}
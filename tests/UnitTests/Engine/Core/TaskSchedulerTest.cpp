@@ -0,0 +1,73 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("Tasks added through the static interface")
+	{
+		std::atomic_uint counter = 0;
+
+		auto Increment = [&](unsigned int value) { counter += value; };
+
+		struct Incrementer
+		{
+			void Increment()
+			{
+				(*counter)++;
+			}
+
+			std::atomic_uint* counter;
+		};
+
+		Incrementer incrementer{ &counter };
+
+		for (unsigned int i = 0; i < 16; ++i)
+			Nz::TaskScheduler::AddTask([&] { counter++; });
+
+		Nz::TaskScheduler::AddTask(Increment, 100u);
+		Nz::TaskScheduler::AddTask(&Incrementer::Increment, &incrementer);
+
+		WHEN("Running them and waiting for them")
+		{
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every task was executed")
+			{
+				CHECK(counter == 16 + 100 + 1);
+			}
+		}
+	}
+
+	GIVEN("Several threads using the static interface at once")
+	{
+		std::atomic_uint counter = 0;
+
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (unsigned int j = 0; j < 8; ++j)
+					Nz::TaskScheduler::AddTask([&] { counter++; });
+
+				Nz::TaskScheduler::Run();
+				Nz::TaskScheduler::WaitForTasks();
+
+				// Tasks are grouped per thread, waiting only waits for the tasks of the calling thread
+				CHECK(counter >= 8);
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		THEN("Every task was executed exactly once")
+		{
+			CHECK(counter == 4 * 8);
+		}
+	}
+}
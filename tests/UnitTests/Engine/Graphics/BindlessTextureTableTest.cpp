@@ -0,0 +1,71 @@
+#include <Nazara/Graphics/BindlessTextureTable.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/TextureSamplerCache.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO("BindlessTextureTable", "[GRAPHICS][BINDLESSTEXTURETABLE]")
+{
+	Nz::Graphics* graphics = Nz::Graphics::Instance();
+	const std::shared_ptr<Nz::RenderDevice>& renderDevice = graphics->GetRenderDevice();
+	if (!renderDevice->GetEnabledFeatures().bindlessTextures)
+	{
+		WARN("bindless textures are not supported by the render device");
+		return;
+	}
+
+	const std::shared_ptr<Nz::Texture>& defaultTexture = graphics->GetDefaultTextures().whiteTextures[Nz::ImageType::E2D];
+	const std::shared_ptr<Nz::TextureSampler>& sampler = graphics->GetSamplerCache().Get({});
+
+	GIVEN("A table of 4096 textures")
+	{
+		Nz::BindlessTextureTable textureTable(renderDevice, 4096, defaultTexture, sampler);
+		CHECK(textureTable.GetCapacity() == 4096);
+		CHECK(textureTable.GetTextureCount() == 0);
+
+		WHEN("Allocating more shader bindings from its layout")
+		{
+			// Each binding holds 4096 descriptors, which has to be taken into account when sizing descriptor pools
+			Nz::ShaderBindingPtr firstBinding = textureTable.GetRenderPipelineLayout()->AllocateShaderBinding(0);
+			Nz::ShaderBindingPtr secondBinding = textureTable.GetRenderPipelineLayout()->AllocateShaderBinding(0);
+
+			CHECK(firstBinding);
+			CHECK(secondBinding);
+		}
+
+		WHEN("Registering textures")
+		{
+			Nz::TextureInfo textureInfo;
+			textureInfo.pixelFormat = Nz::PixelFormat::RGBA8;
+			textureInfo.type = Nz::ImageType::E2D;
+			textureInfo.levelCount = 1;
+			textureInfo.width = 1;
+			textureInfo.height = 1;
+
+			std::shared_ptr<Nz::Texture> firstTexture = renderDevice->InstantiateTexture(textureInfo);
+			std::shared_ptr<Nz::Texture> secondTexture = renderDevice->InstantiateTexture(textureInfo);
+
+			Nz::UInt32 firstIndex = textureTable.RegisterTexture(firstTexture, sampler);
+			CHECK(firstIndex != Nz::BindlessTextureTable::DefaultTextureIndex);
+			CHECK(textureTable.RegisterTexture(firstTexture, sampler) == firstIndex);
+			CHECK(textureTable.GetTextureCount() == 1);
+
+			THEN("Unregistered entries aren't reused before the frame using them is over")
+			{
+				textureTable.UnregisterTexture(firstIndex);
+				CHECK(textureTable.GetTextureCount() == 1);
+
+				textureTable.UnregisterTexture(firstIndex);
+				CHECK(textureTable.GetTextureCount() == 0);
+
+				Nz::UInt32 secondIndex = textureTable.RegisterTexture(secondTexture, sampler);
+				CHECK(secondIndex != Nz::BindlessTextureTable::DefaultTextureIndex);
+				CHECK(secondIndex != firstIndex);
+				CHECK(textureTable.GetTextureCount() == 1);
+
+				textureTable.UnregisterTexture(secondIndex);
+			}
+		}
+	}
+}
@@ -0,0 +1,65 @@
+#include <Nazara/Graphics/DirectionalLightShadowData.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+
+SCENARIO("DirectionalLightShadowData", "[GRAPHICS][DIRECTIONALLIGHTSHADOWDATA]")
+{
+	std::array<float, 4> splitDistances;
+
+	GIVEN("A perspective viewer")
+	{
+		WHEN("Computing uniform splits")
+		{
+			Nz::DirectionalLightShadowData::ComputeCascadeSplits(1.f, 101.f, 0.f, 4, splitDistances.data());
+
+			THEN("Cascades have the same depth")
+			{
+				CHECK(splitDistances[0] == Catch::Approx(26.f));
+				CHECK(splitDistances[1] == Catch::Approx(51.f));
+				CHECK(splitDistances[2] == Catch::Approx(76.f));
+				CHECK(splitDistances[3] == Catch::Approx(101.f));
+			}
+		}
+
+		WHEN("Computing logarithmic splits")
+		{
+			Nz::DirectionalLightShadowData::ComputeCascadeSplits(1.f, 10'000.f, 1.f, 4, splitDistances.data());
+
+			THEN("Each cascade is ten times deeper than the previous one")
+			{
+				CHECK(splitDistances[0] == Catch::Approx(10.f));
+				CHECK(splitDistances[1] == Catch::Approx(100.f));
+				CHECK(splitDistances[2] == Catch::Approx(1'000.f));
+				CHECK(splitDistances[3] == Catch::Approx(10'000.f));
+			}
+		}
+
+		WHEN("Shadow max distance is before the near plane")
+		{
+			Nz::DirectionalLightShadowData::ComputeCascadeSplits(1.f, 0.5f, 0.5f, 2, splitDistances.data());
+
+			THEN("Cascades are empty")
+			{
+				CHECK(splitDistances[0] == Catch::Approx(1.f));
+				CHECK(splitDistances[1] == Catch::Approx(1.f));
+			}
+		}
+	}
+
+	GIVEN("An orthographic viewer with a negative near distance")
+	{
+		WHEN("Computing logarithmic splits")
+		{
+			Nz::DirectionalLightShadowData::ComputeCascadeSplits(-1.f, 99.f, 1.f, 4, splitDistances.data());
+
+			THEN("Uniform splits are used")
+			{
+				CHECK(splitDistances[0] == Catch::Approx(24.f));
+				CHECK(splitDistances[1] == Catch::Approx(49.f));
+				CHECK(splitDistances[2] == Catch::Approx(74.f));
+				CHECK(splitDistances[3] == Catch::Approx(99.f));
+			}
+		}
+	}
+}
@@ -0,0 +1,280 @@
+#include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Graphics/FrameGraph.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/RenderImage.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+	// Render image recording the command buffers submitted by the frame graph instead of executing them
+	class RecordingRenderImage : public Nz::RenderImage
+	{
+		public:
+			void Execute(const Nz::FunctionRef<void(Nz::CommandBufferBuilder& builder)>& /*callback*/, Nz::QueueTypeFlags /*queueTypeFlags*/) override
+			{
+			}
+
+			Nz::UploadPool& GetUploadPool() override
+			{
+				throw std::runtime_error("unexpected upload pool usage");
+			}
+
+			void Present() override
+			{
+			}
+
+			void SubmitCommandBuffer(Nz::CommandBuffer* commandBuffer, Nz::QueueTypeFlags /*queueTypeFlags*/) override
+			{
+				submittedCommandBuffers.push_back(commandBuffer);
+			}
+
+			std::vector<Nz::CommandBuffer*> submittedCommandBuffers;
+	};
+}
+
+SCENARIO("FrameGraph", "[GRAPHICS][FRAMEGRAPH]")
+{
+	Nz::Graphics* graphics = Nz::Graphics::Instance();
+
+	GIVEN("A persistent shadowmap rendered by a pass which can be skipped")
+	{
+		Nz::FramePassExecution shadowPassExecution = Nz::FramePassExecution::Execute;
+		unsigned int shadowPassRecordCount = 0;
+
+		Nz::FrameGraph frameGraph;
+
+		std::size_t shadowmap = frameGraph.AddAttachment({
+			"Shadowmap",
+			graphics->GetPreferredDepthFormat(),
+			Nz::FramePassAttachmentSize::Fixed,
+			256, 256
+		});
+		frameGraph.MarkAttachmentAsPersistent(shadowmap);
+
+		std::size_t output = frameGraph.AddAttachment({
+			"Output",
+			Nz::PixelFormat::RGBA8
+		});
+
+		Nz::FramePass& shadowPass = frameGraph.AddPass("Shadow pass");
+		shadowPass.SetDepthStencilOutput(shadowmap);
+		shadowPass.SetDepthStencilClear(1.f, 0);
+		shadowPass.SetExecutionCallback([&] { return shadowPassExecution; });
+		shadowPass.SetCommandCallback([&](Nz::CommandBufferBuilder& /*builder*/, const Nz::FramePassEnvironment& /*env*/) { shadowPassRecordCount++; });
+
+		Nz::FramePass& forwardPass = frameGraph.AddPass("Forward pass");
+		forwardPass.AddInput(shadowmap);
+		forwardPass.AddOutput(output);
+		forwardPass.SetClearColor(0, Nz::Color::Black());
+		forwardPass.SetCommandCallback([](Nz::CommandBufferBuilder& /*builder*/, const Nz::FramePassEnvironment& /*env*/) {});
+
+		frameGraph.AddBackbufferOutput(output);
+
+		RecordingRenderImage renderImage;
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+
+			auto ExecuteFrame = [&]
+			{
+				renderImage.submittedCommandBuffers.clear();
+
+				Nz::RenderFrame renderFrame(&renderImage, false, Nz::Vector2ui(256, 256), 0);
+				bakedGraph.Resize(renderFrame);
+				bakedGraph.Execute(renderFrame);
+
+				return renderImage.submittedCommandBuffers;
+			};
+
+			std::vector<Nz::CommandBuffer*> firstFrame = ExecuteFrame();
+			CHECK(shadowPassRecordCount == 1);
+			REQUIRE(firstFrame.size() == 2);
+
+			WHEN("The shadow pass is skipped")
+			{
+				shadowPassExecution = Nz::FramePassExecution::Skip;
+
+				std::vector<Nz::CommandBuffer*> skippedFrame = ExecuteFrame();
+
+				THEN("The shadowmap is transitioned back to the layout the forward pass expects")
+				{
+					CHECK(shadowPassRecordCount == 1);
+
+					// The shadowmap was left in the forward pass input layout, the forward pass barrier expects the shadow pass output one
+					REQUIRE(skippedFrame.size() == 2);
+					CHECK(skippedFrame[1] == firstFrame[1]); //< forward pass is kept as is
+				}
+
+				AND_WHEN("It is skipped again")
+				{
+					std::vector<Nz::CommandBuffer*> secondSkippedFrame = ExecuteFrame();
+
+					THEN("Transitions are not recorded again")
+					{
+						CHECK(shadowPassRecordCount == 1);
+						CHECK(secondSkippedFrame == skippedFrame);
+					}
+				}
+
+				AND_WHEN("It is executed again")
+				{
+					shadowPassExecution = Nz::FramePassExecution::Execute;
+
+					std::vector<Nz::CommandBuffer*> executedFrame = ExecuteFrame();
+
+					THEN("Its commands are recorded again")
+					{
+						CHECK(shadowPassRecordCount == 2);
+						REQUIRE(executedFrame.size() == 2);
+						CHECK(executedFrame[1] == firstFrame[1]);
+					}
+				}
+			}
+		}
+
+		graphics->GetRenderDevice()->WaitForIdle();
+	}
+
+	GIVEN("A pass recorded in chunks")
+	{
+		constexpr std::size_t MaxChunkCount = 4;
+
+		std::size_t chunkCount = MaxChunkCount;
+		std::array<std::atomic_uint, MaxChunkCount> chunkRecordCount = {};
+		std::atomic_bool failChunk = false;
+
+		Nz::FrameGraph frameGraph;
+
+		std::size_t output = frameGraph.AddAttachment({
+			"Output",
+			Nz::PixelFormat::RGBA8
+		});
+
+		Nz::FramePass& chunkedPass = frameGraph.AddPass("Chunked pass");
+		chunkedPass.AddOutput(output);
+		chunkedPass.SetClearColor(0, Nz::Color::Black());
+		chunkedPass.SetCommandChunkCallback([&] { return chunkCount; }, [&](Nz::CommandBufferBuilder& /*builder*/, const Nz::FramePassEnvironment& /*env*/, std::size_t chunkIndex)
+		{
+			// Called from worker threads, Catch assertions can't be used here
+			chunkRecordCount.at(chunkIndex)++;
+
+			if (chunkIndex == 1 && failChunk.exchange(false))
+				throw std::runtime_error("chunk recording failure");
+		});
+
+		frameGraph.AddBackbufferOutput(output);
+
+		auto CheckRecordCounts = [&](unsigned int expectedCount)
+		{
+			for (std::size_t i = 0; i < chunkCount; ++i)
+				CHECK(chunkRecordCount[i] == expectedCount);
+		};
+
+		RecordingRenderImage renderImage;
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+
+			auto ExecuteFrame = [&]
+			{
+				renderImage.submittedCommandBuffers.clear();
+
+				Nz::RenderFrame renderFrame(&renderImage, false, Nz::Vector2ui(256, 256), 0);
+				bakedGraph.Resize(renderFrame);
+				bakedGraph.Execute(renderFrame);
+
+				return renderImage.submittedCommandBuffers;
+			};
+
+			WHEN("Executing it")
+			{
+				std::vector<Nz::CommandBuffer*> firstFrame = ExecuteFrame();
+
+				THEN("Every chunk is recorded once")
+				{
+					CHECK(firstFrame.size() == 1);
+					CheckRecordCounts(1);
+				}
+
+				AND_WHEN("Executing it again")
+				{
+					ExecuteFrame();
+
+					THEN("Chunks are recorded again, as secondary command buffers are not reused")
+					{
+						CheckRecordCounts(2);
+					}
+				}
+			}
+
+			WHEN("Recording a chunk fails")
+			{
+				failChunk = true;
+
+				std::vector<Nz::CommandBuffer*> frame = ExecuteFrame();
+
+				THEN("Every chunk is recorded again in the primary command buffer")
+				{
+					CHECK(frame.size() == 1);
+					CheckRecordCounts(2);
+				}
+			}
+
+			WHEN("There's only one chunk")
+			{
+				chunkCount = 1;
+
+				ExecuteFrame();
+				ExecuteFrame();
+
+				THEN("It's recorded in the primary command buffer, which is reused")
+				{
+					CheckRecordCounts(1);
+				}
+			}
+		}
+
+		graphics->GetRenderDevice()->WaitForIdle();
+	}
+
+	GIVEN("An attachment also read outside of the frame graph")
+	{
+		Nz::FrameGraph frameGraph;
+
+		std::size_t depthCopy = frameGraph.AddAttachment({
+			"Depth copy",
+			Nz::PixelFormat::R32F,
+			Nz::FramePassAttachmentSize::SwapchainFactor,
+			100'000, 100'000,
+			Nz::TextureUsage::ShaderReadWrite
+		});
+
+		Nz::FramePass& copyPass = frameGraph.AddPass("Copy pass");
+		copyPass.AddOutput(depthCopy);
+		copyPass.SetCommandCallback([](Nz::CommandBufferBuilder& /*builder*/, const Nz::FramePassEnvironment& /*env*/) {});
+
+		frameGraph.MarkAttachmentAsPersistent(depthCopy);
+		frameGraph.AddBackbufferOutput(depthCopy);
+
+		RecordingRenderImage renderImage;
+		{
+			Nz::BakedFrameGraph bakedGraph = frameGraph.Bake();
+
+			Nz::RenderFrame renderFrame(&renderImage, false, Nz::Vector2ui(256, 256), 0);
+			bakedGraph.Resize(renderFrame);
+
+			THEN("Its texture has both the usage deduced from passes and the additional one")
+			{
+				const Nz::TextureInfo& textureInfo = bakedGraph.GetAttachmentTexture(depthCopy)->GetTextureInfo();
+				CHECK(textureInfo.usageFlags.Test(Nz::TextureUsage::ColorAttachment));
+				CHECK(textureInfo.usageFlags.Test(Nz::TextureUsage::ShaderReadWrite));
+			}
+		}
+
+		graphics->GetRenderDevice()->WaitForIdle();
+	}
+}
@@ -0,0 +1,47 @@
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/IndirectDrawTable.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO("IndirectDrawTable", "[GRAPHICS][INDIRECTDRAWTABLE]")
+{
+	GIVEN("Two world instances")
+	{
+		Nz::WorldInstance firstWorldInstance;
+		Nz::WorldInstance secondWorldInstance;
+
+		THEN("Their instance index matches their offset in the instance buffer")
+		{
+			std::size_t instanceDataSize = Nz::PredefinedInstanceData::GetOffsets().totalSize;
+			CHECK(firstWorldInstance.GetInstanceIndex() * instanceDataSize == firstWorldInstance.GetInstanceBuffer().GetOffset());
+			CHECK(secondWorldInstance.GetInstanceIndex() * instanceDataSize == secondWorldInstance.GetInstanceBuffer().GetOffset());
+			CHECK(firstWorldInstance.GetInstanceIndex() != secondWorldInstance.GetInstanceIndex());
+		}
+
+		WHEN("Adding draws of both instances to a table")
+		{
+			Nz::IndirectDrawTable drawTable(Nz::Graphics::Instance()->GetRenderDevice());
+			CHECK(drawTable.GetDrawCount() == 0);
+
+			Nz::Boxf aabb(-1.f, -1.f, -1.f, 2.f, 2.f, 2.f);
+			std::size_t firstDraw = drawTable.AddIndexedDraw(firstWorldInstance, aabb, 36, 0);
+			std::size_t secondDraw = drawTable.AddIndexedDraw(secondWorldInstance, aabb, 36, 0);
+			std::size_t thirdDraw = drawTable.AddIndexedDraw(firstWorldInstance, aabb, 6, 36);
+
+			THEN("Commands are laid out in insertion order, so consecutive draws can be drawn at once")
+			{
+				CHECK(drawTable.GetDrawCount() == 3);
+				CHECK(firstDraw == 0);
+				CHECK(secondDraw == 1);
+				CHECK(thirdDraw == 2);
+
+				CHECK(drawTable.GetCommandStride() >= sizeof(Nz::CommandBufferBuilder::DrawIndexedIndirectCommand));
+				CHECK(drawTable.GetCommandStride() % 4 == 0);
+				CHECK(drawTable.GetCommandOffset(secondDraw) == drawTable.GetCommandStride());
+				CHECK(drawTable.GetCommandOffset(thirdDraw) == 2 * drawTable.GetCommandStride());
+			}
+		}
+	}
+}
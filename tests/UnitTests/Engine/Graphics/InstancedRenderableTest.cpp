@@ -0,0 +1,104 @@
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+	// Renderable only exposing levels of detail screen sizes
+	class LodRenderable : public Nz::InstancedRenderable
+	{
+		public:
+			LodRenderable(std::vector<float> lodScreenSizes)
+			{
+				UpdateLodScreenSizes(std::move(lodScreenSizes));
+			}
+
+			void BuildElement(Nz::ElementRendererRegistry& /*registry*/, const ElementData& /*elementData*/, std::size_t /*passIndex*/, std::vector<Nz::RenderElementOwner>& /*elements*/) const override
+			{
+			}
+
+			const std::shared_ptr<Nz::MaterialInstance>& GetMaterial(std::size_t /*i*/) const override
+			{
+				static std::shared_ptr<Nz::MaterialInstance> noMaterial;
+				return noMaterial;
+			}
+
+			std::size_t GetMaterialCount() const override
+			{
+				return 0;
+			}
+	};
+}
+
+SCENARIO("InstancedRenderable", "[GRAPHICS][INSTANCEDRENDERABLE]")
+{
+	GIVEN("A renderable with four levels of detail")
+	{
+		LodRenderable renderable({ 0.5f, 0.25f, 0.1f });
+		CHECK(renderable.GetLodCount() == 4);
+
+		WHEN("Selecting levels of detail without hysteresis")
+		{
+			THEN("Thresholds are crossed as soon as the screen size goes below them")
+			{
+				CHECK(renderable.SelectLod(1.f) == 0);
+				CHECK(renderable.SelectLod(0.5f) == 0);
+				CHECK(renderable.SelectLod(0.49f) == 1);
+				CHECK(renderable.SelectLod(0.25f) == 1);
+				CHECK(renderable.SelectLod(0.2f) == 2);
+				CHECK(renderable.SelectLod(0.05f) == 3);
+			}
+
+			THEN("Thresholds are crossed back as soon as the screen size reaches them")
+			{
+				CHECK(renderable.SelectLod(0.09f, 3) == 3);
+				CHECK(renderable.SelectLod(0.1f, 3) == 2);
+				CHECK(renderable.SelectLod(0.25f, 3) == 1);
+				CHECK(renderable.SelectLod(0.6f, 3) == 0);
+			}
+
+			THEN("Out of range levels of detail are clamped")
+			{
+				CHECK(renderable.SelectLod(0.05f, 10) == 3);
+				CHECK(renderable.SelectLod(0.3f, 10) == 1);
+			}
+		}
+
+		WHEN("Selecting levels of detail with a 10% hysteresis")
+		{
+			constexpr float hysteresis = 0.1f;
+
+			THEN("Lower levels of detail are only used once the screen size is 10% below the threshold")
+			{
+				CHECK(renderable.SelectLod(0.47f, 0, hysteresis) == 0);
+				CHECK(renderable.SelectLod(0.44f, 0, hysteresis) == 1);
+				CHECK(renderable.SelectLod(0.24f, 1, hysteresis) == 1);
+				CHECK(renderable.SelectLod(0.22f, 1, hysteresis) == 2);
+				CHECK(renderable.SelectLod(0.05f, 0, hysteresis) == 3);
+			}
+
+			THEN("Higher levels of detail are only used once the screen size is 10% above the threshold")
+			{
+				CHECK(renderable.SelectLod(0.52f, 1, hysteresis) == 1);
+				CHECK(renderable.SelectLod(0.56f, 1, hysteresis) == 0);
+				CHECK(renderable.SelectLod(0.105f, 3, hysteresis) == 3);
+				CHECK(renderable.SelectLod(0.115f, 3, hysteresis) == 2);
+				CHECK(renderable.SelectLod(1.f, 3, hysteresis) == 0);
+			}
+
+			THEN("Screen sizes between both thresholds keep the current level of detail")
+			{
+				for (std::size_t lodIndex : { 0, 1 })
+					CHECK(renderable.SelectLod(0.5f, lodIndex, hysteresis) == lodIndex);
+			}
+		}
+	}
+
+	GIVEN("A renderable without levels of detail")
+	{
+		LodRenderable renderable({});
+		CHECK(renderable.GetLodCount() == 1);
+		CHECK(renderable.SelectLod(0.f) == 0);
+		CHECK(renderable.SelectLod(0.f, 2, 0.1f) == 0);
+	}
+}
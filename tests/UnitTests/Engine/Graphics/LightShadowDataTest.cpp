@@ -0,0 +1,110 @@
+#include <Nazara/Graphics/LightShadowData.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Graphics/Sprite.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+SCENARIO("LightShadowData", "[GRAPHICS][LIGHTSHADOWDATA]")
+{
+	GIVEN("A shadowmap cache and two visible casters")
+	{
+		std::shared_ptr<Nz::MaterialInstance> material = Nz::MaterialInstance::GetDefault(Nz::MaterialType::Basic);
+		Nz::Sprite firstSprite(material);
+		Nz::Sprite secondSprite(material);
+
+		Nz::WorldInstance firstWorldInstance;
+		firstWorldInstance.UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(0.f, 0.f, 0.f)));
+
+		Nz::WorldInstance secondWorldInstance;
+		secondWorldInstance.UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(1.f, 2.f, 3.f)));
+
+		std::vector<Nz::FramePipelinePass::VisibleRenderable> visibleRenderables(2);
+		visibleRenderables[0].instancedRenderable = &firstSprite;
+		visibleRenderables[0].skeletonInstance = nullptr;
+		visibleRenderables[0].worldInstance = &firstWorldInstance;
+		visibleRenderables[1].instancedRenderable = &secondSprite;
+		visibleRenderables[1].skeletonInstance = nullptr;
+		visibleRenderables[1].worldInstance = &secondWorldInstance;
+
+		constexpr std::size_t visibilityHash = 42;
+
+		Nz::LightShadowData::ShadowmapCache cache;
+		CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+
+		cache.Update(visibleRenderables, visibilityHash);
+		CHECK(cache.IsUpToDate(visibleRenderables, visibilityHash));
+
+		WHEN("The shadowmap content is lost")
+		{
+			cache.isValid = false;
+
+			THEN("The shadowmap has to be rendered again")
+			{
+				CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+
+		WHEN("A caster moves")
+		{
+			secondWorldInstance.UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(1.f, 2.f, 3.0001f)));
+
+			THEN("The shadowmap has to be rendered again")
+			{
+				CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+
+		WHEN("A caster is moved to the same position with a negative zero")
+		{
+			firstWorldInstance.UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(-0.f, 0.f, -0.f)));
+
+			THEN("The shadowmap is still up to date")
+			{
+				CHECK(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+
+		WHEN("A caster disappears")
+		{
+			visibleRenderables.pop_back();
+
+			THEN("The shadowmap has to be rendered again")
+			{
+				CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+
+		WHEN("Casters are swapped between world instances")
+		{
+			std::swap(visibleRenderables[0].worldInstance, visibleRenderables[1].worldInstance);
+
+			THEN("The shadowmap has to be rendered again")
+			{
+				CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+
+		WHEN("A renderable is modified")
+		{
+			THEN("The shadowmap has to be rendered again")
+			{
+				CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash + 1));
+			}
+		}
+
+		WHEN("The cache is updated with the new casters")
+		{
+			secondWorldInstance.UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(4.f, 5.f, 6.f)));
+			CHECK_FALSE(cache.IsUpToDate(visibleRenderables, visibilityHash));
+
+			cache.Update(visibleRenderables, visibilityHash);
+
+			THEN("The shadowmap is up to date")
+			{
+				CHECK(cache.IsUpToDate(visibleRenderables, visibilityHash));
+			}
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#include <Nazara/Graphics/GraphicalMesh.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	// Submesh without any buffer, only its levels of detail errors matter
+	Nz::GraphicalMesh::SubMesh BuildSubMesh(const std::vector<float>& lodErrors)
+	{
+		Nz::GraphicalMesh::SubMesh subMesh;
+		subMesh.indexCount = 0;
+		subMesh.indexType = Nz::IndexType::U16;
+		subMesh.vertexDeclaration = Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ);
+
+		for (float error : lodErrors)
+		{
+			auto& lod = subMesh.lods.emplace_back();
+			lod.indexCount = 0;
+			lod.error = error;
+		}
+
+		return subMesh;
+	}
+}
+
+SCENARIO("Model", "[GRAPHICS][MODEL]")
+{
+	GIVEN("A model whose submeshes have different levels of detail")
+	{
+		std::shared_ptr<Nz::GraphicalMesh> graphicalMesh = std::make_shared<Nz::GraphicalMesh>();
+		graphicalMesh->UpdateAABB(Nz::Boxf(-1.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+		graphicalMesh->AddSubMesh(BuildSubMesh({ 0.01f, 0.02f, 0.04f }));
+		graphicalMesh->AddSubMesh(BuildSubMesh({ 0.015f }));
+
+		Nz::Model model(graphicalMesh);
+
+		float diameter = 2.f * model.GetAABB().GetRadius();
+		float maxScreenError = model.GetLodMaxScreenError();
+
+		THEN("Thresholds are computed from the highest error of each level of detail")
+		{
+			REQUIRE(model.GetLodCount() == 4);
+
+			// Second submesh keeps using its least detailed level when the model has more
+			const std::vector<float>& lodScreenSizes = model.GetLodScreenSizes();
+			CHECK(lodScreenSizes[0] == Catch::Approx(maxScreenError * diameter / 0.015f));
+			CHECK(lodScreenSizes[1] == Catch::Approx(maxScreenError * diameter / 0.02f));
+			CHECK(lodScreenSizes[2] == Catch::Approx(maxScreenError * diameter / 0.04f));
+		}
+
+		WHEN("Changing the max screen error")
+		{
+			std::vector<float> previousScreenSizes = model.GetLodScreenSizes();
+			model.SetLodMaxScreenError(maxScreenError * 2.f);
+
+			THEN("Thresholds are scaled accordingly")
+			{
+				const std::vector<float>& lodScreenSizes = model.GetLodScreenSizes();
+				REQUIRE(lodScreenSizes.size() == previousScreenSizes.size());
+				for (std::size_t i = 0; i < lodScreenSizes.size(); ++i)
+					CHECK(lodScreenSizes[i] == Catch::Approx(previousScreenSizes[i] / 2.f));
+			}
+		}
+	}
+
+	GIVEN("A model whose levels of detail errors are not increasing")
+	{
+		std::shared_ptr<Nz::GraphicalMesh> graphicalMesh = std::make_shared<Nz::GraphicalMesh>();
+		graphicalMesh->UpdateAABB(Nz::Boxf(-1.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+		graphicalMesh->AddSubMesh(BuildSubMesh({ 0.f, 0.05f, 0.02f, 0.1f }));
+
+		Nz::Model model(graphicalMesh);
+
+		THEN("Thresholds never increase with the level of detail index")
+		{
+			const std::vector<float>& lodScreenSizes = model.GetLodScreenSizes();
+			REQUIRE(lodScreenSizes.size() == 4);
+
+			CHECK(lodScreenSizes[0] == std::numeric_limits<float>::infinity()); //< lossless level of detail can always be used
+			for (std::size_t i = 1; i < lodScreenSizes.size(); ++i)
+				CHECK(lodScreenSizes[i] <= lodScreenSizes[i - 1]);
+
+			CHECK(lodScreenSizes[2] == lodScreenSizes[1]);
+		}
+
+		THEN("Shrinking screen size only selects less detailed levels")
+		{
+			std::size_t previousLod = 0;
+			for (float screenSize = 1.f; screenSize > 0.0001f; screenSize *= 0.9f)
+			{
+				std::size_t lodIndex = model.SelectLod(screenSize, previousLod);
+				CHECK(lodIndex >= previousLod);
+				previousLod = lodIndex;
+			}
+		}
+	}
+
+	GIVEN("A model without levels of detail")
+	{
+		std::shared_ptr<Nz::GraphicalMesh> graphicalMesh = std::make_shared<Nz::GraphicalMesh>();
+		graphicalMesh->AddSubMesh(BuildSubMesh({}));
+
+		Nz::Model model(graphicalMesh);
+		CHECK(model.GetLodCount() == 1);
+		CHECK(model.GetLodScreenSizes().empty());
+
+		WHEN("Levels of detail are added to the mesh")
+		{
+			graphicalMesh->AddSubMesh(BuildSubMesh({ 0.01f }));
+
+			THEN("Model thresholds are updated")
+			{
+				CHECK(model.GetLodCount() == 2);
+			}
+		}
+	}
+}
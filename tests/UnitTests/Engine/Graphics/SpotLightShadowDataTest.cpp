@@ -0,0 +1,60 @@
+#include <Nazara/Graphics/SpotLightShadowData.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+
+SCENARIO("SpotLightShadowData", "[GRAPHICS][SPOTLIGHTSHADOWDATA]")
+{
+	GIVEN("A spot light with a 2048x2048 shadowmap")
+	{
+		constexpr Nz::UInt32 maxResolution = 2048;
+
+		WHEN("The light covers a part of the screen")
+		{
+			THEN("The resolution is the next power of two")
+			{
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(maxResolution, maxResolution, 300.f) == 512);
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(128, maxResolution, 512.f) == 512);
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(128, maxResolution, 1000.f) == 1024);
+			}
+		}
+
+		WHEN("The light covers more than the shadowmap size")
+		{
+			THEN("The shadowmap size is used")
+			{
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(512, maxResolution, 5000.f) == maxResolution);
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(512, maxResolution, std::numeric_limits<float>::infinity()) == maxResolution);
+			}
+		}
+
+		WHEN("The light is tiny or not visible")
+		{
+			THEN("The minimum resolution is used")
+			{
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(maxResolution, maxResolution, 3.f) == Nz::SpotLightShadowData::MinShadowMapResolution);
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(maxResolution, maxResolution, 0.f) == Nz::SpotLightShadowData::MinShadowMapResolution);
+			}
+		}
+
+		WHEN("The light gets slightly smaller than the current resolution")
+		{
+			THEN("The resolution is kept")
+			{
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(1024, maxResolution, 500.f) == 1024);
+			}
+
+			AND_THEN("It is lowered once the light got noticeably smaller")
+			{
+				CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(1024, maxResolution, 400.f) == 512);
+			}
+		}
+	}
+
+	GIVEN("A spot light with a shadowmap smaller than the minimum resolution")
+	{
+		THEN("The shadowmap size is used")
+		{
+			CHECK(Nz::SpotLightShadowData::ComputeShadowMapResolution(64, 64, 0.f) == 64);
+		}
+	}
+}
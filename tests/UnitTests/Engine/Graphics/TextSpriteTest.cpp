@@ -0,0 +1,60 @@
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/GuillotineTextureAtlas.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Graphics/TextSprite.hpp>
+#include <Nazara/Utility/Font.hpp>
+#include <Nazara/Utility/SimpleTextDrawer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <variant>
+
+SCENARIO("TextSprite", "[GRAPHICS][TEXTSPRITE]")
+{
+	GIVEN("A text sprite displaying outlined distance field text")
+	{
+		std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+		std::shared_ptr<Nz::AbstractAtlas> previousAtlas = font->GetAtlas();
+
+		font->SetAtlas(std::make_shared<Nz::GuillotineTextureAtlas>(*Nz::Graphics::Instance()->GetRenderDevice()));
+		font->EnableDistanceField();
+
+		Nz::SimpleTextDrawer drawer;
+		drawer.SetTextFont(font);
+		drawer.SetCharacterSize(32);
+		drawer.SetTextOutlineThickness(2.f);
+		drawer.SetText("Hello");
+
+		Nz::TextSprite textSprite;
+		textSprite.Update(drawer);
+
+		THEN("Outlines are rendered using a variant of the distance field material")
+		{
+			const auto& defaultMaterials = Nz::Graphics::Instance()->GetDefaultMaterials();
+			CHECK(textSprite.GetMaterial(0) == defaultMaterials.distanceFieldText);
+
+			REQUIRE(textSprite.GetMaterialCount() == 2);
+
+			const auto& outlineMaterial = textSprite.GetMaterial(1);
+			REQUIRE(outlineMaterial);
+			CHECK(outlineMaterial->GetParentMaterial() == defaultMaterials.distanceFieldText->GetParentMaterial());
+
+			const Nz::MaterialSettings::Value* edgeValue = outlineMaterial->GetValueProperty("DistanceFieldEdge");
+			REQUIRE(edgeValue);
+			REQUIRE(std::holds_alternative<float>(*edgeValue));
+			CHECK(std::get<float>(*edgeValue) < 0.5f);
+		}
+
+		WHEN("Removing the outline")
+		{
+			drawer.SetTextOutlineThickness(0.f);
+			textSprite.Update(drawer);
+
+			THEN("The outline material is released")
+			{
+				CHECK(textSprite.GetMaterialCount() == 1);
+			}
+		}
+
+		font->EnableDistanceField(false);
+		font->SetAtlas(previousAtlas);
+	}
+}
@@ -0,0 +1,236 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/MaterialInstance.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
+#include <Nazara/Graphics/UberShader.hpp>
+#include <Nazara/Renderer/Swapchain.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+	template<typename F>
+	bool PollUntil(F&& func)
+	{
+		// Compilations are done by the task scheduler workers
+		for (int i = 0; i < 1000; ++i)
+		{
+			if (func())
+				return true;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+
+		return false;
+	}
+
+	Nz::UInt32 GetOptionHash(const Nz::UberShader& uberShader, const std::string& optionName)
+	{
+		Nz::Pointer<const Nz::UberShader::Option> option;
+		REQUIRE(uberShader.HasOption(optionName, &option));
+
+		return option->hash;
+	}
+
+	bool HasConfig(const std::vector<Nz::UberShader::Config>& configs, const Nz::UberShader::Config& config)
+	{
+		return std::any_of(configs.begin(), configs.end(), [&](const Nz::UberShader::Config& otherConfig)
+		{
+			return Nz::UberShader::ConfigEqual{}(config, otherConfig);
+		});
+	}
+}
+
+SCENARIO("UberShader", "[GRAPHICS][UBERSHADER]")
+{
+	GIVEN("The basic material uber shader")
+	{
+		Nz::UberShader uberShader(nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex, "BasicMaterial");
+
+		Nz::UberShader::Config firstConfig;
+		firstConfig.optionValues[GetOptionHash(uberShader, "VertexPositionLoc")] = Nz::Int32(0);
+
+		Nz::UberShader::Config secondConfig = firstConfig;
+		secondConfig.optionValues[GetOptionHash(uberShader, "AlphaTest")] = true;
+		secondConfig.optionValues[GetOptionHash(uberShader, "VertexUvLoc")] = Nz::Int32(1);
+
+		CHECK(uberShader.GetCompiledConfigs().empty());
+
+		WHEN("Prewarming permutations")
+		{
+			uberShader.Prewarm({ firstConfig, secondConfig });
+
+			THEN("They are compiled")
+			{
+				std::vector<Nz::UberShader::Config> compiledConfigs = uberShader.GetCompiledConfigs();
+				CHECK(compiledConfigs.size() == 2);
+				CHECK(HasConfig(compiledConfigs, firstConfig));
+				CHECK(HasConfig(compiledConfigs, secondConfig));
+			}
+
+			THEN("Retrieving them doesn't compile them again")
+			{
+				const std::shared_ptr<Nz::ShaderModule>& shaderModule = uberShader.Get(secondConfig);
+				CHECK(shaderModule);
+				CHECK(uberShader.Get(secondConfig) == shaderModule);
+				CHECK(uberShader.GetCompiledConfigs().size() == 2);
+			}
+
+			AND_WHEN("Saving them to a manifest")
+			{
+				Nz::ByteArray manifest;
+				{
+					Nz::MemoryStream manifestStream(&manifest, Nz::OpenMode::WriteOnly);
+					REQUIRE(Nz::UberShader::SaveManifest(manifestStream, uberShader.GetCompiledConfigs()));
+				}
+
+				THEN("The manifest can be read back")
+				{
+					Nz::MemoryStream manifestStream(&manifest, Nz::OpenMode::ReadOnly);
+
+					std::vector<Nz::UberShader::Config> manifestConfigs;
+					REQUIRE(Nz::UberShader::LoadManifest(manifestStream, &manifestConfigs));
+
+					CHECK(manifestConfigs.size() == 2);
+					CHECK(HasConfig(manifestConfigs, firstConfig));
+					CHECK(HasConfig(manifestConfigs, secondConfig));
+				}
+
+				THEN("A truncated manifest is rejected")
+				{
+					Nz::ByteArray truncatedManifest(manifest.begin(), manifest.begin() + manifest.GetSize() - 1);
+					Nz::MemoryStream manifestStream(&truncatedManifest, Nz::OpenMode::ReadOnly);
+
+					std::vector<Nz::UberShader::Config> manifestConfigs;
+					CHECK_FALSE(Nz::UberShader::LoadManifest(manifestStream, &manifestConfigs));
+					CHECK(manifestConfigs.empty());
+				}
+			}
+		}
+
+		WHEN("Requesting a permutation asynchronously")
+		{
+			std::shared_ptr<Nz::ShaderModule> asyncModule;
+			REQUIRE(PollUntil([&]
+			{
+				asyncModule = uberShader.GetAsync(secondConfig);
+				return asyncModule != nullptr;
+			}));
+
+			THEN("The synchronous path returns the same permutation without compiling it again")
+			{
+				CHECK(uberShader.Get(secondConfig) == asyncModule);
+				CHECK(uberShader.GetAsync(secondConfig) == asyncModule);
+				CHECK(uberShader.GetCompiledConfigs().size() == 1);
+			}
+
+			THEN("It can be used like a permutation compiled synchronously")
+			{
+				Nz::UberShader syncUberShader(nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex, "BasicMaterial");
+				const std::shared_ptr<Nz::ShaderModule>& syncModule = syncUberShader.Get(secondConfig);
+				REQUIRE(syncModule);
+
+				Nz::RenderPipelineInfo pipelineInfo;
+				pipelineInfo.pipelineLayout = Nz::Graphics::Instance()->GetDefaultMaterials().materials[Nz::MaterialType::Basic].material->GetRenderPipelineLayout();
+				pipelineInfo.vertexBuffers.push_back({ 0, Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_UV) });
+
+				const std::shared_ptr<Nz::RenderDevice>& renderDevice = Nz::Graphics::Instance()->GetRenderDevice();
+
+				pipelineInfo.shaderModules = { syncModule };
+				std::shared_ptr<Nz::RenderPipeline> syncPipeline = renderDevice->InstantiateRenderPipeline(pipelineInfo);
+
+				pipelineInfo.shaderModules = { asyncModule };
+				std::shared_ptr<Nz::RenderPipeline> asyncPipeline = renderDevice->InstantiateRenderPipeline(pipelineInfo);
+
+				CHECK(syncPipeline);
+				CHECK(asyncPipeline);
+			}
+		}
+
+		WHEN("Reading something which isn't a manifest")
+		{
+			Nz::ByteArray data(16, 0xFF);
+			Nz::MemoryStream stream(&data, Nz::OpenMode::ReadOnly);
+
+			std::vector<Nz::UberShader::Config> configs;
+			CHECK_FALSE(Nz::UberShader::LoadManifest(stream, &configs));
+		}
+	}
+
+	GIVEN("The pipeline of the default basic material")
+	{
+		Nz::Graphics* graphics = Nz::Graphics::Instance();
+		const std::shared_ptr<Nz::RenderDevice>& renderDevice = graphics->GetRenderDevice();
+
+		std::size_t forwardPassIndex = graphics->GetMaterialPassRegistry().GetPassIndex("ForwardPass");
+		std::shared_ptr<Nz::MaterialInstance> materialInstance = Nz::MaterialInstance::GetDefault(Nz::MaterialType::Basic);
+		const std::shared_ptr<Nz::MaterialPipeline>& materialPipeline = materialInstance->GetPipeline(forwardPassIndex);
+		REQUIRE(materialPipeline);
+
+		Nz::RenderPipelineInfo::VertexBufferData vertexBuffer = {
+			0,
+			Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_Normal_UV_Tangent)
+		};
+
+		std::vector<Nz::RenderPass::Attachment> attachments;
+		std::vector<Nz::RenderPass::SubpassDescription> subpassDescriptions;
+		std::vector<Nz::RenderPass::SubpassDependency> subpassDependencies;
+		Nz::Swapchain::BuildRenderPass(Nz::PixelFormat::RGBA8, Nz::PixelFormat::Depth24Stencil8, attachments, subpassDescriptions, subpassDependencies);
+
+		std::shared_ptr<Nz::RenderPass> renderPass = renderDevice->InstantiateRenderPass(std::move(attachments), std::move(subpassDescriptions), std::move(subpassDependencies));
+
+		WHEN("Requesting a render pipeline for a new vertex layout")
+		{
+			Nz::RenderPipelineInfo::VertexBufferData uvVertexBuffer = {
+				0,
+				Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_UV)
+			};
+
+			// This returns a fallback pipeline while the permutations are compiled asynchronously (if enabled)
+			CHECK(materialPipeline->GetRenderPipeline(&uvVertexBuffer, 1));
+
+			// Build the permutations the pipeline is expected to use synchronously
+			const Nz::MaterialPipelineInfo& pipelineInfo = materialPipeline->GetInfo();
+
+			std::vector<std::shared_ptr<Nz::ShaderModule>> expectedModules;
+			for (const auto& shader : pipelineInfo.shaders)
+			{
+				Nz::UberShader::Config config;
+				for (const auto& option : pipelineInfo.optionValues)
+					config.optionValues[option.hash] = option.value;
+
+				shader.uberShader->UpdateConfig(config, { uvVertexBuffer });
+				expectedModules.push_back(shader.uberShader->Get(config));
+			}
+
+			THEN("The pipeline eventually uses the same permutations as the synchronous path")
+			{
+				REQUIRE(PollUntil([&]
+				{
+					Nz::MaterialPipeline::UpdatePendingPipelines();
+					return materialPipeline->GetRenderPipeline(&uvVertexBuffer, 1)->GetPipelineInfo().shaderModules == expectedModules;
+				}));
+			}
+		}
+
+		WHEN("Prewarming it for a vertex layout and a render pass")
+		{
+			materialPipeline->Prewarm(&vertexBuffer, 1, renderPass.get(), 0);
+
+			THEN("The render pipeline is available without waiting for compilation")
+			{
+				const std::shared_ptr<Nz::RenderPipeline>& renderPipeline = materialPipeline->GetRenderPipeline(&vertexBuffer, 1);
+				REQUIRE(renderPipeline);
+
+				// Prewarming again reuses the same pipeline
+				materialPipeline->Prewarm(&vertexBuffer, 1, renderPass.get(), 0);
+				CHECK(materialPipeline->GetRenderPipeline(&vertexBuffer, 1) == renderPipeline);
+			}
+		}
+	}
+}
@@ -1,8 +1,10 @@
 #include <Nazara/Math/Matrix4.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <vector>
 
 SCENARIO("Matrix4", "[MATH][MATRIX4]")
 {
@@ -92,6 +94,27 @@ SCENARIO("Matrix4", "[MATH][MATRIX4]")
 				CHECK((matrix2 * invMatrix2) == Nz::Matrix4f::Identity());
 			}
 		}
+
+		WHEN("We transform an array of vectors")
+		{
+			std::array<Nz::Vector3f, 5> vectors3 = { Nz::Vector3f::Zero(), Nz::Vector3f::UnitX(), Nz::Vector3f::UnitY(), Nz::Vector3f::UnitZ(), Nz::Vector3f(-1.f, 2.f, 0.5f) };
+			std::array<Nz::Vector4f, 3> vectors4 = { Nz::Vector4f(1.f, 2.f, 3.f, 1.f), Nz::Vector4f(-1.f, 0.f, 5.f, 0.f), Nz::Vector4f(0.5f, 0.5f, 0.5f, 2.f) };
+
+			std::array<Nz::Vector3f, 5> results3;
+			matrix2.Transform(vectors3.data(), vectors3.size(), results3.data(), 0.5f);
+
+			std::array<Nz::Vector4f, 3> results4 = vectors4;
+			matrix2.Transform(results4.data(), results4.size(), results4.data());
+
+			THEN("It matches individual transformations")
+			{
+				for (std::size_t i = 0; i < vectors3.size(); ++i)
+					CHECK(results3[i].ApproxEqual(matrix2.Transform(vectors3[i], 0.5f)));
+
+				for (std::size_t i = 0; i < vectors4.size(); ++i)
+					CHECK(results4[i].ApproxEqual(matrix2 * vectors4[i]));
+			}
+		}
 	}
 
 	GIVEN("One transformed matrix from rotation 45 and translation 0")
@@ -307,3 +330,34 @@ SCENARIO("Matrix4", "[MATH][MATRIX4]")
 		}
 	}
 }
+
+// Hidden benchmark (run with the [.benchmark] tag), compare builds with and without the math_simd option
+TEST_CASE("Matrix4 benchmark", "[MATH][MATRIX4][.benchmark]")
+{
+	Nz::Matrix4f transformMatrix = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(30.f, 45.f, 60.f).ToQuaternion(), Nz::Vector3f(2.f));
+	Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 1000.f);
+
+	std::vector<Nz::Vector3f> vectors(1024);
+	for (std::size_t i = 0; i < vectors.size(); ++i)
+		vectors[i] = Nz::Vector3f(float(i), float(i % 7), -float(i % 13));
+
+	std::vector<Nz::Vector3f> results(vectors.size());
+
+	BENCHMARK("Multiply")
+	{
+		return projectionMatrix * transformMatrix;
+	};
+
+	BENCHMARK("Inverse")
+	{
+		Nz::Matrix4f inverse;
+		transformMatrix.GetInverse(&inverse);
+		return inverse;
+	};
+
+	BENCHMARK("Transform 1024 vectors")
+	{
+		transformMatrix.Transform(vectors.data(), vectors.size(), results.data());
+		return results.back();
+	};
+}
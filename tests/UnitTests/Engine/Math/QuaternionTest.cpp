@@ -1,5 +1,6 @@
 #include <Nazara/Math/Quaternion.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 SCENARIO("Quaternion", "[MATH][QUATERNION]")
@@ -244,3 +245,19 @@ SCENARIO("Quaternion", "[MATH][QUATERNION]")
 		}
 	}
 }
+
+// Hidden benchmark (run with the [.benchmark] tag), compare builds with and without the math_simd option
+TEST_CASE("Quaternion benchmark", "[MATH][QUATERNION][.benchmark]")
+{
+	Nz::Quaternionf from = Nz::EulerAnglesf(10.f, 20.f, 30.f).ToQuaternion();
+	Nz::Quaternionf to = Nz::EulerAnglesf(-80.f, 45.f, 170.f).ToQuaternion();
+
+	BENCHMARK("Slerp")
+	{
+		Nz::Quaternionf result = from;
+		for (int i = 1; i <= 100; ++i)
+			result = Nz::Quaternionf::Slerp(result, to, i / 100.f);
+
+		return result;
+	};
+}
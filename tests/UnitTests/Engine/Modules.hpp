@@ -4,4 +4,5 @@
 #include <Nazara/Network.hpp>
 #include <Nazara/ChipmunkPhysics2D.hpp>
 #include <Nazara/BulletPhysics3D.hpp>
+#include <Nazara/JoltPhysics3D.hpp>
 #include <Nazara/Utility.hpp>
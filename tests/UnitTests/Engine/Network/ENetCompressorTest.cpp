@@ -0,0 +1,174 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZ4Compressor.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/ENetZstdCompressor.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<std::vector<Nz::UInt8>> GeneratePackets(std::size_t packetCount, unsigned int seed)
+	{
+		std::mt19937 randomGenerator(seed);
+		std::uniform_int_distribution<unsigned int> entityCountDis(1, 20);
+		std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+
+		// Game-like packets: a small header followed by a few entity updates
+		std::vector<std::vector<Nz::UInt8>> packets(packetCount);
+		for (std::size_t i = 0; i < packetCount; ++i)
+		{
+			std::vector<Nz::UInt8>& packet = packets[i];
+			auto Append = [&](auto value)
+			{
+				std::size_t offset = packet.size();
+				packet.resize(offset + sizeof(value));
+				std::memcpy(&packet[offset], &value, sizeof(value));
+			};
+
+			Append(Nz::UInt8(42));
+			Append(Nz::UInt32(i));
+
+			unsigned int entityCount = entityCountDis(randomGenerator);
+			Append(Nz::UInt8(entityCount));
+			for (unsigned int j = 0; j < entityCount; ++j)
+			{
+				Append(Nz::UInt16(j * 3));
+				Append(Nz::UInt8(100));
+				Append(float(j));
+				Append(positionDis(randomGenerator));
+				Append(0.f);
+			}
+		}
+
+		return packets;
+	}
+
+	std::size_t CheckRoundTrip(Nz::ENetCompressor& compressor, const std::vector<std::vector<Nz::UInt8>>& packets)
+	{
+		std::size_t totalCompressedSize = 0;
+
+		std::vector<Nz::UInt8> compressed(4096);
+		std::vector<Nz::UInt8> decompressed(4096);
+		for (const std::vector<Nz::UInt8>& packet : packets)
+		{
+			// Split packet in two buffers as ENet sends commands in separate buffers
+			std::size_t split = packet.size() / 3;
+			Nz::NetBuffer buffers[2] = {
+				{ const_cast<Nz::UInt8*>(packet.data()), split },
+				{ const_cast<Nz::UInt8*>(packet.data()) + split, packet.size() - split }
+			};
+
+			std::size_t compressedSize = compressor.Compress(nullptr, buffers, 2, packet.size(), compressed.data(), compressed.size());
+			REQUIRE(compressedSize > 0);
+
+			std::size_t decompressedSize = compressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+			REQUIRE(decompressedSize == packet.size());
+			REQUIRE(std::equal(packet.begin(), packet.end(), decompressed.begin()));
+
+			totalCompressedSize += compressedSize;
+		}
+
+		return totalCompressedSize;
+	}
+}
+
+SCENARIO("ENetCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	std::vector<std::vector<Nz::UInt8>> packets = GeneratePackets(500, 0);
+
+	std::size_t totalSize = 0;
+	for (const std::vector<Nz::UInt8>& packet : packets)
+		totalSize += packet.size();
+
+	WHEN("Using the range coder")
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+		CHECK(CheckRoundTrip(compressor, packets) < totalSize);
+	}
+
+	WHEN("Using LZ4")
+	{
+		Nz::ENetLZ4Compressor compressor;
+		CheckRoundTrip(compressor, packets);
+	}
+
+	WHEN("Using zstd")
+	{
+		Nz::ENetZstdCompressor compressor;
+		std::size_t compressedSize = CheckRoundTrip(compressor, packets);
+
+		AND_WHEN("Using a trained dictionary")
+		{
+			std::vector<Nz::UInt8> dictionary = Nz::ENetZstdCompressor::TrainDictionary(GeneratePackets(5000, 1), 4096);
+			REQUIRE_FALSE(dictionary.empty());
+
+			Nz::ENetZstdCompressor dictionaryCompressor(dictionary.data(), dictionary.size());
+			CHECK(dictionaryCompressor.HasDictionary());
+			CHECK(CheckRoundTrip(dictionaryCompressor, packets) < compressedSize);
+		}
+	}
+
+	WHEN("Hosts exchange compressed packets")
+	{
+		Nz::ENetHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+		serverHost.SetCompressor(std::make_unique<Nz::ENetRangeCoderCompressor>());
+
+		Nz::ENetHost clientHost;
+		REQUIRE(clientHost.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+		clientHost.SetCompressor(std::make_unique<Nz::ENetRangeCoderCompressor>());
+
+		Nz::ENetPeer* serverPeer = clientHost.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), serverHost.GetBoundAddress().GetPort()), 1);
+		REQUIRE(serverPeer);
+
+		Nz::ENetPeer* clientPeer = nullptr;
+		std::size_t receivedCount = 0;
+
+		auto Pump = [&]
+		{
+			Nz::ENetEvent event;
+			while (serverHost.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					clientPeer = event.peer;
+				else if (event.type == Nz::ENetEventType::Receive)
+					receivedCount++;
+			}
+
+			while (clientHost.Service(&event, 1) > 0)
+				;
+		};
+
+		for (unsigned int i = 0; i < 1000 && (!clientPeer || !serverPeer->IsConnected()); ++i)
+			Pump();
+
+		REQUIRE(clientPeer);
+
+		for (std::size_t i = 0; i < 50; ++i)
+		{
+			Nz::NetPacket packet(1, packets[i].data(), packets[i].size());
+			serverPeer->Send(0, Nz::ENetPacketFlag_Reliable, std::move(packet));
+		}
+
+		for (unsigned int i = 0; i < 1000 && receivedCount < 50; ++i)
+			Pump();
+
+		THEN("Packets are received and statistics are updated")
+		{
+			CHECK(receivedCount == 50);
+
+			const Nz::ENetCompressionStatistics& sendStats = serverPeer->GetCompressionStatistics();
+			CHECK(sendStats.compressedPacketCount > 0);
+			CHECK(sendStats.GetCompressionRatio() < 1.f);
+
+			const Nz::ENetCompressionStatistics& receiveStats = clientPeer->GetCompressionStatistics();
+			CHECK(receiveStats.decompressedPacketCount > 0);
+			CHECK(receiveStats.GetDecompressionRatio() < 1.f);
+		}
+	}
+}
@@ -0,0 +1,247 @@
+#include <Nazara/Core/BitReader.hpp>
+#include <Nazara/Core/BitWriter.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ReplicationClient.hpp>
+#include <Nazara/Network/ReplicationServer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <unordered_map>
+
+SCENARIO("Replication", "[NETWORK][REPLICATION]")
+{
+	GIVEN("A replication server and client connected over ENet")
+	{
+		Nz::ENetHost serverHost;
+		REQUIRE(serverHost.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+
+		Nz::ENetHost clientHost;
+		REQUIRE(clientHost.Create(Nz::NetProtocol::IPv4, 0, 1, 1));
+
+		Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), serverHost.GetBoundAddress().GetPort());
+
+		Nz::ReplicationServer server;
+		Nz::ReplicationClient client;
+
+		Nz::ENetPeer* serverPeer = clientHost.Connect(serverAddress, 1);
+		REQUIRE(serverPeer);
+
+		Nz::ENetPeer* clientPeer = nullptr;
+
+		auto Pump = [&]
+		{
+			Nz::ENetEvent event;
+			while (serverHost.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::IncomingConnect)
+					clientPeer = event.peer;
+				else if (event.type == Nz::ENetEventType::Receive && event.channelId == server.GetChannelId())
+					server.HandlePacket(event.peer, event.packet->data);
+			}
+
+			while (clientHost.Service(&event, 1) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive && event.channelId == client.GetChannelId())
+					client.HandlePacket(event.peer, event.packet->data);
+			}
+		};
+
+		for (unsigned int i = 0; i < 1000 && (!clientPeer || !serverPeer->IsConnected()); ++i)
+			Pump();
+
+		REQUIRE(clientPeer);
+		REQUIRE(serverPeer->IsConnected());
+
+		std::unordered_map<Nz::ReplicatedEntityId, Nz::Vector3f> serverPositions;
+		std::unordered_map<Nz::ReplicatedEntityId, Nz::Int64> serverHealth;
+
+		std::unordered_map<Nz::ReplicatedEntityId, Nz::Vector3f> clientPositions;
+		std::unordered_map<Nz::ReplicatedEntityId, Nz::Int64> clientHealth;
+		std::size_t clientUpdateCount = 0;
+
+		server.RegisterComponent([&](Nz::ReplicatedEntityId entityId, Nz::BitWriter& writer)
+		{
+			writer.WriteQuantized(serverPositions[entityId], -1000.f, 1000.f, 20);
+		});
+
+		server.RegisterComponent([&](Nz::ReplicatedEntityId entityId, Nz::BitWriter& writer)
+		{
+			writer.WriteVarInt(serverHealth[entityId]);
+		});
+
+		client.RegisterComponent([&](Nz::ReplicatedEntityId entityId, Nz::BitReader& reader)
+		{
+			clientPositions[entityId] = reader.ReadQuantizedVector3(-1000.f, 1000.f, 20);
+			clientUpdateCount++;
+		});
+
+		client.RegisterComponent([&](Nz::ReplicatedEntityId entityId, Nz::BitReader& reader)
+		{
+			clientHealth[entityId] = reader.ReadVarInt();
+			clientUpdateCount++;
+		});
+
+		client.OnEntityDestroyed.Connect([&](Nz::ReplicationClient* /*client*/, Nz::ReplicatedEntityId entityId)
+		{
+			clientPositions.erase(entityId);
+			clientHealth.erase(entityId);
+		});
+
+		server.AddClient(clientPeer);
+
+		constexpr Nz::ReplicatedEntityId EntityCount = 100;
+		for (Nz::ReplicatedEntityId entityId = 0; entityId < EntityCount; ++entityId)
+		{
+			Nz::Vector3f position(float(entityId) * 5.f, 0.f, 0.f);
+			serverPositions[entityId] = position;
+			serverHealth[entityId] = 100;
+
+			server.CreateEntity(entityId, 0b11, position);
+		}
+
+		auto IsSynchronized = [&]
+		{
+			if (clientPositions.size() != serverPositions.size() || clientHealth != serverHealth)
+				return false;
+
+			for (auto&& [entityId, position] : serverPositions)
+			{
+				auto it = clientPositions.find(entityId);
+				if (it == clientPositions.end() || position.SquaredDistance(it->second) > 0.01f)
+					return false;
+			}
+
+			return true;
+		};
+
+		auto TickUntilSynchronized = [&]
+		{
+			for (unsigned int i = 0; i < 500; ++i)
+			{
+				server.Tick();
+				Pump();
+
+				if (IsSynchronized())
+					return true;
+			}
+
+			return false;
+		};
+
+		WHEN("Bandwidth is limited")
+		{
+			server.SetClientBandwidthBudget(clientPeer, 100);
+
+			THEN("Entities are spread over several snapshots and eventually replicated")
+			{
+				server.Tick();
+				Pump();
+				Pump();
+
+				CHECK(client.GetEntityCount() > 0);
+				CHECK(client.GetEntityCount() < EntityCount);
+
+				CHECK(TickUntilSynchronized());
+			}
+		}
+
+		WHEN("Entities change over a lossy network")
+		{
+			serverHost.SimulateNetwork(0.2, 0, 20);
+			clientHost.SimulateNetwork(0.2, 0, 20);
+
+			for (unsigned int tick = 0; tick < 30; ++tick)
+			{
+				Nz::ReplicatedEntityId entityId = tick % EntityCount;
+				serverPositions[entityId] += Nz::Vector3f(0.f, 1.f, 0.f);
+				serverHealth[entityId] -= 10;
+
+				server.Tick();
+				Pump();
+			}
+
+			serverHost.SimulateNetwork(0.0, 0, 0);
+			clientHost.SimulateNetwork(0.0, 0, 0);
+
+			THEN("Client converges to the server state")
+			{
+				CHECK(TickUntilSynchronized());
+			}
+		}
+
+		WHEN("Only one component changes")
+		{
+			REQUIRE(TickUntilSynchronized());
+
+			std::size_t updateCount = clientUpdateCount;
+			serverHealth[42] = 50;
+
+			THEN("Only this component is deserialized")
+			{
+				REQUIRE(TickUntilSynchronized());
+				CHECK(clientUpdateCount == updateCount + 1);
+				CHECK(clientHealth[42] == 50);
+			}
+		}
+
+		WHEN("An entity is destroyed")
+		{
+			REQUIRE(TickUntilSynchronized());
+
+			server.DestroyEntity(7);
+			serverPositions.erase(7);
+			serverHealth.erase(7);
+
+			THEN("It is destroyed on the client")
+			{
+				CHECK(TickUntilSynchronized());
+				CHECK_FALSE(client.HasEntity(7));
+			}
+		}
+
+		WHEN("Many entities are destroyed while bandwidth is limited")
+		{
+			REQUIRE(TickUntilSynchronized());
+
+			server.SetClientBandwidthBudget(clientPeer, 20);
+
+			for (Nz::ReplicatedEntityId entityId = 10; entityId < EntityCount; ++entityId)
+			{
+				server.DestroyEntity(entityId);
+				serverPositions.erase(entityId);
+				serverHealth.erase(entityId);
+			}
+
+			THEN("Removals are spread over several snapshots and eventually replicated")
+			{
+				server.Tick();
+				Pump();
+				Pump();
+
+				CHECK(client.GetEntityCount() < EntityCount);
+				CHECK(client.GetEntityCount() > 10);
+
+				CHECK(TickUntilSynchronized());
+				CHECK(client.GetEntityCount() == 10);
+			}
+		}
+
+		WHEN("The client viewer has a limited radius")
+		{
+			server.SetClientViewer(clientPeer, Nz::Vector3f::Zero(), 52.f);
+			server.SetEntityAlwaysRelevant(99, true);
+
+			for (unsigned int i = 0; i < 100; ++i)
+			{
+				server.Tick();
+				Pump();
+			}
+
+			THEN("Only relevant entities are replicated")
+			{
+				CHECK(client.GetEntityCount() == 12); //< 0 to 10 and 99
+				CHECK(client.HasEntity(10));
+				CHECK_FALSE(client.HasEntity(11));
+				CHECK(client.HasEntity(99));
+			}
+		}
+	}
+}
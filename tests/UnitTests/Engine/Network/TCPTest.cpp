@@ -61,5 +61,39 @@ SCENARIO("TCP", "[NETWORK][TCP]")
 				CHECK(result == vector123);
 			}
 		}
+
+		WHEN("We send a shared packet multiple times")
+		{
+			Nz::NetPacket packet(2);
+			packet << Nz::UInt32(42) << Nz::Vector3f(4.f, 5.f, 6.f);
+
+			Nz::NetPacket sharedPacket = packet.Share();
+			CHECK(sharedPacket.GetConstData() == packet.GetConstData());
+			CHECK(sharedPacket.GetNetCode() == 2);
+
+			Nz::NetPacket secondSharedPacket = sharedPacket.Share();
+			CHECK(secondSharedPacket.GetConstData() == packet.GetConstData());
+
+			REQUIRE(serverToClient.SendPacket(packet));
+			REQUIRE(serverToClient.SendPacket(sharedPacket));
+			REQUIRE(serverToClient.SendPacket(secondSharedPacket));
+
+			THEN("We should get every packet on the client")
+			{
+				for (unsigned int i = 0; i < 3; ++i)
+				{
+					Nz::NetPacket resultPacket;
+					REQUIRE(client.ReceivePacket(&resultPacket));
+					CHECK(resultPacket.GetNetCode() == 2);
+
+					Nz::UInt32 value;
+					Nz::Vector3f vector;
+					resultPacket >> value >> vector;
+
+					CHECK(value == 42);
+					CHECK(vector == Nz::Vector3f(4.f, 5.f, 6.f));
+				}
+			}
+		}
 	}
 }
@@ -190,6 +190,62 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 				CHECK(statusWallCollision == 3);
 			}
 		}
+
+		WHEN("We check which bodies moved")
+		{
+			std::vector<Nz::ChipmunkRigidBody2D*> movedBodies;
+			auto CollectMovedBodies = [&]
+			{
+				movedBodies.clear();
+				world.ForEachMovedBody([&](Nz::ChipmunkRigidBody2D& body)
+				{
+					movedBodies.push_back(&body);
+				}, true);
+			};
+
+			CollectMovedBodies();
+			CHECK(movedBodies.size() == 3);
+
+			THEN("Moved bodies are only reset when asked to")
+			{
+				std::size_t movedBodyCount = 0;
+				world.ForEachMovedBody([&](Nz::ChipmunkRigidBody2D& /*body*/)
+				{
+					movedBodyCount++;
+				});
+				CHECK(movedBodyCount == 0);
+
+				wall.SetPosition(Nz::Vector2f(6.f, 0.f));
+				for (int i = 0; i < 2; ++i)
+				{
+					movedBodyCount = 0;
+					world.ForEachMovedBody([&](Nz::ChipmunkRigidBody2D& /*body*/)
+					{
+						movedBodyCount++;
+					});
+					CHECK(movedBodyCount == 1);
+				}
+			}
+
+			THEN("Only the dynamic character is reported after a step")
+			{
+				world.Step(Nz::Time::TickDuration(10));
+				CollectMovedBodies();
+				REQUIRE(movedBodies.size() == 1);
+				CHECK(movedBodies[0] == &character);
+			}
+
+			THEN("Teleported static bodies are reported")
+			{
+				wall.SetPosition(Nz::Vector2f(6.f, 0.f));
+				CollectMovedBodies();
+				REQUIRE(movedBodies.size() == 1);
+				CHECK(movedBodies[0] == &wall);
+
+				CollectMovedBodies();
+				CHECK(movedBodies.empty());
+			}
+		}
 	}
 }
 
@@ -0,0 +1,114 @@
+#include <Nazara/ChipmunkPhysics2D/ChipmunkCollider2D.hpp>
+#include <Nazara/ChipmunkPhysics2D/Systems/ChipmunkPhysics2DSystem.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+SCENARIO("Physics2DSystem", "[PHYSICS2D][PHYSICS2DSYSTEM]")
+{
+	GIVEN("A physics system with interpolation and a falling body")
+	{
+		entt::registry registry;
+
+		Nz::ChipmunkPhysics2DSystem physicsSystem(registry);
+		physicsSystem.EnableInterpolation();
+
+		Nz::ChipmunkPhysWorld2D& physWorld = physicsSystem.GetPhysWorld();
+		physWorld.SetGravity(Nz::Vector2f(0.f, -10.f));
+		physWorld.SetSleepTime(Nz::Time::Second());
+		physWorld.SetStepSize(Nz::Time::Milliseconds(100));
+
+		Nz::ChipmunkRigidBody2D::DynamicSettings dynamicSettings;
+		dynamicSettings.geom = std::make_shared<Nz::ChipmunkCircleCollider2D>(1.f);
+		dynamicSettings.mass = 1.f;
+
+		entt::entity entity = registry.create();
+		Nz::NodeComponent& node = registry.emplace<Nz::NodeComponent>(entity, Nz::Vector3f(0.f, 10.f, 0.f));
+		Nz::ChipmunkRigidBody2DComponent& rigidBody = registry.emplace<Nz::ChipmunkRigidBody2DComponent>(entity, dynamicSettings);
+
+		// First update steps exactly once, leaving nothing in the accumulator
+		physicsSystem.Update(Nz::Time::Milliseconds(100));
+
+		Nz::Vector2f bodyPosition = rigidBody.GetPosition();
+		REQUIRE(bodyPosition.y < 10.f);
+
+		THEN("Node is at the start of the interpolation")
+		{
+			CHECK(node.GetPosition().x == Catch::Approx(0.f));
+			CHECK(node.GetPosition().y == Catch::Approx(10.f));
+		}
+
+		WHEN("Updating without reaching a step")
+		{
+			physicsSystem.Update(Nz::Time::Milliseconds(50));
+
+			THEN("Body didn't move but node is interpolated")
+			{
+				CHECK(rigidBody.GetPosition() == bodyPosition);
+				CHECK(node.GetPosition().y == Catch::Approx((10.f + bodyPosition.y) * 0.5f));
+			}
+
+			AND_WHEN("Updating again without reaching a step")
+			{
+				physicsSystem.Update(Nz::Time::Milliseconds(25));
+
+				THEN("Node keeps being interpolated")
+				{
+					CHECK(node.GetPosition().y == Catch::Approx(10.f + (bodyPosition.y - 10.f) * 0.75f));
+				}
+			}
+		}
+
+		WHEN("Teleporting the body on an update without steps")
+		{
+			rigidBody.TeleportTo(Nz::Vector2f(5.f, 5.f), Nz::RadianAnglef::Zero());
+			physicsSystem.Update(Nz::Time::Milliseconds(50));
+
+			THEN("Node is snapped to the new position")
+			{
+				CHECK(node.GetPosition().x == Catch::Approx(5.f));
+				CHECK(node.GetPosition().y == Catch::Approx(5.f));
+			}
+
+			AND_WHEN("Updating again without reaching a step")
+			{
+				physicsSystem.Update(Nz::Time::Milliseconds(25));
+
+				THEN("Node stays at the new position")
+				{
+					CHECK(node.GetPosition().x == Catch::Approx(5.f));
+					CHECK(node.GetPosition().y == Catch::Approx(5.f));
+				}
+			}
+		}
+
+		WHEN("The body falls asleep")
+		{
+			rigidBody.ForceSleep(); //< applied at the end of next step
+			physicsSystem.Update(Nz::Time::Milliseconds(100));
+			REQUIRE(rigidBody.IsSleeping());
+
+			Nz::Vector2f sleepingPosition = rigidBody.GetPosition();
+			CHECK(node.GetPosition().y == Catch::Approx(bodyPosition.y));
+
+			physicsSystem.Update(Nz::Time::Milliseconds(100));
+
+			THEN("Node is snapped to the final body position")
+			{
+				CHECK(rigidBody.GetPosition() == sleepingPosition);
+				CHECK(node.GetPosition().y == Catch::Approx(sleepingPosition.y));
+			}
+		}
+
+		WHEN("Disabling interpolation")
+		{
+			physicsSystem.Update(Nz::Time::Milliseconds(50));
+			physicsSystem.EnableInterpolation(false);
+
+			THEN("Node is snapped to the body position")
+			{
+				CHECK(node.GetPosition().y == Catch::Approx(bodyPosition.y));
+			}
+		}
+	}
+}
@@ -0,0 +1,183 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/JoltPhysics3D/JoltCollider3D.hpp>
+#include <Nazara/JoltPhysics3D/JoltPhysWorld3D.hpp>
+#include <Nazara/JoltPhysics3D/JoltRigidBody3D.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+	void FillWorld(Nz::JoltPhysWorld3D& world, std::vector<Nz::JoltRigidBody3D>& bodies, std::size_t bodyCountPerSide)
+	{
+		bodies.reserve(bodyCountPerSide * bodyCountPerSide + 1);
+
+		Nz::JoltRigidBody3D::StaticSettings groundSettings(std::make_shared<Nz::JoltBoxCollider3D>(Nz::Vector3f(1000.f, 1.f, 1000.f)));
+		groundSettings.position = Nz::Vector3f(0.f, -0.5f, 0.f);
+		bodies.emplace_back(world, groundSettings);
+
+		std::shared_ptr<Nz::JoltSphereCollider3D> sphereCollider = std::make_shared<Nz::JoltSphereCollider3D>(0.5f);
+		for (std::size_t x = 0; x < bodyCountPerSide; ++x)
+		{
+			for (std::size_t z = 0; z < bodyCountPerSide; ++z)
+			{
+				Nz::JoltRigidBody3D::DynamicSettings sphereSettings(sphereCollider, 1.f);
+				sphereSettings.position = Nz::Vector3f(float(x) * 2.f, 1.f + float((x + z) % 3), float(z) * 2.f);
+				bodies.emplace_back(world, sphereSettings);
+			}
+		}
+	}
+
+	std::vector<Nz::Vector3f> GetPositions(const std::vector<Nz::JoltRigidBody3D>& bodies)
+	{
+		std::vector<Nz::Vector3f> positions;
+		for (const Nz::JoltRigidBody3D& body : bodies)
+			positions.push_back(body.GetPosition());
+
+		return positions;
+	}
+
+	void StepWorld(Nz::JoltPhysWorld3D& world, std::size_t stepCount)
+	{
+		for (std::size_t i = 0; i < stepCount; ++i)
+			world.Step(world.GetStepSize());
+	}
+}
+
+SCENARIO("JoltPhysWorld3D", "[PHYSICS3D][JOLTPHYSWORLD3D]")
+{
+	GIVEN("A physics world with bodies falling on the ground")
+	{
+		Nz::JoltPhysWorld3D world;
+
+		std::vector<Nz::JoltRigidBody3D> bodies;
+		FillWorld(world, bodies, 4);
+
+		StepWorld(world, 10);
+
+		Nz::ByteArray savedState;
+		world.SaveState(savedState);
+		CHECK(savedState.GetSize() > 0);
+
+		std::vector<Nz::Vector3f> savedPositions = GetPositions(bodies);
+
+		StepWorld(world, 30);
+		std::vector<Nz::Vector3f> simulatedPositions = GetPositions(bodies);
+		CHECK(simulatedPositions != savedPositions);
+
+		WHEN("Restoring the saved state")
+		{
+			REQUIRE(world.RestoreState(savedState));
+
+			THEN("Bodies are back to their saved positions")
+			{
+				CHECK(GetPositions(bodies) == savedPositions);
+			}
+
+			AND_WHEN("Simulating the same steps again")
+			{
+				StepWorld(world, 30);
+
+				THEN("Simulation ends up in the same state")
+				{
+					CHECK(GetPositions(bodies) == simulatedPositions);
+				}
+			}
+		}
+
+		WHEN("Computing a delta between two states")
+		{
+			Nz::ByteArray newState;
+			world.SaveState(newState);
+			REQUIRE(newState != savedState);
+
+			Nz::ByteArray delta;
+			Nz::JoltPhysWorld3D::ComputeStateDelta(savedState, newState, delta);
+
+			THEN("Applying it to the reference state gives the new state")
+			{
+				Nz::ByteArray decodedState;
+				REQUIRE(Nz::JoltPhysWorld3D::ApplyStateDelta(savedState, delta, decodedState));
+				CHECK(decodedState == newState);
+			}
+
+			THEN("It can be applied in place")
+			{
+				Nz::ByteArray state = savedState;
+				REQUIRE(Nz::JoltPhysWorld3D::ApplyStateDelta(state, delta, state));
+				CHECK(state == newState);
+			}
+
+			THEN("It can be computed in place")
+			{
+				Nz::ByteArray state = newState;
+				Nz::JoltPhysWorld3D::ComputeStateDelta(savedState, state, state);
+				CHECK(state == delta);
+			}
+
+			THEN("A delta against an identical state is smaller than the state")
+			{
+				Nz::ByteArray emptyDelta;
+				Nz::JoltPhysWorld3D::ComputeStateDelta(newState, newState, emptyDelta);
+				CHECK(emptyDelta.GetSize() < newState.GetSize());
+
+				Nz::ByteArray decodedState;
+				REQUIRE(Nz::JoltPhysWorld3D::ApplyStateDelta(newState, emptyDelta, decodedState));
+				CHECK(decodedState == newState);
+			}
+
+			THEN("A truncated delta is rejected")
+			{
+				Nz::ByteArray truncatedDelta(delta.begin(), delta.begin() + delta.GetSize() / 2);
+
+				Nz::ByteArray decodedState;
+				CHECK_FALSE(Nz::JoltPhysWorld3D::ApplyStateDelta(savedState, truncatedDelta, decodedState));
+			}
+		}
+	}
+}
+
+// Hidden benchmark (run with the [.benchmark] tag)
+TEST_CASE("JoltPhysWorld3D state benchmark", "[PHYSICS3D][JOLTPHYSWORLD3D][.benchmark]")
+{
+	Nz::JoltPhysWorld3D world;
+
+	std::vector<Nz::JoltRigidBody3D> bodies;
+	FillWorld(world, bodies, 100); //< 10k bodies
+
+	StepWorld(world, 10);
+
+	Nz::ByteArray referenceState;
+	world.SaveState(referenceState);
+
+	StepWorld(world, 1);
+
+	Nz::ByteArray state;
+	Nz::ByteArray delta;
+	world.SaveState(state);
+	Nz::JoltPhysWorld3D::ComputeStateDelta(referenceState, state, delta);
+
+	WARN("snapshot size for " << bodies.size() << " bodies: " << state.GetSize() << " bytes, delta with previous tick: " << delta.GetSize() << " bytes");
+
+	BENCHMARK("SaveState")
+	{
+		world.SaveState(state);
+		return state.GetSize();
+	};
+
+	BENCHMARK("RestoreState")
+	{
+		return world.RestoreState(state);
+	};
+
+	BENCHMARK("ComputeStateDelta")
+	{
+		Nz::JoltPhysWorld3D::ComputeStateDelta(referenceState, state, delta);
+		return delta.GetSize();
+	};
+
+	BENCHMARK("ApplyStateDelta")
+	{
+		return Nz::JoltPhysWorld3D::ApplyStateDelta(referenceState, delta, state);
+	};
+}
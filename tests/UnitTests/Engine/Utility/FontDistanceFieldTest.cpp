@@ -0,0 +1,152 @@
+#include <Nazara/Utility/Font.hpp>
+#include <Nazara/Utility/GuillotineImageAtlas.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/SimpleTextDrawer.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+
+SCENARIO("Font distance fields", "[Utility][Font][DistanceField]")
+{
+	GIVEN("The coverage of an antialiased disc")
+	{
+		constexpr unsigned int size = 40;
+		constexpr unsigned int spread = 8;
+		constexpr float centerX = 20.3f;
+		constexpr float centerY = 19.6f;
+		constexpr float radius = 12.f;
+
+		// Coverage is computed using 8x8 samples per pixel
+		Nz::Image coverage(Nz::ImageType::E2D, Nz::PixelFormat::A8, size, size);
+		Nz::UInt8* pixels = coverage.GetPixels();
+		for (unsigned int y = 0; y < size; ++y)
+		{
+			for (unsigned int x = 0; x < size; ++x)
+			{
+				unsigned int sampleCount = 0;
+				for (unsigned int sampleY = 0; sampleY < 8; ++sampleY)
+				{
+					for (unsigned int sampleX = 0; sampleX < 8; ++sampleX)
+					{
+						float posX = x + (sampleX + 0.5f) / 8.f;
+						float posY = y + (sampleY + 0.5f) / 8.f;
+						if (std::hypot(posX - centerX, posY - centerY) < radius)
+							sampleCount++;
+					}
+				}
+
+				pixels[y * size + x] = static_cast<Nz::UInt8>(std::lround(sampleCount * 255.f / 64.f));
+			}
+		}
+
+		WHEN("Computing its distance field")
+		{
+			Nz::Image distanceField = Nz::Font::ComputeDistanceField(coverage, spread);
+
+			THEN("It is extended by the spread on each side")
+			{
+				CHECK(distanceField.GetFormat() == Nz::PixelFormat::A8);
+				CHECK(distanceField.GetWidth() == size + spread * 2);
+				CHECK(distanceField.GetHeight() == size + spread * 2);
+			}
+
+			AND_THEN("It stores the signed distance to the disc edge")
+			{
+				unsigned int fieldSize = distanceField.GetWidth();
+				const Nz::UInt8* fieldPixels = distanceField.GetConstPixels();
+
+				float maxError = 0.f;
+				for (unsigned int y = 0; y < fieldSize; ++y)
+				{
+					for (unsigned int x = 0; x < fieldSize; ++x)
+					{
+						float posX = static_cast<float>(x) - spread + 0.5f;
+						float posY = static_cast<float>(y) - spread + 0.5f;
+						float expectedDistance = radius - std::hypot(posX - centerX, posY - centerY);
+						if (std::abs(expectedDistance) > spread - 1)
+							continue; //< distances are clamped by the spread
+
+						float distance = (fieldPixels[y * fieldSize + x] / 255.f - 0.5f) * 2.f * spread;
+						maxError = std::max(maxError, std::abs(distance - expectedDistance));
+					}
+				}
+
+				CHECK(maxError < 0.75f);
+
+				// Far away pixels are clamped
+				CHECK(fieldPixels[0] == 0);
+				CHECK(fieldPixels[(fieldSize / 2) * fieldSize + fieldSize / 2] == 255);
+			}
+		}
+	}
+
+	GIVEN("A font rendering distance field glyphes")
+	{
+		std::shared_ptr<Nz::Font> font = Nz::Font::GetDefault();
+		std::shared_ptr<Nz::AbstractAtlas> previousAtlas = font->GetAtlas();
+
+		font->SetAtlas(std::make_shared<Nz::GuillotineImageAtlas>());
+		font->EnableDistanceField();
+
+		WHEN("Retrieving a glyph with and without outline")
+		{
+			const Nz::Font::Glyph& glyph = font->GetGlyph(32, Nz::TextStyle_Regular, 0.f, 'A');
+			const Nz::Font::Glyph& outlineGlyph = font->GetGlyph(32, Nz::TextStyle_Regular, 2.f, 'A');
+			const Nz::Font::Glyph& biggerOutlineGlyph = font->GetGlyph(48, Nz::TextStyle_Regular, 3.f, 'A');
+
+			THEN("Every variant uses the same distance field")
+			{
+				REQUIRE(glyph.valid);
+				REQUIRE(outlineGlyph.valid);
+				REQUIRE(biggerOutlineGlyph.valid);
+
+				CHECK(outlineGlyph.atlasRect == glyph.atlasRect);
+				CHECK(outlineGlyph.layerIndex == glyph.layerIndex);
+				CHECK(biggerOutlineGlyph.atlasRect == glyph.atlasRect);
+				CHECK(biggerOutlineGlyph.layerIndex == glyph.layerIndex);
+			}
+
+			AND_THEN("Outlines are rendered by moving the edge value")
+			{
+				CHECK(glyph.distanceFieldEdge == 0.5f);
+				CHECK(outlineGlyph.distanceFieldEdge < 0.5f);
+				CHECK(outlineGlyph.distanceFieldEdge > 0.f);
+
+				// Both outlines are 1/16 of the character size, which is the same outline at reference size
+				CHECK(biggerOutlineGlyph.distanceFieldEdge == outlineGlyph.distanceFieldEdge);
+			}
+		}
+
+		WHEN("Drawing outlined text")
+		{
+			Nz::SimpleTextDrawer drawer;
+			drawer.SetTextFont(font);
+			drawer.SetCharacterSize(32);
+			drawer.SetTextOutlineThickness(2.f);
+			drawer.SetText("AB");
+
+			THEN("Outline glyphes carry their edge value")
+			{
+				REQUIRE(drawer.GetGlyphCount() == 4);
+
+				std::size_t outlineGlyphCount = 0;
+				for (std::size_t i = 0; i < drawer.GetGlyphCount(); ++i)
+				{
+					const auto& glyph = drawer.GetGlyph(i);
+					if (glyph.distanceFieldEdge < 0.5f)
+					{
+						CHECK(glyph.renderOrder < 1);
+						outlineGlyphCount++;
+					}
+					else
+						CHECK(glyph.distanceFieldEdge == 0.5f);
+				}
+
+				CHECK(outlineGlyphCount == 2);
+			}
+		}
+
+		font->EnableDistanceField(false);
+		font->SetAtlas(previousAtlas);
+	}
+}
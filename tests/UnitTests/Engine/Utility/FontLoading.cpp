@@ -126,6 +126,15 @@ SCENARIO("Fonts", "[Utility][Font]")
 				for (char c = '0'; c <= '9'; ++c)
 					characterSet += c;
 
+				// Listeners are notified once the font isn't locked anymore, so they can use it
+				std::size_t layerCount = font->GetAtlas()->GetLayerCount();
+				std::size_t layerChangeCount = 0;
+				auto layerChangeConnection = font->OnFontAtlasLayerChanged.Connect([&](const Nz::Font* changedFont, Nz::AbstractImage* /*oldLayer*/, Nz::AbstractImage* /*newLayer*/)
+				{
+					CHECK(changedFont->GetCachedGlyphCount() > 0);
+					layerChangeCount++;
+				});
+
 				for (unsigned int fontSize : {24, 36, 48, 72, 140})
 				{
 					for (float outlineThickness : { 0.f, 1.f, 2.f, 5.f })
@@ -134,6 +143,11 @@ SCENARIO("Fonts", "[Utility][Font]")
 					}
 				}
 
+				layerChangeConnection.Disconnect();
+
+				if (font->GetAtlas()->GetLayerCount() > layerCount)
+					CHECK(layerChangeCount > 0);
+
 				CHECK(font->GetAtlas()->GetLayerCount() > 1);
 				for (std::size_t layerIndex = 0; layerIndex < font->GetAtlas()->GetLayerCount(); ++layerIndex)
 				{
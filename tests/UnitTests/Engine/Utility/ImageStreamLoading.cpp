@@ -1,9 +1,11 @@
 #include <Nazara/Utility/Image.hpp>
 #include <Nazara/Utility/ImageStream.hpp>
+#include <Nazara/Utility/ImageStreamPlayer.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <filesystem>
+#include <thread>
 
 std::filesystem::path GetAssetDir();
 
@@ -165,4 +167,92 @@ SCENARIO("Streamed images", "[Utility][ImageStream]")
 			}
 		}
 	}
+
+	WHEN("Playing a GIF file asynchronously")
+	{
+		std::array<std::shared_ptr<Nz::Image>, 5> expectedFrames;
+		for (std::size_t i = 0; i < expectedFrames.size(); ++i)
+		{
+			expectedFrames[i] = Nz::Image::LoadFromFile(resourcePath / "Utility/GIF/canvas_bgnd" / (std::to_string(i) + ".png"));
+			REQUIRE(expectedFrames[i]);
+		}
+
+		std::shared_ptr<Nz::ImageStream> gif = Nz::ImageStream::OpenFromFile(resourcePath / "Utility/GIF/canvas_bgnd.gif");
+		REQUIRE(gif);
+
+		Nz::Vector2ui size = gif->GetSize();
+		frameData.resize(Nz::PixelFormatInfo::ComputeSize(gif->GetPixelFormat(), size.x, size.y, 1));
+
+		Nz::ImageStreamPlayer player(gif, 2);
+		CHECK(player.GetFramePixels() == nullptr);
+
+		// Update doesn't wait for the decoding thread, retry until the expected frame is presented
+		auto WaitForFrame = [&](Nz::Time elapsedTime)
+		{
+			bool frameChanged = player.Update(elapsedTime);
+			while (!frameChanged && !player.IsFinished())
+			{
+				std::this_thread::yield();
+				frameChanged = player.Update(Nz::Time::Zero());
+			}
+
+			return frameChanged;
+		};
+
+		auto CheckPresentedFrame = [&](std::size_t frameIndex)
+		{
+			INFO("Presenting frame " << frameIndex);
+
+			REQUIRE(player.GetFramePixels());
+			CHECK(player.GetFrameTime() == Nz::Time::Milliseconds(static_cast<Nz::Int64>(1000 * frameIndex)));
+
+			std::memcpy(frameData.data(), player.GetFramePixels(), frameData.size());
+			CompareFrames(*gif, frameData, *expectedFrames[frameIndex]);
+		};
+
+		THEN("Frames are presented according to their time")
+		{
+			REQUIRE(WaitForFrame(Nz::Time::Zero()));
+			CheckPresentedFrame(0);
+
+			CHECK_FALSE(player.Update(500_ms));
+			CheckPresentedFrame(0);
+
+			REQUIRE(WaitForFrame(500_ms));
+			CheckPresentedFrame(1);
+
+			// Late frames are skipped
+			REQUIRE(WaitForFrame(2000_ms));
+			while (player.GetFrameTime() < 3000_ms && WaitForFrame(Nz::Time::Zero()));
+			CheckPresentedFrame(3);
+
+			REQUIRE(WaitForFrame(1000_ms));
+			CheckPresentedFrame(4);
+
+			CHECK_FALSE(WaitForFrame(1000_ms));
+			CHECK(player.IsFinished());
+		}
+
+		THEN("Seeking restarts presentation from the requested frame")
+		{
+			player.Seek(2);
+
+			REQUIRE(WaitForFrame(Nz::Time::Zero()));
+			CheckPresentedFrame(2);
+			CHECK(player.GetPlayingOffset() == 2000_ms);
+		}
+
+		THEN("Looping players restart after the last frame")
+		{
+			player.EnableLooping(true);
+			player.Seek(4);
+
+			REQUIRE(WaitForFrame(Nz::Time::Zero()));
+			CheckPresentedFrame(4);
+
+			REQUIRE(WaitForFrame(1000_ms));
+			CHECK(player.GetFrameTime() == 5000_ms);
+			CHECK_FALSE(player.IsFinished());
+		}
+	}
 }
@@ -0,0 +1,182 @@
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/SoftwareBuffer.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <tuple>
+
+SCENARIO("Mesh optimization", "[Utility][Mesh]")
+{
+	GIVEN("A subdivided plane built with every optimization enabled")
+	{
+		Nz::MeshParams params;
+		params.optimizeOverdraw = true;
+		params.optimizeVertexFetch = true;
+		params.generateMeshlets = true;
+		params.meshletMaxVertexCount = 32;
+		params.meshletMaxTriangleCount = 32;
+		params.lodCount = 3;
+
+		std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::Plane(Nz::Vector2f(10.f, 10.f), Nz::Vector2ui(31)), params);
+		REQUIRE(mesh);
+
+		std::shared_ptr<Nz::StaticMesh> staticMesh = std::static_pointer_cast<Nz::StaticMesh>(mesh->GetSubMesh(0));
+		Nz::UInt32 triangleCount = staticMesh->GetTriangleCount();
+		REQUIRE(triangleCount > 0);
+
+		THEN("Vertices are numbered in the order they are used")
+		{
+			Nz::IndexMapper indexMapper(*staticMesh->GetIndexBuffer());
+
+			Nz::UInt32 nextVertex = 0;
+			for (Nz::UInt32 i = 0; i < indexMapper.GetIndexCount(); ++i)
+			{
+				Nz::UInt32 vertex = indexMapper.Get(i);
+				REQUIRE(vertex <= nextVertex);
+				if (vertex == nextVertex)
+					nextVertex++;
+			}
+
+			CHECK(nextVertex == staticMesh->GetVertexCount());
+		}
+
+		THEN("Meshlets cover every triangle and respect the limits")
+		{
+			REQUIRE(staticMesh->HasMeshlets());
+
+			const Nz::MeshletData& meshletData = staticMesh->GetMeshlets();
+
+			Nz::UInt32 meshletTriangleCount = 0;
+			for (const Nz::Meshlet& meshlet : meshletData.meshlets)
+			{
+				CHECK(meshlet.vertexCount <= 32);
+				CHECK(meshlet.triangleCount <= 32);
+				meshletTriangleCount += meshlet.triangleCount;
+			}
+
+			CHECK(meshletTriangleCount == triangleCount);
+			CHECK(meshletData.triangles.size() == triangleCount * 3);
+		}
+
+		THEN("Levels of detail have less and less triangles")
+		{
+			const std::vector<Nz::StaticMeshLod>& lods = staticMesh->GetLods();
+			REQUIRE(!lods.empty());
+
+			Nz::UInt32 previousIndexCount = staticMesh->GetIndexBuffer()->GetIndexCount();
+			for (const Nz::StaticMeshLod& lod : lods)
+			{
+				CHECK(lod.indexBuffer->GetIndexCount() < previousIndexCount);
+				CHECK(lod.error <= params.lodMaxError);
+				previousIndexCount = lod.indexBuffer->GetIndexCount();
+			}
+		}
+	}
+
+	GIVEN("A plane built without levels of detail")
+	{
+		std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::Build(Nz::Primitive::Plane(Nz::Vector2f(10.f, 10.f), Nz::Vector2ui(15)));
+		REQUIRE(mesh);
+
+		std::shared_ptr<Nz::StaticMesh> staticMesh = std::static_pointer_cast<Nz::StaticMesh>(mesh->GetSubMesh(0));
+		CHECK(staticMesh->GetLods().empty());
+
+		WHEN("Levels of detail are generated afterwards")
+		{
+			mesh->GenerateLods(2);
+
+			THEN("Submeshes have levels of detail")
+			{
+				const std::vector<Nz::StaticMeshLod>& lods = staticMesh->GetLods();
+				REQUIRE(!lods.empty());
+				CHECK(lods.size() <= 2);
+				CHECK(lods.front().indexBuffer->GetIndexCount() < staticMesh->GetIndexBuffer()->GetIndexCount());
+			}
+		}
+	}
+	GIVEN("A subdivided cube whose faces don't share vertices, like a textured cube")
+	{
+		constexpr Nz::UInt32 Subdivision = 8;
+
+		// Origin and axes of each face, axes cross product being the outward normal
+		const Nz::Vector3f faces[6][3] = {
+			{ Nz::Vector3f(-1.f, -1.f,  1.f), Nz::Vector3f( 2.f, 0.f, 0.f), Nz::Vector3f(0.f, 2.f,  0.f) },
+			{ Nz::Vector3f( 1.f, -1.f, -1.f), Nz::Vector3f(-2.f, 0.f, 0.f), Nz::Vector3f(0.f, 2.f,  0.f) },
+			{ Nz::Vector3f( 1.f, -1.f,  1.f), Nz::Vector3f(0.f, 0.f, -2.f), Nz::Vector3f(0.f, 2.f,  0.f) },
+			{ Nz::Vector3f(-1.f, -1.f, -1.f), Nz::Vector3f(0.f, 0.f,  2.f), Nz::Vector3f(0.f, 2.f,  0.f) },
+			{ Nz::Vector3f(-1.f,  1.f,  1.f), Nz::Vector3f( 2.f, 0.f, 0.f), Nz::Vector3f(0.f, 0.f, -2.f) },
+			{ Nz::Vector3f(-1.f, -1.f, -1.f), Nz::Vector3f( 2.f, 0.f, 0.f), Nz::Vector3f(0.f, 0.f,  2.f) }
+		};
+
+		std::vector<Nz::Vector3f> positions;
+		std::vector<Nz::UInt32> indices;
+		for (const auto& face : faces)
+		{
+			Nz::UInt32 firstVertex = Nz::UInt32(positions.size());
+			for (Nz::UInt32 y = 0; y <= Subdivision; ++y)
+			{
+				for (Nz::UInt32 x = 0; x <= Subdivision; ++x)
+					positions.push_back(face[0] + face[1] * (float(x) / Subdivision) + face[2] * (float(y) / Subdivision));
+			}
+
+			for (Nz::UInt32 y = 0; y < Subdivision; ++y)
+			{
+				for (Nz::UInt32 x = 0; x < Subdivision; ++x)
+				{
+					Nz::UInt32 a = firstVertex + y * (Subdivision + 1) + x;
+					Nz::UInt32 b = a + 1;
+					Nz::UInt32 c = a + Subdivision + 1;
+					Nz::UInt32 d = c + 1;
+					indices.insert(indices.end(), { a, b, d, a, d, c });
+				}
+			}
+		}
+
+		Nz::UInt32 indexCount = Nz::UInt32(indices.size());
+		Nz::IndexBuffer indexBuffer(Nz::IndexType::U32, indexCount, Nz::BufferUsage::DirectMapping | Nz::BufferUsage::Read | Nz::BufferUsage::Write, &Nz::SoftwareBufferFactory, indices.data());
+
+		WHEN("Simplifying it")
+		{
+			Nz::IndexMapper indexMapper(indexBuffer);
+
+			std::vector<Nz::UInt32> simplifiedIndices(indexCount);
+			float error;
+			Nz::UInt32 simplifiedIndexCount = Nz::SimplifyIndices(indexMapper.begin(), indexCount, Nz::SparsePtr<const Nz::Vector3f>(positions.data()), Nz::UInt32(positions.size()), 0, 0.01f, simplifiedIndices.data(), &error);
+
+			THEN("Vertices along the seams between faces are collapsed too")
+			{
+				CHECK(simplifiedIndexCount < indexCount / 6);
+				CHECK(error < 0.01f);
+			}
+
+			THEN("Seams don't crack open")
+			{
+				// Every edge must still have an opposite edge at the same positions
+				auto ToTuple = [&](Nz::UInt32 vertex)
+				{
+					return std::make_tuple(positions[vertex].x, positions[vertex].y, positions[vertex].z);
+				};
+
+				std::map<std::pair<std::tuple<float, float, float>, std::tuple<float, float, float>>, Nz::UInt32> edges;
+				for (Nz::UInt32 i = 0; i < simplifiedIndexCount; i += 3)
+				{
+					for (Nz::UInt32 j = 0; j < 3; ++j)
+						edges[{ ToTuple(simplifiedIndices[i + j]), ToTuple(simplifiedIndices[i + (j + 1) % 3]) }]++;
+				}
+
+				Nz::UInt32 openEdgeCount = 0;
+				for (auto&& [edge, count] : edges)
+				{
+					if (edges.find({ edge.second, edge.first }) == edges.end())
+						openEdgeCount++;
+				}
+
+				CHECK(openEdgeCount == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,133 @@
+#include <Nazara/Utility/Font.hpp>
+#include <Nazara/Utility/RichTextDrawer.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+	void CheckSameLayout(const Nz::RichTextDrawer& drawer, const Nz::RichTextDrawer& reference)
+	{
+		CHECK(drawer.GetBounds() == reference.GetBounds());
+
+		REQUIRE(drawer.GetLineCount() == reference.GetLineCount());
+		for (std::size_t i = 0; i < drawer.GetLineCount(); ++i)
+		{
+			CHECK(drawer.GetLine(i).bounds == reference.GetLine(i).bounds);
+			CHECK(drawer.GetLine(i).glyphIndex == reference.GetLine(i).glyphIndex);
+		}
+
+		REQUIRE(drawer.GetGlyphCount() == reference.GetGlyphCount());
+		for (std::size_t i = 0; i < drawer.GetGlyphCount(); ++i)
+		{
+			const auto& glyph = drawer.GetGlyph(i);
+			const auto& referenceGlyph = reference.GetGlyph(i);
+
+			CHECK(glyph.atlas == referenceGlyph.atlas);
+			CHECK(glyph.atlasRect == referenceGlyph.atlasRect);
+			CHECK(glyph.bounds == referenceGlyph.bounds);
+			CHECK(glyph.color == referenceGlyph.color);
+			CHECK(glyph.renderOrder == referenceGlyph.renderOrder);
+			for (std::size_t j = 0; j < 4; ++j)
+				CHECK(glyph.corners[j] == referenceGlyph.corners[j]);
+		}
+	}
+}
+
+SCENARIO("RichTextDrawer", "[Utility][RichTextDrawer]")
+{
+	GIVEN("A rich text drawer with a limited line width")
+	{
+		Nz::RichTextDrawer drawer;
+		drawer.SetMaxLineWidth(300.f);
+
+		drawer.AppendText("Hello ");
+		drawer.SetTextColor(Nz::Color::Red());
+		drawer.AppendText("world, this line is long enough to wrap\n");
+		drawer.SetTextColor(Nz::Color::White());
+		drawer.SetCharacterSize(32);
+		drawer.AppendText("Bigger text");
+
+		std::size_t glyphCount = drawer.GetGlyphCount();
+		Nz::UInt64 layoutRevision = drawer.GetLayoutRevision();
+		CHECK(layoutRevision != Nz::AbstractTextDrawer::UntrackedLayoutRevision);
+		CHECK(drawer.GetUnchangedGlyphCount(layoutRevision) == glyphCount);
+
+		WHEN("Appending text to the last block")
+		{
+			drawer.AppendText(" and even more text");
+
+			THEN("Layout matches a drawer built at once and previous lines are kept")
+			{
+				Nz::RichTextDrawer reference(drawer);
+				CheckSameLayout(drawer, reference);
+
+				std::size_t unchangedGlyphCount = drawer.GetUnchangedGlyphCount(layoutRevision);
+				CHECK(unchangedGlyphCount > 0);
+				CHECK(unchangedGlyphCount <= glyphCount);
+				CHECK(drawer.GetUnchangedGlyphCount(0xDEADBEEF) == 0);
+			}
+		}
+
+		WHEN("Appending a new block")
+		{
+			drawer.SetTextOutlineThickness(2.f);
+			drawer.AppendText(" outlined");
+
+			THEN("Layout matches a drawer built at once")
+			{
+				Nz::RichTextDrawer reference(drawer);
+				CheckSameLayout(drawer, reference);
+				CHECK(drawer.GetUnchangedGlyphCount(layoutRevision) > 0);
+			}
+		}
+
+		WHEN("Changing a block in the middle")
+		{
+			drawer.SetBlockCharacterSize(1, 40);
+
+			THEN("Layout matches a drawer built at once")
+			{
+				Nz::RichTextDrawer reference(drawer);
+				CheckSameLayout(drawer, reference);
+			}
+		}
+
+		WHEN("Removing the last block")
+		{
+			drawer.RemoveBlock(drawer.GetBlockCount() - 1);
+
+			THEN("Layout matches a drawer built at once")
+			{
+				Nz::RichTextDrawer reference(drawer);
+				CheckSameLayout(drawer, reference);
+			}
+		}
+	}
+
+	GIVEN("A rich text drawer with a single block")
+	{
+		Nz::RichTextDrawer drawer;
+		drawer.SetMaxLineWidth(300.f);
+
+		drawer.AppendText("First line\nSecond line");
+
+		std::size_t firstLineGlyphCount = drawer.GetLine(1).glyphIndex;
+		std::size_t glyphCount = drawer.GetGlyphCount();
+		Nz::UInt64 layoutRevision = drawer.GetLayoutRevision();
+
+		WHEN("Appending text to it")
+		{
+			drawer.AppendText(", long enough to wrap on a third line");
+
+			THEN("Layout matches a drawer built at once and is resumed from the last line")
+			{
+				Nz::RichTextDrawer reference(drawer);
+				CheckSameLayout(drawer, reference);
+
+				CHECK(drawer.GetBlockCount() == 1);
+				CHECK(drawer.GetLineCount() > 2);
+				CHECK(drawer.GetGlyphCount() > glyphCount);
+				CHECK(drawer.GetUnchangedGlyphCount(layoutRevision) == firstLineGlyphCount);
+			}
+		}
+	}
+}
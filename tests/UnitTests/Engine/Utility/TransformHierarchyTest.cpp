@@ -0,0 +1,88 @@
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+
+SCENARIO("TransformHierarchy", "[Utility][TransformHierarchy]")
+{
+	GIVEN("A hierarchy of three nodes and the equivalent Node hierarchy")
+	{
+		Nz::TransformHierarchy hierarchy;
+		std::size_t root = hierarchy.AddNode(Nz::TransformHierarchy::InvalidNodeIndex, Nz::Vector3f(1.f, 2.f, 3.f), Nz::Quaternionf(Nz::DegreeAnglef(90.f), Nz::Vector3f::UnitY()), Nz::Vector3f(2.f));
+		std::size_t child = hierarchy.AddNode(root, Nz::Vector3f(0.f, 0.f, -1.f));
+		std::size_t grandChild = hierarchy.AddNode(child, Nz::Vector3f::UnitX(), Nz::Quaternionf(Nz::DegreeAnglef(45.f), Nz::Vector3f::UnitZ()));
+
+		Nz::Node rootNode(Nz::Vector3f(1.f, 2.f, 3.f), Nz::Quaternionf(Nz::DegreeAnglef(90.f), Nz::Vector3f::UnitY()), Nz::Vector3f(2.f));
+		Nz::Node childNode(Nz::Vector3f(0.f, 0.f, -1.f));
+		childNode.SetParent(rootNode);
+		Nz::Node grandChildNode(Nz::Vector3f::UnitX(), Nz::Quaternionf(Nz::DegreeAnglef(45.f), Nz::Vector3f::UnitZ()));
+		grandChildNode.SetParent(childNode);
+
+		hierarchy.Update();
+
+		auto CheckNode = [&](std::size_t nodeIndex, const Nz::Node& node)
+		{
+			CHECK(hierarchy.GetGlobalPosition(nodeIndex).ApproxEqual(node.GetPosition(Nz::CoordSys::Global), 0.0001f));
+			CHECK(hierarchy.GetGlobalRotation(nodeIndex).ApproxEqual(node.GetRotation(Nz::CoordSys::Global), 0.0001f));
+			CHECK(hierarchy.GetGlobalScale(nodeIndex).ApproxEqual(node.GetScale(Nz::CoordSys::Global), 0.0001f));
+			CHECK(hierarchy.GetTransformMatrix(nodeIndex).ApproxEqual(node.GetTransformMatrix(), 0.0001f));
+		};
+
+		auto IsChanged = [&](std::size_t nodeIndex)
+		{
+			const auto& changedNodes = hierarchy.GetChangedNodes();
+			return std::find(changedNodes.begin(), changedNodes.end(), nodeIndex) != changedNodes.end();
+		};
+
+		THEN("Global transforms match Node ones")
+		{
+			CHECK(hierarchy.GetNodeCount() == 3);
+			CHECK(hierarchy.GetChangedNodes().size() == 3);
+
+			CheckNode(root, rootNode);
+			CheckNode(child, childNode);
+			CheckNode(grandChild, grandChildNode);
+		}
+
+		WHEN("We move the child node")
+		{
+			hierarchy.SetPosition(child, Nz::Vector3f(5.f, 0.f, 0.f));
+			childNode.SetPosition(Nz::Vector3f(5.f, 0.f, 0.f));
+			hierarchy.Update();
+
+			THEN("Only the child and its descendants are updated")
+			{
+				CHECK(hierarchy.GetChangedNodes().size() == 2);
+				CHECK_FALSE(IsChanged(root));
+				CHECK(IsChanged(child));
+				CHECK(IsChanged(grandChild));
+
+				CheckNode(child, childNode);
+				CheckNode(grandChild, grandChildNode);
+			}
+
+			AND_THEN("Nothing is reported without changes")
+			{
+				hierarchy.Update();
+				CHECK(hierarchy.GetChangedNodes().empty());
+			}
+		}
+
+		WHEN("We reparent and remove nodes")
+		{
+			hierarchy.SetParent(grandChild, root);
+			grandChildNode.SetParent(rootNode);
+			hierarchy.RemoveNode(child);
+			hierarchy.Update();
+
+			THEN("The hierarchy is reordered")
+			{
+				CHECK(hierarchy.GetNodeCount() == 2);
+				CHECK_FALSE(hierarchy.IsValid(child));
+				CHECK(hierarchy.GetParent(grandChild) == root);
+				CheckNode(grandChild, grandChildNode);
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#include <Nazara/Platform/WindowEventHandler.hpp>
+#include <Nazara/Widgets/Canvas.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <entt/entt.hpp>
+
+namespace
+{
+	class HoverWidget : public Nz::BaseWidget
+	{
+		public:
+			using BaseWidget::BaseWidget;
+
+			unsigned int enterCount = 0;
+			unsigned int exitCount = 0;
+
+		private:
+			void OnMouseEnter() override
+			{
+				enterCount++;
+			}
+
+			void OnMouseExit() override
+			{
+				exitCount++;
+			}
+	};
+}
+
+SCENARIO("Canvas", "[WIDGETS][CANVAS]")
+{
+	entt::registry registry;
+	Nz::WindowEventHandler eventHandler;
+
+	Nz::Canvas canvas(registry, eventHandler, {}, 0xFFFFFFFF);
+	canvas.Resize({ 800.f, 600.f });
+
+	auto MoveMouse = [&](int x, int y)
+	{
+		Nz::WindowEvent event;
+		event.type = Nz::WindowEventType::MouseMoved;
+		event.mouseMove.deltaX = 0;
+		event.mouseMove.deltaY = 0;
+		event.mouseMove.x = x;
+		event.mouseMove.y = y;
+
+		eventHandler.Dispatch(event);
+	};
+
+	GIVEN("Two widgets side by side")
+	{
+		// Canvas coordinates have their origin at the bottom left, mouse ones at the top left
+		HoverWidget* firstWidget = canvas.Add<HoverWidget>();
+		firstWidget->SetPosition(Nz::Vector3f(0.f, 0.f, 0.f));
+		firstWidget->Resize({ 100.f, 100.f });
+
+		HoverWidget* secondWidget = canvas.Add<HoverWidget>();
+		secondWidget->SetPosition(Nz::Vector3f(200.f, 0.f, 0.f));
+		secondWidget->Resize({ 100.f, 100.f });
+
+		WHEN("Removing the most recently added widget")
+		{
+			secondWidget->Destroy();
+
+			THEN("Hit tests still find the remaining widget")
+			{
+				MoveMouse(50, 550);
+				CHECK(firstWidget->enterCount == 1);
+
+				MoveMouse(250, 550);
+				CHECK(firstWidget->exitCount == 1);
+			}
+		}
+
+		WHEN("Removing the first widget")
+		{
+			firstWidget->Destroy();
+
+			THEN("The moved widget is hit at its own position")
+			{
+				MoveMouse(50, 550);
+				CHECK(secondWidget->enterCount == 0);
+
+				MoveMouse(250, 550);
+				CHECK(secondWidget->enterCount == 1);
+			}
+		}
+	}
+}
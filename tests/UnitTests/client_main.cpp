@@ -0,0 +1,13 @@
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch_session.hpp>
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Widgets/Widgets.hpp>
+
+int main(int argc, char* argv[])
+{
+	Nz::Modules<Nz::Graphics, Nz::Widgets> nazaza;
+
+	return Catch::Session().run(argc, argv);
+}
@@ -7,11 +7,12 @@
 #include <Nazara/Core/Modules.hpp>
 #include <Nazara/Network/Network.hpp>
 #include <Nazara/ChipmunkPhysics2D/ChipmunkPhysics2D.hpp>
+#include <Nazara/JoltPhysics3D/JoltPhysics3D.hpp>
 #include <Nazara/Utility/Utility.hpp>
 
 int main(int argc, char* argv[])
 {
-	Nz::Modules<Nz::Audio, Nz::Network, Nz::ChipmunkPhysics2D, Nz::Utility> nazaza;
+	Nz::Modules<Nz::Audio, Nz::Network, Nz::ChipmunkPhysics2D, Nz::JoltPhysics3D, Nz::Utility> nazaza;
 
 	return Catch::Session().run(argc, argv);
 }
@@ -5,11 +5,10 @@ if is_mode("asan") then
     add_defines("CATCH_CONFIG_NO_POSIX_SIGNALS")
 end
 
-add_deps("NazaraAudio", "NazaraCore", "NazaraNetwork", "NazaraChipmunkPhysics2D")
+add_deps("NazaraAudio", "NazaraCore", "NazaraNetwork", "NazaraChipmunkPhysics2D", "NazaraJoltPhysics3D")
 add_packages("catch2", "entt")
 add_headerfiles("Engine/**.hpp", { prefixdir = "private", install = false })
 add_files("resources.cpp")
-add_files("Engine/**.cpp")
 add_includedirs(".")
 
 if has_config("unitybuild") then
@@ -18,8 +17,20 @@ end
 
 target("UnitTests", function ()
     add_files("main.cpp", {unity_ignored = true})
+    add_files("Engine/**.cpp|Graphics/**.cpp|Widgets/**.cpp")
 
     if has_config("usepch") then
         set_pcxxheader("Engine/Modules.hpp")
     end
 end)
+
+-- Tests requiring a render device
+target("ClientUnitTests", function ()
+    add_deps("NazaraGraphics", "NazaraWidgets")
+    add_files("client_main.cpp", {unity_ignored = true})
+    add_files("Engine/Graphics/**.cpp", "Engine/Widgets/**.cpp")
+
+    if has_config("usepch") then
+        set_pcxxheader("Engine/ClientModules.hpp")
+    end
+end)
@@ -149,7 +149,8 @@ local modules = {
 				remove_files("src/Nazara/Network/Posix/SocketPollerImpl.hpp")
 				remove_files("src/Nazara/Network/Posix/SocketPollerImpl.cpp")
 			end
-		end
+		end,
+		Packages = { "lz4", "zstd" }
 	},
 	Platform = {
 		Option = "platform",
@@ -240,6 +241,7 @@ option("embed_plugins", { description = "Embed enabled plugins code as static li
 option("link_curl", { description = "Link libcurl in the executable instead of dynamically loading it", default = false })
 option("link_openal", { description = "Link OpenAL in the executable instead of dynamically loading it", default = is_plat("wasm") or false })
 option("static", { description = "Build the engine statically (implies embed_rendererbackends and embed_plugins)", default = is_plat("wasm") or false })
+option("math_simd", { description = "Use SIMD instructions (SSE/AVX/NEON) for float matrix and quaternion operations", default = false })
 option("override_runtime", { description = "Override vs runtime to MD in release and MDd in debug", default = true })
 option("unitybuild", { description = "Build the engine using unity build", default = false })
 option("usepch", { description = "Use precompiled headers to speedup compilation", default = false })
@@ -282,6 +284,8 @@ if has_config("joltphysics") then
 end
 
 if has_config("network") then
+	add_requires("lz4", "zstd")
+
 	-- emscripten fetch API is used for WebService on wasm
 	if not is_plat("wasm") then
 		if has_config("link_curl") then
@@ -393,6 +397,10 @@ if not is_mode("release") then
 	set_symbols("debug", "hidden")
 end
 
+if has_config("math_simd") then
+	add_defines("NAZARA_MATH_ENABLE_SIMD=1")
+end
+
 -- Compiler-specific options
 
 if is_plat("windows") then